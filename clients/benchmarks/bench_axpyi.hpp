@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BENCH_AXPYI_HPP
+#define BENCH_AXPYI_HPP
+
+#include "hipsparse_bench.hpp"
+
+template <typename T>
+hipsparseStatus_t bench_axpyi(const Arguments& argus, bench_result& result)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 12000)
+    int                  nnz      = argus.nnz;
+    int                  N        = std::max(argus.N, nnz);
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+    T                    h_alpha  = make_DataType2<T>(argus.alpha, argus.alphai);
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int> hx_ind(nnz);
+    std::vector<T>   hx_val(nnz);
+    std::vector<T>   hy(N);
+
+    srand(12345ULL);
+    hipsparseInitIndex(hx_ind.data(), nnz, idx_base, N + idx_base);
+    hipsparseInit<T>(hx_val, 1, nnz);
+    hipsparseInit<T>(hy, 1, N);
+
+    // Device structures
+    auto dx_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dx_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dy_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * N), device_free};
+
+    int* dx_ind = (int*)dx_ind_managed.get();
+    T*   dx_val = (T*)dx_val_managed.get();
+    T*   dy     = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    double time;
+    CHECK_HIPSPARSE_ERROR(bench_time_us(
+        handle,
+        argus,
+        [&]() { return hipsparseXaxpyi(handle, nnz, &h_alpha, dx_val, dx_ind, dy, idx_base); },
+        &time));
+
+    // y is read and written at the non-zero positions of x
+    result.n   = N;
+    result.nnz = nnz;
+    result.set(time, bench_fma_flops<T>() * nnz, (sizeof(int) + 3.0 * sizeof(T)) * nnz);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+#else
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+#endif // BENCH_AXPYI_HPP
@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BENCH_CSR2CSC_HPP
+#define BENCH_CSR2CSC_HPP
+
+#include "hipsparse_bench.hpp"
+
+template <typename T>
+hipsparseStatus_t bench_csr2csc(const Arguments& argus, bench_result& result)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+    hipsparseAction_t    action   = argus.action;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    int              m = argus.M;
+    int              n = argus.N;
+    int              nnz;
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    CHECK_HIPSPARSE_ERROR(
+        bench_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    // Device structures
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsc_row_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsc_col_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (n + 1)), device_free};
+    auto dcsc_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    int* dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val     = (T*)dcsr_val_managed.get();
+    int* dcsc_row_ind = (int*)dcsc_row_ind_managed.get();
+    int* dcsc_col_ptr = (int*)dcsc_col_ptr_managed.get();
+    T*   dcsc_val     = (T*)dcsc_val_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    double time;
+    CHECK_HIPSPARSE_ERROR(bench_time_us(handle,
+                                        argus,
+                                        [&]() {
+                                            return hipsparseXcsr2csc(handle,
+                                                                     m,
+                                                                     n,
+                                                                     nnz,
+                                                                     dcsr_val,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     dcsc_val,
+                                                                     dcsc_row_ind,
+                                                                     dcsc_col_ptr,
+                                                                     action,
+                                                                     idx_base);
+                                        },
+                                        &time));
+
+    // Values are only moved by the numeric conversion
+    double values = (action == HIPSPARSE_ACTION_NUMERIC) ? 2.0 * sizeof(T) * nnz : 0.0;
+    double bytes  = sizeof(int) * (m + 1.0 + nnz) + sizeof(int) * (n + 1.0 + nnz) + values;
+
+    result.m   = m;
+    result.n   = n;
+    result.nnz = nnz;
+    result.set(time, 0.0, bytes);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+#else
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+#endif // BENCH_CSR2CSC_HPP
@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BENCH_CSRILU02_HPP
+#define BENCH_CSRILU02_HPP
+
+#include "hipsparse_bench.hpp"
+
+// Incomplete LU factorization with zero fill-in. The factorization works in place, the
+// matrix values are restored by a device to device copy before each call, which is
+// part of the timing. The analysis is not part of the timing.
+template <typename T>
+hipsparseStatus_t bench_csrilu02(const Arguments& argus, bench_result& result)
+{
+    hipsparseIndexBase_t   idx_base = argus.idx_base;
+    hipsparseSolvePolicy_t policy   = HIPSPARSE_SOLVE_POLICY_USE_LEVEL;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<csrilu02_struct> unique_ptr_csrilu02(new csrilu02_struct);
+    csrilu02Info_t                   info = unique_ptr_csrilu02->info;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+
+    // Host structures
+    int              m = argus.M;
+    int              n = argus.N;
+    int              nnz;
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    CHECK_HIPSPARSE_ERROR(
+        bench_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    if(m != n)
+    {
+        fprintf(stderr, "csrilu02 requires a square matrix\n");
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Floating point operations of the elimination, row i is updated by each row k < i
+    // it references, with all entries of row k right of the diagonal
+    std::vector<int> diag(m, -1);
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            if(hcsr_col_ind[j] - idx_base == i)
+            {
+                diag[i] = j;
+            }
+        }
+    }
+
+    double flops = 0.0;
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            int k = hcsr_col_ind[j] - idx_base;
+
+            if(k < i && diag[k] >= 0)
+            {
+                int upper = hcsr_row_ptr[k + 1] - idx_base - diag[k] - 1;
+
+                flops += 1.0 + bench_fma_flops<T>() * upper;
+            }
+        }
+    }
+
+    // Device structures
+    auto dptr_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval0_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    int* dptr  = (int*)dptr_managed.get();
+    int* dcol  = (int*)dcol_managed.get();
+    T*   dval  = (T*)dval_managed.get();
+    T*   dval0 = (T*)dval0_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval0, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    int buffer_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02_bufferSize(
+        handle, m, nnz, descr, dval, dptr, dcol, info, &buffer_size));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(buffer_size, 1)), device_free};
+    void* dbuffer = dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02_analysis(
+        handle, m, nnz, descr, dval, dptr, dcol, info, policy, dbuffer));
+
+    hipStream_t stream;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    double time;
+    CHECK_HIPSPARSE_ERROR(bench_time_us(
+        handle,
+        argus,
+        [&]() {
+            if(hipMemcpyAsync(dval, dval0, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream)
+               != hipSuccess)
+            {
+                return HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+
+            return hipsparseXcsrilu02(
+                handle, m, nnz, descr, dval, dptr, dcol, info, policy, dbuffer);
+        },
+        &time));
+
+    double bytes = sizeof(int) * (m + 1.0 + nnz) + sizeof(T) * 3.0 * nnz;
+
+    result.m   = m;
+    result.n   = n;
+    result.nnz = nnz;
+    result.set(time, flops, bytes);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // BENCH_CSRILU02_HPP
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BENCH_CSRMV_HPP
+#define BENCH_CSRMV_HPP
+
+#include "hipsparse_bench.hpp"
+
+template <typename T>
+hipsparseStatus_t bench_csrmv(const Arguments& argus, bench_result& result)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
+    hipsparseOperation_t transA  = argus.transA;
+    T                    h_alpha = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                    h_beta  = make_DataType2<T>(argus.beta, argus.betai);
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, argus.idx_base));
+
+    // Host structures
+    int              m = argus.M;
+    int              n = argus.N;
+    int              nnz;
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    CHECK_HIPSPARSE_ERROR(
+        bench_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    int size_x = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    int size_y = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<T> hx(size_x);
+    std::vector<T> hy(size_y);
+
+    hipsparseInit<T>(hx, 1, size_x);
+    hipsparseInit<T>(hy, 1, size_y);
+
+    // Device structures
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+
+    int* dptr = (int*)dptr_managed.get();
+    int* dcol = (int*)dcol_managed.get();
+    T*   dval = (T*)dval_managed.get();
+    T*   dx   = (T*)dx_managed.get();
+    T*   dy   = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    double time;
+    CHECK_HIPSPARSE_ERROR(bench_time_us(handle,
+                                        argus,
+                                        [&]() {
+                                            return hipsparseXcsrmv(handle,
+                                                                   transA,
+                                                                   m,
+                                                                   n,
+                                                                   nnz,
+                                                                   &h_alpha,
+                                                                   descr,
+                                                                   dval,
+                                                                   dptr,
+                                                                   dcol,
+                                                                   dx,
+                                                                   &h_beta,
+                                                                   dy);
+                                        },
+                                        &time));
+
+    // y is only read if beta is non-zero
+    bool   beta_nz = (argus.beta != 0.0 || argus.betai != 0.0);
+    double flops   = bench_fma_flops<T>() * nnz + (beta_nz ? bench_fma_flops<T>() * size_y : 0.0);
+    double bytes   = sizeof(int) * (m + 1.0 + nnz) + sizeof(T) * (nnz + size_x)
+                   + sizeof(T) * (beta_nz ? 2.0 : 1.0) * size_y;
+
+    result.m   = m;
+    result.n   = n;
+    result.nnz = nnz;
+    result.set(time, flops, bytes);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+#else
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+#endif // BENCH_CSRMV_HPP
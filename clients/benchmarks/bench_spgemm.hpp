@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BENCH_SPGEMM_HPP
+#define BENCH_SPGEMM_HPP
+
+#include "hipsparse_bench.hpp"
+
+// Generic SpGEMM C = alpha * A * A with a square CSR matrix A. The work estimation is
+// not part of the timing, each timed call computes the structure and the values of C.
+template <typename T>
+hipsparseStatus_t bench_spgemm(const Arguments& argus, bench_result& result)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    hipsparseOperation_t trans    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+    hipsparseSpGEMMAlg_t alg      = (hipsparseSpGEMMAlg_t)argus.alg;
+    hipDataType          typeT    = bench_data_type<T>();
+    T                    h_alpha  = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                    h_beta   = make_DataType<T>(0.0);
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+
+    // Host structures
+    int              m = argus.M;
+    int              n = argus.N;
+    int              nnz;
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    CHECK_HIPSPARSE_ERROR(
+        bench_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    if(m != n)
+    {
+        fprintf(stderr, "spgemm requires a square matrix\n");
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Each non-zero a_ik is multiplied with all non-zeros of row k
+    double flops = 0.0;
+    for(int j = 0; j < nnz; ++j)
+    {
+        int k = hcsr_col_ind[j] - idx_base;
+
+        flops += bench_fma_flops<T>() * (hcsr_row_ptr[k + 1] - hcsr_row_ptr[k]);
+    }
+
+    // Device structures
+    auto dptr_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dptrC_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+
+    int* dptr  = (int*)dptr_managed.get();
+    int* dcol  = (int*)dcol_managed.get();
+    T*   dval  = (T*)dval_managed.get();
+    int* dptrC = (int*)dptrC_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Descriptors
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t C;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&C,
+                                             m,
+                                             n,
+                                             0,
+                                             dptrC,
+                                             nullptr,
+                                             nullptr,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    // Work estimation
+    size_t buffer_size1;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                         trans,
+                                                         trans,
+                                                         &h_alpha,
+                                                         A,
+                                                         A,
+                                                         &h_beta,
+                                                         C,
+                                                         typeT,
+                                                         alg,
+                                                         descr,
+                                                         &buffer_size1,
+                                                         nullptr));
+
+    auto dbuffer1_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(buffer_size1, (size_t)1)), device_free};
+    void* dbuffer1 = dbuffer1_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                         trans,
+                                                         trans,
+                                                         &h_alpha,
+                                                         A,
+                                                         A,
+                                                         &h_beta,
+                                                         C,
+                                                         typeT,
+                                                         alg,
+                                                         descr,
+                                                         &buffer_size1,
+                                                         dbuffer1));
+
+    size_t buffer_size2;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                  trans,
+                                                  trans,
+                                                  &h_alpha,
+                                                  A,
+                                                  A,
+                                                  &h_beta,
+                                                  C,
+                                                  typeT,
+                                                  alg,
+                                                  descr,
+                                                  &buffer_size2,
+                                                  nullptr));
+
+    auto dbuffer2_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(buffer_size2, (size_t)1)), device_free};
+    void* dbuffer2 = dbuffer2_managed.get();
+
+    double            time;
+    hipsparseStatus_t status = bench_time_us(
+        handle,
+        argus,
+        [&]() {
+            return hipsparseSpGEMM_compute(handle,
+                                           trans,
+                                           trans,
+                                           &h_alpha,
+                                           A,
+                                           A,
+                                           &h_beta,
+                                           C,
+                                           typeT,
+                                           alg,
+                                           descr,
+                                           &buffer_size2,
+                                           dbuffer2);
+        },
+        &time);
+
+    int64_t rowsC;
+    int64_t colsC;
+    int64_t nnzC = 0;
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMatGetSize(C, &rowsC, &colsC, &nnzC);
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+    CHECK_HIPSPARSE_ERROR(status);
+
+    // A is read twice, C is written once
+    double bytes = 2.0 * (sizeof(int) * (m + 1.0 + nnz) + sizeof(T) * nnz)
+                   + sizeof(int) * (m + 1.0 + nnzC) + sizeof(T) * nnzC;
+
+    result.m   = m;
+    result.n   = n;
+    result.k   = n;
+    result.nnz = nnz;
+    result.set(time, flops, bytes);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+#else
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+#endif // BENCH_SPGEMM_HPP
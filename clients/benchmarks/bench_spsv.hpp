@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef BENCH_SPSV_HPP
+#define BENCH_SPSV_HPP
+
+#include "hipsparse_bench.hpp"
+
+// Generic sparse triangular solve with the lower or upper triangular part of a CSR
+// matrix, selected by argus.fill_mode. The analysis is not part of the timing.
+template <typename T>
+hipsparseStatus_t bench_spsv(const Arguments& argus, bench_result& result)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11030)
+    hipsparseOperation_t transA    = argus.transA;
+    hipsparseIndexBase_t idx_base  = argus.idx_base;
+    hipsparseDiagType_t  diag_type = argus.diag_type;
+    hipsparseFillMode_t  fill_mode = argus.fill_mode;
+    hipsparseSpSVAlg_t   alg       = HIPSPARSE_SPSV_ALG_DEFAULT;
+    hipDataType          typeT     = bench_data_type<T>();
+    T                    h_alpha   = make_DataType2<T>(argus.alpha, argus.alphai);
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    int              m = argus.M;
+    int              n = argus.N;
+    int              nnz;
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    CHECK_HIPSPARSE_ERROR(
+        bench_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    if(m != n)
+    {
+        fprintf(stderr, "spsv requires a square matrix\n");
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Number of non-zeros of the triangular part that is actually read
+    int nnz_tri = 0;
+    for(int i = 0; i < m; ++i)
+    {
+        for(int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            int col = hcsr_col_ind[j] - idx_base;
+
+            if(fill_mode == HIPSPARSE_FILL_MODE_LOWER ? col <= i : col >= i)
+            {
+                ++nnz_tri;
+            }
+        }
+    }
+
+    std::vector<T> hx(m);
+
+    hipsparseInit<T>(hx, 1, m);
+
+    // Device structures
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dptr = (int*)dptr_managed.get();
+    int* dcol = (int*)dcol_managed.get();
+    T*   dval = (T*)dval_managed.get();
+    T*   dx   = (T*)dx_managed.get();
+    T*   dy   = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Descriptors
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x;
+    hipsparseDnVecDescr_t y;
+    hipsparseSpSVDescr_t  descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_createDescr(&descr));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &fill_mode, sizeof(fill_mode)));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_DIAG_TYPE, &diag_type, sizeof(diag_type)));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    size_t buffer_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_bufferSize(
+        handle, transA, &h_alpha, A, x, y, typeT, alg, descr, &buffer_size));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(buffer_size, (size_t)1)), device_free};
+    void* dbuffer = dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_analysis(
+        handle, transA, &h_alpha, A, x, y, typeT, alg, descr, dbuffer));
+
+    double            time;
+    hipsparseStatus_t status = bench_time_us(
+        handle,
+        argus,
+        [&]() {
+            return hipsparseSpSV_solve(
+                handle, transA, &h_alpha, A, x, y, typeT, alg, descr, dbuffer);
+        },
+        &time);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+    CHECK_HIPSPARSE_ERROR(status);
+
+    double flops = bench_fma_flops<T>() * nnz_tri;
+    double bytes = sizeof(int) * (m + 1.0 + nnz_tri) + sizeof(T) * (nnz_tri + 2.0 * m);
+
+    result.m   = m;
+    result.n   = n;
+    result.nnz = nnz;
+    result.set(time, flops, bytes);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+#else
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+#endif // BENCH_SPSV_HPP
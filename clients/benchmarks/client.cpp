@@ -0,0 +1,415 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bench_axpyi.hpp"
+#include "bench_csr2csc.hpp"
+#include "bench_csrmm.hpp"
+#include "bench_csrilu02.hpp"
+#include "bench_csrmv.hpp"
+#include "bench_csrsv2.hpp"
+#include "bench_doti.hpp"
+#include "bench_spgemm.hpp"
+#include "bench_spmm.hpp"
+#include "bench_spmv.hpp"
+#include "bench_spsv.hpp"
+#include "hipsparse_bench.hpp"
+#include "utility.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <hip/hip_runtime_api.h>
+#include <hipsparse.h>
+#include <iostream>
+#include <string>
+
+// Exit code of a routine that is not supported by the backend, such that scripts can tell
+// it apart from a failure
+static const int bench_not_supported = 77;
+
+static void print_usage(void)
+{
+    std::cout
+        << "Usage: hipsparse-bench -f <function> [options]\n"
+        << "\n"
+        << "  -f, --function     axpyi, doti, csrmv, csrmm, csr2csc, spmv, spmm, spgemm, spsv,\n"
+        << "                     csrsv2 or csrilu02\n"
+        << "  -r, --precision    s, d, c or z (default s)\n"
+        << "  -m, --sizem        number of rows (default 128)\n"
+        << "  -n, --sizen        number of columns (default 128)\n"
+        << "  -k, --sizek        number of columns of A in csrmm and spmm (default 128)\n"
+        << "  -z, --sizennz      number of non-zeros of a random matrix (default 32)\n"
+        << "  --file             read the matrix from a .mtx or .bin file\n"
+        << "  --laplacian        generate a 2D laplacian matrix of the given dimension\n"
+        << "  --generator        generate a laplace3d7, laplace3d27, fem, rmat or banded matrix\n"
+        << "  --gendim           grid points per dimension (laplace3d7, laplace3d27, fem),\n"
+        << "                     log2 of the number of vertices (rmat) or rows (banded)\n"
+        << "  --genparam         block size (fem, default 3), edge factor (rmat, default 16)\n"
+        << "                     or bandwidth (banded, default 8)\n"
+        << "  --seed             seed of the generated matrix (default 12345)\n"
+        << "  --alpha, --alphai  real and imaginary part of alpha (default 1, 0)\n"
+        << "  --beta, --betai    real and imaginary part of beta (default 0, 0)\n"
+        << "  --transposeA       N, T or C (default N)\n"
+        << "  --uplo             L or U, triangular part used by csrsv2 and spsv (default L)\n"
+        << "  --diag             N or U, non-unit or unit diagonal in csrsv2 and spsv\n"
+        << "                     (default N)\n"
+        << "  --indexbaseA       0 or 1 (default 0)\n"
+        << "  --action           0 (symbolic) or 1 (numeric) for csr2csc (default 1)\n"
+        << "  --alg              algorithm, hipsparseSpMVAlg_t for spmv, hipsparseSpMMAlg_t for\n"
+        << "                     spmm or hipsparseSpGEMMAlg_t for spgemm (default 0)\n"
+        << "  -i, --iters        number of timed calls (default 10)\n"
+        << "  --warmup           number of calls before timing (default 2)\n"
+        << "  -d, --device       device id (default 0)\n"
+        << "  --format           format of the output file, csv or json (default csv)\n"
+        << "  -o, --output       append results to a file\n"
+        << "\n"
+        << "Exits with code " << bench_not_supported
+        << " if the routine is not supported by the backend.\n";
+}
+
+static hipsparse_matrix_generator parse_generator(const char* arg)
+{
+    for(int g = hipsparse_generator_laplace3d_7pt; g <= hipsparse_generator_banded; ++g)
+    {
+        if(strcmp(arg, hipsparse_generator_name((hipsparse_matrix_generator)g)) == 0)
+        {
+            return (hipsparse_matrix_generator)g;
+        }
+    }
+
+    return hipsparse_generator_none;
+}
+
+static hipsparseOperation_t parse_operation(const char* arg)
+{
+    if(strcmp(arg, "T") == 0)
+    {
+        return HIPSPARSE_OPERATION_TRANSPOSE;
+    }
+
+    if(strcmp(arg, "C") == 0)
+    {
+        return HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE;
+    }
+
+    return HIPSPARSE_OPERATION_NON_TRANSPOSE;
+}
+
+template <typename T>
+static hipsparseStatus_t run_bench(const std::string& function,
+                                   const Arguments&   argus,
+                                   bench_result&      result)
+{
+    if(function == "axpyi")
+    {
+        return bench_axpyi<T>(argus, result);
+    }
+    else if(function == "doti")
+    {
+        return bench_doti<T>(argus, result);
+    }
+    else if(function == "csrmv")
+    {
+        return bench_csrmv<T>(argus, result);
+    }
+    else if(function == "csrmm")
+    {
+        return bench_csrmm<T>(argus, result);
+    }
+    else if(function == "csr2csc")
+    {
+        return bench_csr2csc<T>(argus, result);
+    }
+    else if(function == "spmv")
+    {
+        return bench_spmv<T>(argus, result);
+    }
+    else if(function == "spmm")
+    {
+        return bench_spmm<T>(argus, result);
+    }
+    else if(function == "spgemm")
+    {
+        return bench_spgemm<T>(argus, result);
+    }
+    else if(function == "spsv")
+    {
+        return bench_spsv<T>(argus, result);
+    }
+    else if(function == "csrsv2")
+    {
+        return bench_csrsv2<T>(argus, result);
+    }
+    else if(function == "csrilu02")
+    {
+        return bench_csrilu02<T>(argus, result);
+    }
+
+    return HIPSPARSE_STATUS_INVALID_VALUE;
+}
+
+int main(int argc, char* argv[])
+{
+    Arguments   argus;
+    std::string function;
+    char        precision = 's';
+    int         device_id = 0;
+    std::string format    = "csv";
+    std::string output;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if(arg == "-h" || arg == "--help")
+        {
+            print_usage();
+            return 0;
+        }
+
+        if(i + 1 >= argc)
+        {
+            std::cerr << "Missing value of argument " << arg << std::endl;
+            return -1;
+        }
+
+        const char* value = argv[++i];
+
+        if(arg == "-f" || arg == "--function")
+        {
+            function = value;
+        }
+        else if(arg == "-r" || arg == "--precision")
+        {
+            precision = value[0];
+        }
+        else if(arg == "-m" || arg == "--sizem")
+        {
+            argus.M = atoi(value);
+        }
+        else if(arg == "-n" || arg == "--sizen")
+        {
+            argus.N = atoi(value);
+        }
+        else if(arg == "-k" || arg == "--sizek")
+        {
+            argus.K = atoi(value);
+        }
+        else if(arg == "-z" || arg == "--sizennz")
+        {
+            argus.nnz = atoi(value);
+        }
+        else if(arg == "--file")
+        {
+            argus.filename = value;
+        }
+        else if(arg == "--laplacian")
+        {
+            argus.laplacian = atoi(value);
+        }
+        else if(arg == "--generator")
+        {
+            argus.generator = parse_generator(value);
+
+            if(argus.generator == hipsparse_generator_none)
+            {
+                std::cerr << "Invalid generator " << value << std::endl;
+                return -1;
+            }
+        }
+        else if(arg == "--gendim")
+        {
+            argus.gen_dim = atoi(value);
+        }
+        else if(arg == "--genparam")
+        {
+            argus.gen_param = atoi(value);
+        }
+        else if(arg == "--seed")
+        {
+            argus.seed = atoi(value);
+        }
+        else if(arg == "--alpha")
+        {
+            argus.alpha = atof(value);
+        }
+        else if(arg == "--alphai")
+        {
+            argus.alphai = atof(value);
+        }
+        else if(arg == "--beta")
+        {
+            argus.beta = atof(value);
+        }
+        else if(arg == "--betai")
+        {
+            argus.betai = atof(value);
+        }
+        else if(arg == "--transposeA")
+        {
+            argus.transA = parse_operation(value);
+        }
+        else if(arg == "--uplo")
+        {
+            argus.fill_mode
+                = (strcmp(value, "U") == 0) ? HIPSPARSE_FILL_MODE_UPPER : HIPSPARSE_FILL_MODE_LOWER;
+        }
+        else if(arg == "--diag")
+        {
+            argus.diag_type = (strcmp(value, "U") == 0) ? HIPSPARSE_DIAG_TYPE_UNIT
+                                                        : HIPSPARSE_DIAG_TYPE_NON_UNIT;
+        }
+        else if(arg == "--indexbaseA")
+        {
+            argus.idx_base
+                = (atoi(value) == 1) ? HIPSPARSE_INDEX_BASE_ONE : HIPSPARSE_INDEX_BASE_ZERO;
+        }
+        else if(arg == "--action")
+        {
+            argus.action
+                = (atoi(value) == 0) ? HIPSPARSE_ACTION_SYMBOLIC : HIPSPARSE_ACTION_NUMERIC;
+        }
+        else if(arg == "--alg")
+        {
+            argus.alg = atoi(value);
+        }
+        else if(arg == "-i" || arg == "--iters")
+        {
+            argus.iters = atoi(value);
+        }
+        else if(arg == "--warmup")
+        {
+            argus.warmup = atoi(value);
+        }
+        else if(arg == "-d" || arg == "--device")
+        {
+            device_id = atoi(value);
+        }
+        else if(arg == "--format")
+        {
+            format = value;
+        }
+        else if(arg == "-o" || arg == "--output")
+        {
+            output = value;
+        }
+        else
+        {
+            std::cerr << "Unknown argument " << arg << std::endl;
+            return -1;
+        }
+    }
+
+    if(argus.iters < 1 || argus.warmup < 0 || (format != "csv" && format != "json")
+       || (argus.generator != hipsparse_generator_none && argus.gen_dim < 1))
+    {
+        std::cerr << "Invalid arguments, see hipsparse-bench --help" << std::endl;
+        return -1;
+    }
+
+    CHECK_HIP_ERROR(hipSetDevice(device_id));
+
+    hipDeviceProp_t prop;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, device_id));
+
+    // The device name keys the stored performance baselines of rtest.py
+    bench_result result;
+    result.function  = function;
+    result.device    = prop.name;
+    result.precision = precision;
+
+    hipsparseStatus_t status;
+
+    switch(precision)
+    {
+    case 's':
+        status = run_bench<float>(function, argus, result);
+        break;
+    case 'd':
+        status = run_bench<double>(function, argus, result);
+        break;
+    case 'c':
+        status = run_bench<hipComplex>(function, argus, result);
+        break;
+    case 'z':
+        status = run_bench<hipDoubleComplex>(function, argus, result);
+        break;
+    default:
+        status = HIPSPARSE_STATUS_INVALID_VALUE;
+        break;
+    }
+
+    // Not written to the output file, a benchmark suite can skip the routine on this backend
+    if(status == HIPSPARSE_STATUS_NOT_SUPPORTED)
+    {
+        std::cerr << "hipsparse-bench: " << function << " (" << precision
+                  << ") is not supported" << std::endl;
+        return bench_not_supported;
+    }
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        std::cerr << "hipsparse-bench: " << function << " (" << precision
+                  << ") failed with status " << status << std::endl;
+        return -1;
+    }
+
+    // Human readable summary
+    std::cout << "function  precision  M  N  K  nnz  time_us  GFlop/s  GB/s\n"
+              << result.function << "  " << result.precision << "  " << result.m << "  "
+              << result.n << "  " << result.k << "  " << result.nnz << "  " << result.time_us
+              << "  " << result.gflops << "  " << result.gbyte_s << std::endl;
+
+    if(output != "")
+    {
+        // A CSV header is only written to new files
+        bool header = false;
+        {
+            std::ifstream file(output);
+            header = !file.good() || file.peek() == std::ifstream::traits_type::eof();
+        }
+
+        std::ofstream file(output, std::ios::app);
+        if(!file.is_open())
+        {
+            std::cerr << "Cannot open [write] " << output << std::endl;
+            return -1;
+        }
+
+        if(format == "json")
+        {
+            bench_write_json(file, argus, result);
+        }
+        else
+        {
+            if(header)
+            {
+                bench_write_csv_header(file);
+            }
+
+            bench_write_csv(file, argus, result);
+        }
+    }
+
+    return 0;
+}
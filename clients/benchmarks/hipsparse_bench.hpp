@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_BENCH_HPP
+#define HIPSPARSE_BENCH_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+// Result of a benchmark run, times are averaged over all iterations
+struct bench_result
+{
+    std::string function;
+    std::string device;
+    char        precision;
+    int         m   = 0;
+    int         n   = 0;
+    int         k   = 0;
+    int         nnz = 0;
+
+    double time_us = 0.0;
+    double gflops  = 0.0;
+    double gbyte_s = 0.0;
+
+    // Sets the performance figures from the number of floating point operations
+    // and the number of bytes moved by a single call
+    void set(double time, double flops, double bytes)
+    {
+        time_us = time;
+        gflops  = flops / time / 1e3;
+        gbyte_s = bytes / time / 1e3;
+    }
+};
+
+// Floating point operations of a multiply add
+template <typename T>
+inline double bench_fma_flops()
+{
+    return 2.0;
+}
+
+template <>
+inline double bench_fma_flops<hipComplex>()
+{
+    return 8.0;
+}
+
+template <>
+inline double bench_fma_flops<hipDoubleComplex>()
+{
+    return 8.0;
+}
+
+template <typename T>
+inline hipDataType bench_data_type();
+
+template <>
+inline hipDataType bench_data_type<float>()
+{
+    return HIP_R_32F;
+}
+
+template <>
+inline hipDataType bench_data_type<double>()
+{
+    return HIP_R_64F;
+}
+
+template <>
+inline hipDataType bench_data_type<hipComplex>()
+{
+    return HIP_C_32F;
+}
+
+template <>
+inline hipDataType bench_data_type<hipDoubleComplex>()
+{
+    return HIP_C_64F;
+}
+
+// Average time of a call to f in microseconds. The first warmup calls are not timed.
+template <typename F>
+hipsparseStatus_t bench_time_us(hipsparseHandle_t handle, const Arguments& argus, F f, double* time)
+{
+    hipStream_t stream;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    for(int i = 0; i < argus.warmup; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(f());
+    }
+
+    double start = get_time_us_sync(stream);
+
+    for(int i = 0; i < argus.iters; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(f());
+    }
+
+    *time = (get_time_us_sync(stream) - start) / argus.iters;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Host CSR matrix of the benchmark. The matrix is read from argus.filename (.mtx or
+// .bin), generated as 2D laplacian if argus.laplacian is set, generated by
+// argus.generator if set, or generated randomly with m rows, n columns and argus.nnz
+// non-zeros, in this order. On return, m, n and
+// nnz hold the dimensions of the matrix.
+template <typename T>
+hipsparseStatus_t bench_csr_matrix(const Arguments&  argus,
+                                   int&              m,
+                                   int&              n,
+                                   int&              nnz,
+                                   std::vector<int>& csr_row_ptr,
+                                   std::vector<int>& csr_col_ind,
+                                   std::vector<T>&   csr_val)
+{
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+    const std::string&   filename = argus.filename;
+
+    srand(12345ULL);
+
+    if(filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0)
+    {
+        if(read_bin_matrix(filename.c_str(), m, n, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(filename == "" && argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, csr_row_ptr, csr_col_ind, csr_val, idx_base);
+        nnz   = csr_row_ptr[m] - idx_base;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(filename == "" && argus.generator != hipsparse_generator_none)
+    {
+        gen_matrix(argus.generator,
+                   argus.gen_dim,
+                   argus.gen_param,
+                   argus.seed,
+                   m,
+                   n,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val,
+                   idx_base);
+        nnz = csr_row_ptr[m] - idx_base;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    std::vector<int> coo_row_ind;
+
+    if(filename != "")
+    {
+        if(read_mtx_matrix(filename.c_str(), m, n, nnz, coo_row_ind, csr_col_ind, csr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+    }
+    else
+    {
+        nnz = std::min(argus.nnz, m * n);
+
+        gen_matrix_coo(m, n, nnz, coo_row_ind, csr_col_ind, csr_val, idx_base);
+    }
+
+    // Convert COO to CSR
+    csr_row_ptr.assign(m + 1, 0);
+
+    for(int i = 0; i < nnz; ++i)
+    {
+        ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
+    }
+
+    csr_row_ptr[0] = idx_base;
+    for(int i = 0; i < m; ++i)
+    {
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Machine readable output. CSV and JSON Lines are written one run per line, such that
+// the results of several runs can be appended to the same file.
+inline void bench_write_csv_header(std::ostream& os)
+{
+    os << "function,precision,M,N,K,nnz,alg,iters,time_us,gflops,gbyte_s,device\n";
+}
+
+inline void bench_write_csv(std::ostream& os, const Arguments& argus, const bench_result& result)
+{
+    os << result.function << ',' << result.precision << ',' << result.m << ',' << result.n << ','
+       << result.k << ',' << result.nnz << ',' << argus.alg << ',' << argus.iters << ','
+       << result.time_us << ',' << result.gflops << ',' << result.gbyte_s << ",\""
+       << result.device << "\"\n";
+}
+
+inline void bench_write_json(std::ostream& os, const Arguments& argus, const bench_result& result)
+{
+    os << "{\"function\": \"" << result.function << "\", \"precision\": \"" << result.precision
+       << "\", \"M\": " << result.m << ", \"N\": " << result.n << ", \"K\": " << result.k
+       << ", \"nnz\": " << result.nnz << ", \"alg\": " << argus.alg
+       << ", \"iters\": " << argus.iters << ", \"time_us\": " << result.time_us
+       << ", \"gflops\": " << result.gflops << ", \"gbyte_s\": " << result.gbyte_s
+       << ", \"device\": \"" << result.device << "\"}\n";
+}
+
+#endif // HIPSPARSE_BENCH_HPP
@@ -24,9 +24,13 @@
 #include "unit.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse.h>
+#include <iostream>
 #include <limits>
+#include <type_traits>
 
 #ifdef GOOGLE_TEST
 #include <gtest/gtest.h>
@@ -40,61 +44,311 @@
 #endif
 #endif
 
+/* ========================================Comparison kernels
+ * ==================================================== */
+
+// Number of mismatches that are listed when a check fails
+static const int64_t unit_max_report = 10;
+
+// Rows per work item of the parallel comparison
+static const int64_t unit_block_size = 4096;
+
+// Comparisons below this number of elements are not worth a parallel region
+static const int64_t unit_parallel_size = 65536;
+
+template <typename T>
+struct unit_bits;
+
+template <>
+struct unit_bits<float>
+{
+    typedef uint32_t type;
+};
+
+template <>
+struct unit_bits<double>
+{
+    typedef uint64_t type;
+};
+
+// Distance of a and b in units of the last place. This is the measure of
+// ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ, sign and magnitude are mapped to a biased
+// representation, such that -0 and +0 have distance 0.
+template <typename T>
+static inline uint64_t unit_ulp_distance(T a, T b)
+{
+    typedef typename unit_bits<T>::type U;
+
+    const U sign = U(1) << (sizeof(U) * 8 - 1);
+
+    U ua;
+    U ub;
+    memcpy(&ua, &a, sizeof(T));
+    memcpy(&ub, &b, sizeof(T));
+
+    ua = (ua & sign) ? ~ua + 1 : ua | sign;
+    ub = (ub & sign) ? ~ub + 1 : ub | sign;
+
+    return (ua >= ub) ? ua - ub : ub - ua;
+}
+
+// Predicates of the checks, matching the gtest assertions that report the failure
+template <typename T>
+struct unit_equal
+{
+    bool operator()(T a, T b) const
+    {
+        return a == b;
+    }
+};
+
+template <typename T>
+struct unit_ulp_equal
+{
+    bool operator()(T a, T b) const
+    {
+        return !std::isnan(a) && !std::isnan(b) && unit_ulp_distance(a, b) <= 4;
+    }
+};
+
+template <typename T>
+struct unit_near
+{
+    T tol;
+
+    bool operator()(T a, T b) const
+    {
+        T compare_val = std::max(std::abs(a * tol), 10 * std::numeric_limits<T>::epsilon());
+
+        return std::abs(a - b) <= compare_val;
+    }
+};
+
+// Number of elements of the M x N matrices A and B where pass(a, b) does not hold
+template <typename T, typename P>
+static int64_t unit_count_mismatches(
+    int64_t M, int64_t N, int64_t lda, const T* A, const T* B, P pass)
+{
+    int64_t blocks_per_col = (M - 1) / unit_block_size + 1;
+    int64_t blocks         = (M > 0) ? N * blocks_per_col : 0;
+    int64_t count          = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : count) if(M * N >= unit_parallel_size)
+#endif
+    for(int64_t b = 0; b < blocks; ++b)
+    {
+        int64_t j     = b / blocks_per_col;
+        int64_t begin = (b % blocks_per_col) * unit_block_size;
+        int64_t end   = std::min(begin + unit_block_size, M);
+
+        const T* a = A + j * lda;
+        const T* c = B + j * lda;
+
+        int64_t block_count = 0;
+
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : block_count)
+#endif
+        for(int64_t i = begin; i < end; ++i)
+        {
+            block_count += pass(a[i], c[i]) ? 0 : 1;
+        }
+
+        count += block_count;
+    }
+
+    return count;
+}
+
+// Summary of the differences, only computed if a check fails
+struct unit_stats
+{
+    double   max_abs = 0.0;
+    double   max_rel = 0.0;
+    uint64_t max_ulp = 0;
+};
+
+template <typename T>
+static inline void unit_update_ulp(unit_stats& stats, T a, T b, std::true_type)
+{
+    if(!std::isnan(a) && !std::isnan(b))
+    {
+        stats.max_ulp = std::max(stats.max_ulp, unit_ulp_distance(a, b));
+    }
+}
+
+template <typename T>
+static inline void unit_update_ulp(unit_stats&, T, T, std::false_type)
+{
+}
+
+template <typename T>
+static unit_stats unit_compute_stats(int64_t M, int64_t N, int64_t lda, const T* A, const T* B)
+{
+    double   max_abs = 0.0;
+    double   max_rel = 0.0;
+    uint64_t max_ulp = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_abs, max_rel, max_ulp) \
+    if(M * N >= unit_parallel_size)
+#endif
+    for(int64_t j = 0; j < N; ++j)
+    {
+        unit_stats stats;
+
+        for(int64_t i = 0; i < M; ++i)
+        {
+            double a   = static_cast<double>(A[i + j * lda]);
+            double b   = static_cast<double>(B[i + j * lda]);
+            double err = std::abs(a - b);
+
+            // NaN never compares greater, such that it is skipped
+            if(err > stats.max_abs)
+            {
+                stats.max_abs = err;
+            }
+
+            if(a != 0.0 && err / std::abs(a) > stats.max_rel)
+            {
+                stats.max_rel = err / std::abs(a);
+            }
+
+            unit_update_ulp(
+                stats, A[i + j * lda], B[i + j * lda], std::is_floating_point<T>());
+        }
+
+        max_abs = std::max(max_abs, stats.max_abs);
+        max_rel = std::max(max_rel, stats.max_rel);
+        max_ulp = std::max(max_ulp, stats.max_ulp);
+    }
+
+    unit_stats stats;
+    stats.max_abs = max_abs;
+    stats.max_rel = max_rel;
+    stats.max_ulp = max_ulp;
+
+    return stats;
+}
+
+// Compares the M x N matrices A and B in parallel. If they differ, the summary of the
+// differences and the first mismatches are printed and the offset of the first
+// mismatch is returned, -1 otherwise. Complex matrices are compared as real matrices
+// with parts = 2 rows per element.
+template <typename T, typename P>
+static int64_t
+    unit_check(int64_t M, int64_t N, int64_t lda, const T* A, const T* B, int parts, P pass)
+{
+    int64_t count = unit_count_mismatches(M, N, lda, A, B, pass);
+
+    if(count == 0)
+    {
+        return -1;
+    }
+
+    unit_stats stats = unit_compute_stats(M, N, lda, A, B);
+
+    std::cerr << "unit check: " << count << " of " << M * N << " values differ, max abs error "
+              << stats.max_abs << ", max rel error " << stats.max_rel;
+
+    if(std::is_floating_point<T>::value)
+    {
+        std::cerr << ", max ulp distance " << stats.max_ulp;
+    }
+
+    std::cerr << std::endl;
+
+    // First mismatches in column major order
+    int64_t first    = -1;
+    int64_t reported = 0;
+
+    for(int64_t j = 0; j < N && reported < unit_max_report; ++j)
+    {
+        for(int64_t i = 0; i < M && reported < unit_max_report; ++i)
+        {
+            int64_t idx = i + j * lda;
+
+            if(pass(A[idx], B[idx]))
+            {
+                continue;
+            }
+
+            if(first < 0)
+            {
+                first = idx;
+            }
+
+            std::cerr << "  (" << i / parts << ", " << j << ")";
+
+            if(parts == 2)
+            {
+                std::cerr << ((i % 2 == 0) ? " real" : " imag");
+            }
+
+            std::streamsize precision = std::cerr.precision(std::numeric_limits<T>::max_digits10);
+            std::cerr << ": expected " << A[idx] << ", got " << B[idx] << std::endl;
+            std::cerr.precision(precision);
+
+            ++reported;
+        }
+    }
+
+    return first;
+}
+
 /* ========================================Gtest Unit Check
  * ==================================================== */
 
 /*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, sincer assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+// The matrices are compared in parallel first, the gtest assertion is only evaluated
+// for the first mismatch, such that it reports the failure of the test case.
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_ulp_equal<float>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+        ASSERT_FLOAT_EQ(hCPU[first], hGPU[first]);
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+        assert(hCPU[first] == hGPU[first]);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_ulp_equal<double>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+        ASSERT_DOUBLE_EQ(hCPU[first], hGPU[first]);
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+        assert(hCPU[first] == hGPU[first]);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    float* cpu = reinterpret_cast<float*>(hCPU);
+    float* gpu = reinterpret_cast<float*>(hGPU);
+
+    int64_t first = unit_check(2 * M, N, 2 * lda, cpu, gpu, 2, unit_ulp_equal<float>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+        ASSERT_FLOAT_EQ(cpu[first], gpu[first]);
 #else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
+        assert(cpu[first] == gpu[first]);
 #endif
-        }
     }
 }
 
@@ -102,131 +356,121 @@ template <>
 void unit_check_general(
     int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    double* cpu = reinterpret_cast<double*>(hCPU);
+    double* gpu = reinterpret_cast<double*>(hGPU);
+
+    int64_t first = unit_check(2 * M, N, 2 * lda, cpu, gpu, 2, unit_ulp_equal<double>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+        ASSERT_DOUBLE_EQ(cpu[first], gpu[first]);
 #else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
+        assert(cpu[first] == gpu[first]);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, int* hCPU, int* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_equal<int>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+        ASSERT_EQ(hCPU[first], hGPU[first]);
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+        assert(hCPU[first] == hGPU[first]);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, int64_t* hCPU, int64_t* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_equal<int64_t>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+        ASSERT_EQ(hCPU[first], hGPU[first]);
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+        assert(hCPU[first] == hGPU[first]);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, size_t* hCPU, size_t* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_equal<size_t>());
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+        ASSERT_EQ(hCPU[first], hGPU[first]);
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+        assert(hCPU[first] == hGPU[first]);
 #endif
-        }
     }
 }
 
 /*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+// The tolerance is relative to the CPU result, with a lower bound of 10 epsilon. The
+// real and imaginary parts of complex values are compared independently.
 
 template <>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_near<float>{1e-3f});
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-            float compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-3f),
-                                         10 * std::numeric_limits<float>::epsilon());
+        float compare_val = std::max(std::abs(hCPU[first] * 1e-3f),
+                                     10 * std::numeric_limits<float>::epsilon());
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
+        ASSERT_NEAR(hCPU[first], hGPU[first], compare_val);
 #else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
+        assert(std::abs(hCPU[first] - hGPU[first]) <= compare_val);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t first = unit_check(M, N, lda, hCPU, hGPU, 1, unit_near<double>{1e-10});
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-            double compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-10),
-                                          10 * std::numeric_limits<double>::epsilon());
+        double compare_val = std::max(std::abs(hCPU[first] * 1e-10),
+                                      10 * std::numeric_limits<double>::epsilon());
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
+        ASSERT_NEAR(hCPU[first], hGPU[first], compare_val);
 #else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
+        assert(std::abs(hCPU[first] - hGPU[first]) <= compare_val);
 #endif
-        }
     }
 }
 
 template <>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipComplex compare_val
-                = make_hipFloatComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()),
-                                       std::max(std::abs(hCPU[i + j * lda].y * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()));
+    float* cpu = reinterpret_cast<float*>(hCPU);
+    float* gpu = reinterpret_cast<float*>(hGPU);
+
+    int64_t first = unit_check(2 * M, N, 2 * lda, cpu, gpu, 2, unit_near<float>{1e-3f});
 
+    if(first >= 0)
+    {
+        float compare_val
+            = std::max(std::abs(cpu[first] * 1e-3f), 10 * std::numeric_limits<float>::epsilon());
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
+        ASSERT_NEAR(cpu[first], gpu[first], compare_val);
 #else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
+        assert(std::abs(cpu[first] - gpu[first]) <= compare_val);
 #endif
-        }
     }
 }
 
@@ -234,22 +478,19 @@ template <>
 void unit_check_near(
     int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    double* cpu = reinterpret_cast<double*>(hCPU);
+    double* gpu = reinterpret_cast<double*>(hGPU);
+
+    int64_t first = unit_check(2 * M, N, 2 * lda, cpu, gpu, 2, unit_near<double>{1e-10});
+
+    if(first >= 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipDoubleComplex compare_val
-                = make_hipDoubleComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()),
-                                        std::max(std::abs(hCPU[i + j * lda].y * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()));
+        double compare_val = std::max(std::abs(cpu[first] * 1e-10),
+                                      10 * std::numeric_limits<double>::epsilon());
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
+        ASSERT_NEAR(cpu[first], gpu[first], compare_val);
 #else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
+        assert(std::abs(cpu[first] - gpu[first]) <= compare_val);
 #endif
-        }
     }
 }
@@ -34,7 +34,7 @@
 #define strSUITEcmp(A, B) _stricmp(A, B)
 #endif
 
-#ifdef __cpp_lib_filesystem
+#if defined(__cpp_lib_filesystem) || (__cplusplus >= 201703L && __has_include(<filesystem>))
 #include <filesystem>
 #else
 #include <experimental/filesystem>
@@ -60,7 +60,7 @@ namespace std
 #include <cmath>
 #include <cstdlib>
 
-#ifdef __cpp_lib_filesystem
+#if defined(__cpp_lib_filesystem) || (__cplusplus >= 201703L && __has_include(<filesystem>))
 #include <filesystem>
 #else
 #include <experimental/filesystem>
@@ -0,0 +1,513 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR_BIN_HPP
+#define CSR_BIN_HPP
+
+#include "mtx_reader.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+/*!\file
+ * \brief Versioned binary CSR format. A fixed size header describes the index widths,
+ * the value type, the index base and the symmetry of the source matrix. It is followed by
+ * the row pointer, column index and value arrays, each starting at an aligned offset, such
+ * that a memory mapped file can be used in place. Files without header are read as the
+ * legacy format of int32 dimensions, int32 indices and double values, with base zero.
+ * This header does not depend on HIP, such that it can be used by stand alone tools.
+ */
+
+#define CSR_BIN_MAGIC "HIPSPCSR"
+
+static const uint32_t csr_bin_version   = 1;
+static const uint32_t csr_bin_alignment = 64;
+
+enum csr_bin_value_type
+{
+    csr_bin_r32f = 0,
+    csr_bin_r64f = 1,
+    csr_bin_c32f = 2,
+    csr_bin_c64f = 3
+};
+
+/*! \brief  Value type code of T, specializations for complex types are provided where the
+ *  complex types are known. */
+template <typename T>
+struct csr_bin_value_traits;
+
+template <>
+struct csr_bin_value_traits<float>
+{
+    static const uint8_t type = csr_bin_r32f;
+};
+
+template <>
+struct csr_bin_value_traits<double>
+{
+    static const uint8_t type = csr_bin_r64f;
+};
+
+/*! \brief  On disk header, all fields are little endian */
+struct csr_bin_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint8_t  ptr_width; // Bytes per row pointer, 4 or 8
+    uint8_t  ind_width; // Bytes per column index, 4 or 8
+    uint8_t  value_type; // csr_bin_value_type
+    uint8_t  index_base; // 0 or 1
+    uint8_t  symmetry; // mtx_symmetry of the source, entries are always stored fully
+    uint8_t  reserved0[3];
+    uint32_t alignment;
+    uint32_t reserved1;
+    int64_t  m;
+    int64_t  n;
+    int64_t  nnz;
+    uint64_t ptr_offset;
+    uint64_t ind_offset;
+    uint64_t val_offset;
+    uint64_t checksum; // csr_bin_checksum of the three arrays, in this order
+    uint8_t  reserved2[40];
+};
+
+static_assert(sizeof(csr_bin_header) == 128, "csr_bin_header must be 128 bytes");
+
+static inline size_t csr_bin_value_size(uint8_t type)
+{
+    switch(type)
+    {
+    case csr_bin_r32f:
+        return 4;
+    case csr_bin_r64f:
+    case csr_bin_c32f:
+        return 8;
+    case csr_bin_c64f:
+        return 16;
+    }
+
+    return 0;
+}
+
+static inline uint64_t csr_bin_align(uint64_t offset, uint64_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+/* ============================================================================================ */
+/*! \brief  64 bit FNV-1a hash over 8 byte words, remaining bytes are hashed one by one. The
+ *  hash of several arrays is computed by passing the previous hash as seed. */
+static inline uint64_t
+    csr_bin_checksum(const char* data, size_t size, uint64_t hash = 14695981039346656037ull)
+{
+    const uint64_t prime = 1099511628211ull;
+
+    size_t i = 0;
+    for(; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * prime;
+    }
+
+    for(; i < size; ++i)
+    {
+        hash = (hash ^ (uint8_t)data[i]) * prime;
+    }
+
+    return hash;
+}
+
+/* ============================================================================================ */
+/*! \brief  Write a CSR matrix in the versioned binary format. Returns 0 on success. */
+static inline int csr_bin_write(const char* filename,
+                                int64_t     m,
+                                int64_t     n,
+                                int64_t     nnz,
+                                int         ptr_width,
+                                const void* ptr,
+                                int         ind_width,
+                                const void* ind,
+                                uint8_t     value_type,
+                                const void* val,
+                                int         index_base,
+                                int         symmetry)
+{
+    size_t ptr_size = (size_t)(m + 1) * ptr_width;
+    size_t ind_size = (size_t)nnz * ind_width;
+    size_t val_size = (size_t)nnz * csr_bin_value_size(value_type);
+
+    csr_bin_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CSR_BIN_MAGIC, 8);
+
+    header.version     = csr_bin_version;
+    header.header_size = sizeof(csr_bin_header);
+    header.ptr_width   = (uint8_t)ptr_width;
+    header.ind_width   = (uint8_t)ind_width;
+    header.value_type  = value_type;
+    header.index_base  = (uint8_t)index_base;
+    header.symmetry    = (uint8_t)symmetry;
+    header.alignment   = csr_bin_alignment;
+    header.m           = m;
+    header.n           = n;
+    header.nnz         = nnz;
+    header.ptr_offset  = csr_bin_align(sizeof(csr_bin_header), csr_bin_alignment);
+    header.ind_offset  = csr_bin_align(header.ptr_offset + ptr_size, csr_bin_alignment);
+    header.val_offset  = csr_bin_align(header.ind_offset + ind_size, csr_bin_alignment);
+
+    uint64_t hash   = csr_bin_checksum((const char*)ptr, ptr_size);
+    hash            = csr_bin_checksum((const char*)ind, ind_size, hash);
+    header.checksum = csr_bin_checksum((const char*)val, val_size, hash);
+
+    FILE* f = fopen(filename, "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    // Each array is preceded by zero padding up to its offset
+    const char padding[csr_bin_alignment] = {};
+
+    uint64_t pos = 0;
+    bool     ok  = true;
+
+    auto put = [&](uint64_t offset, const void* data, size_t bytes) {
+        ok  = ok && fwrite(padding, 1, offset - pos, f) == offset - pos;
+        ok  = ok && fwrite(data, 1, bytes, f) == bytes;
+        pos = offset + bytes;
+    };
+
+    put(0, &header, sizeof(header));
+    put(header.ptr_offset, ptr, ptr_size);
+    put(header.ind_offset, ind, ind_size);
+    put(header.val_offset, val, val_size);
+
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Memory mapped binary CSR file, in versioned or legacy format. The arrays can be
+ *  accessed in place, e.g. to upload them to the device without intermediate copies. */
+class csr_bin_file
+{
+public:
+    explicit csr_bin_file(const char* filename)
+        : view_(filename)
+    {
+        if(view_.valid())
+        {
+            size_t size = view_.end() - view_.begin();
+            bool   versioned
+                = size >= sizeof(CSR_BIN_MAGIC) - 1
+                  && memcmp(view_.begin(), CSR_BIN_MAGIC, sizeof(CSR_BIN_MAGIC) - 1) == 0;
+
+            valid_ = versioned ? parse() : parse_legacy();
+        }
+    }
+
+    bool valid() const
+    {
+        return valid_;
+    }
+
+    // Legacy files report version 0
+    const csr_bin_header& header() const
+    {
+        return header_;
+    }
+
+    const char* ptr_data() const
+    {
+        return view_.begin() + header_.ptr_offset;
+    }
+
+    const char* ind_data() const
+    {
+        return view_.begin() + header_.ind_offset;
+    }
+
+    const char* val_data() const
+    {
+        return view_.begin() + header_.val_offset;
+    }
+
+    // Typed access in place, nullptr if the stored layout differs from the requested one
+    template <typename I>
+    const I* row_ptr() const
+    {
+        return in_place<I>(ptr_data(), header_.ptr_width);
+    }
+
+    template <typename J>
+    const J* col_ind() const
+    {
+        return in_place<J>(ind_data(), header_.ind_width);
+    }
+
+    template <typename T>
+    const T* values() const
+    {
+        return (header_.value_type == csr_bin_value_traits<T>::type)
+                   ? in_place<T>(val_data(), sizeof(T))
+                   : nullptr;
+    }
+
+    // Compare the checksum of the arrays against the header, legacy files have none
+    bool verify() const
+    {
+        if(header_.version == 0)
+        {
+            return true;
+        }
+
+        uint64_t hash = csr_bin_checksum(ptr_data(), (size_t)(header_.m + 1) * header_.ptr_width);
+        hash = csr_bin_checksum(ind_data(), (size_t)header_.nnz * header_.ind_width, hash);
+        hash = csr_bin_checksum(
+            val_data(), (size_t)header_.nnz * csr_bin_value_size(header_.value_type), hash);
+
+        return hash == header_.checksum;
+    }
+
+private:
+    template <typename I>
+    static const I* in_place(const char* data, size_t width)
+    {
+        return (width == sizeof(I) && (uintptr_t)data % alignof(I) == 0) ? (const I*)data
+                                                                          : nullptr;
+    }
+
+    bool parse()
+    {
+        size_t size = view_.end() - view_.begin();
+        if(size < sizeof(csr_bin_header))
+        {
+            return false;
+        }
+
+        memcpy(&header_, view_.begin(), sizeof(csr_bin_header));
+
+        if(header_.version == 0 || header_.version > csr_bin_version
+           || header_.header_size != sizeof(csr_bin_header))
+        {
+            return false;
+        }
+
+        if((header_.ptr_width != 4 && header_.ptr_width != 8)
+           || (header_.ind_width != 4 && header_.ind_width != 8)
+           || csr_bin_value_size(header_.value_type) == 0 || header_.index_base > 1
+           || header_.alignment == 0 || header_.m < 0 || header_.n < 0 || header_.nnz < 0)
+        {
+            return false;
+        }
+
+        return check_section(header_.ptr_offset, header_.m + 1, header_.ptr_width, size)
+               && check_section(header_.ind_offset, header_.nnz, header_.ind_width, size)
+               && check_section(header_.val_offset,
+                                header_.nnz,
+                                csr_bin_value_size(header_.value_type),
+                                size);
+    }
+
+    // Legacy layout: m, n, nnz, ptr and col as int32, followed by double values
+    bool parse_legacy()
+    {
+        size_t size = view_.end() - view_.begin();
+        if(size < 3 * sizeof(int32_t))
+        {
+            return false;
+        }
+
+        int32_t dims[3];
+        memcpy(dims, view_.begin(), sizeof(dims));
+
+        memset(&header_, 0, sizeof(csr_bin_header));
+
+        header_.version    = 0;
+        header_.ptr_width  = 4;
+        header_.ind_width  = 4;
+        header_.value_type = csr_bin_r64f;
+        header_.index_base = 0;
+        header_.alignment  = 1;
+        header_.m          = dims[0];
+        header_.n          = dims[1];
+        header_.nnz        = dims[2];
+        header_.ptr_offset = sizeof(dims);
+        header_.ind_offset = header_.ptr_offset + (uint64_t)(header_.m + 1) * 4;
+        header_.val_offset = header_.ind_offset + (uint64_t)header_.nnz * 4;
+
+        if(header_.m < 0 || header_.n < 0 || header_.nnz < 0)
+        {
+            return false;
+        }
+
+        return header_.val_offset + (uint64_t)header_.nnz * 8 <= size;
+    }
+
+    bool check_section(uint64_t offset, int64_t count, size_t width, size_t size) const
+    {
+        return offset % header_.alignment == 0 && offset >= sizeof(csr_bin_header)
+               && offset <= size && (uint64_t)count <= (size - offset) / width;
+    }
+
+    mtx_file_view  view_;
+    csr_bin_header header_;
+    bool           valid_ = false;
+};
+
+/* ============================================================================================ */
+/*! \brief  Copy indices of the given width to dst, adding shift to each index. Returns false
+ *  if an index does not fit into I. */
+template <typename I>
+bool csr_bin_load_indices(const char* src, int width, int64_t count, int shift, I* dst)
+{
+    if(width == sizeof(I) && shift == 0)
+    {
+        memcpy(dst, src, (size_t)count * width);
+        return true;
+    }
+
+    int overflow = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(| : overflow)
+#endif
+    for(int64_t i = 0; i < count; ++i)
+    {
+        int64_t idx;
+        if(width == 4)
+        {
+            int32_t idx32;
+            memcpy(&idx32, src + i * 4, 4);
+            idx = idx32;
+        }
+        else
+        {
+            memcpy(&idx, src + i * 8, 8);
+        }
+
+        idx += shift;
+        overflow |= (idx > (int64_t)std::numeric_limits<I>::max());
+        dst[i] = (I)idx;
+    }
+
+    return overflow == 0;
+}
+
+/*! \brief  Convert values of the given type to T, using mtx_set_value() */
+template <typename T>
+void csr_bin_load_values(const char* src, uint8_t type, int64_t count, T* dst)
+{
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int64_t i = 0; i < count; ++i)
+    {
+        double real = 0.0;
+        double imag = 0.0;
+
+        if(type == csr_bin_r32f)
+        {
+            float v;
+            memcpy(&v, src + i * 4, 4);
+            real = v;
+        }
+        else if(type == csr_bin_r64f)
+        {
+            memcpy(&real, src + i * 8, 8);
+        }
+        else if(type == csr_bin_c32f)
+        {
+            float v[2];
+            memcpy(v, src + i * 8, 8);
+            real = v[0];
+            imag = v[1];
+        }
+        else
+        {
+            double v[2];
+            memcpy(v, src + i * 16, 16);
+            real = v[0];
+            imag = v[1];
+        }
+
+        mtx_set_value(dst[i], real, imag);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Extract the matrix of a verified file with the requested index types, value type
+ *  and index base. Arrays whose stored layout already matches are copied in bulk. Returns 0
+ *  on success. */
+template <typename I, typename J, typename T>
+int csr_bin_read(const csr_bin_file& file,
+                 int                 idx_base,
+                 J&                  nrow,
+                 J&                  ncol,
+                 I&                  nnz,
+                 std::vector<I>&     ptr,
+                 std::vector<J>&     col,
+                 std::vector<T>&     val)
+{
+    const csr_bin_header& header = file.header();
+
+    if(header.m > std::numeric_limits<J>::max() || header.n > std::numeric_limits<J>::max()
+       || header.nnz > std::numeric_limits<I>::max())
+    {
+        return -1;
+    }
+
+    nrow = (J)header.m;
+    ncol = (J)header.n;
+    nnz  = (I)header.nnz;
+
+    ptr.resize(nrow + 1);
+    col.resize(nnz);
+    val.resize(nnz);
+
+    int shift = idx_base - header.index_base;
+
+    if(!csr_bin_load_indices(file.ptr_data(), header.ptr_width, header.m + 1, shift, ptr.data())
+       || !csr_bin_load_indices(file.ind_data(), header.ind_width, header.nnz, shift, col.data()))
+    {
+        return -1;
+    }
+
+    const T* values = file.values<T>();
+    if(values != nullptr)
+    {
+        memcpy(val.data(), values, sizeof(T) * nnz);
+    }
+    else
+    {
+        csr_bin_load_values(file.val_data(), header.value_type, header.nnz, val.data());
+    }
+
+    return 0;
+}
+
+#endif // CSR_BIN_HPP
@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIP_CALL_RECORDER_HPP
+#define HIP_CALL_RECORDER_HPP
+
+// Stand-in for the HIP runtime calls that are not allowed in capture safe mode. The test
+// executable defines hipMalloc(), hipFree() and the synchronizing calls itself, such that
+// the calls made from within hipSPARSE and rocSPARSE are resolved here. Each call is
+// counted while recording and then forwarded to the HIP runtime.
+//
+// The definitions must only be compiled into a single translation unit of the test
+// executable, which has to export its symbols to the shared libraries.
+
+#include <hip/hip_runtime_api.h>
+
+#include <atomic>
+#include <dlfcn.h>
+
+namespace hip_call_recorder
+{
+    struct counts
+    {
+        int malloc_calls;
+        int free_calls;
+        int sync_calls;
+    };
+
+    inline std::atomic<bool>& recording()
+    {
+        static std::atomic<bool> active(false);
+        return active;
+    }
+
+    inline std::atomic<int>& malloc_calls()
+    {
+        static std::atomic<int> calls(0);
+        return calls;
+    }
+
+    inline std::atomic<int>& free_calls()
+    {
+        static std::atomic<int> calls(0);
+        return calls;
+    }
+
+    inline std::atomic<int>& sync_calls()
+    {
+        static std::atomic<int> calls(0);
+        return calls;
+    }
+
+    // Start recording, counts are reset
+    inline void start()
+    {
+        malloc_calls() = 0;
+        free_calls()   = 0;
+        sync_calls()   = 0;
+        recording()    = true;
+    }
+
+    // Stop recording and return the calls that have been made in between
+    inline counts stop()
+    {
+        recording() = false;
+        return counts{malloc_calls(), free_calls(), sync_calls()};
+    }
+
+    inline void record(std::atomic<int>& calls)
+    {
+        if(recording())
+        {
+            ++calls;
+        }
+    }
+
+    // Next definition of a HIP runtime function, i.e. the one of the HIP runtime library
+    template <typename F>
+    F next(const char* name)
+    {
+        return reinterpret_cast<F>(dlsym(RTLD_NEXT, name));
+    }
+}
+
+extern "C" hipError_t hipMalloc(void** ptr, size_t size)
+{
+    static auto fn = hip_call_recorder::next<hipError_t (*)(void**, size_t)>("hipMalloc");
+
+    hip_call_recorder::record(hip_call_recorder::malloc_calls());
+    return fn(ptr, size);
+}
+
+extern "C" hipError_t hipFree(void* ptr)
+{
+    static auto fn = hip_call_recorder::next<hipError_t (*)(void*)>("hipFree");
+
+    hip_call_recorder::record(hip_call_recorder::free_calls());
+    return fn(ptr);
+}
+
+extern "C" hipError_t hipStreamSynchronize(hipStream_t stream)
+{
+    static auto fn = hip_call_recorder::next<hipError_t (*)(hipStream_t)>("hipStreamSynchronize");
+
+    hip_call_recorder::record(hip_call_recorder::sync_calls());
+    return fn(stream);
+}
+
+extern "C" hipError_t hipDeviceSynchronize(void)
+{
+    static auto fn = hip_call_recorder::next<hipError_t (*)(void)>("hipDeviceSynchronize");
+
+    hip_call_recorder::record(hip_call_recorder::sync_calls());
+    return fn();
+}
+
+// A synchronous copy blocks the host until the device has caught up
+extern "C" hipError_t hipMemcpy(void* dst, const void* src, size_t size, hipMemcpyKind kind)
+{
+    static auto fn
+        = hip_call_recorder::next<hipError_t (*)(void*, const void*, size_t, hipMemcpyKind)>(
+            "hipMemcpy");
+
+    hip_call_recorder::record(hip_call_recorder::sync_calls());
+    return fn(dst, src, size, kind);
+}
+
+#endif // HIP_CALL_RECORDER_HPP
@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HOST_BSRMM_HPP
+#define HOST_BSRMM_HPP
+
+#include "host_bsrmv.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <vector>
+
+/*!\file
+ * \brief Host references of bsrmv and bsrmm. They run the BSR kernels of the host backend,
+ * which are specialized for block sizes 2 to 8 and 16 and both block layouts.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Compute y = alpha * A * x + beta * y for a BSR matrix A. */
+template <typename T>
+inline void host_bsrmv(hipsparseDirection_t dir,
+                       hipsparseOperation_t trans,
+                       int                  mb,
+                       int                  nb,
+                       int                  nnzb,
+                       T                    alpha,
+                       const int*           bsr_row_ptr,
+                       const int*           bsr_col_ind,
+                       const T*             bsr_val,
+                       int                  bsr_dim,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       hipsparseIndexBase_t base)
+{
+    hipsparse::bsr_view<int, int> A = {mb,
+                                       bsr_dim,
+                                       dir == HIPSPARSE_DIRECTION_ROW,
+                                       bsr_row_ptr,
+                                       bsr_row_ptr + 1,
+                                       bsr_col_ind,
+                                       base,
+                                       bsr_val};
+
+    hipsparse::host_bsrmv(A, (const int*)nullptr, 0, alpha, x, beta, y);
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute C = alpha * A * op(B) + beta * C for a BSR matrix A and column major B
+ *  and C. */
+template <typename T>
+inline void host_bsrmm(int                     Mb,
+                       int                     N,
+                       int                     Kb,
+                       int                     block_dim,
+                       hipsparseDirection_t    dir,
+                       hipsparseOperation_t    transA,
+                       hipsparseOperation_t    transB,
+                       T                       alpha,
+                       const std::vector<int>& bsr_row_ptr_A,
+                       const std::vector<int>& bsr_col_ind_A,
+                       const std::vector<T>&   bsr_val_A,
+                       const std::vector<T>&   B,
+                       int                     ldb,
+                       T                       beta,
+                       std::vector<T>&         C,
+                       int                     ldc,
+                       hipsparseIndexBase_t    base)
+{
+    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return;
+    }
+
+    if(transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && transB != HIPSPARSE_OPERATION_TRANSPOSE)
+    {
+        return;
+    }
+
+    hipsparse::bsr_view<int, int> A = {Mb,
+                                       block_dim,
+                                       dir == HIPSPARSE_DIRECTION_ROW,
+                                       bsr_row_ptr_A.data(),
+                                       bsr_row_ptr_A.data() + 1,
+                                       bsr_col_ind_A.data(),
+                                       base,
+                                       bsr_val_A.data()};
+
+    hipsparse::host_bsrmm(A,
+                          N,
+                          alpha,
+                          B.data(),
+                          ldb,
+                          transB == HIPSPARSE_OPERATION_TRANSPOSE,
+                          beta,
+                          C.data(),
+                          ldc);
+}
+
+#endif // HOST_BSRMM_HPP
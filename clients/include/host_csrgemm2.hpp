@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HOST_CSRGEMM2_HPP
+#define HOST_CSRGEMM2_HPP
+
+#include "host_csrgemm.hpp"
+#include "host_csrmv.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+/*!\file
+ * \brief Host reference of csrgemm2 and SpGEMM, C = alpha * A * B + beta * D. It runs the
+ * CPU SpGEMM of the host backend, with hash or sort accumulators per row and a schedule
+ * weighted by the number of products per row. A nullptr alpha drops the product, a
+ * nullptr beta drops D.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Compute sparse matrix sparse matrix multiplication. */
+template <typename I, typename J, typename T>
+static I csrgemm2_nnz(J                    m,
+                      J                    n,
+                      J                    k,
+                      const T*             alpha,
+                      const I*             csr_row_ptr_A,
+                      const J*             csr_col_ind_A,
+                      const I*             csr_row_ptr_B,
+                      const J*             csr_col_ind_B,
+                      const T*             beta,
+                      const I*             csr_row_ptr_D,
+                      const J*             csr_col_ind_D,
+                      I*                   csr_row_ptr_C,
+                      hipsparseIndexBase_t idx_base_A,
+                      hipsparseIndexBase_t idx_base_B,
+                      hipsparseIndexBase_t idx_base_C,
+                      hipsparseIndexBase_t idx_base_D)
+{
+    hipsparse::csr_view<I, J> A = {
+        m, k, csr_row_ptr_A, csr_col_ind_A, nullptr, idx_base_A, idx_base_A, nullptr};
+    hipsparse::csr_view<I, J> B = {
+        k, n, csr_row_ptr_B, csr_col_ind_B, nullptr, idx_base_B, idx_base_B, nullptr};
+    hipsparse::csr_view<I, J> D = {
+        m, n, csr_row_ptr_D, csr_col_ind_D, nullptr, idx_base_D, idx_base_D, nullptr};
+
+    hipsparse::host_csrgemm_nnz(static_cast<int64_t>(m),
+                                alpha ? &A : nullptr,
+                                B,
+                                beta ? &D : nullptr,
+                                csr_row_ptr_C + 1);
+
+    // Scan to obtain row offsets
+    csr_row_ptr_C[0] = idx_base_C;
+
+    for(J i = 0; i < m; ++i)
+    {
+        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+    }
+
+    return csr_row_ptr_C[m] - idx_base_C;
+}
+
+template <typename I, typename J, typename T>
+static void csrgemm2(J                    m,
+                     J                    n,
+                     J                    k,
+                     const T*             alpha,
+                     const I*             csr_row_ptr_A,
+                     const J*             csr_col_ind_A,
+                     const T*             csr_val_A,
+                     const I*             csr_row_ptr_B,
+                     const J*             csr_col_ind_B,
+                     const T*             csr_val_B,
+                     const T*             beta,
+                     const I*             csr_row_ptr_D,
+                     const J*             csr_col_ind_D,
+                     const T*             csr_val_D,
+                     const I*             csr_row_ptr_C,
+                     J*                   csr_col_ind_C,
+                     T*                   csr_val_C,
+                     hipsparseIndexBase_t idx_base_A,
+                     hipsparseIndexBase_t idx_base_B,
+                     hipsparseIndexBase_t idx_base_C,
+                     hipsparseIndexBase_t idx_base_D)
+{
+    hipsparse::csr_view<I, J> A = {
+        m, k, csr_row_ptr_A, csr_col_ind_A, nullptr, idx_base_A, idx_base_A, csr_val_A};
+    hipsparse::csr_view<I, J> B = {
+        k, n, csr_row_ptr_B, csr_col_ind_B, nullptr, idx_base_B, idx_base_B, csr_val_B};
+    hipsparse::csr_view<I, J> D = {
+        m, n, csr_row_ptr_D, csr_col_ind_D, nullptr, idx_base_D, idx_base_D, csr_val_D};
+
+    hipsparse::host_csrgemm(static_cast<int64_t>(m),
+                            alpha ? &A : nullptr,
+                            B,
+                            beta ? &D : nullptr,
+                            alpha ? *alpha : T(),
+                            beta ? *beta : T(),
+                            csr_row_ptr_C,
+                            static_cast<int64_t>(idx_base_C),
+                            csr_col_ind_C,
+                            csr_val_C);
+}
+
+#endif // HOST_CSRGEMM2_HPP
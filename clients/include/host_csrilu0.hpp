@@ -0,0 +1,885 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HOST_CSRILU0_HPP
+#define HOST_CSRILU0_HPP
+
+#include "host_csrmv.hpp"
+#include "host_csrsv.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <hipsparse.h>
+#include <limits>
+#include <vector>
+
+/*!\file
+ * \brief Host references of the incomplete factorizations (csrilu02, csric02, bsrilu02 and
+ * bsric02). Rows are factored in parallel, following the level sets of the strictly lower
+ * triangle of the pattern, which is also what the triangular solves use. The analysis of the
+ * pattern is kept in host_ilu0_info, such that repeated factorizations of matrices with the
+ * same pattern only pay for the numeric phase.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Symbolic analysis of a CSR or BSR pattern for the incomplete factorizations.
+ *  A row depends on all rows of the entries in its strictly lower part, used marks the rows
+ *  whose diagonal entry is used for the elimination of a later row. */
+struct host_ilu0_info
+{
+    hipsparse::csrsv_info levels;
+    std::vector<char>     used;
+};
+
+template <typename I, typename J>
+void host_ilu0_analysis(
+    J m, const I* ptr, const J* col, hipsparseIndexBase_t base, host_ilu0_info& info)
+{
+    hipsparse::csr_view<I, J> A = {m, m, ptr, col, nullptr, base, base, nullptr};
+
+    hipsparse::host_csrsv_analysis(A, true, info.levels);
+
+    info.used.assign(m, 0);
+
+    for(J i = 0; i < m; ++i)
+    {
+        for(I j = ptr[i] - base; j < ptr[i + 1] - base && col[j] - base < i; ++j)
+        {
+            info.used[col[j] - base] = 1;
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Incomplete LU factorization with zero fill-in, in place. Returns the lowest
+ *  structural or numerical zero pivot, -1 if there is none. With boost, a diagonal entry
+ *  whose modulus does not exceed boost_tol is replaced by boost_val before it is used. */
+template <typename T>
+int csrilu0(const host_ilu0_info& info,
+            int                   m,
+            const int*            ptr,
+            const int*            col,
+            T*                    val,
+            hipsparseIndexBase_t  idx_base,
+            bool                  boost,
+            double                boost_tol,
+            T                     boost_val)
+{
+    hipsparse::csr_view<int, int> A = {m, m, ptr, col, nullptr, idx_base, idx_base, val};
+
+    // pointer of upper part of each row
+    std::vector<int> diag_offset(m, -1);
+
+    // First zero pivot of each row, the factorization stops at the lowest one
+    std::vector<int> pivot(m, -1);
+
+    std::vector<std::vector<int>> nnz_entries(hipsparse::csrsv_max_threads());
+
+    hipsparse::csrsv_schedule(info.levels, A, [&](int64_t i, int tid) {
+        std::vector<int>& entries = nnz_entries[tid];
+        entries.resize(m, -1);
+
+        int ai        = static_cast<int>(i);
+        int row_start = ptr[ai] - idx_base;
+        int row_end   = ptr[ai + 1] - idx_base;
+        int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_start; j < row_end; ++j)
+        {
+            entries[col[j] - idx_base] = j;
+        }
+
+        bool has_diag = false;
+
+        // loop over lower part of ai-th row
+        for(j = row_start; j < row_end; ++j)
+        {
+            int col_j = col[j] - idx_base;
+
+            if(col_j >= ai)
+            {
+                has_diag = (col_j == ai);
+                break;
+            }
+
+            // Rows without diagonal entry are pivots themselves
+            int diag_j = diag_offset[col_j];
+            if(diag_j == -1)
+            {
+                continue;
+            }
+
+            T diag_val = val[diag_j];
+
+            // Check for numeric pivot
+            if(!boost && diag_val == make_DataType<T>(0.0))
+            {
+                pivot[ai] = (pivot[ai] == -1) ? col_j : pivot[ai];
+                continue;
+            }
+
+            // multiplication factor
+            val[j] = val[j] / diag_val;
+
+            // loop over upper offset pointer and do linear combination for nnz entry
+            for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+            {
+                int idx = entries[col[k] - idx_base];
+
+                if(idx != -1)
+                {
+                    val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
+                }
+            }
+        }
+
+        if(has_diag)
+        {
+            // The diagonal entry is final now, boost it before any later row uses it
+            if(boost && info.used[ai])
+            {
+                val[j] = (boost_tol >= testing_abs(val[j])) ? boost_val : val[j];
+            }
+
+            diag_offset[ai] = j;
+        }
+        else if(pivot[ai] == -1)
+        {
+            // Structural zero diagonal
+            pivot[ai] = ai;
+        }
+
+        // clear nnz entries
+        for(j = row_start; j < row_end; ++j)
+        {
+            entries[col[j] - idx_base] = -1;
+        }
+    });
+
+    for(int ai = 0; ai < m; ++ai)
+    {
+        if(pivot[ai] != -1)
+        {
+            return pivot[ai] + idx_base;
+        }
+    }
+
+    return -1;
+}
+
+template <typename T>
+int csrilu0(int                  m,
+            const int*           ptr,
+            const int*           col,
+            T*                   val,
+            hipsparseIndexBase_t idx_base,
+            bool                 boost,
+            double               boost_tol,
+            T                    boost_val)
+{
+    host_ilu0_info info;
+    host_ilu0_analysis(m, ptr, col, idx_base, info);
+
+    return csrilu0(info, m, ptr, col, val, idx_base, boost, boost_tol, boost_val);
+}
+
+/* ============================================================================================ */
+/*! \brief  Incomplete Cholesky factorization with zero fill-in of the lower triangle, in
+ *  place. A row without diagonal entry is reported as structural and numeric pivot, a zero
+ *  diagonal entry used by a later row as numeric pivot. */
+template <typename T>
+void csric0(const host_ilu0_info& info,
+            int                   M,
+            const int*            csr_row_ptr,
+            const int*            csr_col_ind,
+            T*                    csr_val,
+            hipsparseIndexBase_t  idx_base,
+            int&                  struct_pivot,
+            int&                  numeric_pivot)
+{
+    hipsparse::csr_view<int, int> A
+        = {M, M, csr_row_ptr, csr_col_ind, nullptr, idx_base, idx_base, csr_val};
+
+    // Initialize pivot
+    struct_pivot  = -1;
+    numeric_pivot = -1;
+
+    // pointer of upper part of each row
+    std::vector<int> diag_offset(M, -1);
+
+    // First zero pivot of each row, the row itself if it has no diagonal entry
+    std::vector<int> pivot(M, -1);
+
+    std::vector<std::vector<int>> nnz_entries(hipsparse::csrsv_max_threads());
+
+    hipsparse::csrsv_schedule(info.levels, A, [&](int64_t i, int tid) {
+        std::vector<int>& entries = nnz_entries[tid];
+        entries.resize(M, -1);
+
+        int ai        = static_cast<int>(i);
+        int row_begin = csr_row_ptr[ai] - idx_base;
+        int row_end   = csr_row_ptr[ai + 1] - idx_base;
+        int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_begin; j < row_end; ++j)
+        {
+            entries[csr_col_ind[j] - idx_base] = j;
+        }
+
+        T sum = make_DataType<T>(0.0);
+
+        bool has_diag = false;
+
+        // loop over lower part of ai-th row
+        for(j = row_begin; j < row_end; ++j)
+        {
+            int col_j = csr_col_ind[j] - idx_base;
+
+            if(col_j >= ai)
+            {
+                has_diag = (col_j == ai);
+                break;
+            }
+
+            // Rows without diagonal entry are pivots themselves
+            int row_diag_j = diag_offset[col_j];
+            if(row_diag_j == -1)
+            {
+                continue;
+            }
+
+            T inv_diag = csr_val[row_diag_j];
+
+            // Check for numeric zero
+            if(inv_diag == make_DataType<T>(0.0))
+            {
+                pivot[ai] = (pivot[ai] == -1) ? col_j : pivot[ai];
+                continue;
+            }
+
+            inv_diag = make_DataType<T>(1.0) / inv_diag;
+
+            T local_sum = make_DataType<T>(0.0);
+
+            // loop over upper offset pointer and do linear combination for nnz entry
+            for(int k = csr_row_ptr[col_j] - idx_base; k < row_diag_j; ++k)
+            {
+                int idx = entries[csr_col_ind[k] - idx_base];
+
+                if(idx != -1)
+                {
+                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
+                }
+            }
+
+            T val_j = (csr_val[j] - local_sum) * inv_diag;
+            sum     = testing_fma(val_j, testing_conj(val_j), sum);
+
+            csr_val[j] = val_j;
+        }
+
+        if(has_diag)
+        {
+            // Process diagonal entry
+            csr_val[j] = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
+
+            diag_offset[ai] = j;
+        }
+        else if(pivot[ai] == -1)
+        {
+            // Structural (and numerical) zero diagonal
+            pivot[ai] = ai;
+        }
+
+        // clear nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            entries[csr_col_ind[j] - idx_base] = -1;
+        }
+    });
+
+    for(int ai = 0; ai < M; ++ai)
+    {
+        if(pivot[ai] != -1)
+        {
+            numeric_pivot = pivot[ai] + idx_base;
+            struct_pivot  = (pivot[ai] == ai) ? numeric_pivot : -1;
+
+            return;
+        }
+    }
+}
+
+template <typename T>
+void csric0(int                  M,
+            const int*           csr_row_ptr,
+            const int*           csr_col_ind,
+            T*                   csr_val,
+            hipsparseIndexBase_t idx_base,
+            int&                 struct_pivot,
+            int&                 numeric_pivot)
+{
+    host_ilu0_info info;
+    host_ilu0_analysis(M, csr_row_ptr, csr_col_ind, idx_base, info);
+
+    csric0(info, M, csr_row_ptr, csr_col_ind, csr_val, idx_base, struct_pivot, numeric_pivot);
+}
+
+/* ============================================================================================ */
+/*! \brief  Block incomplete LU factorization with zero fill-in, in place. info is the
+ *  analysis of the block pattern. The factorization stops at the lowest block row without
+ *  diagonal block, which is reported in struct_pivot. */
+template <typename T>
+inline void host_bsrilu02(const host_ilu0_info&   info,
+                          hipsparseDirection_t    dir,
+                          int                     mb,
+                          int                     bsr_dim,
+                          const std::vector<int>& bsr_row_ptr,
+                          const std::vector<int>& bsr_col_ind,
+                          std::vector<T>&         bsr_val,
+                          hipsparseIndexBase_t    base,
+                          int*                    struct_pivot,
+                          int*                    numeric_pivot,
+                          bool                    boost,
+                          double                  boost_tol,
+                          T                       boost_val)
+{
+    hipsparse::csr_view<int, int> A = {
+        mb, mb, bsr_row_ptr.data(), bsr_col_ind.data(), nullptr, base, base, bsr_val.data()};
+
+    // Offset of the diagonal BSR block of each row. The factorization stops at the first
+    // row without diagonal block.
+    std::vector<int> diag_offset(mb, -1);
+    int              last = mb;
+
+    for(int i = 0; i < mb && last == mb; ++i)
+    {
+        for(int j = bsr_row_ptr[i] - base; j < bsr_row_ptr[i + 1] - base; ++j)
+        {
+            if(bsr_col_ind[j] - base >= i)
+            {
+                diag_offset[i] = (bsr_col_ind[j] - base == i) ? j : -1;
+                break;
+            }
+        }
+
+        last = (diag_offset[i] == -1) ? i : mb;
+    }
+
+    std::vector<char>             zero_pivot(mb, 0);
+    std::vector<std::vector<int>> nnz_entries(hipsparse::csrsv_max_threads());
+
+    hipsparse::csrsv_schedule(info.levels, A, [&](int64_t row, int tid) {
+        int i = static_cast<int>(row);
+
+        if(i > last)
+        {
+            return;
+        }
+
+        std::vector<int>& entries = nnz_entries[tid];
+        entries.resize(mb, -1);
+
+        // BSR column entry and exit point
+        int row_begin = bsr_row_ptr[i] - base;
+        int row_end   = bsr_row_ptr[i + 1] - base;
+        int row_diag  = diag_offset[i];
+
+        int j;
+
+        // Set up entry points for linear combination
+        for(j = row_begin; j < row_end; ++j)
+        {
+            int col_j      = bsr_col_ind[j] - base;
+            entries[col_j] = j;
+        }
+
+        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
+        for(j = row_begin; j < row_end; ++j)
+        {
+            // Column index of current BSR block
+            int bsr_col = bsr_col_ind[j] - base;
+
+            // Skip the diagonal and all upper matrix blocks
+            if(bsr_col >= i)
+            {
+                break;
+            }
+
+            // Obtain corresponding row entry and exit point that corresponds with the
+            // current BSR column. Actually, we skip all lower matrix column indices,
+            // therefore starting with the diagonal entry.
+            int diag_j    = diag_offset[bsr_col];
+            int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+
+            // Loop through all rows within the BSR block
+            for(int bi = 0; bi < bsr_dim; ++bi)
+            {
+                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+
+                // Process all rows within the BSR block
+                for(int bk = 0; bk < bsr_dim; ++bk)
+                {
+                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                    // Multiplication factor
+                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = val / diag;
+
+                    // Loop through columns of bk-th row and do linear combination
+                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                    {
+                        bsr_val[BSR_IND(j, bk, bj, dir)]
+                            = testing_fma(-val,
+                                          bsr_val[BSR_IND(diag_j, bi, bj, dir)],
+                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                    }
+                }
+            }
+
+            // Loop over upper offset pointer and do linear combination for nnz entry
+            for(int k = diag_j + 1; k < row_end_j; ++k)
+            {
+                int m = entries[bsr_col_ind[k] - base];
+
+                if(m != -1)
+                {
+                    // Loop through all rows within the BSR block
+                    for(int bi = 0; bi < bsr_dim; ++bi)
+                    {
+                        // Loop through columns of bi-th row and do linear combination
+                        for(int bj = 0; bj < bsr_dim; ++bj)
+                        {
+                            T sum = make_DataType<T>(0);
+
+                            for(int bk = 0; bk < bsr_dim; ++bk)
+                            {
+                                sum = testing_fma(bsr_val[BSR_IND(j, bi, bk, dir)],
+                                                  bsr_val[BSR_IND(k, bk, bj, dir)],
+                                                  sum);
+                            }
+
+                            bsr_val[BSR_IND(m, bi, bj, dir)]
+                                = bsr_val[BSR_IND(m, bi, bj, dir)] - sum;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Process diagonal, loop through all rows within the BSR block. The row without
+        // diagonal block only gets its lower part eliminated.
+        for(int bi = 0; bi < bsr_dim && i < last; ++bi)
+        {
+            T diag = bsr_val[BSR_IND(row_diag, bi, bi, dir)];
+
+            if(boost)
+            {
+                diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
+                bsr_val[BSR_IND(row_diag, bi, bi, dir)] = diag;
+            }
+            else
+            {
+                // Check for numeric pivot
+                if(diag == make_DataType<T>(0))
+                {
+                    zero_pivot[i] = 1;
+                    continue;
+                }
+            }
+
+            // Process all rows within the BSR block after bi-th row
+            for(int bk = bi + 1; bk < bsr_dim; ++bk)
+            {
+                T val = bsr_val[BSR_IND(row_diag, bk, bi, dir)];
+
+                // Multiplication factor
+                bsr_val[BSR_IND(row_diag, bk, bi, dir)] = val = val / diag;
+
+                // Loop through remaining columns of bk-th row and do linear combination
+                for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                {
+                    bsr_val[BSR_IND(row_diag, bk, bj, dir)]
+                        = testing_fma(-val,
+                                      bsr_val[BSR_IND(row_diag, bi, bj, dir)],
+                                      bsr_val[BSR_IND(row_diag, bk, bj, dir)]);
+                }
+            }
+        }
+
+        // Process upper diagonal BSR blocks
+        for(j = row_diag + 1; j < row_end && i < last; ++j)
+        {
+            // Loop through all rows within the BSR block
+            for(int bi = 0; bi < bsr_dim; ++bi)
+            {
+                // Process all rows within the BSR block after bi-th row
+                for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                {
+                    // Loop through columns of bk-th row and do linear combination
+                    for(int bj = 0; bj < bsr_dim; ++bj)
+                    {
+                        bsr_val[BSR_IND(j, bk, bj, dir)]
+                            = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
+                                          bsr_val[BSR_IND(j, bi, bj, dir)],
+                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                    }
+                }
+            }
+        }
+
+        // Reset entry points
+        for(j = row_begin; j < row_end; ++j)
+        {
+            int col_j      = bsr_col_ind[j] - base;
+            entries[col_j] = -1;
+        }
+    });
+
+    *struct_pivot  = (last < mb) ? last + base : -1;
+    *numeric_pivot = -1;
+
+    for(int i = 0; i < last; ++i)
+    {
+        if(zero_pivot[i])
+        {
+            *numeric_pivot = i + base;
+            break;
+        }
+    }
+}
+
+template <typename T>
+inline void host_bsrilu02(hipsparseDirection_t    dir,
+                          int                     mb,
+                          int                     bsr_dim,
+                          const std::vector<int>& bsr_row_ptr,
+                          const std::vector<int>& bsr_col_ind,
+                          std::vector<T>&         bsr_val,
+                          hipsparseIndexBase_t    base,
+                          int*                    struct_pivot,
+                          int*                    numeric_pivot,
+                          bool                    boost,
+                          double                  boost_tol,
+                          T                       boost_val)
+{
+    host_ilu0_info info;
+    host_ilu0_analysis(mb, bsr_row_ptr.data(), bsr_col_ind.data(), base, info);
+
+    host_bsrilu02(info,
+                  dir,
+                  mb,
+                  bsr_dim,
+                  bsr_row_ptr,
+                  bsr_col_ind,
+                  bsr_val,
+                  base,
+                  struct_pivot,
+                  numeric_pivot,
+                  boost,
+                  boost_tol,
+                  boost_val);
+}
+
+/* ============================================================================================ */
+/*! \brief  Block incomplete Cholesky factorization with zero fill-in, in place. info is the
+ *  analysis of the block pattern, the rows of a block row are factored one after another. */
+template <typename T>
+inline void host_bsric02(const host_ilu0_info&   info,
+                         hipsparseDirection_t    direction,
+                         int                     Mb,
+                         int                     block_dim,
+                         const std::vector<int>& bsr_row_ptr,
+                         const std::vector<int>& bsr_col_ind,
+                         std::vector<T>&         bsr_val,
+                         hipsparseIndexBase_t    base,
+                         int*                    struct_pivot,
+                         int*                    numeric_pivot)
+{
+    int M = Mb * block_dim;
+
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    if(bsr_col_ind.size() == 0 && bsr_val.size() == 0)
+    {
+        return;
+    }
+
+    hipsparse::csr_view<int, int> A = {
+        Mb, Mb, bsr_row_ptr.data(), bsr_col_ind.data(), nullptr, base, base, bsr_val.data()};
+
+    // pointer of upper part of each row
+    std::vector<int> diag_block_offset(Mb);
+    std::vector<int> diag_offset(M, -1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < Mb; i++)
+    {
+        int row_begin = bsr_row_ptr[i] - base;
+        int row_end   = bsr_row_ptr[i + 1] - base;
+
+        for(int j = row_begin; j < row_end; j++)
+        {
+            if(bsr_col_ind[j] - base == i)
+            {
+                diag_block_offset[i] = j;
+                break;
+            }
+        }
+    }
+
+    // Lowest pivots found in each block row
+    std::vector<int> block_struct_pivot(Mb, -1);
+    std::vector<int> block_numeric_pivot(Mb, std::numeric_limits<int>::max());
+
+    std::vector<std::vector<int>> nnz_entries(hipsparse::csrsv_max_threads());
+
+    hipsparse::csrsv_schedule(info.levels, A, [&](int64_t block_row, int tid) {
+        std::vector<int>& entries = nnz_entries[tid];
+        entries.resize(M, -1);
+
+        int  bi            = static_cast<int>(block_row);
+        int& numeric_pivot = block_numeric_pivot[bi];
+
+        int row_begin = bsr_row_ptr[bi] - base;
+        int row_end   = bsr_row_ptr[bi + 1] - base;
+
+        for(int i = bi * block_dim; i < (bi + 1) * block_dim; i++)
+        {
+            int local_row = i % block_dim;
+
+            for(int j = row_begin; j < row_end; j++)
+            {
+                int block_col_j = bsr_col_ind[j] - base;
+
+                for(int k = 0; k < block_dim; k++)
+                {
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
+                    {
+                        entries[block_dim * block_col_j + k]
+                            = block_dim * block_dim * j + block_dim * local_row + k;
+                    }
+                    else
+                    {
+                        entries[block_dim * block_col_j + k]
+                            = block_dim * block_dim * j + block_dim * k + local_row;
+                    }
+                }
+            }
+
+            T   sum            = make_DataType<T>(0);
+            int diag_val_index = -1;
+
+            bool has_diag         = false;
+            bool break_outer_loop = false;
+
+            for(int j = row_begin; j < row_end; j++)
+            {
+                int block_col_j = bsr_col_ind[j] - base;
+
+                for(int k = 0; k < block_dim; k++)
+                {
+                    int col_j = block_dim * block_col_j + k;
+
+                    // Mark diagonal and skip row
+                    if(col_j == i)
+                    {
+                        diag_val_index = block_dim * block_dim * j + block_dim * k + k;
+
+                        has_diag         = true;
+                        break_outer_loop = true;
+                        break;
+                    }
+
+                    // Skip upper triangular
+                    if(col_j > i)
+                    {
+                        break_outer_loop = true;
+                        break;
+                    }
+
+                    T val_j;
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
+                    {
+                        val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
+                    }
+                    else
+                    {
+                        val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
+                    }
+
+                    int local_row_j = col_j % block_dim;
+
+                    int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
+                    int row_end_j   = diag_block_offset[col_j / block_dim];
+                    int row_diag_j  = diag_offset[col_j];
+
+                    T local_sum = make_DataType<T>(0);
+                    T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : make_DataType<T>(0);
+
+                    // Check for numeric zero
+                    if(inv_diag == make_DataType<T>(0))
+                    {
+                        // Numerical non-invertible block diagonal
+                        numeric_pivot = std::min(numeric_pivot, block_col_j + base);
+
+                        inv_diag = make_DataType<T>(1);
+                    }
+
+                    inv_diag = make_DataType<T>(1) / inv_diag;
+
+                    // loop over upper offset pointer and do linear combination for nnz entry
+                    for(int l = row_begin_j; l < row_end_j + 1; l++)
+                    {
+                        int block_col_l = bsr_col_ind[l] - base;
+
+                        for(int m = 0; m < block_dim; m++)
+                        {
+                            int idx = entries[block_dim * block_col_l + m];
+
+                            if(idx != -1 && block_dim * block_col_l + m < col_j)
+                            {
+                                if(direction == HIPSPARSE_DIRECTION_ROW)
+                                {
+                                    local_sum = testing_fma(
+                                        bsr_val[block_dim * block_dim * l + block_dim * local_row_j
+                                                + m],
+                                        testing_conj(bsr_val[idx]),
+                                        local_sum);
+                                }
+                                else
+                                {
+                                    local_sum = testing_fma(
+                                        bsr_val[block_dim * block_dim * l + block_dim * m
+                                                + local_row_j],
+                                        testing_conj(bsr_val[idx]),
+                                        local_sum);
+                                }
+                            }
+                        }
+                    }
+
+                    val_j = (val_j - local_sum) * inv_diag;
+                    sum   = testing_fma(val_j, testing_conj(val_j), sum);
+
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
+                    {
+                        bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
+                    }
+                    else
+                    {
+                        bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
+                    }
+                }
+
+                if(break_outer_loop)
+                {
+                    break;
+                }
+            }
+
+            if(!has_diag)
+            {
+                // Structural missing block diagonal
+                block_struct_pivot[bi] = bi + base;
+            }
+
+            // Process diagonal entry
+            if(has_diag)
+            {
+                T diag_entry
+                    = make_DataType<T>(std::sqrt(testing_abs(bsr_val[diag_val_index] - sum)));
+                bsr_val[diag_val_index] = diag_entry;
+
+                if(diag_entry == make_DataType<T>(0))
+                {
+                    // Numerical non-invertible block diagonal
+                    numeric_pivot = std::min(numeric_pivot, bi + base);
+                }
+
+                // Store diagonal offset
+                diag_offset[i] = diag_val_index;
+            }
+
+            for(int j = row_begin; j < row_end; j++)
+            {
+                int block_col_j = bsr_col_ind[j] - base;
+
+                for(int k = 0; k < block_dim; k++)
+                {
+                    entries[block_dim * block_col_j + k] = -1;
+                }
+            }
+        }
+    });
+
+    for(int bi = 0; bi < Mb; bi++)
+    {
+        if(*struct_pivot == -1)
+        {
+            *struct_pivot = block_struct_pivot[bi];
+        }
+
+        if(block_numeric_pivot[bi] != std::numeric_limits<int>::max())
+        {
+            *numeric_pivot = (*numeric_pivot == -1)
+                                 ? block_numeric_pivot[bi]
+                                 : std::min(*numeric_pivot, block_numeric_pivot[bi]);
+        }
+    }
+}
+
+template <typename T>
+inline void host_bsric02(hipsparseDirection_t    direction,
+                         int                     Mb,
+                         int                     block_dim,
+                         const std::vector<int>& bsr_row_ptr,
+                         const std::vector<int>& bsr_col_ind,
+                         std::vector<T>&         bsr_val,
+                         hipsparseIndexBase_t    base,
+                         int*                    struct_pivot,
+                         int*                    numeric_pivot)
+{
+    host_ilu0_info info;
+    host_ilu0_analysis(Mb, bsr_row_ptr.data(), bsr_col_ind.data(), base, info);
+
+    host_bsric02(info,
+                 direction,
+                 Mb,
+                 block_dim,
+                 bsr_row_ptr,
+                 bsr_col_ind,
+                 bsr_val,
+                 base,
+                 struct_pivot,
+                 numeric_pivot);
+}
+
+#endif // HOST_CSRILU0_HPP
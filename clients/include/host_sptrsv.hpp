@@ -0,0 +1,584 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HOST_SPTRSV_HPP
+#define HOST_SPTRSV_HPP
+
+#include "host_csrmv.hpp"
+#include "host_csrsv.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <limits>
+#include <vector>
+
+/*!\file
+ * \brief Host references of the sparse triangular solves (csrsv2, csrsm2, SpSV and SpSM).
+ * Rows are solved in the order of the level set analysis of the host backend, in parallel
+ * where the dependencies allow it. Each row is computed with the arithmetic of the device
+ * kernels, such that the results can be compared within a few ulp: the products of a row
+ * are accumulated with fma by wf_size lanes, the lanes are summed up as a tree and the sum
+ * is multiplied by the reciprocal of the diagonal entry. Transposed solves work on an
+ * explicit transpose of the matrix.
+ */
+
+// Wavefront size of the current device
+inline unsigned int host_sptrsv_wf_size()
+{
+    int             dev;
+    hipDeviceProp_t prop;
+
+    hipGetDevice(&dev);
+    hipGetDeviceProperties(&prop, dev);
+
+    return prop.warpSize;
+}
+
+/* ============================================================================================ */
+/*! \brief  Solve the lower or upper triangle of A * Y = Y in place for nrhs right hand sides,
+ *  where y(i, r) holds the right hand side r on entry. The lowest rows with a missing or
+ *  zero diagonal entry are reported in struct_pivot and numeric_pivot, if they are lower
+ *  than the values passed in. A zero diagonal entry is treated as one. */
+template <typename I, typename J, typename T, typename Y>
+static void host_csrtrsv(J                    M,
+                         J                    nrhs,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         const T*             csr_val,
+                         bool                 lower,
+                         hipsparseDiagType_t  diag_type,
+                         hipsparseIndexBase_t base,
+                         unsigned int         wf_size,
+                         J*                   struct_pivot,
+                         J*                   numeric_pivot,
+                         Y                    y)
+{
+    hipsparse::csr_view<I, J> A = {M, M, csr_row_ptr, csr_col_ind, nullptr, base, base, csr_val};
+    hipsparse::csrsv_info     info;
+
+    hipsparse::host_csrsv_analysis(A, lower, info);
+
+    // Lanes of each thread
+    std::vector<std::vector<T>> lanes(hipsparse::csrsv_max_threads(), std::vector<T>(wf_size));
+
+    hipsparse::csrsv_schedule(info, A, [&](int64_t i, int tid) {
+        std::vector<T>& temp = lanes[tid];
+
+        J row       = static_cast<J>(i);
+        I row_begin = csr_row_ptr[row] - base;
+        I row_end   = csr_row_ptr[row + 1] - base;
+
+        // Reciprocal of the diagonal entry, zero if the row has none
+        T diag_val = make_DataType<T>(0.0);
+
+        if(info.diag[row] >= 0)
+        {
+            T val    = csr_val[info.diag[row]];
+            diag_val = make_DataType<T>(1.0)
+                       / ((val == make_DataType<T>(0.0)) ? make_DataType<T>(1.0) : val);
+        }
+
+        for(J r = 0; r < nrhs; ++r)
+        {
+            temp.assign(wf_size, make_DataType<T>(0.0));
+            temp[0] = y(row, r);
+
+            if(lower)
+            {
+                // Entries up to the diagonal, in row order
+                for(I l = row_begin; l < row_end; l += wf_size)
+                {
+                    for(unsigned int k = 0; k < wf_size; ++k)
+                    {
+                        I j = l + k;
+
+                        if(j >= row_end)
+                        {
+                            break;
+                        }
+
+                        J local_col = csr_col_ind[j] - base;
+
+                        if(local_col >= row)
+                        {
+                            break;
+                        }
+
+                        temp[k] = testing_fma(testing_neg(csr_val[j]), y(local_col, r), temp[k]);
+                    }
+                }
+            }
+            else
+            {
+                // Entries above the diagonal, in reverse row order
+                for(I l = row_end - 1; l >= row_begin; l -= wf_size)
+                {
+                    for(unsigned int k = 0; k < wf_size; ++k)
+                    {
+                        I j = l - k;
+
+                        if(j < row_begin)
+                        {
+                            break;
+                        }
+
+                        J local_col = csr_col_ind[j] - base;
+
+                        if(local_col <= row)
+                        {
+                            continue;
+                        }
+
+                        temp[k] = testing_fma(testing_neg(csr_val[j]), y(local_col, r), temp[k]);
+                    }
+                }
+            }
+
+            for(unsigned int j = 1; j < wf_size; j <<= 1)
+            {
+                for(unsigned int k = 0; k < wf_size - j; ++k)
+                {
+                    temp[k] = temp[k] + temp[k + j];
+                }
+            }
+
+            y(row, r) = (diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT) ? temp[0] * diag_val : temp[0];
+        }
+    });
+
+    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+    {
+        auto    load = [csr_val](int64_t k) { return csr_val[k]; };
+        int64_t s    = hipsparse::csrsv_struct_pivot(info);
+        int64_t n    = hipsparse::csrsv_numeric_pivot<T>(info, load);
+
+        if(s >= 0)
+        {
+            *struct_pivot = std::min(*struct_pivot, static_cast<J>(s + base));
+        }
+
+        if(n >= 0)
+        {
+            *numeric_pivot = std::min(*numeric_pivot, static_cast<J>(n + base));
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_csrsv(hipsparseOperation_t trans,
+                J                    M,
+                I                    nnz,
+                T                    alpha,
+                const I*             csr_row_ptr,
+                const J*             csr_col_ind,
+                const T*             csr_val,
+                const T*             x,
+                T*                   y,
+                hipsparseDiagType_t  diag_type,
+                hipsparseFillMode_t  fill_mode,
+                hipsparseIndexBase_t base,
+                J*                   struct_pivot,
+                J*                   numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = M + 1;
+    *numeric_pivot = M + 1;
+
+    for(J i = 0; i < M; ++i)
+    {
+        y[i] = alpha * x[i];
+    }
+
+    auto         y_entry = [y](int64_t i, int64_t) -> T& { return y[i]; };
+    unsigned int wf_size = host_sptrsv_wf_size();
+
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        host_csrtrsv(M,
+                     static_cast<J>(1),
+                     csr_row_ptr,
+                     csr_col_ind,
+                     csr_val,
+                     fill_mode == HIPSPARSE_FILL_MODE_LOWER,
+                     diag_type,
+                     base,
+                     wf_size,
+                     struct_pivot,
+                     numeric_pivot,
+                     y_entry);
+    }
+    else if(trans == HIPSPARSE_OPERATION_TRANSPOSE
+            || trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+    {
+        // Transpose matrix
+        std::vector<I> csrt_row_ptr(M + 1);
+        std::vector<J> csrt_col_ind(nnz);
+        std::vector<T> csrt_val(nnz);
+
+        host_csr_to_csc(M,
+                        M,
+                        nnz,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        csrt_col_ind,
+                        csrt_row_ptr,
+                        csrt_val,
+                        HIPSPARSE_ACTION_NUMERIC,
+                        base);
+
+        if(trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        {
+            for(size_t i = 0; i < csrt_val.size(); i++)
+            {
+                csrt_val[i] = testing_conj(csrt_val[i]);
+            }
+        }
+
+        // The transpose of a lower triangular matrix is upper triangular and vice versa
+        host_csrtrsv(M,
+                     static_cast<J>(1),
+                     csrt_row_ptr.data(),
+                     csrt_col_ind.data(),
+                     csrt_val.data(),
+                     fill_mode != HIPSPARSE_FILL_MODE_LOWER,
+                     diag_type,
+                     base,
+                     wf_size,
+                     struct_pivot,
+                     numeric_pivot,
+                     y_entry);
+    }
+
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+
+    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+}
+
+template <typename I, typename T>
+void host_coosv(hipsparseOperation_t  trans,
+                I                     M,
+                I                     nnz,
+                T                     alpha,
+                const std::vector<I>& coo_row_ind,
+                const std::vector<I>& coo_col_ind,
+                const std::vector<T>& coo_val,
+                const std::vector<T>& x,
+                std::vector<T>&       y,
+                hipsparseDiagType_t   diag_type,
+                hipsparseFillMode_t   fill_mode,
+                hipsparseIndexBase_t  base,
+                I*                    struct_pivot,
+                I*                    numeric_pivot)
+{
+    std::vector<I> csr_row_ptr(M + 1);
+
+    // coo2csr on host
+    for(I i = 0; i < nnz; ++i)
+    {
+        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
+    }
+
+    csr_row_ptr[0] = base;
+    for(I i = 0; i < M; ++i)
+    {
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
+    }
+
+    host_csrsv(trans,
+               M,
+               nnz,
+               alpha,
+               csr_row_ptr.data(),
+               coo_col_ind.data(),
+               coo_val.data(),
+               x.data(),
+               y.data(),
+               diag_type,
+               fill_mode,
+               base,
+               struct_pivot,
+               numeric_pivot);
+}
+
+template <typename I, typename J, typename T>
+void host_csrsm(J                     M,
+                J                     nrhs,
+                I                     nnz,
+                hipsparseOperation_t  transA,
+                hipsparseOperation_t  transB,
+                T                     alpha,
+                const std::vector<I>& csr_row_ptr,
+                const std::vector<J>& csr_col_ind,
+                const std::vector<T>& csr_val,
+                std::vector<T>&       B,
+                J                     ldb,
+                hipsparseDiagType_t   diag_type,
+                hipsparseFillMode_t   fill_mode,
+                hipsparseIndexBase_t  base,
+                J*                    struct_pivot,
+                J*                    numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = M + 1;
+    *numeric_pivot = M + 1;
+
+    // Right hand side r is column r of op(B)
+    T*   b       = B.data();
+    auto b_entry = [b, ldb, transB](int64_t i, int64_t r) -> T& {
+        return (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? b[r * ldb + i] : b[i * ldb + r];
+    };
+
+    unsigned int wf_size = host_sptrsv_wf_size();
+
+    for(J r = 0; r < nrhs; ++r)
+    {
+        for(J i = 0; i < M; ++i)
+        {
+            T& entry = b_entry(i, r);
+
+            entry = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+                        ? alpha * testing_conj(entry)
+                        : alpha * entry;
+        }
+    }
+
+    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        host_csrtrsv(M,
+                     nrhs,
+                     csr_row_ptr.data(),
+                     csr_col_ind.data(),
+                     csr_val.data(),
+                     fill_mode == HIPSPARSE_FILL_MODE_LOWER,
+                     diag_type,
+                     base,
+                     wf_size,
+                     struct_pivot,
+                     numeric_pivot,
+                     b_entry);
+    }
+    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE
+            || transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+    {
+        // Transpose matrix
+        std::vector<I> csrt_row_ptr(M + 1);
+        std::vector<J> csrt_col_ind(nnz);
+        std::vector<T> csrt_val(nnz);
+
+        host_csr_to_csc(M,
+                        M,
+                        nnz,
+                        csr_row_ptr.data(),
+                        csr_col_ind.data(),
+                        csr_val.data(),
+                        csrt_col_ind,
+                        csrt_row_ptr,
+                        csrt_val,
+                        HIPSPARSE_ACTION_NUMERIC,
+                        base);
+
+        if(transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        {
+            for(size_t i = 0; i < csrt_val.size(); i++)
+            {
+                csrt_val[i] = testing_conj(csrt_val[i]);
+            }
+        }
+
+        host_csrtrsv(M,
+                     nrhs,
+                     csrt_row_ptr.data(),
+                     csrt_col_ind.data(),
+                     csrt_val.data(),
+                     fill_mode != HIPSPARSE_FILL_MODE_LOWER,
+                     diag_type,
+                     base,
+                     wf_size,
+                     struct_pivot,
+                     numeric_pivot,
+                     b_entry);
+    }
+
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+
+    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+}
+
+template <typename I, typename T>
+void host_coosm(I                     M,
+                I                     nrhs,
+                I                     nnz,
+                hipsparseOperation_t  transA,
+                hipsparseOperation_t  transB,
+                T                     alpha,
+                const std::vector<I>& coo_row_ind,
+                const std::vector<I>& coo_col_ind,
+                const std::vector<T>& coo_val,
+                std::vector<T>&       B,
+                I                     ldb,
+                hipsparseDiagType_t   diag_type,
+                hipsparseFillMode_t   fill_mode,
+                hipsparseIndexBase_t  base,
+                I*                    struct_pivot,
+                I*                    numeric_pivot)
+{
+    std::vector<I> csr_row_ptr(M + 1);
+
+    // coo2csr on host
+    for(I i = 0; i < nnz; ++i)
+    {
+        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
+    }
+
+    csr_row_ptr[0] = base;
+    for(I i = 0; i < M; ++i)
+    {
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
+    }
+
+    host_csrsm(M,
+               nrhs,
+               nnz,
+               transA,
+               transB,
+               alpha,
+               csr_row_ptr,
+               coo_col_ind,
+               coo_val,
+               B,
+               ldb,
+               diag_type,
+               fill_mode,
+               base,
+               struct_pivot,
+               numeric_pivot);
+}
+
+/* ============================================================================================ */
+/*! \brief  Sparse triangular solve of the lower or upper triangle of op(A), as used by
+ *  csrsv2. Returns the lowest row with a missing or zero diagonal entry, or -1. */
+template <typename T>
+static int csr_trsv(hipsparseOperation_t trans,
+                    int                  m,
+                    const int*           ptr,
+                    const int*           col,
+                    const T*             val,
+                    T                    alpha,
+                    const T*             x,
+                    T*                   y,
+                    hipsparseIndexBase_t idx_base,
+                    hipsparseDiagType_t  diag_type,
+                    unsigned int         wf_size,
+                    bool                 lower)
+{
+    const int* csr_row_ptr = ptr;
+    const int* csr_col_ind = col;
+    const T*   csr_val     = val;
+
+    std::vector<int> vptr;
+    std::vector<int> vcol;
+    std::vector<T>   vval;
+
+    if(trans == HIPSPARSE_OPERATION_TRANSPOSE)
+    {
+        int nnz = ptr[m] - idx_base;
+
+        vptr.resize(m + 1);
+        vcol.resize(nnz);
+        vval.resize(nnz);
+
+        // Transpose
+        transpose_csr(
+            m, m, nnz, ptr, col, val, vptr.data(), vcol.data(), vval.data(), idx_base, idx_base);
+
+        csr_row_ptr = vptr.data();
+        csr_col_ind = vcol.data();
+        csr_val     = vval.data();
+    }
+
+    for(int i = 0; i < m; ++i)
+    {
+        y[i] = alpha * x[i];
+    }
+
+    int struct_pivot  = (std::numeric_limits<int>::max)();
+    int numeric_pivot = (std::numeric_limits<int>::max)();
+
+    host_csrtrsv(m,
+                 1,
+                 csr_row_ptr,
+                 csr_col_ind,
+                 csr_val,
+                 lower,
+                 diag_type,
+                 idx_base,
+                 wf_size,
+                 &struct_pivot,
+                 &numeric_pivot,
+                 [y](int64_t i, int64_t) -> T& { return y[i]; });
+
+    int pivot = std::min(struct_pivot, numeric_pivot);
+
+    return (pivot != (std::numeric_limits<int>::max)()) ? pivot : -1;
+}
+
+/*! \brief  Sparse triangular lower solve using CSR storage format. */
+template <typename T>
+int csr_lsolve(hipsparseOperation_t trans,
+               int                  m,
+               const int*           ptr,
+               const int*           col,
+               const T*             val,
+               T                    alpha,
+               const T*             x,
+               T*                   y,
+               hipsparseIndexBase_t idx_base,
+               hipsparseDiagType_t  diag_type,
+               unsigned int         wf_size)
+{
+    return csr_trsv(trans, m, ptr, col, val, alpha, x, y, idx_base, diag_type, wf_size, true);
+}
+
+/*! \brief  Sparse triangular upper solve using CSR storage format. */
+template <typename T>
+int csr_usolve(hipsparseOperation_t trans,
+               int                  m,
+               const int*           ptr,
+               const int*           col,
+               const T*             val,
+               T                    alpha,
+               const T*             x,
+               T*                   y,
+               hipsparseIndexBase_t idx_base,
+               hipsparseDiagType_t  diag_type,
+               unsigned int         wf_size)
+{
+    return csr_trsv(trans, m, ptr, col, val, alpha, x, y, idx_base, diag_type, wf_size, false);
+}
+
+#endif // HOST_SPTRSV_HPP
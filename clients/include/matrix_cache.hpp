@@ -0,0 +1,284 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef MATRIX_CACHE_HPP
+#define MATRIX_CACHE_HPP
+
+#include "csr_bin.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include <typeinfo>
+#include <vector>
+
+/*!\file
+ * \brief Process wide cache of binary CSR matrices. Each file is mapped and verified once,
+ * views with specific index types, value type and index base are derived on first use.
+ * Views are kept until their total size exceeds the limit given in MiB by
+ * HIPSPARSE_TEST_MATRIX_CACHE_SIZE (default 2048, 0 disables caching of views), the least
+ * recently used views are dropped first. Files that change on disk are mapped again.
+ */
+
+/*! \brief  Matrix of a binary CSR file with specific index types, value type and base */
+template <typename I, typename J, typename T>
+struct matrix_cache_view
+{
+    J              m;
+    J              n;
+    I              nnz;
+    std::vector<I> ptr;
+    std::vector<J> col;
+    std::vector<T> val;
+};
+
+class matrix_cache
+{
+public:
+    explicit matrix_cache(size_t limit)
+        : limit_(limit)
+    {
+    }
+
+    matrix_cache(const matrix_cache&) = delete;
+    matrix_cache& operator=(const matrix_cache&) = delete;
+
+    static matrix_cache& instance()
+    {
+        static matrix_cache cache(default_limit());
+        return cache;
+    }
+
+    // Returns nullptr if the file cannot be read or does not fit the requested types
+    template <typename I, typename J, typename T>
+    std::shared_ptr<const matrix_cache_view<I, J, T>> get(const std::string& filename,
+                                                          int                idx_base)
+    {
+        typedef matrix_cache_view<I, J, T> view_type;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        refresh(filename);
+
+        std::string key = filename + "|" + typeid(view_type).name() + "|"
+                          + std::to_string(idx_base);
+
+        auto it = views_.find(key);
+        if(it != views_.end())
+        {
+            ++hits_;
+            it->second.last_use = ++clock_;
+            return std::static_pointer_cast<const view_type>(it->second.data);
+        }
+
+        ++misses_;
+
+        const csr_bin_file* file = open(filename);
+        if(file == nullptr)
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<view_type> view = std::make_shared<view_type>();
+        if(csr_bin_read(
+               *file, idx_base, view->m, view->n, view->nnz, view->ptr, view->col, view->val)
+           != 0)
+        {
+            return nullptr;
+        }
+
+        size_t bytes = sizeof(I) * view->ptr.size() + sizeof(J) * view->col.size()
+                       + sizeof(T) * view->val.size();
+
+        if(bytes <= limit_)
+        {
+            evict(limit_ - bytes);
+
+            entry& e   = views_[key];
+            e.data     = view;
+            e.bytes    = bytes;
+            e.last_use = ++clock_;
+
+            bytes_ += bytes;
+        }
+
+        return view;
+    }
+
+    // Drop all views and close all files
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        views_.clear();
+        files_.clear();
+        bytes_ = 0;
+    }
+
+    size_t bytes() const
+    {
+        return bytes_;
+    }
+
+    size_t hits() const
+    {
+        return hits_;
+    }
+
+    size_t misses() const
+    {
+        return misses_;
+    }
+
+private:
+    struct entry
+    {
+        std::shared_ptr<const void> data;
+        size_t                      bytes;
+        uint64_t                    last_use;
+    };
+
+    static size_t default_limit()
+    {
+        const char* env = getenv("HIPSPARSE_TEST_MATRIX_CACHE_SIZE");
+        size_t      mib = env ? strtoull(env, nullptr, 10) : 2048;
+
+        return mib << 20;
+    }
+
+    struct file_entry
+    {
+        std::unique_ptr<csr_bin_file> file;
+        int64_t                       size;
+        int64_t                       mtime;
+    };
+
+    static bool file_stat(const std::string& filename, int64_t& size, int64_t& mtime)
+    {
+        struct stat st;
+        if(stat(filename.c_str(), &st) != 0)
+        {
+            return false;
+        }
+
+        size  = (int64_t)st.st_size;
+        mtime = (int64_t)st.st_mtime;
+
+        return true;
+    }
+
+    // Drop the file and all its views if it changed since it was mapped
+    void refresh(const std::string& filename)
+    {
+        auto it = files_.find(filename);
+        if(it == files_.end())
+        {
+            return;
+        }
+
+        int64_t size;
+        int64_t mtime;
+        if(file_stat(filename, size, mtime) && size == it->second.size
+           && mtime == it->second.mtime)
+        {
+            return;
+        }
+
+        files_.erase(it);
+
+        std::string prefix = filename + "|";
+        for(auto view = views_.begin(); view != views_.end();)
+        {
+            if(view->first.compare(0, prefix.size(), prefix) == 0)
+            {
+                bytes_ -= view->second.bytes;
+                view = views_.erase(view);
+            }
+            else
+            {
+                ++view;
+            }
+        }
+    }
+
+    // Map and verify a file once, failures are not cached
+    const csr_bin_file* open(const std::string& filename)
+    {
+        auto it = files_.find(filename);
+        if(it != files_.end())
+        {
+            return it->second.file.get();
+        }
+
+        file_entry entry;
+        if(!file_stat(filename, entry.size, entry.mtime))
+        {
+            return nullptr;
+        }
+
+        entry.file.reset(new csr_bin_file(filename.c_str()));
+        if(!entry.file->valid() || !entry.file->verify())
+        {
+            return nullptr;
+        }
+
+        return (files_[filename] = std::move(entry)).file.get();
+    }
+
+    // Drop least recently used views until at most size bytes are cached
+    void evict(size_t size)
+    {
+        while(bytes_ > size)
+        {
+            auto lru = views_.begin();
+            for(auto it = views_.begin(); it != views_.end(); ++it)
+            {
+                if(it->second.last_use < lru->second.last_use)
+                {
+                    lru = it;
+                }
+            }
+
+            bytes_ -= lru->second.bytes;
+            views_.erase(lru);
+        }
+    }
+
+    std::mutex mutex_;
+
+    std::map<std::string, file_entry> files_;
+    std::map<std::string, entry>      views_;
+
+    size_t   limit_;
+    size_t   bytes_  = 0;
+    size_t   hits_   = 0;
+    size_t   misses_ = 0;
+    uint64_t clock_  = 0;
+};
+
+#endif // MATRIX_CACHE_HPP
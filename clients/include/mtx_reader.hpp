@@ -0,0 +1,681 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef MTX_READER_HPP
+#define MTX_READER_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*!\file
+ * \brief MatrixMarket reader for large matrices. The file is memory mapped, split into
+ * chunks at line boundaries and parsed in parallel (if OpenMP is available). This header
+ * does not depend on HIP, such that it can be used by stand alone tools.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Read only view of a whole file, memory mapped where supported */
+class mtx_file_view
+{
+public:
+    explicit mtx_file_view(const char* filename)
+    {
+#ifdef WIN32
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if(!file.is_open())
+        {
+            return;
+        }
+
+        buffer_.resize((size_t)file.tellg());
+        file.seekg(0);
+        if(!file.read(buffer_.data(), buffer_.size()))
+        {
+            return;
+        }
+
+        data_  = buffer_.data();
+        size_  = buffer_.size();
+        valid_ = true;
+#else
+        int fd = open(filename, O_RDONLY);
+        if(fd < 0)
+        {
+            return;
+        }
+
+        struct stat st;
+        if(fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(ptr != MAP_FAILED)
+            {
+                // Pages are read front to back by each thread
+                madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+
+                data_  = (const char*)ptr;
+                size_  = st.st_size;
+                valid_ = true;
+            }
+        }
+
+        close(fd);
+#endif
+    }
+
+    ~mtx_file_view()
+    {
+#ifndef WIN32
+        if(valid_)
+        {
+            munmap((void*)data_, size_);
+        }
+#endif
+    }
+
+    mtx_file_view(const mtx_file_view&) = delete;
+    mtx_file_view& operator=(const mtx_file_view&) = delete;
+
+    bool valid() const
+    {
+        return valid_;
+    }
+
+    const char* begin() const
+    {
+        return data_;
+    }
+
+    const char* end() const
+    {
+        return data_ + size_;
+    }
+
+private:
+    const char* data_  = nullptr;
+    size_t      size_  = 0;
+    bool        valid_ = false;
+#ifdef WIN32
+    std::vector<char> buffer_;
+#endif
+};
+
+/* ============================================================================================ */
+/*! \brief  Bounded number parsing. The file is not null terminated, thus none of the C
+ *  library parsers can be used directly. */
+static inline const char* mtx_skip_blank(const char* p, const char* end)
+{
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+
+    return p;
+}
+
+static inline const char* mtx_next_line(const char* p, const char* end)
+{
+    const char* q = (const char*)memchr(p, '\n', end - p);
+    return (q != nullptr) ? q + 1 : end;
+}
+
+// Returns nullptr if no integer could be parsed
+static inline const char* mtx_parse_int(const char* p, const char* end, int64_t& x)
+{
+    p = mtx_skip_blank(p, end);
+
+    bool neg = (p < end && *p == '-');
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+        ++p;
+    }
+
+    if(p == end || *p < '0' || *p > '9')
+    {
+        return nullptr;
+    }
+
+    x = 0;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        x = x * 10 + (*p - '0');
+        ++p;
+    }
+
+    x = neg ? -x : x;
+
+    return p;
+}
+
+// Returns nullptr if no number could be parsed. Numbers with at most 19 significant
+// digits and a small exponent are converted exactly, all others fall back to strtod.
+static inline const char* mtx_parse_real(const char* p, const char* end, double& x)
+{
+    static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                   1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    p = mtx_skip_blank(p, end);
+
+    const char* token = p;
+
+    bool neg = (p < end && *p == '-');
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int      digits   = 0;
+    int      exponent = 0;
+    bool     any      = false;
+
+    // Leading zeros do not count as significant digits
+    while(p < end && *p == '0')
+    {
+        any = true;
+        ++p;
+    }
+
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        if(digits < 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            ++digits;
+        }
+        else
+        {
+            ++exponent;
+        }
+
+        any = true;
+        ++p;
+    }
+
+    if(p < end && *p == '.')
+    {
+        ++p;
+
+        if(digits == 0)
+        {
+            while(p < end && *p == '0')
+            {
+                --exponent;
+                any = true;
+                ++p;
+            }
+        }
+
+        while(p < end && *p >= '0' && *p <= '9')
+        {
+            if(digits < 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                --exponent;
+                ++digits;
+            }
+
+            any = true;
+            ++p;
+        }
+    }
+
+    if(any && p < end && (*p == 'e' || *p == 'E'))
+    {
+        int64_t     e;
+        const char* q = mtx_parse_int(p + 1, end, e);
+
+        // Exponents must follow the 'e' immediately
+        if(q != nullptr && p + 1 < end && *(p + 1) != ' ' && *(p + 1) != '\t')
+        {
+            exponent += (int)std::max<int64_t>(std::min<int64_t>(e, 100000), -100000);
+            p = q;
+        }
+    }
+
+    bool delimited = (p == end || *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n');
+
+    if(any && delimited && mantissa < (UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22)
+    {
+        x = (exponent < 0) ? (double)mantissa / pow10[-exponent]
+                           : (double)mantissa * pow10[exponent];
+        x = neg ? -x : x;
+
+        return p;
+    }
+
+    // Slow path, e.g. long mantissas, large exponents, inf or nan
+    char        buffer[128];
+    const char* q = token;
+    while(q < end && *q != ' ' && *q != '\t' && *q != '\r' && *q != '\n')
+    {
+        ++q;
+    }
+
+    size_t length = q - token;
+    if(length == 0 || length >= sizeof(buffer))
+    {
+        return nullptr;
+    }
+
+    memcpy(buffer, token, length);
+    buffer[length] = '\0';
+
+    char* stop;
+    x = strtod(buffer, &stop);
+
+    return (stop == buffer + length) ? q : nullptr;
+}
+
+/* ============================================================================================ */
+/*! \brief  Conversion of a parsed value to the value type of the matrix. Overloads for
+ *  complex types are provided where the complex types are known. */
+static inline void mtx_set_value(float& val, double real, double)
+{
+    val = (float)real;
+}
+
+static inline void mtx_set_value(double& val, double real, double)
+{
+    val = real;
+}
+
+enum mtx_symmetry
+{
+    mtx_general,
+    mtx_symmetric,
+    mtx_skew_symmetric,
+    mtx_hermitian
+};
+
+/*! \brief  Qualifiers of a MatrixMarket coordinate matrix */
+struct mtx_banner
+{
+    bool         pattern;
+    bool         complex;
+    mtx_symmetry symmetry;
+};
+
+/* ============================================================================================ */
+/*! \brief  Parse the banner line [p, eol). Returns false if the banner is invalid or not
+ *  supported. */
+static inline bool mtx_parse_banner(const char* p, const char* eol, mtx_banner& banner)
+{
+    std::string line(p, eol);
+    for(char& c : line)
+    {
+        c = tolower(c);
+    }
+
+    char header[32];
+    char array[32];
+    char coord[32];
+    char data[32];
+    char type[32];
+
+    if(sscanf(line.c_str(), "%31s %31s %31s %31s %31s", header, array, coord, data, type) != 5
+       || strcmp(header, "%%matrixmarket") != 0 || strcmp(array, "matrix") != 0
+       || strcmp(coord, "coordinate") != 0)
+    {
+        return false;
+    }
+
+    banner.pattern = !strcmp(data, "pattern");
+    banner.complex = !strcmp(data, "complex");
+
+    if(!banner.pattern && !banner.complex && strcmp(data, "real") != 0
+       && strcmp(data, "integer") != 0)
+    {
+        return false;
+    }
+
+    if(!strcmp(type, "general"))
+    {
+        banner.symmetry = mtx_general;
+    }
+    else if(!strcmp(type, "symmetric"))
+    {
+        banner.symmetry = mtx_symmetric;
+    }
+    else if(!strcmp(type, "skew-symmetric"))
+    {
+        banner.symmetry = mtx_skew_symmetric;
+    }
+    else if(!strcmp(type, "hermitian"))
+    {
+        banner.symmetry = mtx_hermitian;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/*! \brief  Read the banner of a MatrixMarket file. Returns 0 on success. */
+static inline int mtx_read_banner(const char* filename, mtx_banner& banner)
+{
+    mtx_file_view file(filename);
+    if(!file.valid())
+    {
+        return -1;
+    }
+
+    const char* eol = mtx_next_line(file.begin(), file.end());
+
+    return mtx_parse_banner(file.begin(), eol, banner) ? 0 : -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read a MatrixMarket coordinate matrix into COO format, sorted by row and column
+ *  index. All data qualifiers (real, integer, complex, pattern) and all symmetry qualifiers
+ *  (general, symmetric, skew-symmetric, hermitian) are supported, symmetric matrices are
+ *  expanded to general matrices. Complex values are converted to their real part if T is
+ *  a real type. Returns 0 on success. */
+template <typename T>
+int mtx_read_coo(const char*       filename,
+                 int&              nrow,
+                 int&              ncol,
+                 int&              nnz,
+                 std::vector<int>& row,
+                 std::vector<int>& col,
+                 std::vector<T>&   val,
+                 int               idx_base)
+{
+    mtx_file_view file(filename);
+    if(!file.valid())
+    {
+        return -1;
+    }
+
+    const char* p   = file.begin();
+    const char* end = file.end();
+
+    // Banner
+    const char* eol = mtx_next_line(p, end);
+
+    mtx_banner banner;
+    if(!mtx_parse_banner(p, eol, banner))
+    {
+        return -1;
+    }
+
+    bool         pattern  = banner.pattern;
+    bool         complex  = banner.complex;
+    mtx_symmetry symmetry = banner.symmetry;
+
+    // Skip comments and empty lines
+    p = eol;
+    while(p < end)
+    {
+        const char* q = mtx_skip_blank(p, end);
+        if(q < end && *q != '%' && *q != '\n')
+        {
+            break;
+        }
+
+        p = mtx_next_line(p, end);
+    }
+
+    // Dimensions
+    int64_t m64;
+    int64_t n64;
+    int64_t snnz;
+
+    const char* q = mtx_parse_int(p, end, m64);
+    q             = (q != nullptr) ? mtx_parse_int(q, end, n64) : nullptr;
+    q             = (q != nullptr) ? mtx_parse_int(q, end, snnz) : nullptr;
+
+    if(q == nullptr || m64 < 0 || n64 < 0 || snnz < 0 || m64 > INT32_MAX || n64 > INT32_MAX)
+    {
+        return -1;
+    }
+
+    nrow = (int)m64;
+    ncol = (int)n64;
+
+    const char* body = mtx_next_line(q, end);
+
+    // Split the entries into chunks at line boundaries
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+
+    int64_t num_chunks = std::max<int64_t>(
+        1, std::min<int64_t>(num_threads * 8, (end - body) / (1 << 16)));
+
+    std::vector<const char*> chunk(num_chunks + 1);
+
+    chunk[0]          = body;
+    chunk[num_chunks] = end;
+    for(int64_t c = 1; c < num_chunks; ++c)
+    {
+        const char* split = body + (end - body) * c / num_chunks;
+        chunk[c]          = std::max(chunk[c - 1], mtx_next_line(split, end));
+    }
+
+    // Number of lines and of entries (including mirrored entries) per chunk
+    std::vector<int64_t> chunk_lines(num_chunks + 1, 0);
+    std::vector<int64_t> chunk_entries(num_chunks + 1, 0);
+    int                  error = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t c = 0; c < num_chunks; ++c)
+    {
+        int64_t lines   = 0;
+        int64_t entries = 0;
+
+        for(const char* s = chunk[c]; s < chunk[c + 1]; s = mtx_next_line(s, chunk[c + 1]))
+        {
+            const char* t = mtx_skip_blank(s, chunk[c + 1]);
+            if(t == chunk[c + 1] || *t == '\n' || *t == '%')
+            {
+                continue;
+            }
+
+            int64_t i = 0;
+            int64_t j = 0;
+
+            t = mtx_parse_int(t, chunk[c + 1], i);
+            t = (t != nullptr) ? mtx_parse_int(t, chunk[c + 1], j) : nullptr;
+
+            if(t == nullptr || i < 1 || i > m64 || j < 1 || j > n64)
+            {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                error = 1;
+                break;
+            }
+
+            ++lines;
+            entries += (symmetry != mtx_general && i != j) ? 2 : 1;
+        }
+
+        chunk_lines[c + 1]   = lines;
+        chunk_entries[c + 1] = entries;
+    }
+
+    for(int64_t c = 0; c < num_chunks; ++c)
+    {
+        chunk_lines[c + 1] += chunk_lines[c];
+        chunk_entries[c + 1] += chunk_entries[c];
+    }
+
+    if(error || chunk_lines[num_chunks] != snnz || chunk_entries[num_chunks] > INT32_MAX)
+    {
+        return -1;
+    }
+
+    nnz = (int)chunk_entries[num_chunks];
+
+    std::vector<int> unsorted_row(nnz);
+    std::vector<int> unsorted_col(nnz);
+    std::vector<T>   unsorted_val(nnz);
+
+    // Parse the entries, each chunk writes to its own range
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t c = 0; c < num_chunks; ++c)
+    {
+        int64_t idx = chunk_entries[c];
+
+        for(const char* s = chunk[c]; s < chunk[c + 1]; s = mtx_next_line(s, chunk[c + 1]))
+        {
+            const char* t = mtx_skip_blank(s, chunk[c + 1]);
+            if(t == chunk[c + 1] || *t == '\n' || *t == '%')
+            {
+                continue;
+            }
+
+            int64_t i = 0;
+            int64_t j = 0;
+            double  real = 1.0;
+            double  imag = 0.0;
+
+            t = mtx_parse_int(t, chunk[c + 1], i);
+            t = mtx_parse_int(t, chunk[c + 1], j);
+
+            if(!pattern)
+            {
+                t = mtx_parse_real(t, chunk[c + 1], real);
+                t = (t != nullptr && complex) ? mtx_parse_real(t, chunk[c + 1], imag) : t;
+
+                if(t == nullptr)
+                {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                    error = 1;
+                    break;
+                }
+            }
+
+            unsorted_row[idx] = (int)i - 1 + idx_base;
+            unsorted_col[idx] = (int)j - 1 + idx_base;
+            mtx_set_value(unsorted_val[idx], real, imag);
+            ++idx;
+
+            if(symmetry != mtx_general && i != j)
+            {
+                unsorted_row[idx] = (int)j - 1 + idx_base;
+                unsorted_col[idx] = (int)i - 1 + idx_base;
+
+                if(symmetry == mtx_skew_symmetric)
+                {
+                    mtx_set_value(unsorted_val[idx], -real, -imag);
+                }
+                else if(symmetry == mtx_hermitian)
+                {
+                    mtx_set_value(unsorted_val[idx], real, -imag);
+                }
+                else
+                {
+                    mtx_set_value(unsorted_val[idx], real, imag);
+                }
+
+                ++idx;
+            }
+        }
+    }
+
+    if(error)
+    {
+        return -1;
+    }
+
+    // Sort by row index (stable counting sort), then by column index within each row
+    std::vector<int> row_ptr(nrow + 1, 0);
+    for(int i = 0; i < nnz; ++i)
+    {
+        ++row_ptr[unsorted_row[i] - idx_base + 1];
+    }
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    std::vector<int> perm(nnz);
+    {
+        std::vector<int> pos(row_ptr.begin(), row_ptr.end() - 1);
+        for(int i = 0; i < nnz; ++i)
+        {
+            perm[pos[unsorted_row[i] - idx_base]++] = i;
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < nrow; ++i)
+    {
+        std::stable_sort(perm.data() + row_ptr[i],
+                         perm.data() + row_ptr[i + 1],
+                         [&](int a, int b) { return unsorted_col[a] < unsorted_col[b]; });
+    }
+
+    row.resize(nnz);
+    col.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int i = 0; i < nnz; ++i)
+    {
+        row[i] = unsorted_row[perm[i]];
+        col[i] = unsorted_col[perm[i]];
+        val[i] = unsorted_val[perm[i]];
+    }
+
+    return 0;
+}
+
+#endif // MTX_READER_HPP
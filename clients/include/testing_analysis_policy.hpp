@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_ANALYSIS_POLICY_HPP
+#define TESTING_ANALYSIS_POLICY_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <vector>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_analysis_policy_bad_arg(void)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<csrilu02_struct> unique_ptr_csrilu02(new csrilu02_struct);
+    csrilu02Info_t                   ilu_info = unique_ptr_csrilu02->info;
+
+    std::unique_ptr<csric02_struct> unique_ptr_csric02(new csric02_struct);
+    csric02Info_t                   ic_info = unique_ptr_csric02->info;
+
+    hipsparseAnalysisPolicy_t policy;
+    csrsv2Info_t              sv_info;
+
+    verify_hipsparse_status(hipsparseSetAnalysisPolicy(nullptr, HIPSPARSE_ANALYSIS_POLICY_REUSE),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status(hipsparseGetAnalysisPolicy(nullptr, &policy),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetAnalysisPolicy(handle, (hipsparseAnalysisPolicy_t)2), "Error: invalid policy");
+    verify_hipsparse_status_invalid_value(hipsparseGetAnalysisPolicy(handle, nullptr),
+                                          "Error: policy is nullptr");
+
+    verify_hipsparse_status_invalid_value(hipsparseShareCsrilu02Info(nullptr, &sv_info),
+                                          "Error: source is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseShareCsrilu02Info(ilu_info, nullptr),
+                                          "Error: info is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseShareCsric02Info(nullptr, &sv_info),
+                                          "Error: source is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseShareCsric02Info(ic_info, nullptr),
+                                          "Error: info is nullptr");
+}
+
+// Incomplete LU factorization of M, followed by the solution of L * U * y = x
+template <typename T>
+hipsparseStatus_t analysis_policy_ilu0_solve(hipsparseHandle_t   handle,
+                                             int                 m,
+                                             int                 nnz,
+                                             hipsparseMatDescr_t descr_M,
+                                             hipsparseMatDescr_t descr_L,
+                                             hipsparseMatDescr_t descr_U,
+                                             T*                  dval,
+                                             const int*          dptr,
+                                             const int*          dcol,
+                                             csrilu02Info_t      info_M,
+                                             csrsv2Info_t        info_L,
+                                             csrsv2Info_t        info_U,
+                                             const T*            dx,
+                                             T*                  dz,
+                                             T*                  dy)
+{
+    hipsparseOperation_t   trans  = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseSolvePolicy_t policy = HIPSPARSE_SOLVE_POLICY_USE_LEVEL;
+    T                      h_one  = make_DataType<T>(1.0);
+
+    // Obtain the largest buffer size of all three routines
+    int size_M;
+    int size_L;
+    int size_U;
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseXcsrilu02_bufferSize(handle, m, nnz, descr_M, dval, dptr, dcol, info_M, &size_M));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_bufferSize(
+        handle, trans, m, nnz, descr_L, dval, dptr, dcol, info_L, &size_L));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_bufferSize(
+        handle, trans, m, nnz, descr_U, dval, dptr, dcol, info_U, &size_U));
+
+    int size = std::max(size_M, std::max(size_L, size_U));
+
+    auto dbuffer_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dbuffer");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Analysis
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrilu02_analysis(
+        handle, m, nnz, descr_M, dval, dptr, dcol, info_M, policy, dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_analysis(
+        handle, trans, m, nnz, descr_L, dval, dptr, dcol, info_L, policy, dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_analysis(
+        handle, trans, m, nnz, descr_U, dval, dptr, dcol, info_U, policy, dbuffer));
+
+    // Factorization
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseXcsrilu02(handle, m, nnz, descr_M, dval, dptr, dcol, info_M, policy, dbuffer));
+
+    // Solve L * z = x and U * y = z
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_solve(
+        handle, trans, m, nnz, &h_one, descr_L, dval, dptr, dcol, info_L, dx, dz, policy, dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_solve(
+        handle, trans, m, nnz, &h_one, descr_U, dval, dptr, dcol, info_U, dz, dy, policy, dbuffer));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsparseStatus_t testing_analysis_policy(Arguments argus)
+{
+    int                  ndim     = argus.laplacian;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle_force(new handle_struct);
+    hipsparseHandle_t              handle_force = test_handle_force->handle;
+
+    std::unique_ptr<handle_struct> test_handle_reuse(new handle_struct);
+    hipsparseHandle_t              handle_reuse = test_handle_reuse->handle;
+
+    std::unique_ptr<descr_struct> test_descr_M(new descr_struct);
+    hipsparseMatDescr_t           descr_M = test_descr_M->descr;
+
+    std::unique_ptr<descr_struct> test_descr_L(new descr_struct);
+    hipsparseMatDescr_t           descr_L = test_descr_L->descr;
+
+    std::unique_ptr<descr_struct> test_descr_U(new descr_struct);
+    hipsparseMatDescr_t           descr_U = test_descr_U->descr;
+
+    // Info structures for the reference, with separate analysis
+    std::unique_ptr<csrilu02_struct> test_info_M_force(new csrilu02_struct);
+    csrilu02Info_t                   info_M_force = test_info_M_force->info;
+
+    std::unique_ptr<csrsv2_struct> test_info_L_force(new csrsv2_struct);
+    csrsv2Info_t                   info_L_force = test_info_L_force->info;
+
+    std::unique_ptr<csrsv2_struct> test_info_U_force(new csrsv2_struct);
+    csrsv2Info_t                   info_U_force = test_info_U_force->info;
+
+    // Info structure that is shared between factorization and solves
+    std::unique_ptr<csrilu02_struct> test_info_M_reuse(new csrilu02_struct);
+    csrilu02Info_t                   info_M_reuse = test_info_M_reuse->info;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_M, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_L, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_U, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatFillMode(descr_L, HIPSPARSE_FILL_MODE_LOWER));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatDiagType(descr_L, HIPSPARSE_DIAG_TYPE_UNIT));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatFillMode(descr_U, HIPSPARSE_FILL_MODE_UPPER));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatDiagType(descr_U, HIPSPARSE_DIAG_TYPE_NON_UNIT));
+
+    // Analysis is recomputed by default
+    hipsparseAnalysisPolicy_t policy;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetAnalysisPolicy(handle_reuse, &policy));
+
+    int policy_gold = HIPSPARSE_ANALYSIS_POLICY_FORCE;
+    int policy_int  = policy;
+    unit_check_general(1, 1, 1, &policy_gold, &policy_int);
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSetAnalysisPolicy(handle_reuse, HIPSPARSE_ANALYSIS_POLICY_REUSE));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetAnalysisPolicy(handle_reuse, &policy));
+
+    policy_gold = HIPSPARSE_ANALYSIS_POLICY_REUSE;
+    policy_int  = policy;
+    unit_check_general(1, 1, 1, &policy_gold, &policy_int);
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hx(m);
+    hipsparseInit<T>(hx, 1, m);
+
+    // Allocate memory on device
+    auto dptr_managed   = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed   = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_1_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dz_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dptr   = (int*)dptr_managed.get();
+    int* dcol   = (int*)dcol_managed.get();
+    T*   dval_1 = (T*)dval_1_managed.get();
+    T*   dval_2 = (T*)dval_2_managed.get();
+    T*   dx     = (T*)dx_managed.get();
+    T*   dz     = (T*)dz_managed.get();
+    T*   dy_1   = (T*)dy_1_managed.get();
+    T*   dy_2   = (T*)dy_2_managed.get();
+
+    if(!dptr || !dcol || !dval_1 || !dval_2 || !dx || !dz || !dy_1 || !dy_2)
+    {
+        verify_hipsparse_status_success(
+            HIPSPARSE_STATUS_ALLOC_FAILED,
+            "!dptr || !dcol || !dval_1 || !dval_2 || !dx || !dz || !dy_1 || !dy_2");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Reference, each routine analyses the matrix on its own
+    CHECK_HIPSPARSE_ERROR(analysis_policy_ilu0_solve(handle_force,
+                                                     m,
+                                                     nnz,
+                                                     descr_M,
+                                                     descr_L,
+                                                     descr_U,
+                                                     dval_1,
+                                                     dptr,
+                                                     dcol,
+                                                     info_M_force,
+                                                     info_L_force,
+                                                     info_U_force,
+                                                     dx,
+                                                     dz,
+                                                     dy_1));
+
+    // Factorization and triangular solves share one analysis
+    csrsv2Info_t info_L_reuse;
+    csrsv2Info_t info_U_reuse;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseShareCsrilu02Info(info_M_reuse, &info_L_reuse));
+    CHECK_HIPSPARSE_ERROR(hipsparseShareCsrilu02Info(info_M_reuse, &info_U_reuse));
+
+    CHECK_HIPSPARSE_ERROR(analysis_policy_ilu0_solve(handle_reuse,
+                                                     m,
+                                                     nnz,
+                                                     descr_M,
+                                                     descr_L,
+                                                     descr_U,
+                                                     dval_2,
+                                                     dptr,
+                                                     dcol,
+                                                     info_M_reuse,
+                                                     info_L_reuse,
+                                                     info_U_reuse,
+                                                     dx,
+                                                     dz,
+                                                     dy_2));
+
+    // Copy output from device to CPU
+    std::vector<T> hval_1(nnz);
+    std::vector<T> hval_2(nnz);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hval_1.data(), dval_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hval_2.data(), dval_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, nnz, 1, hval_1.data(), hval_2.data());
+    unit_check_near(1, m, 1, hy_1.data(), hy_2.data());
+
+    // Shared structures keep the analysis alive until the last one is destroyed
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyCsrsv2Info(info_L_reuse));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyCsrsv2Info(info_U_reuse));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_ANALYSIS_POLICY_HPP
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR_BIN_HPP
+#define TESTING_CSR_BIN_HPP
+
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Writes and reads binary CSR files in all layouts. No device required.
+void testing_csr_bin(void)
+{
+    std::string filename = hipsparse_exepath() + "hipsparse_csr_bin_test.bin";
+
+    // 3 x 4 matrix with one based 64 bit row pointers, 32 bit column indices and complex values
+    std::vector<int64_t> file_ptr = {1, 3, 3, 5};
+    std::vector<int32_t> file_ind = {1, 4, 2, 3};
+    std::vector<double>  file_val = {1.0, -1.0, 2.0, 0.5, 3.0, 0.0, 4.0, 2.5};
+
+    ASSERT_EQ(csr_bin_write(filename.c_str(),
+                            3,
+                            4,
+                            4,
+                            sizeof(int64_t),
+                            file_ptr.data(),
+                            sizeof(int32_t),
+                            file_ind.data(),
+                            csr_bin_c64f,
+                            file_val.data(),
+                            1,
+                            mtx_general),
+              0);
+
+    // Matching layout is used in place
+    {
+        csr_bin_file file(filename.c_str());
+
+        ASSERT_TRUE(file.valid());
+        ASSERT_TRUE(file.verify());
+        EXPECT_EQ(file.header().version, csr_bin_version);
+        EXPECT_TRUE(file.row_ptr<int64_t>() != nullptr);
+        EXPECT_TRUE(file.col_ind<int32_t>() != nullptr);
+        EXPECT_TRUE(file.values<hipDoubleComplex>() != nullptr);
+        EXPECT_TRUE(file.values<double>() == nullptr);
+    }
+
+    // Conversion of index width, index base and value type
+    {
+        int                 m;
+        int                 n;
+        int                 nnz;
+        std::vector<int>    ptr;
+        std::vector<int>    col;
+        std::vector<double> val;
+
+        ASSERT_EQ(read_bin_matrix(
+                      filename.c_str(), m, n, nnz, ptr, col, val, HIPSPARSE_INDEX_BASE_ZERO),
+                  0);
+
+        std::vector<int>    gold_ptr = {0, 2, 2, 4};
+        std::vector<int>    gold_col = {0, 3, 1, 2};
+        std::vector<double> gold_val = {1.0, 2.0, 3.0, 4.0};
+
+        ASSERT_EQ(m, 3);
+        ASSERT_EQ(n, 4);
+        ASSERT_EQ(nnz, 4);
+
+        unit_check_general(1, m + 1, 1, gold_ptr.data(), ptr.data());
+        unit_check_general(1, nnz, 1, gold_col.data(), col.data());
+        unit_check_general(1, nnz, 1, gold_val.data(), val.data());
+    }
+
+    {
+        int64_t                       m;
+        int64_t                       n;
+        int64_t                       nnz;
+        std::vector<int64_t>          ptr;
+        std::vector<int64_t>          col;
+        std::vector<hipDoubleComplex> val;
+
+        ASSERT_EQ(
+            read_bin_matrix(filename.c_str(), m, n, nnz, ptr, col, val, HIPSPARSE_INDEX_BASE_ONE),
+            0);
+
+        std::vector<int64_t>          gold_col = {1, 4, 2, 3};
+        std::vector<hipDoubleComplex> gold_val = {make_DataType<hipDoubleComplex>(1.0, -1.0),
+                                                  make_DataType<hipDoubleComplex>(2.0, 0.5),
+                                                  make_DataType<hipDoubleComplex>(3.0, 0.0),
+                                                  make_DataType<hipDoubleComplex>(4.0, 2.5)};
+
+        unit_check_general(1, m + 1, 1, file_ptr.data(), ptr.data());
+        unit_check_general(1, nnz, 1, gold_col.data(), col.data());
+        unit_check_general(1, nnz, 1, gold_val.data(), val.data());
+    }
+
+    // Corrupted arrays are rejected
+    {
+        FILE* f = fopen(filename.c_str(), "r+b");
+        ASSERT_TRUE(f != nullptr);
+        fseek(f, -1, SEEK_END);
+        fputc(0x7f, f);
+        fclose(f);
+
+        csr_bin_file file(filename.c_str());
+
+        EXPECT_TRUE(file.valid());
+        EXPECT_FALSE(file.verify());
+    }
+
+    // Legacy files without header
+    {
+        FILE* f = fopen(filename.c_str(), "wb");
+        ASSERT_TRUE(f != nullptr);
+
+        int    dims[3] = {2, 2, 2};
+        int    ptr[3]  = {0, 1, 2};
+        int    ind[2]  = {1, 0};
+        double val[2]  = {3.5, 4.5};
+
+        fwrite(dims, sizeof(int), 3, f);
+        fwrite(ptr, sizeof(int), 3, f);
+        fwrite(ind, sizeof(int), 2, f);
+        fwrite(val, sizeof(double), 2, f);
+        fclose(f);
+
+        int                m;
+        int                n;
+        int                nnz;
+        std::vector<int>   hptr;
+        std::vector<int>   hcol;
+        std::vector<float> hval;
+
+        ASSERT_EQ(read_bin_matrix(
+                      filename.c_str(), m, n, nnz, hptr, hcol, hval, HIPSPARSE_INDEX_BASE_ONE),
+                  0);
+
+        std::vector<int>   gold_ptr = {1, 2, 3};
+        std::vector<int>   gold_col = {2, 1};
+        std::vector<float> gold_val = {3.5f, 4.5f};
+
+        ASSERT_EQ(csr_bin_file(filename.c_str()).header().version, 0u);
+        unit_check_general(1, m + 1, 1, gold_ptr.data(), hptr.data());
+        unit_check_general(1, nnz, 1, gold_col.data(), hcol.data());
+        unit_check_general(1, nnz, 1, gold_val.data(), hval.data());
+    }
+
+    remove(filename.c_str());
+}
+
+#endif // TESTING_CSR_BIN_HPP
@@ -27,6 +27,7 @@
 
 #include "hipsparse.hpp"
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_csrgemm2.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
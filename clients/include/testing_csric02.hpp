@@ -27,6 +27,7 @@
 
 #include "hipsparse.hpp"
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_csrilu0.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
@@ -261,6 +261,20 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
         nrow = ncol = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
         nnz         = hcsr_row_ptr[nrow];
     }
+    else if(argus.generator != hipsparse_generator_none)
+    {
+        gen_matrix(argus.generator,
+                   argus.gen_dim,
+                   argus.gen_param,
+                   argus.seed,
+                   nrow,
+                   ncol,
+                   hcsr_row_ptr,
+                   hcol_ind,
+                   hval,
+                   idx_base);
+        nnz = hcsr_row_ptr[nrow] - idx_base;
+    }
     else
     {
         if(filename != "")
@@ -0,0 +1,208 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_ANALYSIS_CACHE_HPP
+#define TESTING_CSRMV_ANALYSIS_CACHE_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <vector>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_csrmv_analysis_cache_bad_arg(void)
+{
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    hipsparseAnalysisCache_t cache;
+    int64_t                  generation;
+
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetMatAnalysisCache(nullptr, HIPSPARSE_ANALYSIS_CACHE_ON),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetMatAnalysisCache(descr, (hipsparseAnalysisCache_t)2), "Error: invalid cache");
+    verify_hipsparse_status_invalid_value(hipsparseGetMatAnalysisCache(nullptr, &cache),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGetMatAnalysisCache(descr, nullptr),
+                                          "Error: cache is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSetMatGeneration(nullptr, 1),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGetMatGeneration(nullptr, &generation),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGetMatGeneration(descr, nullptr),
+                                          "Error: generation is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseInvalidateMatAnalysis(nullptr),
+                                          "Error: descr is nullptr");
+}
+
+template <typename T>
+hipsparseStatus_t testing_csrmv_analysis_cache(Arguments argus)
+{
+    int                  ndim     = argus.laplacian;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(0.0);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = test_descr->descr;
+
+    std::unique_ptr<descr_struct> test_descr_copy(new descr_struct);
+    hipsparseMatDescr_t           descr_copy = test_descr_copy->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+
+    // Cache is disabled by default
+    hipsparseAnalysisCache_t cache;
+    int64_t                  generation;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseGetMatAnalysisCache(descr, &cache));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetMatGeneration(descr, &generation));
+
+    int     cache_gold      = HIPSPARSE_ANALYSIS_CACHE_OFF;
+    int     cache_int       = cache;
+    int64_t generation_gold = 0;
+
+    unit_check_general(1, 1, 1, &cache_gold, &cache_int);
+    unit_check_general(1, 1, 1, &generation_gold, &generation);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatAnalysisCache(descr, HIPSPARSE_ANALYSIS_CACHE_ON));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetMatAnalysisCache(descr, &cache));
+
+    cache_gold = HIPSPARSE_ANALYSIS_CACHE_ON;
+    cache_int  = cache;
+    unit_check_general(1, 1, 1, &cache_gold, &cache_int);
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcol_ind;
+    std::vector<T>   hval;
+
+    srand(12345ULL);
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcol_ind, hval, idx_base);
+    int n   = m;
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+    std::vector<T> hy_gold(m);
+
+    hipsparseInit<T>(hx, 1, n);
+
+    // Allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dptr = (int*)dptr_managed.get();
+    int* dcol = (int*)dcol_managed.get();
+    T*   dval = (T*)dval_managed.get();
+    T*   dx   = (T*)dx_managed.get();
+    T*   dy   = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dval || !dptr || !dcol || !dx || !dy");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+    // CPU
+    for(int i = 0; i < m; ++i)
+    {
+        T sum = make_DataType<T>(0.0);
+
+        for(int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            sum = testing_fma(hval[j], hx[hcol_ind[j] - idx_base], sum);
+        }
+
+        hy_gold[i] = h_alpha * sum;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    // First call performs the analysis, the second call reuses it, a new generation and
+    // an explicit invalidation force the analysis to be redone
+    for(int pass = 0; pass < 4; ++pass)
+    {
+        if(pass == 2)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSetMatGeneration(descr, 1));
+        }
+        else if(pass == 3)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseInvalidateMatAnalysis(descr));
+        }
+
+        CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(T) * m));
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(
+            handle, transA, m, n, nnz, &h_alpha, descr, dval, dptr, dcol, dx, &h_beta, dy));
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+    }
+
+    // Settings are copied with the descriptor
+    CHECK_HIPSPARSE_ERROR(hipsparseCopyMatDescr(descr_copy, descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetMatAnalysisCache(descr_copy, &cache));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetMatGeneration(descr_copy, &generation));
+
+    cache_int       = cache;
+    generation_gold = 1;
+    unit_check_general(1, 1, 1, &cache_gold, &cache_int);
+    unit_check_general(1, 1, 1, &generation_gold, &generation);
+
+    // Disabling the cache falls back to the non-analysed algorithm
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatAnalysisCache(descr, HIPSPARSE_ANALYSIS_CACHE_OFF));
+
+    CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(T) * m));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(
+        handle, transA, m, n, nnz, &h_alpha, descr, dval, dptr, dcol, dx, &h_beta, dy));
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRMV_ANALYSIS_CACHE_HPP
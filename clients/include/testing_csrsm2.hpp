@@ -27,6 +27,7 @@
 
 #include "hipsparse.hpp"
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_sptrsv.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
@@ -243,6 +243,22 @@ void testing_csru2csr_bad_arg(void)
             handle, 0, n, nnz, nullptr, (float*)nullptr, nullptr, nullptr, nullptr, &bufferSize),
         "Error: nnz is invalid");
 #endif
+
+#if(!defined(CUDART_VERSION))
+    // Testing csru2csr permutation mode for bad args
+    hipsparseCsru2csrPermutation_t permutation;
+
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetCsru2csrInfoPermutation(nullptr, HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD),
+        "Error: info is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetCsru2csrInfoPermutation(info, (hipsparseCsru2csrPermutation_t)2),
+        "Error: permutation is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseGetCsru2csrInfoPermutation(nullptr, &permutation), "Error: info is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGetCsru2csrInfoPermutation(info, nullptr),
+                                          "Error: permutation is nullptr");
+#endif
 }
 
 template <typename T>
@@ -389,6 +405,35 @@ hipsparseStatus_t testing_csru2csr(void)
     unit_check_general(1, nnz, 1, hcsr_col_ind_unsorted.data(), hcsr_col_ind_unsorted_gold.data());
     unit_check_general(1, nnz, 1, hcsr_val_unsorted.data(), hcsr_val_unsorted_gold.data());
 
+#if(!defined(CUDART_VERSION))
+    // Sort again without keeping the permutation
+    hipsparseCsru2csrPermutation_t permutation;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseGetCsru2csrInfoPermutation(info, &permutation));
+
+    int permutation_gold = HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP;
+    int permutation_int  = permutation;
+    unit_check_general(1, 1, 1, &permutation_gold, &permutation_int);
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSetCsru2csrInfoPermutation(info, HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsru2csr(
+        handle, m, n, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, dbuffer));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_col_ind.data(), dcsr_col_ind, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, nnz, 1, hcsr_col_ind.data(), hcsr_col_ind_gold.data());
+    unit_check_general(1, nnz, 1, hcsr_val.data(), hcsr_val_gold.data());
+
+    // Without permutation, the matrix cannot be unsorted
+    verify_hipsparse_status_invalid_value(
+        hipsparseXcsr2csru(
+            handle, m, n, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, dbuffer),
+        "Error: permutation has been discarded");
+#endif
+
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_EXECUTION_MODE_HPP
+#define TESTING_EXECUTION_MODE_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_execution_mode_bad_arg(void)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparseExecutionMode_t mode;
+
+    verify_hipsparse_status(hipsparseSetExecutionMode(nullptr, HIPSPARSE_EXEC_ASYNC),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status(hipsparseGetExecutionMode(nullptr, &mode),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSetExecutionMode(handle, (hipsparseExecutionMode_t)3), "Error: invalid mode");
+    verify_hipsparse_status_invalid_value(hipsparseGetExecutionMode(handle, nullptr),
+                                          "Error: mode is nullptr");
+}
+
+template <typename T>
+hipsparseStatus_t testing_execution_mode(Arguments argus)
+{
+    int                  N        = argus.N;
+    int                  nnz      = argus.nnz;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Default mode is blocking
+    hipsparseExecutionMode_t mode;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetExecutionMode(handle, &mode));
+
+    int mode_gold = HIPSPARSE_EXEC_BLOCKING;
+    int mode_int  = mode;
+    unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetExecutionMode(handle, HIPSPARSE_EXEC_ASYNC));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetExecutionMode(handle, &mode));
+
+    mode_gold = HIPSPARSE_EXEC_ASYNC;
+    mode_int  = mode;
+    unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+
+    // Host structures
+    std::vector<int> hx_ind(nnz);
+    std::vector<T>   hx_val(nnz);
+    std::vector<T>   hy(N);
+
+    T hresult_1;
+    T hresult_2;
+    T hresult_gold;
+
+    srand(12345ULL);
+    hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
+    hipsparseInit<T>(hx_val, 1, nnz);
+    hipsparseInit<T>(hy, 1, N);
+
+    // Allocate memory on device
+    auto dx_ind_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dx_val_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dy_managed        = hipsparse_unique_ptr{device_malloc(sizeof(T) * N), device_free};
+    auto dresult_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dx_ind    = (int*)dx_ind_managed.get();
+    T*   dx_val    = (T*)dx_val_managed.get();
+    T*   dy        = (T*)dy_managed.get();
+    T*   dresult_2 = (T*)dresult_2_managed.get();
+
+    if(!dx_ind || !dx_val || !dy || !dresult_2)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dx_ind || !dx_val || !dy || !dresult_2");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    // Results into host memory are available on return
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, &hresult_1, idx_base));
+
+    // Results into device memory are available after synchronizing the stream
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+    CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, dresult_2, idx_base));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipMemcpy(&hresult_2, dresult_2, sizeof(T), hipMemcpyDeviceToHost));
+
+    // CPU
+    hresult_gold = make_DataType<T>(0.0);
+    for(int i = 0; i < nnz; ++i)
+    {
+        hresult_gold = hresult_gold + hy[hx_ind[i] - idx_base] * hx_val[i];
+    }
+
+    unit_check_general(1, 1, 1, &hresult_gold, &hresult_1);
+    unit_check_general(1, 1, 1, &hresult_gold, &hresult_2);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_EXECUTION_MODE_HPP
@@ -0,0 +1,778 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_GRAPH_CAPTURE_HPP
+#define TESTING_GRAPH_CAPTURE_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <vector>
+
+#ifndef _WIN32
+#include "hip_call_recorder.hpp"
+#endif
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_graph_capture_bad_arg(void)
+{
+    int m   = 100;
+    int n   = 100;
+    int nnz = 100;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto csr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto csr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto csr_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+    auto csc_col_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (n + 1)), device_free};
+    auto csc_row_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto csc_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+
+    int*   csr_row_ptr = (int*)csr_row_ptr_managed.get();
+    int*   csr_col_ind = (int*)csr_col_ind_managed.get();
+    float* csr_val     = (float*)csr_val_managed.get();
+    int*   csc_col_ptr = (int*)csc_col_ptr_managed.get();
+    int*   csc_row_ind = (int*)csc_row_ind_managed.get();
+    float* csc_val     = (float*)csc_val_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !csr_val || !csc_col_ptr || !csc_row_ind || !csc_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    verify_hipsparse_status_success(
+        hipsparseSetExecutionMode(handle, HIPSPARSE_EXEC_CAPTURE_SAFE), "success");
+
+    // Workspace cannot be changed in capture safe mode
+    verify_hipsparse_status_not_supported(hipsparseReserveWorkspace(handle, 1024),
+                                          "Error: workspace reserved in capture safe mode");
+    verify_hipsparse_status_not_supported(hipsparseReleaseWorkspace(handle),
+                                          "Error: workspace released in capture safe mode");
+
+    // Without reserved workspace, the conversion would need to allocate
+    verify_hipsparse_status_not_supported(hipsparseXcsr2csc(handle,
+                                                            m,
+                                                            n,
+                                                            nnz,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csc_val,
+                                                            csc_row_ind,
+                                                            csc_col_ptr,
+                                                            HIPSPARSE_ACTION_NUMERIC,
+                                                            HIPSPARSE_INDEX_BASE_ZERO),
+                                          "Error: workspace has not been reserved");
+
+    // Nothing has been allocated by the failing call
+    size_t size;
+    size_t size_gold = 0;
+    verify_hipsparse_status_success(hipsparseGetWorkspaceSize(handle, &size), "success");
+    unit_check_general(1, 1, 1, &size_gold, &size);
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    // The csrmv analysis cache cannot be filled in capture safe mode
+    float alpha = 1.0f;
+    float beta  = 0.0f;
+
+    verify_hipsparse_status_success(
+        hipsparseSetMatAnalysisCache(descr, HIPSPARSE_ANALYSIS_CACHE_ON), "success");
+    verify_hipsparse_status_not_supported(hipsparseXcsrmv(handle,
+                                                          HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          &alpha,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          csc_val,
+                                                          &beta,
+                                                          csr_val),
+                                          "Error: csrmv analysis cached in capture safe mode");
+
+    // Analysis routines allocate meta data
+    std::unique_ptr<csrsv2_struct> unique_ptr_csrsv2(new csrsv2_struct);
+    csrsv2Info_t                   csrsv2_info = unique_ptr_csrsv2->info;
+
+    verify_hipsparse_status_not_supported(
+        hipsparseXcsrsv2_analysis(handle,
+                                  HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csrsv2_info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  csc_val),
+        "Error: csrsv2 analysis in capture safe mode");
+
+    // SpMV would run the analysis, as it has not been preprocessed
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x;
+    hipsparseDnVecDescr_t y;
+
+    verify_hipsparse_status_success(hipsparseCreateCsr(&A,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       csr_val,
+                                                       HIPSPARSE_INDEX_32I,
+                                                       HIPSPARSE_INDEX_32I,
+                                                       HIPSPARSE_INDEX_BASE_ZERO,
+                                                       HIP_R_32F),
+                                    "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, csc_val, HIP_R_32F), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, csr_val, HIP_R_32F), "success");
+
+    verify_hipsparse_status_not_supported(hipsparseSpMV(handle,
+                                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                        &alpha,
+                                                        A,
+                                                        x,
+                                                        &beta,
+                                                        y,
+                                                        HIP_R_32F,
+                                                        HIPSPARSE_SPMV_ALG_DEFAULT,
+                                                        csc_row_ind),
+                                          "Error: SpMV analysis in capture safe mode");
+
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+
+    // Zero pivots cannot be copied to the host without synchronization
+    std::unique_ptr<csrilu02_struct> unique_ptr_csrilu02(new csrilu02_struct);
+    std::unique_ptr<csric02_struct>  unique_ptr_csric02(new csric02_struct);
+    std::unique_ptr<csrsm2_struct>   unique_ptr_csrsm2(new csrsm2_struct);
+    std::unique_ptr<bsrsv2_struct>   unique_ptr_bsrsv2(new bsrsv2_struct);
+    std::unique_ptr<bsrilu02_struct> unique_ptr_bsrilu02(new bsrilu02_struct);
+    std::unique_ptr<bsric02_struct>  unique_ptr_bsric02(new bsric02_struct);
+    std::unique_ptr<bsrsm2_struct>   unique_ptr_bsrsm2(new bsrsm2_struct);
+
+    int position;
+
+    verify_hipsparse_status_success(
+        hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST), "success");
+
+    verify_hipsparse_status_not_supported(
+        hipsparseXcsrsv2_zeroPivot(handle, csrsv2_info, &position),
+        "Error: csrsv2 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXcsrilu02_zeroPivot(handle, unique_ptr_csrilu02->info, &position),
+        "Error: csrilu02 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXcsric02_zeroPivot(handle, unique_ptr_csric02->info, &position),
+        "Error: csric02 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXcsrsm2_zeroPivot(handle, unique_ptr_csrsm2->info, &position),
+        "Error: csrsm2 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXbsrsv2_zeroPivot(handle, unique_ptr_bsrsv2->info, &position),
+        "Error: bsrsv2 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXbsrilu02_zeroPivot(handle, unique_ptr_bsrilu02->info, &position),
+        "Error: bsrilu02 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXbsric02_zeroPivot(handle, unique_ptr_bsric02->info, &position),
+        "Error: bsric02 zero pivot copied to host in capture safe mode");
+    verify_hipsparse_status_not_supported(
+        hipsparseXbsrsm2_zeroPivot(handle, unique_ptr_bsrsm2->info, &position),
+        "Error: bsrsm2 zero pivot copied to host in capture safe mode");
+}
+
+template <typename T>
+hipsparseStatus_t testing_graph_capture(Arguments argus)
+{
+    int                  ndim     = argus.laplacian;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+    hipsparseAction_t    action   = HIPSPARSE_ACTION_NUMERIC;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int n   = m;
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Allocate memory on device
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsc_col_ptr_1_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (n + 1)), device_free};
+    auto dcsc_row_ind_1_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsc_val_1_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsc_col_ptr_2_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (n + 1)), device_free};
+    auto dcsc_row_ind_2_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsc_val_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed         = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dcsr_row_ptr   = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind   = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val       = (T*)dcsr_val_managed.get();
+    int* dcsc_col_ptr_1 = (int*)dcsc_col_ptr_1_managed.get();
+    int* dcsc_row_ind_1 = (int*)dcsc_row_ind_1_managed.get();
+    T*   dcsc_val_1     = (T*)dcsc_val_1_managed.get();
+    int* dcsc_col_ptr_2 = (int*)dcsc_col_ptr_2_managed.get();
+    int* dcsc_row_ind_2 = (int*)dcsc_row_ind_2_managed.get();
+    T*   dcsc_val_2     = (T*)dcsc_val_2_managed.get();
+    T*   dx             = (T*)dx_managed.get();
+    T*   dy_1           = (T*)dy_1_managed.get();
+    T*   dy_2           = (T*)dy_2_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsc_col_ptr_1 || !dcsc_row_ind_1
+       || !dcsc_val_1 || !dcsc_col_ptr_2 || !dcsc_row_ind_2 || !dcsc_val_2 || !dx || !dy_1
+       || !dy_2)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                        "!dcsc_col_ptr || !dcsc_row_ind || !dcsc_val || "
+                                        "!dx || !dy");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    std::vector<T> hx(n);
+    hipsparseInit<T>(hx, 1, n);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = test_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatAnalysisCache(descr, HIPSPARSE_ANALYSIS_CACHE_ON));
+
+    T h_alpha = make_DataType<T>(1.0);
+    T h_beta  = make_DataType<T>(0.0);
+
+    // Reference conversion, this also fills the workspace with the required buffers
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csc(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            dcsr_val,
+                                            dcsr_row_ptr,
+                                            dcsr_col_ind,
+                                            dcsc_val_1,
+                                            dcsc_row_ind_1,
+                                            dcsc_col_ptr_1,
+                                            action,
+                                            idx_base));
+
+    // Reference product, this also attaches the csrmv analysis to the descriptor
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(handle,
+                                          HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dcsr_val,
+                                          dcsr_row_ptr,
+                                          dcsr_col_ind,
+                                          dx,
+                                          &h_beta,
+                                          dy_1));
+
+    size_t size_before;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size_before));
+
+    // Capture the conversion into a graph. In global capture mode, the runtime rejects
+    // any allocation or synchronization that would break the capture.
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, stream));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetExecutionMode(handle, HIPSPARSE_EXEC_CAPTURE_SAFE));
+
+    hipGraph_t     graph;
+    hipGraphExec_t graph_exec;
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+
+    hipsparseStatus_t status = hipsparseXcsr2csc(handle,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 dcsc_val_2,
+                                                 dcsc_row_ind_2,
+                                                 dcsc_col_ptr_2,
+                                                 action,
+                                                 idx_base);
+
+    // The cached analysis is re-used, thus csrmv does not allocate
+    hipsparseStatus_t status_csrmv = hipsparseXcsrmv(handle,
+                                                     HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     &h_alpha,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     dx,
+                                                     &h_beta,
+                                                     dy_2);
+
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    verify_hipsparse_status_success(status, "csr2csc during stream capture");
+    verify_hipsparse_status_success(status_csrmv, "csrmv during stream capture");
+
+    // Workspace has not grown during capture
+    size_t size_after;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size_after));
+    unit_check_general(1, 1, 1, &size_before, &size_after);
+
+    // Replay the graph
+    CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+    CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetExecutionMode(handle, HIPSPARSE_EXEC_BLOCKING));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // Copy output from device to CPU
+    std::vector<int> hcsc_col_ptr_1(n + 1);
+    std::vector<int> hcsc_row_ind_1(nnz);
+    std::vector<T>   hcsc_val_1(nnz);
+    std::vector<int> hcsc_col_ptr_2(n + 1);
+    std::vector<int> hcsc_row_ind_2(nnz);
+    std::vector<T>   hcsc_val_2(nnz);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsc_col_ptr_1.data(), dcsc_col_ptr_1, sizeof(int) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsc_row_ind_1.data(), dcsc_row_ind_1, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsc_val_1.data(), dcsc_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsc_col_ptr_2.data(), dcsc_col_ptr_2, sizeof(int) * (n + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsc_row_ind_2.data(), dcsc_row_ind_2, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsc_val_2.data(), dcsc_val_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, n + 1, 1, hcsc_col_ptr_1.data(), hcsc_col_ptr_2.data());
+    unit_check_general(1, nnz, 1, hcsc_row_ind_1.data(), hcsc_row_ind_2.data());
+    unit_check_general(1, nnz, 1, hcsc_val_1.data(), hcsc_val_2.data());
+
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, m, 1, hy_1.data(), hy_2.data());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#ifndef _WIN32
+// Drives the routines that re-use memory across calls through the recorded HIP runtime
+// and checks that no device memory is allocated or freed and that the stream is not
+// synchronized in capture safe mode.
+template <typename T>
+hipsparseStatus_t testing_graph_capture_recorded(Arguments argus)
+{
+    int                  ndim     = argus.laplacian;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+    hipsparseSpGEMMAlg_t alg      = HIPSPARSE_SPGEMM_DEFAULT;
+    hipsparseOperation_t trans    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int n   = m;
+    int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Unsorted copy of the matrix, with the columns of each row in reverse order
+    std::vector<int> hcsru_col_ind(hcsr_col_ind);
+    std::vector<T>   hcsru_val(hcsr_val);
+
+    for(int i = 0; i < m; ++i)
+    {
+        int row_begin = hcsr_row_ptr[i] - idx_base;
+        int row_end   = hcsr_row_ptr[i + 1] - idx_base;
+
+        std::reverse(hcsru_col_ind.begin() + row_begin, hcsru_col_ind.begin() + row_end);
+        std::reverse(hcsru_val.begin() + row_begin, hcsru_val.begin() + row_end);
+    }
+
+    // Allocate memory on device
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsru_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsru_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dcsr_row_ptr   = (int*)dcsr_row_ptr_managed.get();
+    int* dcsr_col_ind   = (int*)dcsr_col_ind_managed.get();
+    T*   dcsr_val       = (T*)dcsr_val_managed.get();
+    int* dcsru_col_ind  = (int*)dcsru_col_ind_managed.get();
+    T*   dcsru_val      = (T*)dcsru_val_managed.get();
+    int* dcsr_row_ptr_C = (int*)dcsr_row_ptr_C_managed.get();
+    T*   dx             = (T*)dx_managed.get();
+    T*   dy_1           = (T*)dy_1_managed.get();
+    T*   dy_2           = (T*)dy_2_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsru_col_ind || !dcsru_val
+       || !dcsr_row_ptr_C || !dx || !dy_1 || !dy_2)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                        "!dcsru_col_ind || !dcsru_val || !dcsr_row_ptr_C || "
+                                        "!dx || !dy");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsru_col_ind, hcsru_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsru_val, hcsru_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    std::vector<T> hx(n);
+    hipsparseInit<T>(hx, 1, n);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = test_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatAnalysisCache(descr, HIPSPARSE_ANALYSIS_CACHE_ON));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    T h_alpha = make_DataType<T>(1.0);
+    T h_beta  = make_DataType<T>(0.0);
+
+    // Reference product, this also attaches the csrmv analysis to the descriptor
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dcsr_val,
+                                          dcsr_row_ptr,
+                                          dcsr_col_ind,
+                                          dx,
+                                          &h_beta,
+                                          dy_1));
+
+    // C = A * A, the symbolic stages of SpGEMMreuse are done up front
+    std::unique_ptr<spgemm_struct> test_spgemm(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         spgemm_descr = test_spgemm->descr;
+
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t C;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             dcsr_val,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&C,
+                                             m,
+                                             n,
+                                             0,
+                                             dcsr_row_ptr_C,
+                                             nullptr,
+                                             nullptr,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+
+    size_t bufferSize1;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
+        handle, trans, trans, A, A, C, alg, spgemm_descr, &bufferSize1, nullptr));
+
+    auto externalBuffer1_managed = hipsparse_unique_ptr{device_malloc(bufferSize1), device_free};
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(handle,
+                                                              trans,
+                                                              trans,
+                                                              A,
+                                                              A,
+                                                              C,
+                                                              alg,
+                                                              spgemm_descr,
+                                                              &bufferSize1,
+                                                              externalBuffer1_managed.get()));
+
+    size_t bufferSize2, bufferSize3, bufferSize4, bufferSize5;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
+                                                   trans,
+                                                   trans,
+                                                   A,
+                                                   A,
+                                                   C,
+                                                   alg,
+                                                   spgemm_descr,
+                                                   &bufferSize2,
+                                                   nullptr,
+                                                   &bufferSize3,
+                                                   nullptr,
+                                                   &bufferSize4,
+                                                   nullptr));
+
+    auto externalBuffer2_managed = hipsparse_unique_ptr{device_malloc(bufferSize2), device_free};
+    auto externalBuffer3_managed = hipsparse_unique_ptr{device_malloc(bufferSize3), device_free};
+    auto externalBuffer4_managed = hipsparse_unique_ptr{device_malloc(bufferSize4), device_free};
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
+                                                   trans,
+                                                   trans,
+                                                   A,
+                                                   A,
+                                                   C,
+                                                   alg,
+                                                   spgemm_descr,
+                                                   &bufferSize2,
+                                                   externalBuffer2_managed.get(),
+                                                   &bufferSize3,
+                                                   externalBuffer3_managed.get(),
+                                                   &bufferSize4,
+                                                   externalBuffer4_managed.get()));
+
+    int64_t rows_C, cols_C, nnz_C;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C, &rows_C, &cols_C, &nnz_C));
+
+    auto dcsr_col_ind_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_C), device_free};
+    auto dcsr_val_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    int* dcsr_col_ind_C = (int*)dcsr_col_ind_C_managed.get();
+    T*   dcsr_val_C     = (T*)dcsr_val_C_managed.get();
+
+    if(!dcsr_col_ind_C || !dcsr_val_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                        "!dcsr_col_ind_C || !dcsr_val_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCsrSetPointers(C, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
+        handle, trans, trans, A, A, C, alg, spgemm_descr, &bufferSize5, nullptr));
+
+    auto externalBuffer5_managed = hipsparse_unique_ptr{device_malloc(bufferSize5), device_free};
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(handle,
+                                                    trans,
+                                                    trans,
+                                                    A,
+                                                    A,
+                                                    C,
+                                                    alg,
+                                                    spgemm_descr,
+                                                    &bufferSize5,
+                                                    externalBuffer5_managed.get()));
+
+    // The permutation of csru2csr is discarded, thus it is taken from the workspace
+    std::unique_ptr<csru2csr_struct> test_csru2csr(new csru2csr_struct);
+    csru2csrInfo_t                   csru2csr_info = test_csru2csr->info;
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSetCsru2csrInfoPermutation(csru2csr_info, HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD));
+
+    size_t csru2csr_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsru2csr_bufferSizeExt(
+        handle, m, n, nnz, dcsru_val, dcsr_row_ptr, dcsru_col_ind, csru2csr_info, &csru2csr_size));
+
+    auto csru2csr_buffer_managed
+        = hipsparse_unique_ptr{device_malloc(csru2csr_size), device_free};
+
+    // A single reserved block serves the permutation, which is in a smaller size class
+    CHECK_HIPSPARSE_ERROR(hipsparseReserveWorkspace(handle, 4 * sizeof(int) * nnz));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // Record all calls in capture safe mode
+    CHECK_HIPSPARSE_ERROR(hipsparseSetExecutionMode(handle, HIPSPARSE_EXEC_CAPTURE_SAFE));
+
+    hip_call_recorder::start();
+
+    hipsparseStatus_t status_csrmv = hipsparseXcsrmv(handle,
+                                                     trans,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     &h_alpha,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     dx,
+                                                     &h_beta,
+                                                     dy_2);
+
+    hipsparseStatus_t status_spgemm = hipsparseSpGEMMreuse_compute(
+        handle, trans, trans, &h_alpha, A, A, &h_beta, C, typeT, alg, spgemm_descr);
+
+    hipsparseStatus_t status_csru2csr = hipsparseXcsru2csr(handle,
+                                                           m,
+                                                           n,
+                                                           nnz,
+                                                           descr,
+                                                           dcsru_val,
+                                                           dcsr_row_ptr,
+                                                           dcsru_col_ind,
+                                                           csru2csr_info,
+                                                           csru2csr_buffer_managed.get());
+
+    hip_call_recorder::counts calls = hip_call_recorder::stop();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetExecutionMode(handle, HIPSPARSE_EXEC_BLOCKING));
+
+    verify_hipsparse_status_success(status_csrmv, "csrmv in capture safe mode");
+    verify_hipsparse_status_success(status_spgemm, "SpGEMMreuse_compute in capture safe mode");
+    verify_hipsparse_status_success(status_csru2csr, "csru2csr in capture safe mode");
+
+    // Nothing has been allocated, freed or synchronized
+    int calls_gold = 0;
+    unit_check_general(1, 1, 1, &calls_gold, &calls.malloc_calls);
+    unit_check_general(1, 1, 1, &calls_gold, &calls.free_calls);
+    unit_check_general(1, 1, 1, &calls_gold, &calls.sync_calls);
+
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // Results match those computed outside of capture safe mode
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, m, 1, hy_1.data(), hy_2.data());
+
+    std::vector<T> hcsr_val_C_1(nnz_C);
+    std::vector<T> hcsr_val_C_2(nnz_C);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_C_1.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_compute(
+        handle, trans, trans, &h_alpha, A, A, &h_beta, C, typeT, alg, spgemm_descr));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_C_2.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, nnz_C, 1, hcsr_val_C_2.data(), hcsr_val_C_1.data());
+
+    std::vector<int> hcsru_col_ind_sorted(nnz);
+    std::vector<T>   hcsru_val_sorted(nnz);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcsru_col_ind_sorted.data(),
+                              dcsru_col_ind,
+                              sizeof(int) * nnz,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsru_val_sorted.data(), dcsru_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, nnz, 1, hcsr_col_ind.data(), hcsru_col_ind_sorted.data());
+    unit_check_general(1, nnz, 1, hcsr_val.data(), hcsru_val_sorted.data());
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif // _WIN32
+
+#endif // TESTING_GRAPH_CAPTURE_HPP
@@ -0,0 +1,348 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_LOGGING_HPP
+#define TESTING_LOGGING_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <hipsparse.h>
+#include <iostream>
+#include <logging.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace hipsparse_test;
+
+// Compares two strings, reporting a mismatch through the unit check
+inline void logging_check_string(const std::string& gold, const std::string& str)
+{
+    int one_i = 1;
+    int match = (gold == str);
+
+    if(!match)
+    {
+        std::cerr << "Expected: " << gold << "\nActual:   " << str << std::endl;
+    }
+
+    unit_check_general(1, 1, 1, &one_i, &match);
+}
+
+// Checks the formatting and the profile output of the logging layer, using local
+// streams instead of the environment configuration. No device required.
+void testing_logging_mock(void)
+{
+    // Trace lines
+    {
+        std::string line = hipsparse::log_line("hipsparseScsrmv",
+                                               (const void*)nullptr,
+                                               HIPSPARSE_OPERATION_TRANSPOSE,
+                                               100,
+                                               2.5,
+                                               std::string("abc"));
+
+        std::ostringstream gold;
+        gold << "hipsparseScsrmv," << (const void*)nullptr << ",1,100,2.5,abc";
+
+        logging_check_string(gold.str(), line);
+    }
+
+    // Bench command lines skip empty arguments
+    {
+        std::string line = hipsparse::log_command(
+            "-f", "csrmv", "-r", "d", std::string(""), "--sizem", 10, std::string("--alpha 2"));
+
+        logging_check_string("./hipsparse-bench -f csrmv -r d --sizem 10 --alpha 2", line);
+    }
+
+    // Trace output
+    {
+        std::ostringstream trace;
+        std::ostringstream bench;
+        std::ostringstream profile;
+
+        hipsparse::logger log(hipsparse::layer_mode_log_trace | hipsparse::layer_mode_log_profile,
+                              &trace,
+                              &bench,
+                              &profile,
+                              hipsparse::profile_format_json);
+
+        int mode_gold = 5;
+        int mode      = log.mode();
+        unit_check_general(1, 1, 1, &mode_gold, &mode);
+
+        log.trace("a,b");
+        logging_check_string("a,b\n", trace.str());
+        logging_check_string("", bench.str());
+
+        // Dumping a handle without calls writes nothing
+        log.dump_profile(&trace);
+        logging_check_string("", profile.str());
+    }
+
+    // JSON profile, all handles are written to a single array
+    {
+        std::ostringstream profile;
+
+        int handle_a;
+        int handle_b;
+
+        std::ostringstream gold;
+        gold << "[\n  {\n    \"handle\": \"" << (const void*)&handle_a
+             << "\",\n    \"functions\": [\n"
+             << "      {\"name\": \"hipsparseSaxpyi\", \"calls\": 1, \"time_us\": 1},\n"
+             << "      {\"name\": \"hipsparseScsrmv\", \"calls\": 2, \"time_us\": 5}\n"
+             << "    ]\n  }";
+
+        {
+            hipsparse::logger log(hipsparse::layer_mode_log_profile,
+                                  &std::cerr,
+                                  &std::cerr,
+                                  &profile,
+                                  hipsparse::profile_format_json);
+
+            log.profile(&handle_a, "hipsparseScsrmv", 2.0);
+            log.profile(&handle_a, "hipsparseScsrmv", 3.0);
+            log.profile(&handle_a, "hipsparseSaxpyi", 1.0);
+            log.profile(&handle_b, "hipsparseSdoti", 4.0);
+
+            log.dump_profile(&handle_a);
+            logging_check_string(gold.str(), profile.str());
+
+            // The profile is reset after dumping it, other handles are not affected
+            log.dump_profile(&handle_a);
+            logging_check_string(gold.str(), profile.str());
+
+            log.dump_profile(&handle_b);
+        }
+
+        // The array is closed with the logger
+        gold << ",\n  {\n    \"handle\": \"" << (const void*)&handle_b
+             << "\",\n    \"functions\": [\n"
+             << "      {\"name\": \"hipsparseSdoti\", \"calls\": 1, \"time_us\": 4}\n"
+             << "    ]\n  }\n]\n";
+
+        logging_check_string(gold.str(), profile.str());
+    }
+
+    // CSV profile, the header is only written once
+    {
+        std::ostringstream profile;
+
+        hipsparse::logger log(hipsparse::layer_mode_log_profile,
+                              &std::cerr,
+                              &std::cerr,
+                              &profile,
+                              hipsparse::profile_format_csv);
+
+        int handle_a;
+        int handle_b;
+
+        log.profile(&handle_a, "hipsparseDcsr2csc", 1.5);
+        log.profile(&handle_a, "hipsparseDcsr2csc", 1.5);
+        log.profile(&handle_b, "hipsparseDdoti", 2.0);
+        log.dump_profile(&handle_a);
+        log.dump_profile(&handle_b);
+
+        std::ostringstream gold;
+        gold << "handle,function,calls,time_us\n"
+             << (const void*)&handle_a << ",hipsparseDcsr2csc,2,3\n"
+             << (const void*)&handle_b << ",hipsparseDdoti,1,2\n";
+
+        logging_check_string(gold.str(), profile.str());
+    }
+}
+
+// Output file of a logging layer, in the temporary directory of the test
+inline std::string logging_path(const char* name)
+{
+    return ::testing::TempDir() + "hipsparse_logging_" + name;
+}
+
+inline std::vector<std::string> logging_read_lines(const std::string& path)
+{
+    std::vector<std::string> lines;
+    std::ifstream            file(path);
+
+    for(std::string line; std::getline(file, line);)
+    {
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+// Calls csrmv twice on a handle of its own
+inline hipsparseStatus_t logging_layer_calls(void)
+{
+    int   m     = 2;
+    int   nnz   = 2;
+    float alpha = 2.0f;
+    float beta  = 0.0f;
+
+    std::vector<int>   hcsr_row_ptr = {0, 1, 2};
+    std::vector<int>   hcsr_col_ind = {0, 1};
+    std::vector<float> hcsr_val     = {1.0f, 2.0f};
+    std::vector<float> hx           = {1.0f, 1.0f};
+    std::vector<float> hy(m);
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+
+    hipsparseHandle_t   handle;
+    hipsparseMatDescr_t descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreate(&handle));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseScsrmv(handle,
+                                              HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                              m,
+                                              m,
+                                              nnz,
+                                              &alpha,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              dx,
+                                              &beta,
+                                              dy));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(float) * m, hipMemcpyDeviceToHost));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyMatDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroy(handle));
+
+    return (hy[0] == 2.0f && hy[1] == 4.0f) ? HIPSPARSE_STATUS_SUCCESS
+                                            : HIPSPARSE_STATUS_INTERNAL_ERROR;
+}
+
+// Checks the trace, bench and profile output of real calls. The logging configuration is
+// read from the environment once per process, such that the calls are made in a child
+// process that runs the test executable from the start. Trace and bench logging share a
+// single file.
+void testing_logging_layer(void)
+{
+    std::string log_path     = logging_path("trace_bench.log");
+    std::string profile_path = logging_path("profile.json");
+
+    setenv("HIPSPARSE_LAYER", "7", 1);
+    setenv("HIPSPARSE_LOG_TRACE_PATH", log_path.c_str(), 1);
+    setenv("HIPSPARSE_LOG_BENCH_PATH", log_path.c_str(), 1);
+    setenv("HIPSPARSE_LOG_PROFILE_PATH", profile_path.c_str(), 1);
+    setenv("HIPSPARSE_LOG_PROFILE_FORMAT", "json", 1);
+
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_EXIT(exit(logging_layer_calls() == HIPSPARSE_STATUS_SUCCESS ? EXIT_SUCCESS
+                                                                       : EXIT_FAILURE),
+                ::testing::ExitedWithCode(EXIT_SUCCESS),
+                "");
+
+    unsetenv("HIPSPARSE_LAYER");
+    unsetenv("HIPSPARSE_LOG_TRACE_PATH");
+    unsetenv("HIPSPARSE_LOG_BENCH_PATH");
+    unsetenv("HIPSPARSE_LOG_PROFILE_PATH");
+    unsetenv("HIPSPARSE_LOG_PROFILE_FORMAT");
+
+    // Each csrmv is traced, followed by the command of the benchmark client
+    std::vector<std::string> lines = logging_read_lines(log_path);
+
+    std::string bench = "./hipsparse-bench -f csrmv -r s --transposeA N --sizem 2 --sizen 2 "
+                        "--sizennz 2 --alpha 2 --beta 0 --indexbaseA 0";
+
+    int calls_gold = 2;
+    int calls      = 0;
+    int bench_gold = 2;
+    int benched    = 0;
+
+    for(size_t i = 0; i < lines.size(); ++i)
+    {
+        if(lines[i].compare(0, 16, "hipsparseScsrmv,") == 0)
+        {
+            ++calls;
+            benched += (i + 1 < lines.size() && lines[i + 1] == bench);
+        }
+    }
+
+    unit_check_general(1, 1, 1, &calls_gold, &calls);
+    unit_check_general(1, 1, 1, &bench_gold, &benched);
+
+    // The profile is a single JSON array, that also holds the handle of the version query
+    // of the test executable
+    std::ifstream      file(profile_path);
+    std::ostringstream profile;
+    profile << file.rdbuf();
+
+    std::string json  = profile.str();
+    std::string begin = "[\n  {\n    \"handle\": ";
+    std::string end   = "\n    ]\n  }\n]\n";
+    std::string csrmv = "{\"name\": \"hipsparseScsrmv\", \"calls\": 2, \"time_us\": ";
+    std::string mode  = "{\"name\": \"hipsparseSetPointerMode\", \"calls\": 1, ";
+
+    int one_i = 1;
+    int valid = json.size() > begin.size() + end.size() && json.compare(0, begin.size(), begin) == 0
+                && json.compare(json.size() - end.size(), end.size(), end) == 0
+                && json.find("\n  }\n  {") == std::string::npos
+                && json.find(csrmv) != std::string::npos
+                && json.find(mode) != std::string::npos;
+
+    if(!valid)
+    {
+        std::cerr << "Profile:\n" << json << std::endl;
+    }
+
+    unit_check_general(1, 1, 1, &one_i, &valid);
+
+    std::remove(log_path.c_str());
+    std::remove(profile_path.c_str());
+}
+
+#endif // TESTING_LOGGING_HPP
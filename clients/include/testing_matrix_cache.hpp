@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_MATRIX_CACHE_HPP
+#define TESTING_MATRIX_CACHE_HPP
+
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Checks sharing and eviction of cached matrix views, using a local cache. No device required.
+void testing_matrix_cache(void)
+{
+    std::string filename = hipsparse_exepath() + "hipsparse_matrix_cache_test.bin";
+
+    std::vector<int>    file_ptr = {0, 2, 3};
+    std::vector<int>    file_ind = {0, 1, 1};
+    std::vector<double> file_val = {1.0, 2.0, 3.0};
+
+    ASSERT_EQ(csr_bin_write(filename.c_str(),
+                            2,
+                            2,
+                            3,
+                            sizeof(int),
+                            file_ptr.data(),
+                            sizeof(int),
+                            file_ind.data(),
+                            csr_bin_r64f,
+                            file_val.data(),
+                            0,
+                            mtx_general),
+              0);
+
+    // Room for two views of float or one view of float and one view of double
+    size_t view_bytes   = 3 * sizeof(int) + 3 * sizeof(int) + 3 * sizeof(float);
+    size_t double_bytes = 3 * sizeof(int) + 3 * sizeof(int) + 3 * sizeof(double);
+
+    matrix_cache cache(view_bytes + double_bytes);
+
+    auto get = [&](hipsparseIndexBase_t base) {
+        return cache.get<int, int, float>(filename, base);
+    };
+
+    auto zero = get(HIPSPARSE_INDEX_BASE_ZERO);
+    ASSERT_TRUE(zero != nullptr);
+
+    EXPECT_EQ(zero->m, 2);
+    EXPECT_EQ(zero->nnz, 3);
+    EXPECT_EQ(cache.misses(), 1u);
+
+    // Repeated requests share the view
+    EXPECT_EQ(get(HIPSPARSE_INDEX_BASE_ZERO), zero);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.bytes(), view_bytes);
+
+    // A different base is derived lazily from the same file
+    auto one = get(HIPSPARSE_INDEX_BASE_ONE);
+    ASSERT_TRUE(one != nullptr);
+
+    std::vector<int>   gold_ptr = {1, 3, 4};
+    std::vector<int>   gold_col = {1, 2, 2};
+    std::vector<float> gold_val = {1.0f, 2.0f, 3.0f};
+
+    unit_check_general(1, 3, 1, gold_ptr.data(), (int*)one->ptr.data());
+    unit_check_general(1, 3, 1, gold_col.data(), (int*)one->col.data());
+    unit_check_general(1, 3, 1, gold_val.data(), (float*)one->val.data());
+
+    EXPECT_EQ(cache.bytes(), 2 * view_bytes);
+
+    // Touch the zero based view, such that the one based view is evicted first
+    get(HIPSPARSE_INDEX_BASE_ZERO);
+    cache.get<int, int, double>(filename, HIPSPARSE_INDEX_BASE_ZERO);
+
+    size_t hits = cache.hits();
+    EXPECT_EQ(get(HIPSPARSE_INDEX_BASE_ZERO), zero);
+    EXPECT_EQ(cache.hits(), hits + 1);
+    EXPECT_NE(get(HIPSPARSE_INDEX_BASE_ONE), one);
+    EXPECT_LE(cache.bytes(), view_bytes + double_bytes);
+
+    // Views stay valid after the cache is cleared
+    cache.clear();
+    EXPECT_EQ(cache.bytes(), 0u);
+    EXPECT_EQ(one->ptr[2], 4);
+
+    remove(filename.c_str());
+
+    EXPECT_TRUE(get(HIPSPARSE_INDEX_BASE_ZERO) == nullptr);
+}
+
+#endif // TESTING_MATRIX_CACHE_HPP
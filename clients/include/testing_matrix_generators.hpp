@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_MATRIX_GENERATORS_HPP
+#define TESTING_MATRIX_GENERATORS_HPP
+
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <vector>
+
+// Checks that all rows have strictly increasing columns within [0, n)
+static void generators_check_rows(int                     m,
+                                  int                     n,
+                                  const std::vector<int>& ptr,
+                                  const std::vector<int>& col,
+                                  int                     idx_base)
+{
+    ASSERT_EQ(ptr[0], idx_base);
+
+    for(int i = 0; i < m; ++i)
+    {
+        for(int k = ptr[i] - idx_base; k < ptr[i + 1] - idx_base; ++k)
+        {
+            ASSERT_GE(col[k] - idx_base, 0);
+            ASSERT_LT(col[k] - idx_base, n);
+
+            if(k > ptr[i] - idx_base)
+            {
+                ASSERT_LT(col[k - 1], col[k]);
+            }
+        }
+    }
+}
+
+// Checks the structure of all generated matrices. No device required.
+void testing_matrix_generators(void)
+{
+    int                 m;
+    int                 n;
+    std::vector<int>    ptr;
+    std::vector<int>    col;
+    std::vector<double> val;
+
+    // 3D laplacians, nnz per dimension is 3 * ndim - 2 for 3 point stencils
+    gen_matrix(hipsparse_generator_laplace3d_7pt,
+               10,
+               0,
+               1,
+               m,
+               n,
+               ptr,
+               col,
+               val,
+               HIPSPARSE_INDEX_BASE_ZERO);
+
+    EXPECT_EQ(m, 1000);
+    EXPECT_EQ(n, 1000);
+    EXPECT_EQ(ptr[m], 7 * 1000 - 6 * 100);
+    generators_check_rows(m, n, ptr, col, 0);
+
+    gen_matrix(hipsparse_generator_laplace3d_27pt,
+               10,
+               0,
+               1,
+               m,
+               n,
+               ptr,
+               col,
+               val,
+               HIPSPARSE_INDEX_BASE_ONE);
+
+    EXPECT_EQ(m, 1000);
+    EXPECT_EQ(ptr[m] - 1, 28 * 28 * 28);
+    generators_check_rows(m, n, ptr, col, 1);
+
+    // FEM-like, one dense 2 x 2 block per coupling of the 27 point neighborhood
+    gen_matrix(
+        hipsparse_generator_fem_block, 6, 2, 1, m, n, ptr, col, val, HIPSPARSE_INDEX_BASE_ZERO);
+
+    EXPECT_EQ(m, 6 * 6 * 6 * 2);
+    EXPECT_EQ(ptr[m], 16 * 16 * 16 * 4);
+    generators_check_rows(m, n, ptr, col, 0);
+
+    // Banded, rows near the boundary are shorter
+    gen_matrix(
+        hipsparse_generator_banded, 100, 3, 1, m, n, ptr, col, val, HIPSPARSE_INDEX_BASE_ZERO);
+
+    EXPECT_EQ(m, 100);
+    EXPECT_EQ(ptr[m], 100 * 7 - 2 * (3 + 2 + 1));
+    generators_check_rows(m, n, ptr, col, 0);
+
+    // R-MAT, deterministic for a given seed and with skewed row lengths
+    gen_matrix(
+        hipsparse_generator_rmat, 12, 16, 7, m, n, ptr, col, val, HIPSPARSE_INDEX_BASE_ZERO);
+
+    EXPECT_EQ(m, 4096);
+    EXPECT_LE(ptr[m], 16 * 4096);
+    generators_check_rows(m, n, ptr, col, 0);
+
+    int max_row = 0;
+    for(int i = 0; i < m; ++i)
+    {
+        max_row = std::max(max_row, ptr[i + 1] - ptr[i]);
+    }
+
+    EXPECT_GT(max_row, 10 * ptr[m] / m);
+
+    std::vector<int>    ptr_one;
+    std::vector<int>    col_one;
+    std::vector<double> val_one;
+
+    gen_matrix(hipsparse_generator_rmat,
+               12,
+               16,
+               7,
+               m,
+               n,
+               ptr_one,
+               col_one,
+               val_one,
+               HIPSPARSE_INDEX_BASE_ONE);
+
+    ASSERT_EQ(ptr_one[m] - 1, ptr[m]);
+
+    for(int i = 0; i < m + 1; ++i)
+    {
+        ASSERT_EQ(ptr_one[i], ptr[i] + 1);
+    }
+
+    for(int k = 0; k < ptr[m]; ++k)
+    {
+        ASSERT_EQ(col_one[k], col[k] + 1);
+    }
+
+    unit_check_general(1, ptr[m], 1, val.data(), val_one.data());
+
+    gen_matrix(hipsparse_generator_rmat,
+               12,
+               16,
+               8,
+               m,
+               n,
+               ptr_one,
+               col_one,
+               val_one,
+               HIPSPARSE_INDEX_BASE_ZERO);
+
+    EXPECT_TRUE(ptr_one != ptr || col_one != col);
+}
+
+#endif // TESTING_MATRIX_GENERATORS_HPP
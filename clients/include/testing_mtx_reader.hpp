@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_MTX_READER_HPP
+#define TESTING_MTX_READER_HPP
+
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+static void mtx_reader_write(const std::string& filename, const std::string& content)
+{
+    FILE* f = fopen(filename.c_str(), "wb");
+    ASSERT_TRUE(f != nullptr);
+    fwrite(content.data(), 1, content.size(), f);
+    fclose(f);
+}
+
+template <typename T>
+static void mtx_reader_check(const std::string&      filename,
+                             hipsparseIndexBase_t    idx_base,
+                             int                     gold_m,
+                             int                     gold_n,
+                             const std::vector<int>& gold_row,
+                             const std::vector<int>& gold_col,
+                             const std::vector<T>&   gold_val)
+{
+    int              m;
+    int              n;
+    int              nnz;
+    std::vector<int> row;
+    std::vector<int> col;
+    std::vector<T>   val;
+
+    ASSERT_EQ(read_mtx_matrix(filename.c_str(), m, n, nnz, row, col, val, idx_base), 0);
+
+    ASSERT_EQ(m, gold_m);
+    ASSERT_EQ(n, gold_n);
+    ASSERT_EQ(nnz, (int)gold_row.size());
+
+    unit_check_general(1, nnz, 1, (int*)gold_row.data(), row.data());
+    unit_check_general(1, nnz, 1, (int*)gold_col.data(), col.data());
+    unit_check_general(1, nnz, 1, (T*)gold_val.data(), val.data());
+}
+
+// Reads small MatrixMarket files covering all supported qualifiers. No device required.
+void testing_mtx_reader(void)
+{
+    std::string filename = hipsparse_exepath() + "hipsparse_mtx_reader_test.mtx";
+
+    // General, unsorted entries with comments, blank lines and CRLF line endings
+    mtx_reader_write(filename,
+                     "%%MatrixMarket matrix coordinate real general\r\n"
+                     "% comment\r\n"
+                     "\r\n"
+                     "3 4 5\r\n"
+                     "3 4 -1.5e2\r\n"
+                     "1 2 0.25\r\n"
+                     "\r\n"
+                     "  2 1   3\r\n"
+                     "1 1 -7.0E-1\r\n"
+                     "3 2 12345678901234567890\r\n");
+
+    mtx_reader_check<double>(filename,
+                             HIPSPARSE_INDEX_BASE_ZERO,
+                             3,
+                             4,
+                             {0, 0, 1, 2, 2},
+                             {0, 1, 0, 1, 3},
+                             {-0.7, 0.25, 3.0, 12345678901234567890.0, -150.0});
+    mtx_reader_check<float>(filename,
+                            HIPSPARSE_INDEX_BASE_ONE,
+                            3,
+                            4,
+                            {1, 1, 2, 3, 3},
+                            {1, 2, 1, 2, 4},
+                            {-0.7f, 0.25f, 3.0f, (float)12345678901234567890.0, -150.0f});
+
+    // Symmetric, the diagonal is not mirrored
+    mtx_reader_write(filename,
+                     "%%MatrixMarket matrix coordinate real symmetric\n"
+                     "3 3 3\n"
+                     "1 1 1\n"
+                     "3 1 2\n"
+                     "3 2 3\n");
+
+    mtx_reader_check<double>(filename,
+                             HIPSPARSE_INDEX_BASE_ZERO,
+                             3,
+                             3,
+                             {0, 0, 1, 2, 2},
+                             {0, 2, 2, 0, 1},
+                             {1.0, 2.0, 3.0, 2.0, 3.0});
+
+    // Skew-symmetric, mirrored entries are negated
+    mtx_reader_write(filename,
+                     "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+                     "2 2 1\n"
+                     "2 1 4\n");
+
+    mtx_reader_check<double>(
+        filename, HIPSPARSE_INDEX_BASE_ZERO, 2, 2, {0, 1}, {1, 0}, {-4.0, 4.0});
+
+    // Hermitian, mirrored entries are conjugated
+    mtx_reader_write(filename,
+                     "%%MatrixMarket matrix coordinate complex hermitian\n"
+                     "2 2 2\n"
+                     "1 1 1 0\n"
+                     "2 1 2 -3\n");
+
+    mtx_reader_check<hipDoubleComplex>(filename,
+                                       HIPSPARSE_INDEX_BASE_ZERO,
+                                       2,
+                                       2,
+                                       {0, 0, 1},
+                                       {0, 1, 0},
+                                       {make_DataType<hipDoubleComplex>(1.0, 0.0),
+                                        make_DataType<hipDoubleComplex>(2.0, 3.0),
+                                        make_DataType<hipDoubleComplex>(2.0, -3.0)});
+
+    // Pattern
+    mtx_reader_write(filename,
+                     "%%MatrixMarket matrix coordinate pattern general\n"
+                     "2 2 2\n"
+                     "2 2\n"
+                     "1 2\n");
+
+    mtx_reader_check<hipComplex>(filename,
+                                 HIPSPARSE_INDEX_BASE_ZERO,
+                                 2,
+                                 2,
+                                 {0, 1},
+                                 {1, 1},
+                                 {make_DataType<hipComplex>(1.0), make_DataType<hipComplex>(1.0)});
+
+    // Large enough to be split into several chunks, with many entries per row
+    {
+        int m   = 1000;
+        int n   = 700;
+        int nnz = 50000;
+
+        std::string content = "%%MatrixMarket matrix coordinate real general\n";
+        content += std::to_string(m) + " " + std::to_string(n) + " " + std::to_string(nnz) + "\n";
+
+        // Entry k is stored in row k % m, in descending column order within a row
+        std::vector<int>    gold_row(nnz);
+        std::vector<int>    gold_col(nnz);
+        std::vector<double> gold_val(nnz);
+
+        for(int k = 0; k < nnz; ++k)
+        {
+            int i = k % m;
+            int j = (n - 1) - (k / m);
+
+            content += std::to_string(i + 1) + " " + std::to_string(j + 1) + " "
+                       + std::to_string(k) + ".5\n";
+
+            int idx       = i * (nnz / m) + (nnz / m - 1 - k / m);
+            gold_row[idx] = i;
+            gold_col[idx] = j;
+            gold_val[idx] = k + 0.5;
+        }
+
+        mtx_reader_write(filename, content);
+        mtx_reader_check<double>(
+            filename, HIPSPARSE_INDEX_BASE_ZERO, m, n, gold_row, gold_col, gold_val);
+    }
+
+    // Malformed entries and truncated files are rejected
+    {
+        int                 m;
+        int                 n;
+        int                 nnz;
+        std::vector<int>    row;
+        std::vector<int>    col;
+        std::vector<double> val;
+
+        mtx_reader_write(filename,
+                         "%%MatrixMarket matrix coordinate real general\n"
+                         "2 2 2\n"
+                         "1 1 x\n"
+                         "2 2 1\n");
+        EXPECT_EQ(
+            read_mtx_matrix(filename.c_str(), m, n, nnz, row, col, val, HIPSPARSE_INDEX_BASE_ZERO),
+            -1);
+
+        mtx_reader_write(filename,
+                         "%%MatrixMarket matrix coordinate real general\n"
+                         "2 2 3\n"
+                         "1 1 1\n"
+                         "2 2 1\n");
+        EXPECT_EQ(
+            read_mtx_matrix(filename.c_str(), m, n, nnz, row, col, val, HIPSPARSE_INDEX_BASE_ZERO),
+            -1);
+
+        mtx_reader_write(filename,
+                         "%%MatrixMarket matrix coordinate real general\n"
+                         "2 2 1\n"
+                         "3 1 1\n");
+        EXPECT_EQ(
+            read_mtx_matrix(filename.c_str(), m, n, nnz, row, col, val, HIPSPARSE_INDEX_BASE_ZERO),
+            -1);
+    }
+
+    remove(filename.c_str());
+}
+
+#endif // TESTING_MTX_READER_HPP
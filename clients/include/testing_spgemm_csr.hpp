@@ -26,6 +26,7 @@
 #define TESTING_SPGEMM_CSR_HPP
 
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_csrgemm2.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
@@ -333,6 +334,31 @@ void testing_spgemm_csr_bad_arg(void)
             handle, transA, transB, &alpha, A, B, &beta, nullptr, dataType, alg, descr),
         "Error: C is nullptr");
 
+#if(!defined(CUDART_VERSION))
+    // SpGEMM scalar hints
+    hipsparseScalarHint_t alphaHint;
+    hipsparseScalarHint_t betaHint;
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_setScalarHints(
+            nullptr, HIPSPARSE_SCALAR_HINT_NONZERO, HIPSPARSE_SCALAR_HINT_ZERO),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_setScalarHints(
+            descr, (hipsparseScalarHint_t)3, HIPSPARSE_SCALAR_HINT_ZERO),
+        "Error: alphaHint is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_setScalarHints(
+            descr, HIPSPARSE_SCALAR_HINT_NONZERO, (hipsparseScalarHint_t)3),
+        "Error: betaHint is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_getScalarHints(nullptr, &alphaHint, &betaHint),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_getScalarHints(descr, nullptr, &betaHint), "Error: alphaHint is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_getScalarHints(descr, &alphaHint, nullptr), "Error: betaHint is nullptr");
+#endif
+
     // Destruct
     verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
     verify_hipsparse_status_success(hipsparseDestroySpMat(B), "success");
@@ -371,8 +397,18 @@ hipsparseStatus_t testing_spgemm_csr(void)
     std::unique_ptr<handle_struct> test_handle(new handle_struct);
     hipsparseHandle_t              handle = test_handle->handle;
 
-    std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
-    hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+    // Each product has its own SpGEMM descriptor
+    std::unique_ptr<spgemm_struct> unique_ptr_descr_1(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr_1 = unique_ptr_descr_1->descr;
+
+    std::unique_ptr<spgemm_struct> unique_ptr_descr_2(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr_2 = unique_ptr_descr_2->descr;
+
+#if(!defined(CUDART_VERSION))
+    // alpha is non-zero and beta is zero, device pointer mode does not need to read them
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_setScalarHints(
+        descr_2, HIPSPARSE_SCALAR_HINT_NONZERO, HIPSPARSE_SCALAR_HINT_ZERO));
+#endif
 
     // Host structures
     std::vector<I> hcsr_row_ptr_A;
@@ -513,7 +549,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                          C1,
                                                          typeT,
                                                          alg,
-                                                         descr,
+                                                         descr_1,
                                                          &bufferSize1,
                                                          nullptr));
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
@@ -527,7 +563,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                          C2,
                                                          typeT,
                                                          alg,
-                                                         descr,
+                                                         descr_2,
                                                          &bufferSize1,
                                                          nullptr));
 
@@ -546,7 +582,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                          C1,
                                                          typeT,
                                                          alg,
-                                                         descr,
+                                                         descr_1,
                                                          &bufferSize1,
                                                          externalBuffer1));
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
@@ -560,7 +596,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                          C2,
                                                          typeT,
                                                          alg,
-                                                         descr,
+                                                         descr_2,
                                                          &bufferSize1,
                                                          externalBuffer1));
 
@@ -580,7 +616,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                   C1,
                                                   typeT,
                                                   alg,
-                                                  descr,
+                                                  descr_1,
                                                   &bufferSize2,
                                                   nullptr));
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
@@ -594,7 +630,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                   C2,
                                                   typeT,
                                                   alg,
-                                                  descr,
+                                                  descr_2,
                                                   &bufferSize2,
                                                   nullptr));
 
@@ -613,7 +649,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                   C1,
                                                   typeT,
                                                   alg,
-                                                  descr,
+                                                  descr_1,
                                                   &bufferSize2,
                                                   externalBuffer2));
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
@@ -627,7 +663,7 @@ hipsparseStatus_t testing_spgemm_csr(void)
                                                   C2,
                                                   typeT,
                                                   alg,
-                                                  descr,
+                                                  descr_2,
                                                   &bufferSize2,
                                                   externalBuffer2));
 
@@ -673,10 +709,10 @@ hipsparseStatus_t testing_spgemm_csr(void)
     // SpGEMM copy
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
-        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, descr));
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, descr_1));
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
-    CHECK_HIPSPARSE_ERROR(
-        hipsparseSpGEMM_copy(handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
+        handle, transA, transB, d_alpha, A, B, d_beta, C2, typeT, alg, descr_2));
 
     // Copy output from device to CPU
     std::vector<I> hcsr_row_ptr_C_1(m + 1);
@@ -767,4 +803,291 @@ hipsparseStatus_t testing_spgemm_csr(void)
 #endif
 }
 
+// Band matrix with the given number of off-diagonals on each side of the diagonal
+template <typename I, typename J, typename T>
+void spgemm_csr_band_matrix(J               m,
+                            J               bandwidth,
+                            std::vector<I>& csr_row_ptr,
+                            std::vector<J>& csr_col_ind,
+                            std::vector<T>& csr_val)
+{
+    csr_row_ptr.assign(m + 1, 0);
+    csr_col_ind.clear();
+    csr_val.clear();
+
+    for(J i = 0; i < m; ++i)
+    {
+        for(J j = std::max(i - bandwidth, (J)0); j <= std::min(i + bandwidth, m - 1); ++j)
+        {
+            csr_col_ind.push_back(j);
+            csr_val.push_back(make_DataType<T>((i + 2 * j) % 7 + 1));
+        }
+
+        csr_row_ptr[i + 1] = csr_col_ind.size();
+    }
+}
+
+// Repeated SpGEMM on the same matrix C, where the sparsity pattern of the product changes
+// from one call to the next
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spgemm_csr_repeated(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+    J                    m        = 100;
+    T                    h_alpha  = make_DataType<T>(1.0);
+    T                    h_beta   = make_DataType<T>(0.0);
+    hipsparseOperation_t trans    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseSpGEMMAlg_t alg      = HIPSPARSE_SPGEMM_DEFAULT;
+
+    // The product grows, shrinks and grows again
+    J bandwidths[] = {1, 3, 0, 2};
+
+    // Index and data type
+    hipsparseIndexType_t typeI
+        = (typeid(I) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipsparseIndexType_t typeJ
+        = (typeid(J) == typeid(int32_t)) ? HIPSPARSE_INDEX_32I : HIPSPARSE_INDEX_64I;
+    hipDataType typeT = (typeid(T) == typeid(float))
+                            ? HIP_R_32F
+                            : ((typeid(T) == typeid(double))
+                                   ? HIP_R_64F
+                                   : ((typeid(T) == typeid(hipComplex) ? HIP_C_32F : HIP_C_64F)));
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    auto dcsr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+
+    I* dcsr_row_ptr_C = (I*)dcsr_row_ptr_C_managed.get();
+
+    if(!dcsr_row_ptr_C)
+    {
+        verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED, "!dcsr_row_ptr_C");
+        return HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    hipsparseSpMatDescr_t C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &C, m, m, 0, dcsr_row_ptr_C, nullptr, nullptr, typeI, typeJ, idx_base, typeT));
+
+    // Arrays of C have to stay valid until they have been replaced by the next product
+    std::vector<hipsparse_unique_ptr> dcsr_C_managed;
+
+    for(J bandwidth : bandwidths)
+    {
+        // C = A * A
+        std::vector<I> hcsr_row_ptr_A;
+        std::vector<J> hcsr_col_ind_A;
+        std::vector<T> hcsr_val_A;
+
+        spgemm_csr_band_matrix(m, bandwidth, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A);
+
+        I nnz_A = hcsr_row_ptr_A[m];
+
+        auto dcsr_row_ptr_A_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+        auto dcsr_col_ind_A_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_A), device_free};
+        auto dcsr_val_A_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+
+        I* dcsr_row_ptr_A = (I*)dcsr_row_ptr_A_managed.get();
+        J* dcsr_col_ind_A = (J*)dcsr_col_ind_A_managed.get();
+        T* dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+
+        if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A)
+        {
+            verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                            "!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A");
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+
+        hipsparseSpMatDescr_t A;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                                 m,
+                                                 m,
+                                                 nnz_A,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 dcsr_val_A,
+                                                 typeI,
+                                                 typeJ,
+                                                 idx_base,
+                                                 typeT));
+
+        // SpGEMM work estimation
+        size_t bufferSize1;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                             trans,
+                                                             trans,
+                                                             &h_alpha,
+                                                             A,
+                                                             A,
+                                                             &h_beta,
+                                                             C,
+                                                             typeT,
+                                                             alg,
+                                                             descr,
+                                                             &bufferSize1,
+                                                             nullptr));
+
+        auto externalBuffer1_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize1), device_free};
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                             trans,
+                                                             trans,
+                                                             &h_alpha,
+                                                             A,
+                                                             A,
+                                                             &h_beta,
+                                                             C,
+                                                             typeT,
+                                                             alg,
+                                                             descr,
+                                                             &bufferSize1,
+                                                             externalBuffer1_managed.get()));
+
+        // SpGEMM compute, C still refers to the arrays of the previous product
+        size_t bufferSize2;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                      trans,
+                                                      trans,
+                                                      &h_alpha,
+                                                      A,
+                                                      A,
+                                                      &h_beta,
+                                                      C,
+                                                      typeT,
+                                                      alg,
+                                                      descr,
+                                                      &bufferSize2,
+                                                      nullptr));
+
+        auto externalBuffer2_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize2), device_free};
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                      trans,
+                                                      trans,
+                                                      &h_alpha,
+                                                      A,
+                                                      A,
+                                                      &h_beta,
+                                                      C,
+                                                      typeT,
+                                                      alg,
+                                                      descr,
+                                                      &bufferSize2,
+                                                      externalBuffer2_managed.get()));
+
+        // Allocate the arrays of C for the new pattern
+        int64_t rows_C, cols_C, nnz_C;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C, &rows_C, &cols_C, &nnz_C));
+
+        dcsr_C_managed.push_back(
+            hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_C), device_free});
+        J* dcsr_col_ind_C = (J*)dcsr_C_managed.back().get();
+
+        dcsr_C_managed.push_back(
+            hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free});
+        T* dcsr_val_C = (T*)dcsr_C_managed.back().get();
+
+        if(!dcsr_col_ind_C || !dcsr_val_C)
+        {
+            verify_hipsparse_status_success(HIPSPARSE_STATUS_ALLOC_FAILED,
+                                            "!dcsr_col_ind_C || !dcsr_val_C");
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCsrSetPointers(C, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C));
+
+        // SpGEMM copy
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
+            handle, trans, trans, &h_alpha, A, A, &h_beta, C, typeT, alg, descr));
+
+        // Copy output from device to CPU
+        std::vector<I> hcsr_row_ptr_C(m + 1);
+        std::vector<J> hcsr_col_ind_C(nnz_C);
+        std::vector<T> hcsr_val_C(nnz_C);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_row_ptr_C.data(), dcsr_row_ptr_C, sizeof(I) * (m + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_col_ind_C.data(), dcsr_col_ind_C, sizeof(J) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // Compute SpGEMM on host
+        std::vector<I> hcsr_row_ptr_C_gold(m + 1);
+
+        int64_t nnz_C_gold = csrgemm2_nnz(m,
+                                          m,
+                                          m,
+                                          &h_alpha,
+                                          hcsr_row_ptr_A.data(),
+                                          hcsr_col_ind_A.data(),
+                                          hcsr_row_ptr_A.data(),
+                                          hcsr_col_ind_A.data(),
+                                          (const T*)nullptr,
+                                          (const I*)nullptr,
+                                          (const J*)nullptr,
+                                          hcsr_row_ptr_C_gold.data(),
+                                          idx_base,
+                                          idx_base,
+                                          idx_base,
+                                          HIPSPARSE_INDEX_BASE_ZERO);
+
+        std::vector<J> hcsr_col_ind_C_gold(nnz_C_gold);
+        std::vector<T> hcsr_val_C_gold(nnz_C_gold);
+
+        csrgemm2(m,
+                 m,
+                 m,
+                 &h_alpha,
+                 hcsr_row_ptr_A.data(),
+                 hcsr_col_ind_A.data(),
+                 hcsr_val_A.data(),
+                 hcsr_row_ptr_A.data(),
+                 hcsr_col_ind_A.data(),
+                 hcsr_val_A.data(),
+                 (const T*)nullptr,
+                 (const I*)nullptr,
+                 (const J*)nullptr,
+                 (const T*)nullptr,
+                 hcsr_row_ptr_C_gold.data(),
+                 hcsr_col_ind_C_gold.data(),
+                 hcsr_val_C_gold.data(),
+                 idx_base,
+                 idx_base,
+                 idx_base,
+                 HIPSPARSE_INDEX_BASE_ZERO);
+
+        unit_check_general(1, 1, 1, &nnz_C_gold, &nnz_C);
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+        unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+        unit_check_general(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPGEMM_CSR_HPP
@@ -26,6 +26,7 @@
 #define TESTING_SPGEMMREUSE_CSR_HPP
 
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_csrgemm2.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
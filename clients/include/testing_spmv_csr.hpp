@@ -26,6 +26,7 @@
 #define TESTING_SPMV_CSR_HPP
 
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_csrmv.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
@@ -296,79 +297,17 @@ hipsparseStatus_t testing_spmv_csr(void)
     CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
     CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
 
-    // Query for warpSize
-    hipDeviceProp_t prop;
-    hipGetDeviceProperties(&prop, 0);
-
-    int WF_SIZE;
-    I   nnz_per_row = nnz / m;
-
-    if(prop.warpSize == 32)
-    {
-        if(nnz_per_row < 4)
-            WF_SIZE = 2;
-        else if(nnz_per_row < 8)
-            WF_SIZE = 4;
-        else if(nnz_per_row < 16)
-            WF_SIZE = 8;
-        else if(nnz_per_row < 32)
-            WF_SIZE = 16;
-        else
-            WF_SIZE = 32;
-    }
-    else if(prop.warpSize == 64)
-    {
-        if(nnz_per_row < 4)
-            WF_SIZE = 2;
-        else if(nnz_per_row < 8)
-            WF_SIZE = 4;
-        else if(nnz_per_row < 16)
-            WF_SIZE = 8;
-        else if(nnz_per_row < 32)
-            WF_SIZE = 16;
-        else if(nnz_per_row < 64)
-            WF_SIZE = 32;
-        else
-            WF_SIZE = 64;
-    }
-    else
-    {
-        return HIPSPARSE_STATUS_INTERNAL_ERROR;
-    }
-
-    for(J i = 0; i < m; ++i)
-    {
-        std::vector<T> sum(WF_SIZE, make_DataType<T>(0.0));
-
-        for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; j += WF_SIZE)
-        {
-            for(int k = 0; k < WF_SIZE; ++k)
-            {
-                if(j + k < hcsr_row_ptr[i + 1] - idx_base)
-                {
-                    sum[k] = testing_fma(
-                        h_alpha * hval[j + k], hx[hcol_ind[j + k] - idx_base], sum[k]);
-                }
-            }
-        }
-
-        for(int j = 1; j < WF_SIZE; j <<= 1)
-        {
-            for(int k = 0; k < WF_SIZE - j; ++k)
-            {
-                sum[k] = sum[k] + sum[k + j];
-            }
-        }
-
-        if(h_beta == make_DataType<T>(0.0))
-        {
-            hy_gold[i] = sum[0];
-        }
-        else
-        {
-            hy_gold[i] = testing_fma(h_beta, hy_gold[i], sum[0]);
-        }
-    }
+    // Host reference, load balanced by merge path
+    const T*                  hval_ptr = hval.data();
+    hipsparse::csr_view<I, J> hA       = {
+        m, n, hcsr_row_ptr.data(), hcol_ind.data(), nullptr, idx_base, idx_base, hval_ptr};
+
+    hipsparse::host_csrmv_merge_path(hA,
+                                     [hval_ptr](int64_t k) { return hval_ptr[k]; },
+                                     h_alpha,
+                                     hx.data(),
+                                     h_beta,
+                                     hy_gold.data());
 
     unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
     unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
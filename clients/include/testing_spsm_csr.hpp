@@ -26,6 +26,7 @@
 #define TESTING_SPSM_CSR_HPP
 
 #include "hipsparse_test_unique_ptr.hpp"
+#include "host_sptrsv.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
 
@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_UNIT_CHECK_HPP
+#define TESTING_UNIT_CHECK_HPP
+
+#include "unit.hpp"
+
+#include <cmath>
+#include <gtest/gtest-spi.h>
+#include <gtest/gtest.h>
+#include <hipsparse.h>
+#include <limits>
+#include <vector>
+
+// Matrices of the checks, EXPECT_FATAL_FAILURE cannot refer to local variables
+static std::vector<float>      unit_test_sA;
+static std::vector<float>      unit_test_sB;
+static std::vector<double>     unit_test_dA;
+static std::vector<double>     unit_test_dB;
+static std::vector<hipComplex> unit_test_cA;
+static std::vector<hipComplex> unit_test_cB;
+static std::vector<int>        unit_test_iA;
+static std::vector<int>        unit_test_iB;
+
+// Checks the parallel comparison of the unit checks against the gtest assertions they
+// report with. No device required.
+void testing_unit_check(void)
+{
+    // Large enough for the parallel path, the padding rows are not compared
+    const int64_t M   = 1000;
+    const int64_t N   = 300;
+    const int64_t lda = 1003;
+
+    unit_test_sA.assign(lda * N, 0.0f);
+    unit_test_dA.assign(lda * N, 0.0);
+    unit_test_cA.assign(lda * N, make_hipFloatComplex(0.0f, 0.0f));
+    unit_test_iA.assign(lda * N, 0);
+
+    for(int64_t j = 0; j < N; ++j)
+    {
+        for(int64_t i = 0; i < M; ++i)
+        {
+            float v = 1.0f + 0.25f * ((i * 7 + j * 13) % 97) - 12.0f;
+
+            unit_test_sA[i + j * lda] = v;
+            unit_test_dA[i + j * lda] = v;
+            unit_test_cA[i + j * lda] = make_hipFloatComplex(v, -v);
+            unit_test_iA[i + j * lda] = (int)(i + j);
+        }
+    }
+
+    unit_test_sB = unit_test_sA;
+    unit_test_dB = unit_test_dA;
+    unit_test_cB = unit_test_cA;
+    unit_test_iB = unit_test_iA;
+
+    // Differences in the padding are ignored
+    unit_test_sB[M] = 1.0f;
+    unit_test_iB[M] = -1;
+
+    unit_check_general(M, N, lda, unit_test_sA.data(), unit_test_sB.data());
+    unit_check_general(M, N, lda, unit_test_dA.data(), unit_test_dB.data());
+    unit_check_general(M, N, lda, unit_test_cA.data(), unit_test_cB.data());
+    unit_check_general(M, N, lda, unit_test_iA.data(), unit_test_iB.data());
+    unit_check_near(M, N, lda, unit_test_sA.data(), unit_test_sB.data());
+    unit_check_near(M, N, lda, unit_test_dA.data(), unit_test_dB.data());
+    unit_check_near(M, N, lda, unit_test_cA.data(), unit_test_cB.data());
+
+    // ASSERT_FLOAT_EQ accepts a distance of 4 ulps
+    int64_t idx = 517 + 211 * lda;
+    float   a   = unit_test_sA[idx];
+
+    unit_test_sB[idx] = std::nextafter(
+        std::nextafter(std::nextafter(std::nextafter(a, 100.0f), 100.0f), 100.0f), 100.0f);
+    unit_check_general(M, N, lda, unit_test_sA.data(), unit_test_sB.data());
+
+    unit_test_sB[idx] = std::nextafter(unit_test_sB[idx], 100.0f);
+    EXPECT_FATAL_FAILURE(
+        unit_check_general(1000, 300, 1003, unit_test_sA.data(), unit_test_sB.data()),
+        "Expected equality");
+
+    // Relative tolerance of unit_check_near
+    unit_test_sB[idx] = a + std::abs(a) * 0.5e-3f;
+    unit_check_near(M, N, lda, unit_test_sA.data(), unit_test_sB.data());
+
+    unit_test_sB[idx] = a + std::abs(a) * 2e-3f;
+    EXPECT_FATAL_FAILURE(
+        unit_check_near(1000, 300, 1003, unit_test_sA.data(), unit_test_sB.data()),
+        "The difference between");
+
+    // NaN never passes
+    unit_test_dB[idx] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FATAL_FAILURE(
+        unit_check_general(1000, 300, 1003, unit_test_dA.data(), unit_test_dB.data()),
+        "Expected equality");
+    EXPECT_FATAL_FAILURE(
+        unit_check_near(1000, 300, 1003, unit_test_dA.data(), unit_test_dB.data()), "");
+
+    // Imaginary part of a complex value in the last row
+    unit_test_cB[M - 1 + (N - 1) * lda].y += 1.0f;
+    EXPECT_FATAL_FAILURE(
+        unit_check_general(1000, 300, 1003, unit_test_cA.data(), unit_test_cB.data()),
+        "Expected equality");
+
+    // Integers are compared exactly
+    unit_test_iB[idx] += 1;
+    EXPECT_FATAL_FAILURE(
+        unit_check_general(1000, 300, 1003, unit_test_iA.data(), unit_test_iB.data()),
+        "Expected equality");
+}
+
+#endif // TESTING_UNIT_CHECK_HPP
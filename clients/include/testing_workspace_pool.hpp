@@ -0,0 +1,525 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_WORKSPACE_POOL_HPP
+#define TESTING_WORKSPACE_POOL_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cstdlib>
+#include <hipsparse.h>
+#include <workspace_pool.hpp>
+
+using namespace hipsparse_test;
+
+// Host allocator standing in for hipMalloc / hipFree, counting all calls
+struct workspace_mock_allocator
+{
+    int    num_allocate   = 0;
+    int    num_deallocate = 0;
+    size_t live_bytes     = 0;
+
+    // Number of allocations that succeed before allocations fail
+    int fail_after = -1;
+
+    std::vector<std::pair<void*, size_t>> blocks;
+
+    static void* allocate(size_t size, void* user_data)
+    {
+        workspace_mock_allocator* mock = (workspace_mock_allocator*)user_data;
+
+        if(mock->fail_after == 0)
+        {
+            return nullptr;
+        }
+
+        if(mock->fail_after > 0)
+        {
+            --mock->fail_after;
+        }
+
+        void* ptr = malloc(size);
+
+        ++mock->num_allocate;
+        mock->live_bytes += size;
+        mock->blocks.push_back(std::make_pair(ptr, size));
+
+        return ptr;
+    }
+
+    static void deallocate(void* ptr, void* user_data)
+    {
+        workspace_mock_allocator* mock = (workspace_mock_allocator*)user_data;
+
+        for(size_t i = 0; i < mock->blocks.size(); ++i)
+        {
+            if(mock->blocks[i].first == ptr)
+            {
+                mock->live_bytes -= mock->blocks[i].second;
+                mock->blocks.erase(mock->blocks.begin() + i);
+                break;
+            }
+        }
+
+        ++mock->num_deallocate;
+        free(ptr);
+    }
+
+    hipsparse::workspace_allocator get()
+    {
+        return {allocate, deallocate, this};
+    }
+};
+
+// Checks the workspace pool against the mock allocator, no device required
+void testing_workspace_pool_mock(void)
+{
+    int    zero_i  = 0;
+    int    one_i   = 1;
+    int    two_i   = 2;
+    size_t zero_sz = 0;
+
+    // Size classes
+    {
+        int c[5] = {hipsparse::workspace_pool::size_class(1),
+                    hipsparse::workspace_pool::size_class(256),
+                    hipsparse::workspace_pool::size_class(257),
+                    hipsparse::workspace_pool::size_class(4096),
+                    hipsparse::workspace_pool::size_class(4097)};
+        int c_gold[5] = {0, 0, 1, 4, 5};
+
+        unit_check_general(1, 5, 1, c_gold, c);
+    }
+
+    // Grow only policy re-uses released blocks of the same size class
+    {
+        workspace_mock_allocator mock;
+
+        {
+            hipsparse::workspace_pool pool(mock.get());
+
+            void* p1;
+            void* p2;
+            void* p3;
+
+            // Zero sized requests do not allocate
+            int success = pool.acquire(0, &p1);
+            unit_check_general(1, 1, 1, &one_i, &success);
+            unit_check_general(1, 1, 1, &zero_i, &mock.num_allocate);
+
+            pool.acquire(1000, &p1);
+            pool.release(p1);
+            pool.acquire(900, &p2);
+
+            // Same block is returned without allocating again
+            int same = (p1 == p2);
+            unit_check_general(1, 1, 1, &one_i, &mock.num_allocate);
+            unit_check_general(1, 1, 1, &one_i, &same);
+
+            // Larger request does not fit the cached class
+            pool.acquire(5000, &p3);
+            unit_check_general(1, 1, 1, &two_i, &mock.num_allocate);
+
+            pool.release(p2);
+            pool.release(p3);
+
+            size_t cached      = pool.cached_bytes();
+            size_t in_use      = pool.in_use_bytes();
+            size_t cached_gold = 1024 + 8192;
+            unit_check_general(1, 1, 1, &cached_gold, &cached);
+            unit_check_general(1, 1, 1, &zero_sz, &in_use);
+            unit_check_general(1, 1, 1, &zero_i, &mock.num_deallocate);
+
+            // Trimming returns all idle blocks
+            pool.trim();
+
+            size_t allocated = pool.allocated_bytes();
+            unit_check_general(1, 1, 1, &two_i, &mock.num_deallocate);
+            unit_check_general(1, 1, 1, &zero_sz, &allocated);
+            unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+
+            // Block in use at destruction
+            pool.acquire(100, &p1);
+        }
+
+        unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+        unit_check_general(1, 1, 1, &mock.num_allocate, &mock.num_deallocate);
+    }
+
+    // Trim policy only caches up to the reserved size
+    {
+        workspace_mock_allocator mock;
+
+        {
+            hipsparse::workspace_pool pool(mock.get());
+            pool.set_policy(hipsparse::workspace_pool::trim_to_reserve);
+
+            void* p1;
+            void* p2;
+
+            pool.acquire(1000, &p1);
+            pool.release(p1);
+
+            // Nothing reserved, block is returned immediately
+            unit_check_general(1, 1, 1, &one_i, &mock.num_deallocate);
+
+            // Reserve pre-allocates a cached block
+            pool.reserve(2048);
+            unit_check_general(1, 1, 1, &two_i, &mock.num_allocate);
+
+            pool.acquire(2000, &p1);
+            pool.acquire(2000, &p2);
+            pool.release(p1);
+            pool.release(p2);
+
+            // One block fits into the reserved size, the other one is freed
+            size_t cached      = pool.cached_bytes();
+            size_t cached_gold = 2048;
+            unit_check_general(1, 1, 1, &cached_gold, &cached);
+            unit_check_general(1, 1, 1, &two_i, &mock.num_deallocate);
+
+            // Releasing everything resets the reservation
+            pool.release_all();
+
+            size_t reserved = pool.reserved_bytes();
+            unit_check_general(1, 1, 1, &zero_sz, &reserved);
+            unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+        }
+
+        unit_check_general(1, 1, 1, &mock.num_allocate, &mock.num_deallocate);
+    }
+
+    // Switching to the trim policy or thawing the pool keeps the reserved block
+    {
+        workspace_mock_allocator mock;
+
+        {
+            hipsparse::workspace_pool pool(mock.get());
+
+            void* p1;
+            void* p2;
+            void* p3;
+
+            // Reserved size is rounded up to the block
+            pool.reserve(3000);
+
+            size_t reserved      = pool.reserved_bytes();
+            size_t reserved_gold = 4096;
+            unit_check_general(1, 1, 1, &reserved_gold, &reserved);
+
+            // Idle blocks beyond the reserved size, smaller and larger than the reserve
+            pool.acquire(3000, &p1);
+            pool.acquire(1000, &p2);
+            pool.acquire(10000, &p3);
+            pool.release(p1);
+            pool.release(p2);
+            pool.release(p3);
+
+            pool.set_policy(hipsparse::workspace_pool::trim_to_reserve);
+
+            size_t cached = pool.cached_bytes();
+            unit_check_general(1, 1, 1, &reserved_gold, &cached);
+            unit_check_general(1, 1, 1, &reserved_gold, &mock.live_bytes);
+
+            // The reserved block is served without the allocator
+            mock.fail_after = 0;
+
+            int success = pool.acquire(3000, &p1);
+            unit_check_general(1, 1, 1, &one_i, &success);
+
+            // Same after leaving the frozen state with extra blocks cached
+            mock.fail_after = -1;
+            pool.acquire(1000, &p2);
+            pool.set_frozen(true);
+            pool.release(p1);
+            pool.release(p2);
+            pool.set_frozen(false);
+
+            cached = pool.cached_bytes();
+            unit_check_general(1, 1, 1, &reserved_gold, &cached);
+
+            mock.fail_after = 0;
+
+            success = pool.acquire(3000, &p1);
+            unit_check_general(1, 1, 1, &one_i, &success);
+
+            pool.release(p1);
+        }
+
+        unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+    }
+
+    // Smaller requests are served by the smallest cached block that fits
+    {
+        workspace_mock_allocator mock;
+
+        {
+            hipsparse::workspace_pool pool(mock.get());
+
+            void* p1;
+            void* p2;
+            void* p3;
+
+            pool.reserve(1 << 20);
+            unit_check_general(1, 1, 1, &one_i, &mock.num_allocate);
+
+            // The reserved block serves a request of a smaller class
+            int success = pool.acquire(4096, &p1);
+            unit_check_general(1, 1, 1, &one_i, &success);
+            unit_check_general(1, 1, 1, &one_i, &mock.num_allocate);
+
+            int same = (p1 == mock.blocks[0].first);
+            unit_check_general(1, 1, 1, &one_i, &same);
+
+            // Reserving a smaller size is covered by the cached block as well
+            pool.release(p1);
+            pool.reserve(1000);
+            unit_check_general(1, 1, 1, &one_i, &mock.num_allocate);
+
+            // With blocks of several classes cached, the smallest fitting one is used
+            pool.acquire(1000, &p1);
+            pool.acquire(5000, &p2);
+            pool.release(p2);
+            pool.release(p1);
+
+            pool.acquire(300, &p3);
+            same = (p3 == p2);
+            unit_check_general(1, 1, 1, &one_i, &same);
+
+            size_t cached      = pool.cached_bytes();
+            size_t cached_gold = 1 << 20;
+            unit_check_general(1, 1, 1, &cached_gold, &cached);
+
+            pool.release(p3);
+        }
+
+        unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+    }
+
+    // Same for a frozen pool, which cannot fall back to the allocator
+    {
+        workspace_mock_allocator mock;
+
+        hipsparse::workspace_pool pool(mock.get());
+        pool.set_policy(hipsparse::workspace_pool::trim_to_reserve);
+        pool.reserve(4096);
+        pool.set_frozen(true);
+
+        void* p1;
+
+        int success = pool.acquire(100, &p1);
+        unit_check_general(1, 1, 1, &one_i, &success);
+        unit_check_general(1, 1, 1, &one_i, &mock.num_allocate);
+
+        pool.release(p1);
+
+        success = pool.acquire(4000, &p1);
+        unit_check_general(1, 1, 1, &one_i, &success);
+        unit_check_general(1, 1, 1, &one_i, &mock.num_allocate);
+
+        pool.release(p1);
+        pool.set_frozen(false);
+    }
+
+    // Dropping idle blocks after an allocation failure keeps the reserved block
+    {
+        workspace_mock_allocator mock;
+
+        hipsparse::workspace_pool pool(mock.get());
+        pool.reserve(4096);
+
+        void* p1;
+        void* p2;
+
+        pool.acquire(5000, &p1);
+        pool.release(p1);
+
+        mock.fail_after = 0;
+
+        int success = pool.acquire(20000, &p1);
+        unit_check_general(1, 1, 1, &zero_i, &success);
+
+        size_t cached      = pool.cached_bytes();
+        size_t cached_gold = 4096;
+        unit_check_general(1, 1, 1, &cached_gold, &cached);
+        unit_check_general(1, 1, 1, &cached_gold, &mock.live_bytes);
+
+        success = pool.acquire(3000, &p2);
+        unit_check_general(1, 1, 1, &one_i, &success);
+
+        pool.release(p2);
+    }
+
+    // Allocation failures are reported and idle blocks are dropped before giving up
+    {
+        workspace_mock_allocator mock;
+
+        hipsparse::workspace_pool pool(mock.get());
+
+        void* p1;
+        void* p2;
+
+        mock.fail_after = 1;
+
+        int success = pool.acquire(300, &p1);
+        unit_check_general(1, 1, 1, &one_i, &success);
+
+        pool.release(p1);
+
+        success       = pool.acquire(10000, &p2);
+        size_t cached = pool.cached_bytes();
+        unit_check_general(1, 1, 1, &zero_i, &success);
+        unit_check_general(1, 1, 1, &zero_sz, &cached);
+        unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+    }
+
+    // Frozen pool, as used for stream capture, never calls the allocator
+    {
+        workspace_mock_allocator mock;
+
+        {
+            hipsparse::workspace_pool pool(mock.get());
+            pool.set_policy(hipsparse::workspace_pool::trim_to_reserve);
+            pool.reserve(4096);
+
+            void* p1;
+            void* p2;
+
+            pool.set_frozen(true);
+
+            int num_allocate   = mock.num_allocate;
+            int num_deallocate = mock.num_deallocate;
+
+            // Reserved block is handed out
+            int success = pool.acquire(3000, &p1);
+            unit_check_general(1, 1, 1, &one_i, &success);
+
+            // Requests that are not cached fail, nothing is dropped to make room
+            success = pool.acquire(3000, &p2);
+            unit_check_general(1, 1, 1, &zero_i, &success);
+
+            success = pool.acquire(100000, &p2);
+            unit_check_general(1, 1, 1, &zero_i, &success);
+
+            success = pool.reserve(100000);
+            unit_check_general(1, 1, 1, &zero_i, &success);
+
+            // Released blocks are kept, independent of the policy
+            pool.release(p1);
+            pool.trim();
+            pool.release_all();
+
+            size_t cached      = pool.cached_bytes();
+            size_t cached_gold = 4096;
+            unit_check_general(1, 1, 1, &cached_gold, &cached);
+            unit_check_general(1, 1, 1, &num_allocate, &mock.num_allocate);
+            unit_check_general(1, 1, 1, &num_deallocate, &mock.num_deallocate);
+
+            // Blocks are returned once the pool is thawed
+            pool.set_frozen(false);
+            pool.trim();
+            unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+
+            // Frozen pool still releases everything on destruction
+            pool.acquire(500, &p1);
+            pool.release(p1);
+            pool.set_frozen(true);
+        }
+
+        unit_check_general(1, 1, 1, &zero_sz, &mock.live_bytes);
+        unit_check_general(1, 1, 1, &mock.num_allocate, &mock.num_deallocate);
+    }
+}
+
+void testing_workspace_pool_bad_arg(void)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparseWorkspacePolicy_t policy;
+    size_t                     size;
+
+    verify_hipsparse_status(hipsparseSetWorkspacePolicy(nullptr, HIPSPARSE_WORKSPACE_POLICY_TRIM),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status(hipsparseGetWorkspacePolicy(nullptr, &policy),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status(hipsparseGetWorkspaceSize(nullptr, &size),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status(hipsparseReserveWorkspace(nullptr, 1024),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status(hipsparseReleaseWorkspace(nullptr),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+
+    verify_hipsparse_status_invalid_value(hipsparseGetWorkspacePolicy(handle, nullptr),
+                                          "Error: policy is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGetWorkspaceSize(handle, nullptr),
+                                          "Error: size is nullptr");
+}
+
+hipsparseStatus_t testing_workspace_pool(void)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Default policy
+    hipsparseWorkspacePolicy_t policy;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePolicy(handle, &policy));
+
+    int policy_gold = HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY;
+    int policy_int  = policy;
+    unit_check_general(1, 1, 1, &policy_gold, &policy_int);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetWorkspacePolicy(handle, HIPSPARSE_WORKSPACE_POLICY_TRIM));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspacePolicy(handle, &policy));
+
+    policy_gold = HIPSPARSE_WORKSPACE_POLICY_TRIM;
+    policy_int  = policy;
+    unit_check_general(1, 1, 1, &policy_gold, &policy_int);
+
+    // Reserve device memory
+    size_t size;
+    CHECK_HIPSPARSE_ERROR(hipsparseReserveWorkspace(handle, 1 << 20));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size));
+
+    size_t size_gold = 1 << 20;
+    unit_check_general(1, 1, 1, &size_gold, &size);
+
+    // Release device memory
+    CHECK_HIPSPARSE_ERROR(hipsparseReleaseWorkspace(handle));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size));
+
+    size_gold = 0;
+    unit_check_general(1, 1, 1, &size_gold, &size);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_WORKSPACE_POOL_HPP
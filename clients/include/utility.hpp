@@ -25,7 +25,10 @@
 #ifndef TESTING_UTILITY_HPP
 #define TESTING_UTILITY_HPP
 
+#include "csr_bin.hpp"
 #include "hipsparse.h"
+#include "matrix_cache.hpp"
+#include "mtx_reader.hpp"
 #include <algorithm>
 #include <assert.h>
 #include <complex>
@@ -635,225 +638,464 @@ void gen_matrix_coo(I                    m,
 }
 
 /* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-static inline void read_mtx_value(std::istringstream& is, int& row, int& col, float& val)
+/*! \brief  Synthetic matrix generators for performance workloads */
+typedef enum hipsparse_matrix_generator_
 {
-    is >> row >> col >> val;
-}
+    hipsparse_generator_none = 0, /**< no generator */
+    hipsparse_generator_laplace3d_7pt, /**< 3D laplacian, 7 point stencil */
+    hipsparse_generator_laplace3d_27pt, /**< 3D laplacian, 27 point stencil */
+    hipsparse_generator_fem_block, /**< FEM-like matrix with dense blocks per node */
+    hipsparse_generator_rmat, /**< R-MAT power-law graph */
+    hipsparse_generator_banded /**< banded matrix */
+} hipsparse_matrix_generator;
 
-static inline void read_mtx_value(std::istringstream& is, int& row, int& col, double& val)
+static inline const char* hipsparse_generator_name(hipsparse_matrix_generator generator)
 {
-    is >> row >> col >> val;
+    switch(generator)
+    {
+    case hipsparse_generator_none:
+        return "none";
+    case hipsparse_generator_laplace3d_7pt:
+        return "laplace3d7";
+    case hipsparse_generator_laplace3d_27pt:
+        return "laplace3d27";
+    case hipsparse_generator_fem_block:
+        return "fem";
+    case hipsparse_generator_rmat:
+        return "rmat";
+    case hipsparse_generator_banded:
+        return "banded";
+    }
+
+    return "invalid";
 }
 
-static inline void read_mtx_value(std::istringstream& is, int& row, int& col, hipComplex& val)
+/*! \brief  Counter based random numbers. The value only depends on the seed and the index,
+ *  such that the parallel generators are deterministic for a given seed. */
+static inline uint64_t gen_hash(uint64_t seed, uint64_t i)
 {
-    float real;
-    float imag;
-
-    is >> row >> col >> real >> imag;
-
-    val = make_DataType<hipComplex>(real, imag);
+    // splitmix64
+    uint64_t z = seed + (i + 1) * 0x9e3779b97f4a7c15ull;
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
 }
 
-static inline void read_mtx_value(std::istringstream& is, int& row, int& col, hipDoubleComplex& val)
+// Uniform in [0, 1)
+static inline double gen_uniform(uint64_t seed, uint64_t i)
 {
-    double real;
-    double imag;
-
-    is >> row >> col >> real >> imag;
-
-    val = make_DataType<hipDoubleComplex>(real, imag);
+    return (gen_hash(seed, i) >> 11) * (1.0 / 9007199254740992.0);
 }
 
+// Integer values in [1, 10] like random_generator(), multiplied by sign
 template <typename T>
-int read_mtx_matrix(const char*          filename,
-                    int&                 nrow,
-                    int&                 ncol,
-                    int&                 nnz,
-                    std::vector<int>&    row,
-                    std::vector<int>&    col,
-                    std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
+inline T gen_value(uint64_t seed, uint64_t i, double sign = 1.0)
 {
-    const char* env = getenv("GTEST_LISTENER");
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
-    {
-        printf("Reading matrix %s...", filename);
-        fflush(stdout);
-    }
-
-    FILE* f = fopen(filename, "r");
-    if(!f)
-    {
-        return -1;
-    }
+    return make_DataType<T>(sign * (gen_hash(seed, 2 * i) % 10 + 1),
+                            sign * (gen_hash(seed, 2 * i + 1) % 10 + 1));
+}
 
-    char line[1024];
+/*! \brief  Build a CSR matrix row by row, in parallel. count(i) returns the number of
+ *  entries of row i, fill(i, col, val) writes them with sorted, zero based columns. */
+template <typename I, typename J, typename T, typename Count, typename Fill>
+void gen_csr_rows(J                    m,
+                  std::vector<I>&      ptr,
+                  std::vector<J>&      col,
+                  std::vector<T>&      val,
+                  hipsparseIndexBase_t idx_base,
+                  Count                count,
+                  Fill                 fill)
+{
+    ptr.resize(m + 1);
+    ptr[0] = 0;
 
-    // Check for banner
-    if(!fgets(line, 1024, f))
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < m; ++i)
     {
-        return -1;
+        ptr[i + 1] = count(i);
     }
 
-    char banner[16];
-    char array[16];
-    char coord[16];
-    char data[16];
-    char type[16];
-
-    // Extract banner
-    if(sscanf(line, "%15s %15s %15s %15s %15s", banner, array, coord, data, type) != 5)
+    for(J i = 0; i < m; ++i)
     {
-        return -1;
+        ptr[i + 1] += ptr[i];
     }
 
-    // Convert to lower case
-    for(char* p = array; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = coord; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = data; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = type; *p != '\0'; *p = tolower(*p), p++)
-        ;
-
-    // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14) != 0)
-    {
-        return -1;
-    }
+    col.resize(ptr[m]);
+    val.resize(ptr[m]);
 
-    // Check array type
-    if(strcmp(array, "matrix") != 0)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < m; ++i)
     {
-        return -1;
+        fill(i, col.data() + ptr[i], val.data() + ptr[i]);
     }
 
-    // Check coord
-    if(strcmp(coord, "coordinate") != 0)
+    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
     {
-        return -1;
-    }
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(J i = 0; i < m + 1; ++i)
+        {
+            ++ptr[i];
+        }
 
-    // Check data
-    if(strcmp(data, "real") != 0 && strcmp(data, "integer") != 0 && strcmp(data, "pattern") != 0)
-    {
-        return -1;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(I j = 0; j < ptr[m] - 1; ++j)
+        {
+            ++col[j];
+        }
     }
+}
 
-    // Check type
-    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
-    {
-        return -1;
-    }
+/* ============================================================================================ */
+/*! \brief  Generate 3D laplacian on unit cube in CSR format, with 7 or 27 point stencil */
+template <typename I, typename J, typename T>
+J gen_3d_laplacian(int                  ndim,
+                   int                  points,
+                   std::vector<I>&      ptr,
+                   std::vector<J>&      col,
+                   std::vector<T>&      val,
+                   hipsparseIndexBase_t idx_base)
+{
+    J n = (J)ndim * ndim * ndim;
 
-    // Symmetric flag
-    int symm = !strcmp(type, "symmetric");
+    // Loops over all neighbors of grid point i, in increasing column order
+    auto neighbors = [=](J i, J* c, T* v) {
+        J x = i % ndim;
+        J y = (i / ndim) % ndim;
+        J z = i / ((J)ndim * ndim);
 
-    // Skip comments
-    while(fgets(line, 1024, f))
-    {
-        if(line[0] != '%')
+        I nnz = 0;
+        for(int dz = -1; dz <= 1; ++dz)
         {
-            break;
+            for(int dy = -1; dy <= 1; ++dy)
+            {
+                for(int dx = -1; dx <= 1; ++dx)
+                {
+                    if(points == 7 && std::abs(dx) + std::abs(dy) + std::abs(dz) > 1)
+                    {
+                        continue;
+                    }
+
+                    if(x + dx < 0 || x + dx >= ndim || y + dy < 0 || y + dy >= ndim
+                       || z + dz < 0 || z + dz >= ndim)
+                    {
+                        continue;
+                    }
+
+                    if(c != nullptr)
+                    {
+                        c[nnz] = i + (dz * ndim + dy) * ndim + dx;
+                        v[nnz] = make_DataType<T>((dx == 0 && dy == 0 && dz == 0) ? points - 1.0
+                                                                                  : -1.0);
+                    }
+
+                    ++nnz;
+                }
+            }
         }
-    }
 
-    // Read dimensions
-    int snnz;
+        return nnz;
+    };
 
-    sscanf(line, "%d %d %d", &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
+    gen_csr_rows(
+        n,
+        ptr,
+        col,
+        val,
+        idx_base,
+        [&](J i) { return neighbors(i, nullptr, nullptr); },
+        [&](J i, J* c, T* v) { neighbors(i, c, v); });
 
-    std::vector<int> unsorted_row(nnz);
-    std::vector<int> unsorted_col(nnz);
-    std::vector<T>   unsorted_val(nnz);
+    return n;
+}
 
-    // Read entries
-    int idx = 0;
-    while(fgets(line, 1024, f))
-    {
-        if(idx >= nnz)
+/* ============================================================================================ */
+/*! \brief  Generate a FEM-like matrix in CSR format. Nodes of a ndim^3 grid are coupled to
+ *  their 27 point neighborhood, each coupling is a dense block of block_dim x block_dim
+ *  random values. The diagonal is dominant. */
+template <typename I, typename J, typename T>
+J gen_fem_block(int                  ndim,
+                int                  block_dim,
+                uint64_t             seed,
+                std::vector<I>&      ptr,
+                std::vector<J>&      col,
+                std::vector<T>&      val,
+                hipsparseIndexBase_t idx_base)
+{
+    J nodes = (J)ndim * ndim * ndim;
+    J n     = nodes * block_dim;
+
+    // Loops over all entries of row i, in increasing column order
+    auto entries = [=](J i, J* c, T* v) {
+        J node = i / block_dim;
+        J x    = node % ndim;
+        J y    = (node / ndim) % ndim;
+        J z    = node / ((J)ndim * ndim);
+
+        I nnz = 0;
+        for(int dz = -1; dz <= 1; ++dz)
         {
-            return true;
-        }
+            for(int dy = -1; dy <= 1; ++dy)
+            {
+                for(int dx = -1; dx <= 1; ++dx)
+                {
+                    if(x + dx < 0 || x + dx >= ndim || y + dy < 0 || y + dy >= ndim
+                       || z + dz < 0 || z + dz >= ndim)
+                    {
+                        continue;
+                    }
 
-        int irow;
-        int icol;
-        T   ival;
+                    J neighbor = node + (dz * ndim + dy) * ndim + dx;
 
-        std::istringstream ss(line);
+                    for(int b = 0; b < block_dim; ++b)
+                    {
+                        if(c != nullptr)
+                        {
+                            J j    = neighbor * block_dim + b;
+                            c[nnz] = j;
+                            v[nnz] = (i == j) ? make_DataType<T>(27.0 * 10.0 * block_dim)
+                                              : gen_value<T>(seed, (uint64_t)i * n + j, -1.0);
+                        }
 
-        if(!strcmp(data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = make_DataType<T>(1.0);
-        }
-        else
-        {
-            read_mtx_value(ss, irow, icol, ival);
+                        ++nnz;
+                    }
+                }
+            }
         }
 
-        if(idx_base == HIPSPARSE_INDEX_BASE_ZERO)
+        return nnz;
+    };
+
+    gen_csr_rows(
+        n,
+        ptr,
+        col,
+        val,
+        idx_base,
+        [&](J i) { return entries(i, nullptr, nullptr); },
+        [&](J i, J* c, T* v) { entries(i, c, v); });
+
+    return n;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a banded matrix in CSR format, with lower and upper bandwidth bw. The
+ *  diagonal is dominant. */
+template <typename I, typename J, typename T>
+void gen_banded(J                    m,
+                J                    n,
+                J                    bw,
+                uint64_t             seed,
+                std::vector<I>&      ptr,
+                std::vector<J>&      col,
+                std::vector<T>&      val,
+                hipsparseIndexBase_t idx_base)
+{
+    gen_csr_rows(
+        m,
+        ptr,
+        col,
+        val,
+        idx_base,
+        [=](J i) {
+            J begin = std::max(i - bw, (J)0);
+            J end   = std::min(i + bw + 1, n);
+            return (I)std::max(end - begin, (J)0);
+        },
+        [=](J i, J* c, T* v) {
+            J begin = std::max(i - bw, (J)0);
+            J end   = std::min(i + bw + 1, n);
+
+            for(J j = begin; j < end; ++j)
+            {
+                c[j - begin] = j;
+                v[j - begin] = (i == j) ? make_DataType<T>(10.0 * (2 * bw + 1))
+                                        : gen_value<T>(seed, (uint64_t)i * n + j);
+            }
+        });
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a R-MAT (recursive Kronecker) graph with 2^scale vertices and
+ *  edge_factor * 2^scale sampled edges in CSR format. Each edge descends scale levels into
+ *  one of the quadrants with probabilities a, b, c and 1 - a - b - c. Duplicate edges are
+ *  merged, such that row lengths follow a power-law distribution. */
+template <typename I, typename J, typename T>
+J gen_rmat(int                  scale,
+           int                  edge_factor,
+           uint64_t             seed,
+           std::vector<I>&      ptr,
+           std::vector<J>&      col,
+           std::vector<T>&      val,
+           hipsparseIndexBase_t idx_base,
+           double               a = 0.57,
+           double               b = 0.19,
+           double               c = 0.19)
+{
+    J       n      = (J)1 << scale;
+    int64_t nedges = (int64_t)edge_factor * n;
+
+    std::vector<J> edge_row(nedges);
+    std::vector<J> edge_col(nedges);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        J i = 0;
+        J j = 0;
+
+        for(int level = 0; level < scale; ++level)
         {
-            --irow;
-            --icol;
+            double r = gen_uniform(seed, (uint64_t)e * scale + level);
+
+            i = (i << 1) | (r >= a + b);
+            j = (j << 1) | ((r >= a && r < a + b) || r >= a + b + c);
         }
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+        edge_row[e] = i;
+        edge_col[e] = j;
+    }
+
+    // Bucket the edges by row
+    std::vector<int64_t> bucket(n + 1, 0);
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        ++bucket[edge_row[e] + 1];
+    }
 
-        ++idx;
+    for(J i = 0; i < n; ++i)
+    {
+        bucket[i + 1] += bucket[i];
+    }
 
-        if(symm && irow != icol)
-        {
-            if(idx >= nnz)
+    std::vector<J>       sorted_col(nedges);
+    std::vector<int64_t> offset(bucket.begin(), bucket.end() - 1);
+    for(int64_t e = 0; e < nedges; ++e)
+    {
+        sorted_col[offset[edge_row[e]]++] = edge_col[e];
+    }
+
+    // Sort and merge duplicates within each row
+    std::vector<I> row_nnz(n);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < n; ++i)
+    {
+        J* begin = sorted_col.data() + bucket[i];
+        J* end   = sorted_col.data() + bucket[i + 1];
+
+        std::sort(begin, end);
+        row_nnz[i] = (I)(std::unique(begin, end) - begin);
+    }
+
+    gen_csr_rows(
+        n,
+        ptr,
+        col,
+        val,
+        idx_base,
+        [&](J i) { return row_nnz[i]; },
+        [&](J i, J* cols, T* vals) {
+            for(I k = 0; k < row_nnz[i]; ++k)
             {
-                return true;
+                cols[k] = sorted_col[bucket[i] + k];
+                vals[k] = gen_value<T>(seed, (uint64_t)i * n + cols[k]);
             }
+        });
 
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
-        }
+    return n;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a matrix with one of the synthetic generators. The meaning of dim and
+ *  param depends on the generator, param 0 selects a default:
+ *  - laplace3d_7pt, laplace3d_27pt: dim grid points per dimension, param unused
+ *  - fem_block: dim grid points per dimension, param block size (default 3)
+ *  - rmat: dim log2 of the number of vertices, param edge factor (default 16)
+ *  - banded: dim rows and columns, param lower and upper bandwidth (default 8)
+ *  On return, m and n hold the dimensions of the matrix. */
+template <typename I, typename J, typename T>
+void gen_matrix(hipsparse_matrix_generator generator,
+                int                        dim,
+                int                        param,
+                int                        seed,
+                J&                         m,
+                J&                         n,
+                std::vector<I>&            ptr,
+                std::vector<J>&            col,
+                std::vector<T>&            val,
+                hipsparseIndexBase_t       idx_base)
+{
+    switch(generator)
+    {
+    case hipsparse_generator_laplace3d_7pt:
+        m = n = gen_3d_laplacian(dim, 7, ptr, col, val, idx_base);
+        break;
+    case hipsparse_generator_laplace3d_27pt:
+        m = n = gen_3d_laplacian(dim, 27, ptr, col, val, idx_base);
+        break;
+    case hipsparse_generator_fem_block:
+        m = n = gen_fem_block(dim, param ? param : 3, seed, ptr, col, val, idx_base);
+        break;
+    case hipsparse_generator_rmat:
+        m = n = gen_rmat(dim, param ? param : 16, seed, ptr, col, val, idx_base);
+        break;
+    case hipsparse_generator_banded:
+        m = n = dim;
+        gen_banded(m, n, (J)(param ? param : 8), seed, ptr, col, val, idx_base);
+        break;
+    case hipsparse_generator_none:
+        m = n = 0;
+        ptr.assign(1, idx_base);
+        col.clear();
+        val.clear();
+        break;
     }
-    fclose(f);
+}
 
-    row.resize(nnz);
-    col.resize(nnz);
-    val.resize(nnz);
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in COO format */
+static inline void mtx_set_value(hipComplex& val, double real, double imag)
+{
+    val = make_DataType<hipComplex>(real, imag);
+}
 
-    // Sort by row and column index
-    std::vector<int> perm(nnz);
-    for(int i = 0; i < nnz; ++i)
+static inline void mtx_set_value(hipDoubleComplex& val, double real, double imag)
+{
+    val = make_DataType<hipDoubleComplex>(real, imag);
+}
+
+template <typename T>
+int read_mtx_matrix(const char*          filename,
+                    int&                 nrow,
+                    int&                 ncol,
+                    int&                 nnz,
+                    std::vector<int>&    row,
+                    std::vector<int>&    col,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t idx_base)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
     {
-        perm[i] = i;
+        printf("Reading matrix %s...", filename);
+        fflush(stdout);
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
-
-    for(int i = 0; i < nnz; ++i)
+    if(mtx_read_coo(filename, nrow, ncol, nnz, row, col, val, idx_base) != 0)
     {
-        row[i] = unsorted_row[perm[i]];
-        col[i] = unsorted_col[perm[i]];
-        val[i] = unsorted_val[perm[i]];
+        return -1;
     }
 
     if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
@@ -866,7 +1108,21 @@ int read_mtx_matrix(const char*          filename,
 }
 
 /* ============================================================================================ */
-/*! \brief  Read matrix from binary file in CSR format */
+/*! \brief  Binary CSR value type codes of the complex types */
+template <>
+struct csr_bin_value_traits<hipComplex>
+{
+    static const uint8_t type = csr_bin_c32f;
+};
+
+template <>
+struct csr_bin_value_traits<hipDoubleComplex>
+{
+    static const uint8_t type = csr_bin_c64f;
+};
+
+/*! \brief  Read matrix from binary file in CSR format. The file is read once per process,
+ *  converted arrays are shared through the matrix cache. */
 template <typename I, typename J, typename T>
 int read_bin_matrix(const char*          filename,
                     J&                   nrow,
@@ -884,70 +1140,20 @@ int read_bin_matrix(const char*          filename,
         fflush(stdout);
     }
 
-    FILE* f = fopen(filename, "rb");
-    if(!f)
-    {
-        return -1;
-    }
-
-    int err;
+    std::shared_ptr<const matrix_cache_view<I, J, T>> view
+        = matrix_cache::instance().get<I, J, T>(filename, idx_base);
 
-    int nrowf, ncolf, nnzf;
-
-    err = fread(&nrowf, sizeof(int), 1, f);
-    err |= fread(&ncolf, sizeof(int), 1, f);
-    err |= fread(&nnzf, sizeof(int), 1, f);
-    if(!err)
-    {
-        fclose(f);
-        return -1;
-    }
-    nrow = (J)nrowf;
-    ncol = (J)ncolf;
-    nnz  = (I)nnzf;
-
-    // Allocate memory
-    std::vector<int>    ptrf(nrow + 1);
-    std::vector<int>    colf(nnz);
-    std::vector<double> valf(nnz);
-    ptr.resize(nrow + 1);
-    col.resize(nnz);
-    val.resize(nnz);
-
-    err |= fread(ptrf.data(), sizeof(int), nrow + 1, f);
-    err |= fread(colf.data(), sizeof(int), nnz, f);
-    err |= fread(valf.data(), sizeof(double), nnz, f);
-    if(!err)
+    if(view == nullptr)
     {
-        fclose(f);
         return -1;
     }
 
-    fclose(f);
-
-    for(J i = 0; i < nrow + 1; ++i)
-    {
-        ptr[i] = (I)ptrf[i];
-    }
-
-    for(I i = 0; i < nnz; ++i)
-    {
-        col[i] = (J)colf[i];
-        val[i] = make_DataType<T>(valf[i]);
-    }
-
-    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
-    {
-        for(J i = 0; i < nrow + 1; ++i)
-        {
-            ++ptr[i];
-        }
-
-        for(I i = 0; i < nnz; ++i)
-        {
-            ++col[i];
-        }
-    }
+    nrow = view->m;
+    ncol = view->n;
+    nnz  = view->nnz;
+    ptr  = view->ptr;
+    col  = view->col;
+    val  = view->val;
 
     if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
     {
@@ -2146,301 +2352,25 @@ inline void host_bsr_to_csr(hipsparseDirection_t    direction,
     }
 }
 
-template <typename T>
-inline void host_bsrmv(hipsparseDirection_t dir,
-                       hipsparseOperation_t trans,
-                       int                  mb,
-                       int                  nb,
-                       int                  nnzb,
-                       T                    alpha,
-                       const int*           bsr_row_ptr,
-                       const int*           bsr_col_ind,
-                       const T*             bsr_val,
-                       int                  bsr_dim,
-                       const T*             x,
-                       T                    beta,
-                       T*                   y,
-                       hipsparseIndexBase_t base)
+template <typename I, typename J, typename T>
+void host_csrmm(J                    M,
+                J                    N,
+                J                    K,
+                hipsparseOperation_t transA,
+                hipsparseOperation_t transB,
+                T                    alpha,
+                const I*             csr_row_ptr_A,
+                const J*             csr_col_ind_A,
+                const T*             csr_val_A,
+                const T*             B,
+                J                    ldb,
+                T                    beta,
+                T*                   C,
+                J                    ldc,
+                hipsparseOrder_t     order,
+                hipsparseIndexBase_t base)
 {
-    // Quick return
-    if(alpha == make_DataType<T>(0))
-    {
-        if(beta != make_DataType<T>(1))
-        {
-            for(int i = 0; i < mb * bsr_dim; ++i)
-            {
-                y[i] = beta * y[i];
-            }
-        }
-
-        return;
-    }
-
-    int WFSIZE;
-
-    if(bsr_dim == 2)
-    {
-        int blocks_per_row = nnzb / mb;
-
-        if(blocks_per_row < 8)
-        {
-            WFSIZE = 4;
-        }
-        else if(blocks_per_row < 16)
-        {
-            WFSIZE = 8;
-        }
-        else if(blocks_per_row < 32)
-        {
-            WFSIZE = 16;
-        }
-        else if(blocks_per_row < 64)
-        {
-            WFSIZE = 32;
-        }
-        else
-        {
-            WFSIZE = 64;
-        }
-    }
-    else if(bsr_dim <= 8)
-    {
-        WFSIZE = 8;
-    }
-    else if(bsr_dim <= 16)
-    {
-        WFSIZE = 16;
-    }
-    else
-    {
-        WFSIZE = 32;
-    }
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int row = 0; row < mb; ++row)
-    {
-        int row_begin = bsr_row_ptr[row] - base;
-        int row_end   = bsr_row_ptr[row + 1] - base;
-
-        if(bsr_dim == 2)
-        {
-            std::vector<T> sum0(WFSIZE, make_DataType<T>(0));
-            std::vector<T> sum1(WFSIZE, make_DataType<T>(0));
-
-            for(int j = row_begin; j < row_end; j += WFSIZE)
-            {
-                for(int k = 0; k < WFSIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        int col = bsr_col_ind[j + k] - base;
-
-                        if(dir == HIPSPARSE_DIRECTION_COLUMN)
-                        {
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 0],
-                                                  x[col * bsr_dim + 0],
-                                                  sum0[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 1],
-                                                  x[col * bsr_dim + 0],
-                                                  sum1[k]);
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 2],
-                                                  x[col * bsr_dim + 1],
-                                                  sum0[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 3],
-                                                  x[col * bsr_dim + 1],
-                                                  sum1[k]);
-                        }
-                        else
-                        {
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 0],
-                                                  x[col * bsr_dim + 0],
-                                                  sum0[k]);
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 1],
-                                                  x[col * bsr_dim + 1],
-                                                  sum0[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 2],
-                                                  x[col * bsr_dim + 0],
-                                                  sum1[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 3],
-                                                  x[col * bsr_dim + 1],
-                                                  sum1[k]);
-                        }
-                    }
-                }
-            }
-
-            for(int j = 1; j < WFSIZE; j <<= 1)
-            {
-                for(int k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] = sum0[k] + sum0[k + j];
-                    sum1[k] = sum1[k] + sum1[k + j];
-                }
-            }
-
-            if(beta != make_DataType<T>(0))
-            {
-                y[row * bsr_dim + 0] = testing_fma(beta, y[row * bsr_dim + 0], alpha * sum0[0]);
-                y[row * bsr_dim + 1] = testing_fma(beta, y[row * bsr_dim + 1], alpha * sum1[0]);
-            }
-            else
-            {
-                y[row * bsr_dim + 0] = alpha * sum0[0];
-                y[row * bsr_dim + 1] = alpha * sum1[0];
-            }
-        }
-        else
-        {
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                std::vector<T> sum(WFSIZE, make_DataType<T>(0));
-
-                for(int j = row_begin; j < row_end; ++j)
-                {
-                    int col = bsr_col_ind[j] - base;
-
-                    for(int bj = 0; bj < bsr_dim; bj += WFSIZE)
-                    {
-                        for(int k = 0; k < WFSIZE; ++k)
-                        {
-                            if(bj + k < bsr_dim)
-                            {
-                                if(dir == HIPSPARSE_DIRECTION_COLUMN)
-                                {
-                                    sum[k] = testing_fma(
-                                        bsr_val[bsr_dim * bsr_dim * j + bsr_dim * (bj + k) + bi],
-                                        x[bsr_dim * col + (bj + k)],
-                                        sum[k]);
-                                }
-                                else
-                                {
-                                    sum[k] = testing_fma(
-                                        bsr_val[bsr_dim * bsr_dim * j + bsr_dim * bi + (bj + k)],
-                                        x[bsr_dim * col + (bj + k)],
-                                        sum[k]);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                for(int j = 1; j < WFSIZE; j <<= 1)
-                {
-                    for(int k = 0; k < WFSIZE - j; ++k)
-                    {
-                        sum[k] = sum[k] + sum[k + j];
-                    }
-                }
-
-                if(beta != make_DataType<T>(0))
-                {
-                    y[row * bsr_dim + bi]
-                        = testing_fma(beta, y[row * bsr_dim + bi], alpha * sum[0]);
-                }
-                else
-                {
-                    y[row * bsr_dim + bi] = alpha * sum[0];
-                }
-            }
-        }
-    }
-}
-
-template <typename T>
-inline void host_bsrmm(int                     Mb,
-                       int                     N,
-                       int                     Kb,
-                       int                     block_dim,
-                       hipsparseDirection_t    dir,
-                       hipsparseOperation_t    transA,
-                       hipsparseOperation_t    transB,
-                       T                       alpha,
-                       const std::vector<int>& bsr_row_ptr_A,
-                       const std::vector<int>& bsr_col_ind_A,
-                       const std::vector<T>&   bsr_val_A,
-                       const std::vector<T>&   B,
-                       int                     ldb,
-                       T                       beta,
-                       std::vector<T>&         C,
-                       int                     ldc,
-                       hipsparseIndexBase_t    base)
-{
-    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        return;
-    }
-
-    if(transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && transB != HIPSPARSE_OPERATION_TRANSPOSE)
-    {
-        return;
-    }
-
-    int M = Mb * block_dim;
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < M; i++)
-    {
-        int local_row = i % block_dim;
-
-        int row_begin = bsr_row_ptr_A[i / block_dim] - base;
-        int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
-
-        for(int j = 0; j < N; j++)
-        {
-            int idx_C = i + j * ldc;
-
-            T sum = make_DataType<T>(0.0);
-
-            for(int s = row_begin; s < row_end; s++)
-            {
-                for(int t = 0; t < block_dim; t++)
-                {
-                    int idx_A = (dir == HIPSPARSE_DIRECTION_ROW)
-                                    ? block_dim * block_dim * s + block_dim * local_row + t
-                                    : block_dim * block_dim * s + block_dim * t + local_row;
-                    int idx_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-                                    ? j * ldb + block_dim * (bsr_col_ind_A[s] - base) + t
-                                    : (block_dim * (bsr_col_ind_A[s] - base) + t) * ldb + j;
-
-                    sum = sum + alpha * bsr_val_A[idx_A] * B[idx_B];
-                }
-            }
-
-            if(beta == make_DataType<T>(0.0))
-            {
-                C[idx_C] = sum;
-            }
-            else
-            {
-                C[idx_C] = sum + beta * C[idx_C];
-            }
-        }
-    }
-}
-
-template <typename I, typename J, typename T>
-void host_csrmm(J                    M,
-                J                    N,
-                J                    K,
-                hipsparseOperation_t transA,
-                hipsparseOperation_t transB,
-                T                    alpha,
-                const I*             csr_row_ptr_A,
-                const J*             csr_col_ind_A,
-                const T*             csr_val_A,
-                const T*             B,
-                J                    ldb,
-                T                    beta,
-                T*                   C,
-                J                    ldc,
-                hipsparseOrder_t     order,
-                hipsparseIndexBase_t base)
-{
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -2836,1005 +2766,75 @@ void host_coomm_batched(I                    M,
 }
 
 template <typename T>
-int csrilu0(int                  m,
-            const int*           ptr,
-            const int*           col,
-            T*                   val,
-            hipsparseIndexBase_t idx_base,
-            bool                 boost,
-            double               boost_tol,
-            T                    boost_val)
+void bsrsm(int                  mb,
+           int                  nrhs,
+           int                  nnzb,
+           hipsparseDirection_t dir,
+           hipsparseOperation_t transA,
+           hipsparseOperation_t transX,
+           T                    alpha,
+           const int*           bsr_row_ptr,
+           const int*           bsr_col_ind,
+           const T*             bsr_val,
+           int                  bsr_dim,
+           const T*             B,
+           int                  ldb,
+           T*                   X,
+           int                  ldx,
+           hipsparseDiagType_t  diag_type,
+           hipsparseFillMode_t  fill_mode,
+           hipsparseIndexBase_t base,
+           int*                 struct_pivot,
+           int*                 numeric_pivot)
 {
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(m);
-    std::vector<int> nnz_entries(m, 0);
+    // Initialize pivot
+    *struct_pivot  = mb + 1;
+    *numeric_pivot = mb + 1;
 
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < m; ++ai)
+    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        // ai-th row entries
-        int row_start = ptr[ai] - idx_base;
-        int row_end   = ptr[ai + 1] - idx_base;
-        int j;
-
-        // nnz position of ai-th row in val array
-        for(j = row_start; j < row_end; ++j)
-        {
-            nnz_entries[col[j] - idx_base] = j;
-        }
-
-        bool has_diag = false;
-
-        // loop over ai-th row nnz entries
-        for(j = row_start; j < row_end; ++j)
-        {
-            // if nnz entry is in lower matrix
-            if(col[j] - idx_base < ai)
-            {
-                int col_j  = col[j] - idx_base;
-                int diag_j = diag_offset[col_j];
-
-                T diag_val = val[diag_j];
-
-                if(boost)
-                {
-                    diag_val    = (boost_tol >= testing_abs(diag_val)) ? boost_val : diag_val;
-                    val[diag_j] = diag_val;
-                }
-                else
-                {
-                    // Check for numeric pivot
-                    if(diag_val == make_DataType<T>(0.0))
-                    {
-                        // Numerical zero diagonal
-                        return col_j + idx_base;
-                    }
-                }
-
-                // multiplication factor
-                val[j] = val[j] / diag_val;
-
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
-                {
-                    // if nnz at this position do linear combination
-                    if(nnz_entries[col[k] - idx_base] != 0)
-                    {
-                        int idx  = nnz_entries[col[k] - idx_base];
-                        val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
-                    }
-                }
-            }
-            else if(col[j] - idx_base == ai)
-            {
-                has_diag = true;
-                break;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        if(!has_diag)
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
         {
-            // Structural zero digonal
-            return ai + idx_base;
+            bsr_lsolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
         }
-
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
-
-        // clear nnz entries
-        for(j = row_start; j < row_end; ++j)
+        else
         {
-            nnz_entries[col[j] - idx_base] = 0;
+            bsr_usolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
         }
     }
-
-    return -1;
-}
-
-template <typename T>
-inline void host_bsrilu02(hipsparseDirection_t    dir,
-                          int                     mb,
-                          int                     bsr_dim,
-                          const std::vector<int>& bsr_row_ptr,
-                          const std::vector<int>& bsr_col_ind,
-                          std::vector<T>&         bsr_val,
-                          hipsparseIndexBase_t    base,
-                          int*                    struct_pivot,
-                          int*                    numeric_pivot,
-                          bool                    boost,
-                          double                  boost_tol,
-                          T                       boost_val)
-{
-    // Initialize pivots
-    *struct_pivot  = mb + 1;
-    *numeric_pivot = mb + 1;
-
-    // Temporary vector to hold diagonal offset to access diagonal BSR block
-    std::vector<int> diag_offset(mb);
-    std::vector<int> nnz_entries(mb, -1);
-
-    // First diagonal block is index 0
-    diag_offset[0] = 0;
-
-    // Loop over all BSR rows
-    for(int i = 0; i < mb; ++i)
-    {
-        // Flag whether we have a diagonal block or not
-        bool has_diag = false;
-
-        // BSR column entry and exit point
-        int row_begin = bsr_row_ptr[i] - base;
-        int row_end   = bsr_row_ptr[i + 1] - base;
-
-        int j;
-
-        // Set up entry points for linear combination
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = j;
-        }
-
-        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
-        for(j = row_begin; j < row_end; ++j)
-        {
-            // Column index of current BSR block
-            int bsr_col = bsr_col_ind[j] - base;
-
-            // If this is a diagonal block, set diagonal flag to true and skip
-            // all upcoming blocks as we exceed the lower matrix part
-            if(bsr_col == i)
-            {
-                has_diag = true;
-                break;
-            }
-
-            // Skip all upper matrix blocks
-            if(bsr_col > i)
-            {
-                break;
-            }
-
-            // Process all lower matrix BSR blocks
-
-            // Obtain corresponding row entry and exit point that corresponds with the
-            // current BSR column. Actually, we skip all lower matrix column indices,
-            // therefore starting with the diagonal entry.
-            int diag_j    = diag_offset[bsr_col];
-            int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
-
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
-
-                // Process all rows within the BSR block
-                for(int bk = 0; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
-
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = val / diag;
-
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(diag_j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
-            }
-
-            // Loop over upper offset pointer and do linear combination for nnz entry
-            for(int k = diag_j + 1; k < row_end_j; ++k)
-            {
-                int bsr_col_k = bsr_col_ind[k] - base;
-
-                if(nnz_entries[bsr_col_k] != -1)
-                {
-                    int m = nnz_entries[bsr_col_k];
-
-                    // Loop through all rows within the BSR block
-                    for(int bi = 0; bi < bsr_dim; ++bi)
-                    {
-                        // Loop through columns of bi-th row and do linear combination
-                        for(int bj = 0; bj < bsr_dim; ++bj)
-                        {
-                            T sum = make_DataType<T>(0);
-
-                            for(int bk = 0; bk < bsr_dim; ++bk)
-                            {
-                                sum = testing_fma(bsr_val[BSR_IND(j, bi, bk, dir)],
-                                                  bsr_val[BSR_IND(k, bk, bj, dir)],
-                                                  sum);
-                            }
-
-                            bsr_val[BSR_IND(m, bi, bj, dir)]
-                                = bsr_val[BSR_IND(m, bi, bj, dir)] - sum;
-                        }
-                    }
-                }
-            }
-        }
-
-        // Check for structural pivot
-        if(!has_diag)
-        {
-            *struct_pivot = std::min(*struct_pivot, i + base);
-            break;
-        }
-
-        // Process diagonal
-        if(bsr_col_ind[j] - base == i)
-        {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
-
-                if(boost)
-                {
-                    diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
-                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
-                }
-                else
-                {
-                    // Check for numeric pivot
-                    if(diag == make_DataType<T>(0))
-                    {
-                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
-                        continue;
-                    }
-                }
-
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
-
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = val / diag;
-
-                    // Loop through remaining columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
-            }
-        }
-
-        // Store diagonal BSR block entry point
-        int row_diag = diag_offset[i] = j;
-
-        // Process upper diagonal BSR blocks
-        for(j = row_diag + 1; j < row_end; ++j)
-        {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = 0; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
-            }
-        }
-
-        // Reset entry points
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = -1;
-        }
-    }
-
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
-}
-
-template <typename T>
-inline void host_bsric02(hipsparseDirection_t    direction,
-                         int                     Mb,
-                         int                     block_dim,
-                         const std::vector<int>& bsr_row_ptr,
-                         const std::vector<int>& bsr_col_ind,
-                         std::vector<T>&         bsr_val,
-                         hipsparseIndexBase_t    base,
-                         int*                    struct_pivot,
-                         int*                    numeric_pivot)
-{
-    int M = Mb * block_dim;
-
-    // Initialize pivot
-    *struct_pivot  = -1;
-    *numeric_pivot = -1;
-
-    if(bsr_col_ind.size() == 0 && bsr_val.size() == 0)
-    {
-        return;
-    }
-
-    // pointer of upper part of each row
-    std::vector<int> diag_block_offset(Mb);
-    std::vector<int> diag_offset(M, -1);
-    std::vector<int> nnz_entries(M, -1);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < Mb; i++)
-    {
-        int row_begin = bsr_row_ptr[i] - base;
-        int row_end   = bsr_row_ptr[i + 1] - base;
-
-        for(int j = row_begin; j < row_end; j++)
-        {
-            if(bsr_col_ind[j] - base == i)
-            {
-                diag_block_offset[i] = j;
-                break;
-            }
-        }
-    }
-
-    for(int i = 0; i < M; i++)
-    {
-        int local_row = i % block_dim;
-
-        int row_begin = bsr_row_ptr[i / block_dim] - base;
-        int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
-
-        for(int j = row_begin; j < row_end; j++)
-        {
-            int block_col_j = bsr_col_ind[j] - base;
-
-            for(int k = 0; k < block_dim; k++)
-            {
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * local_row + k;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * k + local_row;
-                }
-            }
-        }
-
-        T   sum            = make_DataType<T>(0);
-        int diag_val_index = -1;
-
-        bool has_diag         = false;
-        bool break_outer_loop = false;
-
-        for(int j = row_begin; j < row_end; j++)
-        {
-            int block_col_j = bsr_col_ind[j] - base;
-
-            for(int k = 0; k < block_dim; k++)
-            {
-                int col_j = block_dim * block_col_j + k;
-
-                // Mark diagonal and skip row
-                if(col_j == i)
-                {
-                    diag_val_index = block_dim * block_dim * j + block_dim * k + k;
-
-                    has_diag         = true;
-                    break_outer_loop = true;
-                    break;
-                }
-
-                // Skip upper triangular
-                if(col_j > i)
-                {
-                    break_outer_loop = true;
-                    break;
-                }
-
-                T val_j;
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
-                }
-                else
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
-                }
-
-                int local_row_j = col_j % block_dim;
-
-                int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
-                int row_end_j   = diag_block_offset[col_j / block_dim];
-                int row_diag_j  = diag_offset[col_j];
-
-                T local_sum = make_DataType<T>(0);
-                T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : make_DataType<T>(0);
-
-                // Check for numeric zero
-                if(inv_diag == make_DataType<T>(0))
-                {
-                    // Numerical non-invertible block diagonal
-                    if(*numeric_pivot == -1)
-                    {
-                        *numeric_pivot = block_col_j + base;
-                    }
-
-                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
-
-                    inv_diag = make_DataType<T>(1);
-                }
-
-                inv_diag = make_DataType<T>(1) / inv_diag;
-
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(int l = row_begin_j; l < row_end_j + 1; l++)
-                {
-                    int block_col_l = bsr_col_ind[l] - base;
-
-                    for(int m = 0; m < block_dim; m++)
-                    {
-                        int idx = nnz_entries[block_dim * block_col_l + m];
-
-                        if(idx != -1 && block_dim * block_col_l + m < col_j)
-                        {
-                            if(direction == HIPSPARSE_DIRECTION_ROW)
-                            {
-                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
-                                                                + block_dim * local_row_j + m],
-                                                        testing_conj(bsr_val[idx]),
-                                                        local_sum);
-                            }
-                            else
-                            {
-                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
-                                                                + block_dim * m + local_row_j],
-                                                        testing_conj(bsr_val[idx]),
-                                                        local_sum);
-                            }
-                        }
-                    }
-                }
-
-                val_j = (val_j - local_sum) * inv_diag;
-                sum   = testing_fma(val_j, testing_conj(val_j), sum);
-
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
-                }
-                else
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
-                }
-            }
-
-            if(break_outer_loop)
-            {
-                break;
-            }
-        }
-
-        if(!has_diag)
-        {
-            // Structural missing block diagonal
-            if(*struct_pivot == -1)
-            {
-                *struct_pivot = i / block_dim + base;
-            }
-        }
-
-        // Process diagonal entry
-        if(has_diag)
-        {
-            T diag_entry = make_DataType<T>(std::sqrt(testing_abs(bsr_val[diag_val_index] - sum)));
-            bsr_val[diag_val_index] = diag_entry;
-
-            if(diag_entry == make_DataType<T>(0))
-            {
-                // Numerical non-invertible block diagonal
-                if(*numeric_pivot == -1)
-                {
-                    *numeric_pivot = i / block_dim + base;
-                }
-
-                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
-            }
-
-            // Store diagonal offset
-            diag_offset[i] = diag_val_index;
-        }
-
-        for(int j = row_begin; j < row_end; j++)
-        {
-            int block_col_j = bsr_col_ind[j] - base;
-
-            for(int k = 0; k < block_dim; k++)
-            {
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
-                }
-            }
-        }
-    }
-}
-
-template <typename T>
-void csric0(int                  M,
-            const int*           csr_row_ptr,
-            const int*           csr_col_ind,
-            T*                   csr_val,
-            hipsparseIndexBase_t idx_base,
-            int&                 struct_pivot,
-            int&                 numeric_pivot)
-{
-    // Initialize pivot
-    struct_pivot  = -1;
-    numeric_pivot = -1;
-
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(M);
-    std::vector<int> nnz_entries(M, 0);
-
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < M; ++ai)
-    {
-        // ai-th row entries
-        int row_begin = csr_row_ptr[ai] - idx_base;
-        int row_end   = csr_row_ptr[ai + 1] - idx_base;
-        int j;
-
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - idx_base] = j;
-        }
-
-        T sum = make_DataType<T>(0.0);
-
-        bool has_diag = false;
-
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j = csr_col_ind[j] - idx_base;
-            T   val_j = csr_val[j];
-
-            // Mark diagonal and skip row
-            if(col_j == ai)
-            {
-                has_diag = true;
-                break;
-            }
-
-            // Skip upper triangular
-            if(col_j > ai)
-            {
-                break;
-            }
-
-            int row_begin_j = csr_row_ptr[col_j] - idx_base;
-            int row_diag_j  = diag_offset[col_j];
-
-            T local_sum = make_DataType<T>(0.0);
-            T inv_diag  = csr_val[row_diag_j];
-
-            // Check for numeric zero
-            if(inv_diag == make_DataType<T>(0.0))
-            {
-                // Numerical zero diagonal
-                numeric_pivot = col_j + idx_base;
-                return;
-            }
-
-            inv_diag = make_DataType<T>(1.0) / inv_diag;
-
-            // loop over upper offset pointer and do linear combination for nnz entry
-            for(int k = row_begin_j; k < row_diag_j; ++k)
-            {
-                int col_k = csr_col_ind[k] - idx_base;
-
-                // if nnz at this position do linear combination
-                if(nnz_entries[col_k] != 0)
-                {
-                    int idx   = nnz_entries[col_k];
-                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
-                }
-            }
-
-            val_j = (val_j - local_sum) * inv_diag;
-            sum   = testing_fma(val_j, testing_conj(val_j), sum);
-
-            csr_val[j] = val_j;
-        }
-
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            struct_pivot  = ai + idx_base;
-            numeric_pivot = ai + idx_base;
-            return;
-        }
-
-        // Process diagonal entry
-        T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
-        csr_val[j]   = diag_entry;
-
-        // Store diagonal offset
-        diag_offset[ai] = j;
-
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - idx_base] = 0;
-        }
-    }
-}
-
-/* ============================================================================================ */
-/*! \brief  Sparse triangular system solve using CSR storage format. */
-template <typename I, typename J, typename T>
-static inline void host_lssolve(J                     M,
-                                J                     nrhs,
-                                hipsparseOperation_t  transB,
-                                T                     alpha,
-                                const std::vector<I>& csr_row_ptr,
-                                const std::vector<J>& csr_col_ind,
-                                const std::vector<T>& csr_val,
-                                std::vector<T>&       B,
-                                J                     ldb,
-                                hipsparseDiagType_t   diag_type,
-                                hipsparseIndexBase_t  base,
-                                J*                    struct_pivot,
-                                J*                    numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        std::vector<T> temp(prop.warpSize);
-
-        // Process lower triangular part
-        for(J row = 0; row < M; ++row)
-        {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
-
-            J idx_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldb + row : row * ldb + i;
-
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = alpha * testing_conj(B[idx_B]);
-            }
-            else
-            {
-                temp[0] = alpha * B[idx_B];
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = make_DataType<T>(0.0);
-
-            for(I l = row_begin; l < row_end; l += prop.warpSize)
-            {
-                for(int k = 0; k < prop.warpSize; ++k)
-                {
-                    I j = l + k;
-
-                    // Do not run out of bounds
-                    if(j >= row_end)
-                    {
-                        break;
-                    }
-
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
-
-                    if(local_val == make_DataType<T>(0.0) && local_col == row
-                       && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Numerical zero pivot found, avoid division by 0 and store
-                        // index for later use
-                        *numeric_pivot = std::min(*numeric_pivot, row + base);
-                        local_val      = make_DataType<T>(1.0);
-                    }
-
-                    // Ignore all entries that are above the diagonal
-                    if(local_col > row)
-                    {
-                        break;
-                    }
-
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        // If diagonal type is non unit, do division by diagonal entry
-                        // This is not required for unit diagonal for obvious reasons
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            diag     = j;
-                            diag_val = make_DataType<T>(1.0) / local_val;
-                        }
-
-                        break;
-                    }
-
-                    // Lower triangular part
-                    J idx     = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldb + local_col
-                                                                              : local_col * ldb + i;
-                    T neg_val = make_DataType<T>(-1.0) * local_val;
-
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
-                    {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
-                    }
-                }
-            }
-
-            for(int j = 1; j < prop.warpSize; j <<= 1)
-            {
-                for(int k = 0; k < prop.warpSize - j; ++k)
-                {
-                    temp[k] = temp[k] + temp[k + j];
-                }
-            }
-
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
-
-                B[idx_B] = temp[0] * diag_val;
-            }
-            else
-            {
-                B[idx_B] = temp[0];
-            }
-        }
-    }
-}
-
-template <typename I, typename J, typename T>
-static inline void host_ussolve(J                     M,
-                                J                     nrhs,
-                                hipsparseOperation_t  transB,
-                                T                     alpha,
-                                const std::vector<I>& csr_row_ptr,
-                                const std::vector<J>& csr_col_ind,
-                                const std::vector<T>& csr_val,
-                                std::vector<T>&       B,
-                                J                     ldb,
-                                hipsparseDiagType_t   diag_type,
-                                hipsparseIndexBase_t  base,
-                                J*                    struct_pivot,
-                                J*                    numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        std::vector<T> temp(prop.warpSize);
-
-        // Process upper triangular part
-        for(J row = M - 1; row >= 0; --row)
-        {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
-
-            J idx_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldb + row : row * ldb + i;
-
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = alpha * testing_conj(B[idx_B]);
-            }
-            else
-            {
-                temp[0] = alpha * B[idx_B];
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = make_DataType<T>(0.0);
-
-            for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
-            {
-                for(int k = 0; k < prop.warpSize; ++k)
-                {
-                    I j = l - k;
-
-                    // Do not run out of bounds
-                    if(j < row_begin)
-                    {
-                        break;
-                    }
-
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
-
-                    // Ignore all entries that are below the diagonal
-                    if(local_col < row)
-                    {
-                        continue;
-                    }
-
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            // Check for numerical zero
-                            if(local_val == make_DataType<T>(0.0))
-                            {
-                                *numeric_pivot = std::min(*numeric_pivot, row + base);
-                                local_val      = make_DataType<T>(1.0);
-                            }
-
-                            diag     = j;
-                            diag_val = make_DataType<T>(1.0) / local_val;
-                        }
-
-                        continue;
-                    }
-
-                    // Upper triangular part
-                    J idx     = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? i * ldb + local_col
-                                                                              : local_col * ldb + i;
-                    T neg_val = make_DataType<T>(-1.0) * local_val;
-
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
-                    {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
-                    }
-                }
-            }
-
-            for(int j = 1; j < prop.warpSize; j <<= 1)
-            {
-                for(int k = 0; k < prop.warpSize - j; ++k)
-                {
-                    temp[k] = temp[k] + temp[k + j];
-                }
-            }
-
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
-
-                B[idx_B] = temp[0] * diag_val;
-            }
-            else
-            {
-                B[idx_B] = temp[0];
-            }
-        }
-    }
-}
-
-template <typename T>
-void bsrsm(int                  mb,
-           int                  nrhs,
-           int                  nnzb,
-           hipsparseDirection_t dir,
-           hipsparseOperation_t transA,
-           hipsparseOperation_t transX,
-           T                    alpha,
-           const int*           bsr_row_ptr,
-           const int*           bsr_col_ind,
-           const T*             bsr_val,
-           int                  bsr_dim,
-           const T*             B,
-           int                  ldb,
-           T*                   X,
-           int                  ldx,
-           hipsparseDiagType_t  diag_type,
-           hipsparseFillMode_t  fill_mode,
-           hipsparseIndexBase_t base,
-           int*                 struct_pivot,
-           int*                 numeric_pivot)
-{
-    // Initialize pivot
-    *struct_pivot  = mb + 1;
-    *numeric_pivot = mb + 1;
-
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            bsr_lsolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-        else
-        {
-            bsr_usolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-    }
-    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE)
+    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE)
     {
         // Transpose matrix
         std::vector<int> bsrt_row_ptr(mb + 1);
@@ -3898,556 +2898,8 @@ void bsrsm(int                  mb,
 
     *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
 
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
-}
-
-template <typename I, typename J, typename T>
-void host_csr_lsolve(J                    M,
-                     T                    alpha,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     const T*             x,
-                     T*                   y,
-                     hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process lower triangular part
-    for(J row = 0; row < M; ++row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0.0));
-        temp[0] = alpha * x[row];
-
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = make_DataType<T>(0.0);
-
-        for(I l = row_begin; l < row_end; l += prop.warpSize)
-        {
-            for(int k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l + k;
-
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                if(local_val == make_DataType<T>(0.0) && local_col == row
-                   && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                {
-                    // Numerical zero pivot found, avoid division by 0
-                    // and store index for later use.
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = make_DataType<T>(1);
-                }
-
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        diag     = j;
-                        diag_val = make_DataType<T>(1) / local_val;
-                    }
-
-                    break;
-                }
-
-                // Lower triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
-            }
-        }
-
-        for(int j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(int k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
-
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
-
-            y[row] = temp[0] * diag_val;
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
-    }
-}
-
-template <typename I, typename J, typename T>
-void host_csr_usolve(J                    M,
-                     T                    alpha,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     const T*             x,
-                     T*                   y,
-                     hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process upper triangular part
-    for(J row = M - 1; row >= 0; --row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0));
-        temp[0] = alpha * x[row];
-
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = make_DataType<T>(0);
-
-        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
-        {
-            for(int k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l - k;
-
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
-                {
-                    continue;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Check for numerical zero
-                        if(local_val == make_DataType<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = make_DataType<T>(1);
-                        }
-
-                        diag     = j;
-                        diag_val = make_DataType<T>(1) / local_val;
-                    }
-
-                    continue;
-                }
-
-                // Upper triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
-            }
-        }
-
-        for(int j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(int k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
-
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
-
-            y[row] = temp[0] * diag_val;
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
-    }
-}
-
-template <typename I, typename J, typename T>
-void host_csrsv(hipsparseOperation_t trans,
-                J                    M,
-                I                    nnz,
-                T                    alpha,
-                const I*             csr_row_ptr,
-                const J*             csr_col_ind,
-                const T*             csr_val,
-                const T*             x,
-                T*                   y,
-                hipsparseDiagType_t  diag_type,
-                hipsparseFillMode_t  fill_mode,
-                hipsparseIndexBase_t base,
-                J*                   struct_pivot,
-                J*                   numeric_pivot)
-{
-    // Initialize pivot
-    *struct_pivot  = M + 1;
-    *numeric_pivot = M + 1;
-
-    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
-        {
-            host_csr_usolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-    }
-    else if(trans == HIPSPARSE_OPERATION_TRANSPOSE
-            || trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-    {
-        // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
-
-        host_csr_to_csc(M,
-                        M,
-                        nnz,
-                        csr_row_ptr,
-                        csr_col_ind,
-                        csr_val,
-                        csrt_col_ind,
-                        csrt_row_ptr,
-                        csrt_val,
-                        HIPSPARSE_ACTION_NUMERIC,
-                        base);
-
-        if(trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-        {
-            for(size_t i = 0; i < csrt_val.size(); i++)
-            {
-                csrt_val[i] = testing_conj(csrt_val[i]);
-            }
-        }
-
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_csr_usolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-    }
-
-    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
-
-    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
-}
-
-template <typename I, typename T>
-void host_coosv(hipsparseOperation_t  trans,
-                I                     M,
-                I                     nnz,
-                T                     alpha,
-                const std::vector<I>& coo_row_ind,
-                const std::vector<I>& coo_col_ind,
-                const std::vector<T>& coo_val,
-                const std::vector<T>& x,
-                std::vector<T>&       y,
-                hipsparseDiagType_t   diag_type,
-                hipsparseFillMode_t   fill_mode,
-                hipsparseIndexBase_t  base,
-                I*                    struct_pivot,
-                I*                    numeric_pivot)
-{
-    std::vector<I> csr_row_ptr(M + 1);
-
-    //host_coo_to_csr(M, coo_row_ind, csr_row_ptr, base);
-    // coo2csr on host
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
-    }
-
-    csr_row_ptr[0] = base;
-    for(I i = 0; i < M; ++i)
-    {
-        csr_row_ptr[i + 1] += csr_row_ptr[i];
-    }
-
-    host_csrsv(trans,
-               M,
-               nnz,
-               alpha,
-               csr_row_ptr.data(),
-               coo_col_ind.data(),
-               coo_val.data(),
-               x.data(),
-               y.data(),
-               diag_type,
-               fill_mode,
-               base,
-               struct_pivot,
-               numeric_pivot);
-}
-
-template <typename I, typename J, typename T>
-void host_csrsm(J                     M,
-                J                     nrhs,
-                I                     nnz,
-                hipsparseOperation_t  transA,
-                hipsparseOperation_t  transB,
-                T                     alpha,
-                const std::vector<I>& csr_row_ptr,
-                const std::vector<J>& csr_col_ind,
-                const std::vector<T>& csr_val,
-                std::vector<T>&       B,
-                J                     ldb,
-                hipsparseDiagType_t   diag_type,
-                hipsparseFillMode_t   fill_mode,
-                hipsparseIndexBase_t  base,
-                J*                    struct_pivot,
-                J*                    numeric_pivot)
-{
-    // Initialize pivot
-    *struct_pivot  = M + 1;
-    *numeric_pivot = M + 1;
-
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_lssolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csr_row_ptr,
-                         csr_col_ind,
-                         csr_val,
-                         B,
-                         ldb,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-        else
-        {
-            host_ussolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csr_row_ptr,
-                         csr_col_ind,
-                         csr_val,
-                         B,
-                         ldb,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-    }
-    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE
-            || transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-    {
-        // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
-
-        host_csr_to_csc(M,
-                        M,
-                        nnz,
-                        csr_row_ptr.data(),
-                        csr_col_ind.data(),
-                        csr_val.data(),
-                        csrt_col_ind,
-                        csrt_row_ptr,
-                        csrt_val,
-                        HIPSPARSE_ACTION_NUMERIC,
-                        base);
-
-        if(transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-        {
-            for(size_t i = 0; i < csrt_val.size(); i++)
-            {
-                csrt_val[i] = testing_conj(csrt_val[i]);
-            }
-        }
-
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_ussolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csrt_row_ptr,
-                         csrt_col_ind,
-                         csrt_val,
-                         B,
-                         ldb,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-        else
-        {
-            host_lssolve(M,
-                         nrhs,
-                         transB,
-                         alpha,
-                         csrt_row_ptr,
-                         csrt_col_ind,
-                         csrt_val,
-                         B,
-                         ldb,
-                         diag_type,
-                         base,
-                         struct_pivot,
-                         numeric_pivot);
-        }
-    }
-
-    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
-
-    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
-}
-
-template <typename I, typename T>
-void host_coosm(I                     M,
-                I                     nrhs,
-                I                     nnz,
-                hipsparseOperation_t  transA,
-                hipsparseOperation_t  transB,
-                T                     alpha,
-                const std::vector<I>& coo_row_ind,
-                const std::vector<I>& coo_col_ind,
-                const std::vector<T>& coo_val,
-                std::vector<T>&       B,
-                I                     ldb,
-                hipsparseDiagType_t   diag_type,
-                hipsparseFillMode_t   fill_mode,
-                hipsparseIndexBase_t  base,
-                I*                    struct_pivot,
-                I*                    numeric_pivot)
-{
-    std::vector<I> csr_row_ptr(M + 1);
-
-    //host_coo_to_csr(M, coo_row_ind, csr_row_ptr, base);
-    // coo2csr on host
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
-    }
-
-    csr_row_ptr[0] = base;
-    for(I i = 0; i < M; ++i)
-    {
-        csr_row_ptr[i + 1] += csr_row_ptr[i];
-    }
-
-    host_csrsm(M,
-               nrhs,
-               nnz,
-               transA,
-               transB,
-               alpha,
-               csr_row_ptr,
-               coo_col_ind,
-               coo_val,
-               B,
-               ldb,
-               diag_type,
-               fill_mode,
-               base,
-               struct_pivot,
-               numeric_pivot);
+    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
 /* ============================================================================================ */
@@ -4804,268 +3256,6 @@ void bsrsv(hipsparseOperation_t trans,
     *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
-/* ============================================================================================ */
-/*! \brief  Sparse triangular lower solve using CSR storage format. */
-template <typename T>
-int csr_lsolve(hipsparseOperation_t trans,
-               int                  m,
-               const int*           ptr,
-               const int*           col,
-               const T*             val,
-               T                    alpha,
-               const T*             x,
-               T*                   y,
-               hipsparseIndexBase_t idx_base,
-               hipsparseDiagType_t  diag_type,
-               unsigned int         wf_size)
-{
-    const int* csr_row_ptr = ptr;
-    const int* csr_col_ind = col;
-    const T*   csr_val     = val;
-
-    std::vector<int> vptr;
-    std::vector<int> vcol;
-    std::vector<T>   vval;
-
-    if(trans == HIPSPARSE_OPERATION_TRANSPOSE)
-    {
-        int nnz = ptr[m] - idx_base;
-
-        vptr.resize(m + 1);
-        vcol.resize(nnz);
-        vval.resize(nnz);
-
-        // Transpose
-        transpose_csr(
-            m, m, nnz, ptr, col, val, vptr.data(), vcol.data(), vval.data(), idx_base, idx_base);
-
-        csr_row_ptr = vptr.data();
-        csr_col_ind = vcol.data();
-        csr_val     = vval.data();
-    }
-
-    int            pivot = (std::numeric_limits<int>::max)();
-    std::vector<T> temp(wf_size);
-
-    for(int i = 0; i < m; ++i)
-    {
-        temp.assign(wf_size, make_DataType<T>(0.0));
-        temp[0] = alpha * x[i];
-
-        int diag      = -1;
-        int row_begin = csr_row_ptr[i] - idx_base;
-        int row_end   = csr_row_ptr[i + 1] - idx_base;
-
-        T diag_val = make_DataType<T>(0.0);
-
-        for(int l = row_begin; l < row_end; l += wf_size)
-        {
-            for(unsigned int k = 0; k < wf_size; ++k)
-            {
-                int j = l + k;
-
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
-
-                int col_j = csr_col_ind[j] - idx_base;
-                T   val_j = csr_val[j];
-
-                if(col_j < i)
-                {
-                    // Lower part
-                    temp[k] = testing_fma(-csr_val[j], y[col_j], temp[k]);
-                }
-                else if(col_j == i)
-                {
-                    // Diagonal
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Check for numerical zero
-                        if(val_j == make_DataType<T>(0.0))
-                        {
-                            pivot = std::min(pivot, i + idx_base);
-                            val_j = make_DataType<T>(1.0);
-                        }
-
-                        diag     = j;
-                        diag_val = make_DataType<T>(1.0) / val_j;
-                    }
-
-                    break;
-                }
-                else
-                {
-                    // Upper part
-                    break;
-                }
-            }
-        }
-
-        for(unsigned int j = 1; j < wf_size; j <<= 1)
-        {
-            for(unsigned int k = 0; k < wf_size - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
-
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                pivot = std::min(pivot, i + idx_base);
-            }
-
-            y[i] = temp[0] * diag_val;
-        }
-        else
-        {
-            y[i] = temp[0];
-        }
-    }
-
-    if(pivot != (std::numeric_limits<int>::max)())
-    {
-        return pivot;
-    }
-
-    return -1;
-}
-
-/* ============================================================================================ */
-/*! \brief  Sparse triangular upper solve using CSR storage format. */
-template <typename T>
-int csr_usolve(hipsparseOperation_t trans,
-               int                  m,
-               const int*           ptr,
-               const int*           col,
-               const T*             val,
-               T                    alpha,
-               const T*             x,
-               T*                   y,
-               hipsparseIndexBase_t idx_base,
-               hipsparseDiagType_t  diag_type,
-               unsigned int         wf_size)
-{
-    const int* csr_row_ptr = ptr;
-    const int* csr_col_ind = col;
-    const T*   csr_val     = val;
-
-    std::vector<int> vptr;
-    std::vector<int> vcol;
-    std::vector<T>   vval;
-
-    if(trans == HIPSPARSE_OPERATION_TRANSPOSE)
-    {
-        int nnz = ptr[m] - idx_base;
-
-        vptr.resize(m + 1);
-        vcol.resize(nnz);
-        vval.resize(nnz);
-
-        // Transpose
-        transpose_csr(
-            m, m, nnz, ptr, col, val, vptr.data(), vcol.data(), vval.data(), idx_base, idx_base);
-
-        csr_row_ptr = vptr.data();
-        csr_col_ind = vcol.data();
-        csr_val     = vval.data();
-    }
-
-    int            pivot = (std::numeric_limits<int>::max)();
-    std::vector<T> temp(wf_size);
-
-    for(int i = m - 1; i >= 0; --i)
-    {
-        temp.assign(wf_size, make_DataType<T>(0.0));
-        temp[0] = alpha * x[i];
-
-        int diag      = -1;
-        int row_begin = csr_row_ptr[i] - idx_base;
-        int row_end   = csr_row_ptr[i + 1] - idx_base;
-
-        T diag_val = make_DataType<T>(0.0);
-
-        for(int l = row_end - 1; l >= row_begin; l -= wf_size)
-        {
-            for(unsigned int k = 0; k < wf_size; ++k)
-            {
-                int j = l - k;
-
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
-
-                int col_j = csr_col_ind[j] - idx_base;
-                T   val_j = csr_val[j];
-
-                if(col_j < i)
-                {
-                    // Lower part
-                    continue;
-                }
-                else if(col_j == i)
-                {
-                    // Diagonal
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Check for numerical zero
-                        if(val_j == make_DataType<T>(0.0))
-                        {
-                            pivot = std::min(pivot, i + idx_base);
-                            val_j = make_DataType<T>(1.0);
-                        }
-
-                        diag     = j;
-                        diag_val = make_DataType<T>(1.0) / val_j;
-                    }
-
-                    continue;
-                }
-                else
-                {
-                    // Upper part
-                    temp[k] = testing_fma(-csr_val[j], y[col_j], temp[k]);
-                }
-            }
-        }
-
-        for(unsigned int j = 1; j < wf_size; j <<= 1)
-        {
-            for(unsigned int k = 0; k < wf_size - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
-
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                pivot = std::min(pivot, i + idx_base);
-            }
-
-            y[i] = temp[0] * diag_val;
-        }
-        else
-        {
-            y[i] = temp[0];
-        }
-    }
-
-    if(pivot != (std::numeric_limits<int>::max)())
-    {
-        return pivot;
-    }
-
-    return -1;
-}
-
 /* ============================================================================================ */
 /*! \brief  Transpose sparse matrix using CSR storage format. */
 template <typename I, typename J, typename T>
@@ -5400,271 +3590,6 @@ static void host_csrgeam(int                  M,
     }
 }
 
-/* ============================================================================================ */
-/*! \brief  Compute sparse matrix sparse matrix multiplication. */
-template <typename I, typename J, typename T>
-static I csrgemm2_nnz(J                    m,
-                      J                    n,
-                      J                    k,
-                      const T*             alpha,
-                      const I*             csr_row_ptr_A,
-                      const J*             csr_col_ind_A,
-                      const I*             csr_row_ptr_B,
-                      const J*             csr_col_ind_B,
-                      const T*             beta,
-                      const I*             csr_row_ptr_D,
-                      const J*             csr_col_ind_D,
-                      I*                   csr_row_ptr_C,
-                      hipsparseIndexBase_t idx_base_A,
-                      hipsparseIndexBase_t idx_base_B,
-                      hipsparseIndexBase_t idx_base_C,
-                      hipsparseIndexBase_t idx_base_D)
-{
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<J> nnz(n, -1);
-
-#ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
-#endif
-
-        J rows_per_thread = (m + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, m);
-
-        // Index base
-        csr_row_ptr_C[0] = idx_base_C;
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
-        {
-            // Initialize csr row pointer with previous row offset
-            csr_row_ptr_C[i + 1] = 0;
-
-            if(alpha)
-            {
-                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
-
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - idx_base_A;
-
-                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
-
-                    // Loop over columns of B in row col_A
-                    for(I irow = row_begin_B; irow < row_end_B; ++irow)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[irow] - idx_base_B;
-
-                        // Check if a new nnz is generated
-                        if(nnz[col_B] != i)
-                        {
-                            nnz[col_B] = i;
-                            ++csr_row_ptr_C[i + 1];
-                        }
-                    }
-                }
-            }
-
-            // Add nnz of D if beta != 0
-            if(beta)
-            {
-                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
-
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
-                {
-                    J col_D = csr_col_ind_D[j] - idx_base_D;
-
-                    // Check if a new nnz is generated
-                    if(nnz[col_D] != i)
-                    {
-                        nnz[col_D] = i;
-                        ++csr_row_ptr_C[i + 1];
-                    }
-                }
-            }
-        }
-    }
-
-    // Scan to obtain row offsets
-    for(J i = 0; i < m; ++i)
-    {
-        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
-    }
-
-    return csr_row_ptr_C[m] - idx_base_C;
-}
-
-template <typename I, typename J, typename T>
-static void csrgemm2(J                    m,
-                     J                    n,
-                     J                    k,
-                     const T*             alpha,
-                     const I*             csr_row_ptr_A,
-                     const J*             csr_col_ind_A,
-                     const T*             csr_val_A,
-                     const I*             csr_row_ptr_B,
-                     const J*             csr_col_ind_B,
-                     const T*             csr_val_B,
-                     const T*             beta,
-                     const I*             csr_row_ptr_D,
-                     const J*             csr_col_ind_D,
-                     const T*             csr_val_D,
-                     const I*             csr_row_ptr_C,
-                     J*                   csr_col_ind_C,
-                     T*                   csr_val_C,
-                     hipsparseIndexBase_t idx_base_A,
-                     hipsparseIndexBase_t idx_base_B,
-                     hipsparseIndexBase_t idx_base_C,
-                     hipsparseIndexBase_t idx_base_D)
-{
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<I> nnz(n, -1);
-
-#ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
-#endif
-
-        J rows_per_thread = (m + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, m);
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
-        {
-            I row_begin_C = csr_row_ptr_C[i] - idx_base_C;
-            I row_end_C   = row_begin_C;
-
-            if(alpha)
-            {
-                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
-
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - idx_base_A;
-                    // Current value of A
-                    T val_A = *alpha * csr_val_A[j];
-
-                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
-
-                    // Loop over columns of B in row col_A
-                    for(I l = row_begin_B; l < row_end_B; ++l)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[l] - idx_base_B;
-                        // Current value of B
-                        T val_B = csr_val_B[l];
-
-                        // Check if a new nnz is generated or if the product is appended
-                        if(nnz[col_B] < row_begin_C)
-                        {
-                            nnz[col_B]               = row_end_C;
-                            csr_col_ind_C[row_end_C] = col_B + idx_base_C;
-                            csr_val_C[row_end_C]     = val_A * val_B;
-                            ++row_end_C;
-                        }
-                        else
-                        {
-                            csr_val_C[nnz[col_B]] = csr_val_C[nnz[col_B]] + val_A * val_B;
-                        }
-                    }
-                }
-            }
-
-            // Add nnz of D if beta != 0
-            if(beta)
-            {
-                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
-
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
-                {
-                    // Current column of D
-                    J col_D = csr_col_ind_D[j] - idx_base_D;
-                    // Current value of D
-                    T val_D = *beta * csr_val_D[j];
-
-                    // Check if a new nnz is generated or if the value is added
-                    if(nnz[col_D] < row_begin_C)
-                    {
-                        nnz[col_D] = row_end_C;
-
-                        csr_col_ind_C[row_end_C] = col_D + idx_base_C;
-                        csr_val_C[row_end_C]     = val_D;
-                        ++row_end_C;
-                    }
-                    else
-                    {
-                        csr_val_C[nnz[col_D]] = csr_val_C[nnz[col_D]] + val_D;
-                    }
-                }
-            }
-        }
-    }
-
-    I nnz_C = csr_row_ptr_C[m] - idx_base_C;
-
-    std::vector<J> col(nnz_C);
-    std::vector<T> val(nnz_C);
-
-    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz_C);
-    memcpy(val.data(), csr_val_C, sizeof(T) * nnz_C);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < m; ++i)
-    {
-        I row_begin = csr_row_ptr_C[i] - idx_base_C;
-        I row_end   = csr_row_ptr_C[i + 1] - idx_base_C;
-        J row_nnz   = row_end - row_begin;
-
-        std::vector<J> perm(row_nnz);
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            perm[j] = j;
-        }
-
-        J* col_entry = &col[row_begin];
-        T* val_entry = &val[row_begin];
-
-        std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-            return col_entry[a] <= col_entry[b];
-        });
-
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
-        }
-    }
-}
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -5742,10 +3667,18 @@ public:
     int timing     = 0;
 
     int iters     = 10;
+    int warmup    = 2;
+    int alg       = 0;
     int laplacian = 0;
     int ell_width = 0;
     int temp      = 0;
 
+    hipsparse_matrix_generator generator = hipsparse_generator_none;
+
+    int gen_dim   = 0;
+    int gen_param = 0;
+    int seed      = 12345;
+
     int    numericboost{};
     double boosttol{};
     double boostval{};
@@ -5793,10 +3726,17 @@ public:
         this->timing     = rhs.timing;
 
         this->iters     = rhs.iters;
+        this->warmup    = rhs.warmup;
+        this->alg       = rhs.alg;
         this->laplacian = rhs.laplacian;
         this->ell_width = rhs.ell_width;
         this->temp      = rhs.temp;
 
+        this->generator = rhs.generator;
+        this->gen_dim   = rhs.gen_dim;
+        this->gen_param = rhs.gen_param;
+        this->seed      = rhs.seed;
+
         this->numericboost = rhs.numericboost;
         this->boosttol     = rhs.boosttol;
         this->boostval     = rhs.boostval;
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_analysis_policy.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, hipsparseIndexBase_t> analysis_policy_tuple;
+
+int analysis_policy_dim_range[] = {8, 50, 200};
+
+hipsparseIndexBase_t analysis_policy_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_analysis_policy : public testing::TestWithParam<analysis_policy_tuple>
+{
+protected:
+    parameterized_analysis_policy() {}
+    virtual ~parameterized_analysis_policy() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_analysis_policy_arguments(analysis_policy_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(analysis_policy_bad_arg, analysis_policy)
+{
+    testing_analysis_policy_bad_arg();
+}
+
+TEST_P(parameterized_analysis_policy, analysis_policy_float)
+{
+    Arguments arg = setup_analysis_policy_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_analysis_policy<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_analysis_policy, analysis_policy_double)
+{
+    Arguments arg = setup_analysis_policy_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_analysis_policy<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_analysis_policy, analysis_policy_float_complex)
+{
+    Arguments arg = setup_analysis_policy_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_analysis_policy<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_analysis_policy, analysis_policy_double_complex)
+{
+    Arguments arg = setup_analysis_policy_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_analysis_policy<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(analysis_policy,
+                         parameterized_analysis_policy,
+                         testing::Combine(testing::ValuesIn(analysis_policy_dim_range),
+                                          testing::ValuesIn(analysis_policy_idxbase_range)));
@@ -32,6 +32,7 @@ typedef hipsparseOperation_t                                 trans;
 typedef hipsparseIndexBase_t                                 base;
 typedef std::tuple<int, int, double, double, trans, base>    csrmv_tuple;
 typedef std::tuple<double, double, trans, base, std::string> csrmv_bin_tuple;
+typedef std::tuple<double, double, trans, base, int>         csrmv_gen_tuple;
 
 int csr_M_range[] = {-1, 0, 500, 7111};
 int csr_N_range[] = {-3, 0, 842, 4441};
@@ -54,6 +55,16 @@ std::string csr_bin[] = {"nos1.bin",
                          "Chebyshev4.bin",
                          "shipsec1.bin"};
 
+// Synthetic matrices with regular, blocked and skewed row lengths, as
+// {generator, dimension, parameter}
+int csr_gen[][3] = {{hipsparse_generator_laplace3d_7pt, 24, 0},
+                    {hipsparse_generator_laplace3d_27pt, 16, 0},
+                    {hipsparse_generator_fem_block, 8, 3},
+                    {hipsparse_generator_rmat, 13, 16},
+                    {hipsparse_generator_banded, 5000, 32}};
+
+int csr_gen_range[] = {0, 1, 2, 3, 4};
+
 class parameterized_csrmv : public testing::TestWithParam<csrmv_tuple>
 {
 protected:
@@ -72,6 +83,15 @@ protected:
     virtual void TearDown() {}
 };
 
+class parameterized_csrmv_gen : public testing::TestWithParam<csrmv_gen_tuple>
+{
+protected:
+    parameterized_csrmv_gen() {}
+    virtual ~parameterized_csrmv_gen() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
 Arguments setup_csrmv_arguments(csrmv_tuple tup)
 {
     Arguments arg;
@@ -105,6 +125,26 @@ Arguments setup_csrmv_arguments(csrmv_bin_tuple tup)
     return arg;
 }
 
+Arguments setup_csrmv_arguments(csrmv_gen_tuple tup)
+{
+    Arguments arg;
+    arg.M        = 100;
+    arg.N        = 100;
+    arg.alpha    = std::get<0>(tup);
+    arg.beta     = std::get<1>(tup);
+    arg.transA   = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.timing   = 0;
+
+    const int* gen = csr_gen[std::get<4>(tup)];
+
+    arg.generator = (hipsparse_matrix_generator)gen[0];
+    arg.gen_dim   = gen[1];
+    arg.gen_param = gen[2];
+
+    return arg;
+}
+
 // Only run tests for CUDA 11.1 or greater
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11010)
 TEST(csrmv_bad_arg, csrmv_float)
@@ -159,6 +199,22 @@ TEST_P(parameterized_csrmv_bin, csrmv_bin_double)
     hipsparseStatus_t status = testing_csrmv<double>(arg);
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
+
+TEST_P(parameterized_csrmv_gen, csrmv_gen_float)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrmv<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrmv_gen, csrmv_gen_double)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrmv<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
 #endif
 
 INSTANTIATE_TEST_SUITE_P(csrmv,
@@ -177,3 +233,11 @@ INSTANTIATE_TEST_SUITE_P(csrmv_bin,
                                           testing::ValuesIn(csr_trans_range),
                                           testing::ValuesIn(csr_idxbase_range),
                                           testing::ValuesIn(csr_bin)));
+
+INSTANTIATE_TEST_SUITE_P(csrmv_gen,
+                         parameterized_csrmv_gen,
+                         testing::Combine(testing::ValuesIn(csr_alpha_range),
+                                          testing::ValuesIn(csr_beta_range),
+                                          testing::ValuesIn(csr_trans_range),
+                                          testing::ValuesIn(csr_idxbase_range),
+                                          testing::ValuesIn(csr_gen_range)));
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmv_analysis_cache.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, double, hipsparseIndexBase_t> csrmv_analysis_cache_tuple;
+
+int    csrmv_analysis_cache_dim_range[]   = {16, 100, 300};
+double csrmv_analysis_cache_alpha_range[] = {1.0, -0.5};
+
+hipsparseIndexBase_t csrmv_analysis_cache_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csrmv_analysis_cache
+    : public testing::TestWithParam<csrmv_analysis_cache_tuple>
+{
+protected:
+    parameterized_csrmv_analysis_cache() {}
+    virtual ~parameterized_csrmv_analysis_cache() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_analysis_cache_arguments(csrmv_analysis_cache_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrmv_analysis_cache_bad_arg, csrmv_analysis_cache)
+{
+    testing_csrmv_analysis_cache_bad_arg();
+}
+
+TEST_P(parameterized_csrmv_analysis_cache, csrmv_analysis_cache_float)
+{
+    Arguments arg = setup_csrmv_analysis_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrmv_analysis_cache<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrmv_analysis_cache, csrmv_analysis_cache_double)
+{
+    Arguments arg = setup_csrmv_analysis_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrmv_analysis_cache<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrmv_analysis_cache, csrmv_analysis_cache_float_complex)
+{
+    Arguments arg = setup_csrmv_analysis_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrmv_analysis_cache<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrmv_analysis_cache, csrmv_analysis_cache_double_complex)
+{
+    Arguments arg = setup_csrmv_analysis_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrmv_analysis_cache<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    csrmv_analysis_cache,
+    parameterized_csrmv_analysis_cache,
+    testing::Combine(testing::ValuesIn(csrmv_analysis_cache_dim_range),
+                     testing::ValuesIn(csrmv_analysis_cache_alpha_range),
+                     testing::ValuesIn(csrmv_analysis_cache_idxbase_range)));
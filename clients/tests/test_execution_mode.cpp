@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_execution_mode.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> execution_mode_tuple;
+
+int execution_mode_N_range[]   = {12000, 15332};
+int execution_mode_nnz_range[] = {5, 1000, 12000};
+
+hipsparseIndexBase_t execution_mode_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_execution_mode : public testing::TestWithParam<execution_mode_tuple>
+{
+protected:
+    parameterized_execution_mode() {}
+    virtual ~parameterized_execution_mode() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_execution_mode_arguments(execution_mode_tuple tup)
+{
+    Arguments arg;
+    arg.N        = std::get<0>(tup);
+    arg.nnz      = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(execution_mode_bad_arg, execution_mode)
+{
+    testing_execution_mode_bad_arg();
+}
+
+TEST_P(parameterized_execution_mode, execution_mode_float)
+{
+    Arguments arg = setup_execution_mode_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_execution_mode<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_execution_mode, execution_mode_double)
+{
+    Arguments arg = setup_execution_mode_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_execution_mode<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(execution_mode,
+                         parameterized_execution_mode,
+                         testing::Combine(testing::ValuesIn(execution_mode_N_range),
+                                          testing::ValuesIn(execution_mode_nnz_range),
+                                          testing::ValuesIn(execution_mode_idx_base_range)));
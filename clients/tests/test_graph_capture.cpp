@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_graph_capture.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, hipsparseIndexBase_t> graph_capture_tuple;
+
+int graph_capture_dim_range[] = {8, 50, 200};
+
+hipsparseIndexBase_t graph_capture_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_graph_capture : public testing::TestWithParam<graph_capture_tuple>
+{
+protected:
+    parameterized_graph_capture() {}
+    virtual ~parameterized_graph_capture() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_graph_capture_arguments(graph_capture_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(graph_capture_bad_arg, graph_capture)
+{
+    testing_graph_capture_bad_arg();
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_float)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_double)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_float_complex)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_double_complex)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+#ifndef _WIN32
+TEST_P(parameterized_graph_capture, graph_capture_recorded_float)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture_recorded<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_recorded_double)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture_recorded<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_recorded_float_complex)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture_recorded<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_graph_capture, graph_capture_recorded_double_complex)
+{
+    Arguments arg = setup_graph_capture_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_graph_capture_recorded<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(graph_capture,
+                         parameterized_graph_capture,
+                         testing::Combine(testing::ValuesIn(graph_capture_dim_range),
+                                          testing::ValuesIn(graph_capture_idxbase_range)));
@@ -54,4 +54,16 @@ TEST(spgemm_csr, spgemm_csr_i64_i64_hipDoubleComplex)
     hipsparseStatus_t status = testing_spgemm_csr<int64_t, int64_t, hipDoubleComplex>();
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
+
+TEST(spgemm_csr, spgemm_csr_repeated_i32_i32_float)
+{
+    hipsparseStatus_t status = testing_spgemm_csr_repeated<int32_t, int32_t, float>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(spgemm_csr, spgemm_csr_repeated_i64_i64_hipDoubleComplex)
+{
+    hipsparseStatus_t status = testing_spgemm_csr_repeated<int64_t, int64_t, hipDoubleComplex>();
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
 #endif
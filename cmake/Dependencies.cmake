@@ -36,8 +36,18 @@ else( )
     file(TO_CMAKE_PATH "$ENV{HIP_PATH}" HIP_PATH)
 endif( )
 
-# Either rocSPARSE or cuSPARSE is required
-if(NOT USE_CUDA)
+# Either rocSPARSE or cuSPARSE is required, the host backend only requires a HIP runtime
+# for the CPU
+if(USE_HOST)
+  find_package(hip_cpu_rt REQUIRED)
+  find_package(OpenMP REQUIRED)
+
+  # Clients link hip::host for all backends but CUDA
+  if(NOT TARGET hip::host)
+    add_library(hip::host INTERFACE IMPORTED)
+    set_property(TARGET hip::host PROPERTY INTERFACE_LINK_LIBRARIES hip_cpu_rt::hip_cpu_rt)
+  endif()
+elseif(NOT USE_CUDA)
   if(WIN32)
         find_package(hip REQUIRED CONFIG PATHS ${HIP_PATH} ${ROCM_PATH})
         find_package( rocsparse REQUIRED CONFIG PATHS ${ROCSPARSE_PATH} )
@@ -21,216 +21,39 @@
  *
  * ************************************************************************ */
 
+#include "../clients/include/csr_bin.hpp"
+#include "../clients/include/mtx_reader.hpp"
+
 #include <algorithm>
+#include <cmath>
 #include <math.h>
-#include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <vector>
 
-int read_mtx_matrix(const char*          filename,
-                    int&                 nrow,
-                    int&                 ncol,
-                    int&                 nnz,
-                    std::vector<int>&    row,
-                    std::vector<int>&    col,
-                    std::vector<double>& val)
+struct complex_value
 {
-    FILE* f = fopen(filename, "r");
-    if(!f)
-    {
-        return -1;
-    }
-
-    char line[1024];
-
-    // Check for banner
-    if(!fgets(line, 1024, f))
-    {
-        return -1;
-    }
-
-    char banner[16];
-    char array[16];
-    char coord[16];
-    char data[16];
-    char type[16];
-
-    // Extract banner
-    if(sscanf(line, "%s %s %s %s %s", banner, array, coord, data, type) != 5)
-    {
-        return -1;
-    }
-
-    // Convert to lower case
-    for(char* p = array; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = coord; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = data; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = type; *p != '\0'; *p = tolower(*p), p++)
-        ;
-
-    // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14) != 0)
-    {
-        return -1;
-    }
-
-    // Check array type
-    if(strcmp(array, "matrix") != 0)
-    {
-        return -1;
-    }
-
-    // Check coord
-    if(strcmp(coord, "coordinate") != 0)
-    {
-        return -1;
-    }
-
-    // Check data
-    if(strcmp(data, "real") != 0 && strcmp(data, "integer") != 0 && strcmp(data, "pattern") != 0)
-    {
-        return -1;
-    }
-
-    // Check type
-    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
-    {
-        return -1;
-    }
-
-    // Symmetric flag
-    int symm = !strcmp(type, "symmetric");
-
-    // Skip comments
-    while(fgets(line, 1024, f))
-    {
-        if(line[0] != '%')
-        {
-            break;
-        }
-    }
-
-    // Read dimensions
-    int snnz;
-
-    sscanf(line, "%d %d %d", &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
-
-    std::vector<int>    unsorted_row(nnz);
-    std::vector<int>    unsorted_col(nnz);
-    std::vector<double> unsorted_val(nnz);
-
-    // Read entries
-    int idx = 0;
-    while(fgets(line, 1024, f))
-    {
-        if(idx >= nnz)
-        {
-            return -1;
-        }
-
-        int    irow;
-        int    icol;
-        double ival;
-
-        if(!strcmp(data, "pattern"))
-        {
-            sscanf(line, "%d %d", &irow, &icol);
-            ival = 1.0;
-        }
-        else
-        {
-            sscanf(line, "%d %d %lg", &irow, &icol, &ival);
-        }
-
-        --irow;
-        --icol;
+    double x;
+    double y;
+};
 
-        // Take absolute matrix value to avoid rounding issues when testing
-        ival = std::abs(ival);
-
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
-
-        ++idx;
-
-        if(symm && irow != icol)
-        {
-            if(idx >= nnz)
-            {
-                return -1;
-            }
-
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
-        }
-    }
-    fclose(f);
-
-    row.resize(nnz);
-    col.resize(nnz);
-    val.resize(nnz);
-
-    // Sort by row and column index
-    std::vector<int> perm(nnz);
-    for(int i = 0; i < nnz; ++i)
-    {
-        perm[i] = i;
-    }
-
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
-
-    for(int i = 0; i < nnz; ++i)
-    {
-        row[i] = unsorted_row[perm[i]];
-        col[i] = unsorted_col[perm[i]];
-        val[i] = unsorted_val[perm[i]];
-    }
-
-    return 0;
+static inline void mtx_set_value(complex_value& val, double real, double imag)
+{
+    val.x = real;
+    val.y = imag;
 }
 
-int write_bin_matrix(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const double* val)
+// Take absolute matrix value to avoid rounding issues when testing
+static inline void abs_value(double& val)
 {
-    FILE* f = fopen(filename, "wb");
-    if(!f)
-    {
-        return -1;
-    }
-
-    int err;
-    err = fwrite(&m, sizeof(int), 1, f);
-    err |= fwrite(&n, sizeof(int), 1, f);
-    err |= fwrite(&nnz, sizeof(int), 1, f);
-    err |= fwrite(ptr, sizeof(int), m + 1, f);
-    err |= fwrite(col, sizeof(int), nnz, f);
-    err |= fwrite(val, sizeof(double), nnz, f);
-
-    fclose(f);
+    val = std::abs(val);
+}
 
-    return 0;
+static inline void abs_value(complex_value& val)
+{
+    val.x = std::abs(val.x);
+    val.y = std::abs(val.y);
 }
 
 int coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
@@ -252,34 +75,72 @@ int coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
     return 0;
 }
 
-int main(int argc, char* argv[])
+template <typename T>
+int convert(const char* src, const char* dst, uint8_t value_type, mtx_symmetry symmetry)
 {
     int m;
     int n;
     int nnz;
 
-    std::vector<int>    ptr;
-    std::vector<int>    row;
-    std::vector<int>    col;
-    std::vector<double> val;
+    std::vector<int> ptr;
+    std::vector<int> row;
+    std::vector<int> col;
+    std::vector<T>   val;
 
-    if(read_mtx_matrix(argv[1], m, n, nnz, row, col, val) != 0)
+    if(mtx_read_coo(src, m, n, nnz, row, col, val, 0) != 0)
     {
-        fprintf(stderr, "Cannot open [read] %s.\n", argv[1]);
+        fprintf(stderr, "Cannot open [read] %s.\n", src);
         return -1;
     }
 
+    for(int i = 0; i < nnz; ++i)
+    {
+        abs_value(val[i]);
+    }
+
     if(coo_to_csr(m, nnz, row.data(), ptr) != 0)
     {
-        fprintf(stderr, "Cannot convert %s from COO to CSR.\n", argv[1]);
+        fprintf(stderr, "Cannot convert %s from COO to CSR.\n", src);
         return -1;
     }
 
-    if(write_bin_matrix(argv[2], m, n, nnz, ptr.data(), col.data(), val.data()) != 0)
-    {
-        fprintf(stderr, "Cannot open [write] %s.\n", argv[2]);
+    if(csr_bin_write(dst,
+                     m,
+                     n,
+                     nnz,
+                     sizeof(int),
+                     ptr.data(),
+                     sizeof(int),
+                     col.data(),
+                     value_type,
+                     val.data(),
+                     0,
+                     symmetry)
+       != 0)
+    {
+        fprintf(stderr, "Cannot open [write] %s.\n", dst);
         return -1;
     }
 
     return 0;
 }
+
+int main(int argc, char* argv[])
+{
+    if(argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <matrix.mtx> <matrix.bin>\n", argv[0]);
+        return -1;
+    }
+
+    mtx_banner banner;
+    if(mtx_read_banner(argv[1], banner) != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s.\n", argv[1]);
+        return -1;
+    }
+
+    // Complex matrices keep their imaginary part, all others are stored as double
+    return banner.complex ? convert<complex_value>(argv[1], argv[2], csr_bin_c64f, banner.symmetry)
+                          : convert<double>(argv[1], argv[2], csr_bin_r64f, banner.symmetry);
+}
@@ -358,6 +358,97 @@ typedef enum {
     HIPSPARSE_DIRECTION_COLUMN = 1
 } hipsparseDirection_t;
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup types_module
+ *  \brief Specify the caching policy of the handle workspace.
+ *
+ *  \details
+ *  The \ref hipsparseWorkspacePolicy_t indicates whether temporary device buffers,
+ *  that are allocated internally by hipSPARSE, are kept cached for subsequent calls
+ *  (\ref HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY) or whether the cache is trimmed to the
+ *  size reserved by hipsparseReserveWorkspace() (\ref HIPSPARSE_WORKSPACE_POLICY_TRIM).
+ */
+typedef enum {
+    HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY = 0,
+    HIPSPARSE_WORKSPACE_POLICY_TRIM      = 1
+} hipsparseWorkspacePolicy_t;
+
+/*! \ingroup types_module
+ *  \brief Specify the execution mode.
+ *
+ *  \details
+ *  The \ref hipsparseExecutionMode_t indicates whether routines, that are blocking
+ *  in cuSPARSE (e.g. hipsparseXdoti() or hipsparseXcsrsv2_analysis()), synchronize
+ *  the stream before returning (\ref HIPSPARSE_EXEC_BLOCKING) or whether they return
+ *  right after all work has been enqueued (\ref HIPSPARSE_EXEC_ASYNC). In addition to
+ *  the latter, \ref HIPSPARSE_EXEC_CAPTURE_SAFE guarantees that no device memory is
+ *  allocated or freed, such that all calls can be captured into a hipGraph.
+ */
+typedef enum {
+    HIPSPARSE_EXEC_BLOCKING     = 0,
+    HIPSPARSE_EXEC_ASYNC        = 1,
+    HIPSPARSE_EXEC_CAPTURE_SAFE = 2
+} hipsparseExecutionMode_t;
+
+/*! \ingroup types_module
+ *  \brief Specify whether matrix analysis is cached.
+ *
+ *  \details
+ *  The \ref hipsparseAnalysisCache_t indicates whether routines that do not take an
+ *  explicit analysis structure, e.g. hipsparseXcsrmv(), keep the analysis of the matrix
+ *  attached to the matrix descriptor for subsequent calls
+ *  (\ref HIPSPARSE_ANALYSIS_CACHE_ON) or not (\ref HIPSPARSE_ANALYSIS_CACHE_OFF).
+ */
+typedef enum {
+    HIPSPARSE_ANALYSIS_CACHE_OFF = 0,
+    HIPSPARSE_ANALYSIS_CACHE_ON  = 1
+} hipsparseAnalysisCache_t;
+
+/*! \ingroup types_module
+ *  \brief Specify whether existing analysis meta data is re-used.
+ *
+ *  \details
+ *  The \ref hipsparseAnalysisPolicy_t indicates whether analysis routines, e.g.
+ *  hipsparseXcsrsv2_analysis() or hipsparseXcsrilu02_analysis(), always recompute the
+ *  analysis (\ref HIPSPARSE_ANALYSIS_POLICY_FORCE) or whether they re-use meta data that
+ *  is already present in the info structure (\ref HIPSPARSE_ANALYSIS_POLICY_REUSE).
+ */
+typedef enum {
+    HIPSPARSE_ANALYSIS_POLICY_FORCE = 0,
+    HIPSPARSE_ANALYSIS_POLICY_REUSE = 1
+} hipsparseAnalysisPolicy_t;
+
+/*! \ingroup types_module
+ *  \brief Specify what is known about a scalar.
+ *
+ *  \details
+ *  The \ref hipsparseScalarHint_t indicates whether a scalar that is passed in device
+ *  memory is known to be zero (\ref HIPSPARSE_SCALAR_HINT_ZERO), known to be non-zero
+ *  (\ref HIPSPARSE_SCALAR_HINT_NONZERO) or unknown (\ref HIPSPARSE_SCALAR_HINT_UNKNOWN).
+ *  If the scalar is unknown, it has to be read to the host, which blocks the stream.
+ */
+typedef enum {
+    HIPSPARSE_SCALAR_HINT_UNKNOWN = 0,
+    HIPSPARSE_SCALAR_HINT_ZERO    = 1,
+    HIPSPARSE_SCALAR_HINT_NONZERO = 2
+} hipsparseScalarHint_t;
+
+/*! \ingroup types_module
+ *  \brief Specify whether the csru2csr permutation is kept.
+ *
+ *  \details
+ *  The \ref hipsparseCsru2csrPermutation_t indicates whether hipsparseXcsru2csr() keeps
+ *  the sorting permutation in the csru2csr info structure, such that the matrix can be
+ *  unsorted again by hipsparseXcsr2csru() (\ref HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP),
+ *  or whether the permutation is only held in temporary storage of the handle
+ *  (\ref HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD).
+ */
+typedef enum {
+    HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP    = 0,
+    HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD = 1
+} hipsparseCsru2csrPermutation_t;
+#endif
+
 // clang-format on
 
 #ifdef __cplusplus
@@ -449,6 +540,139 @@ hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePoi
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode);
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup aux_module
+ *  \brief Specify execution mode
+ *
+ *  \details
+ *  \p hipsparseSetExecutionMode specifies the execution mode to be used by the
+ *  hipSPARSE library context and all subsequent function calls. By default, routines
+ *  that are blocking in cuSPARSE synchronize the stream before returning
+ *  (\ref HIPSPARSE_EXEC_BLOCKING). With \ref HIPSPARSE_EXEC_ASYNC, this
+ *  synchronization is skipped and results are only available after the stream has been
+ *  synchronized by the user. Scalar results that are returned into host memory, e.g.
+ *  by hipsparseXdoti() in \ref HIPSPARSE_POINTER_MODE_HOST, are always available on
+ *  return.
+ *
+ *  \ref HIPSPARSE_EXEC_CAPTURE_SAFE additionally makes sure that the stream of the
+ *  handle can be captured into a hipGraph. Temporary buffers are then only taken from
+ *  the workspace that has been reserved by hipsparseReserveWorkspace() before entering
+ *  this mode, where a reserved buffer also serves any smaller request. Calls that would
+ *  need to allocate or free device memory, or to read data back to the host, return
+ *  \ref HIPSPARSE_STATUS_NOT_SUPPORTED before enqueuing any work, e.g. if the reserved
+ *  workspace is too small, if a scalar has to be read from device memory, or for
+ *  hipsparseSpGEMM_compute(), that has to determine the number of non-zeros of the
+ *  product. Scalar results should be returned into device memory.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetExecutionMode(hipsparseHandle_t        handle,
+                                            hipsparseExecutionMode_t mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current execution mode from library context
+ *
+ *  \details
+ *  \p hipsparseGetExecutionMode gets the hipSPARSE library context execution mode
+ *  which is currently used for all subsequent function calls.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetExecutionMode(hipsparseHandle_t         handle,
+                                            hipsparseExecutionMode_t* mode);
+
+/*! \ingroup aux_module
+ *  \brief Specify the analysis policy
+ *
+ *  \details
+ *  \p hipsparseSetAnalysisPolicy specifies whether the analysis routines of the
+ *  triangular solvers and incomplete factorizations re-use meta data that is already
+ *  present in their info structure. With \ref HIPSPARSE_ANALYSIS_POLICY_REUSE, a
+ *  repeated analysis of the same matrix is skipped, and the analysis of the lower
+ *  triangular part is shared between csrilu02, csric02 and csrsv2 if they operate on
+ *  the same info structure, see hipsparseShareCsrilu02Info(). The default is
+ *  \ref HIPSPARSE_ANALYSIS_POLICY_FORCE.
+ *
+ *  \note
+ *  Meta data is only valid for the sparsity pattern it has been computed for. If the
+ *  pattern of a matrix changes, the info structure has to be analysed with
+ *  \ref HIPSPARSE_ANALYSIS_POLICY_FORCE or a new info structure has to be used.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetAnalysisPolicy(hipsparseHandle_t         handle,
+                                             hipsparseAnalysisPolicy_t policy);
+
+/*! \ingroup aux_module
+ *  \brief Get current analysis policy from library context
+ *
+ *  \details
+ *  \p hipsparseGetAnalysisPolicy gets the hipSPARSE library context analysis policy
+ *  which is currently used for all subsequent function calls.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetAnalysisPolicy(hipsparseHandle_t          handle,
+                                             hipsparseAnalysisPolicy_t* policy);
+
+/*! \ingroup aux_module
+ *  \brief Specify the workspace policy
+ *
+ *  \details
+ *  \p hipsparseSetWorkspacePolicy specifies how the hipSPARSE library context caches
+ *  temporary device buffers that are allocated internally, e.g. by hipsparseXcsr2csc()
+ *  or hipsparseXhyb2csr(). Buffers are bucketed into power of two size classes and a
+ *  request is served by the smallest cached buffer that is large enough. With
+ *  \ref HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY (default), released buffers stay cached
+ *  until hipsparseReleaseWorkspace() or hipsparseDestroy() is called. With
+ *  \ref HIPSPARSE_WORKSPACE_POLICY_TRIM, only up to the size reserved by
+ *  hipsparseReserveWorkspace() is kept cached.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetWorkspacePolicy(hipsparseHandle_t          handle,
+                                              hipsparseWorkspacePolicy_t policy);
+
+/*! \ingroup aux_module
+ *  \brief Get current workspace policy from library context
+ *
+ *  \details
+ *  \p hipsparseGetWorkspacePolicy gets the hipSPARSE library context workspace policy.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetWorkspacePolicy(hipsparseHandle_t           handle,
+                                              hipsparseWorkspacePolicy_t* policy);
+
+/*! \ingroup aux_module
+ *  \brief Get the workspace size
+ *
+ *  \details
+ *  \p hipsparseGetWorkspaceSize returns the number of bytes of device memory that are
+ *  currently held by the hipSPARSE library context workspace.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetWorkspaceSize(hipsparseHandle_t handle, size_t* size);
+
+/*! \ingroup aux_module
+ *  \brief Reserve workspace
+ *
+ *  \details
+ *  \p hipsparseReserveWorkspace makes sure that a temporary buffer of at least \p size
+ *  bytes is cached by the hipSPARSE library context workspace, such that subsequent
+ *  calls requiring up to \p size bytes of temporary storage do not allocate device
+ *  memory. The reserved size also limits the cache under
+ *  \ref HIPSPARSE_WORKSPACE_POLICY_TRIM.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseReserveWorkspace(hipsparseHandle_t handle, size_t size);
+
+/*! \ingroup aux_module
+ *  \brief Release workspace
+ *
+ *  \details
+ *  \p hipsparseReleaseWorkspace synchronizes the library context stream and frees all
+ *  cached temporary buffers of the hipSPARSE library context workspace. The reserved
+ *  size is reset to zero.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseReleaseWorkspace(hipsparseHandle_t handle);
+#endif
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
@@ -560,6 +784,72 @@ hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparse
 HIPSPARSE_EXPORT
 hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA);
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup aux_module
+ *  \brief Specify the analysis cache of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseSetMatAnalysisCache enables or disables the analysis cache of a matrix
+ *  descriptor. With \ref HIPSPARSE_ANALYSIS_CACHE_ON, the first call to
+ *  hipsparseXcsrmv() performs the matrix analysis and keeps it attached to the
+ *  descriptor. Subsequent calls with the same matrix (i.e. same dimensions, number of
+ *  non-zeros, row pointer and column index arrays) and the same descriptor generation
+ *  reuse the analysis and run the load balanced csrmv algorithm. The analysis is only
+ *  cached for non-transposed matrices of type \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+ *  Disabling the cache releases the cached analysis. The cache is disabled by default.
+ *
+ *  \note
+ *  The analysis depends on the sparsity pattern only. If the pattern is modified in
+ *  place, the user has to call hipsparseSetMatGeneration() or
+ *  hipsparseInvalidateMatAnalysis().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetMatAnalysisCache(hipsparseMatDescr_t      descrA,
+                                               hipsparseAnalysisCache_t cache);
+
+/*! \ingroup aux_module
+ *  \brief Get the analysis cache of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseGetMatAnalysisCache returns whether the analysis cache of a matrix
+ *  descriptor is enabled.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetMatAnalysisCache(const hipsparseMatDescr_t descrA,
+                                               hipsparseAnalysisCache_t* cache);
+
+/*! \ingroup aux_module
+ *  \brief Specify the generation of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseSetMatGeneration sets the generation counter of a matrix descriptor.
+ *  The generation is part of the key of cached analysis data, such that changing it
+ *  forces the analysis to be redone on the next call. The initial generation is 0.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetMatGeneration(hipsparseMatDescr_t descrA, int64_t generation);
+
+/*! \ingroup aux_module
+ *  \brief Get the generation of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseGetMatGeneration returns the generation counter of a matrix descriptor.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetMatGeneration(const hipsparseMatDescr_t descrA,
+                                            int64_t*                  generation);
+
+/*! \ingroup aux_module
+ *  \brief Invalidate the cached analysis of a matrix descriptor
+ *
+ *  \details
+ *  \p hipsparseInvalidateMatAnalysis releases all analysis data that is cached with a
+ *  matrix descriptor. The analysis cache remains enabled, if it was enabled before.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseInvalidateMatAnalysis(hipsparseMatDescr_t descrA);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 11000)
 /*! \ingroup aux_module
  *  \brief Create a \p HYB matrix structure
@@ -751,6 +1041,37 @@ hipsparseStatus_t hipsparseCreateCsric02Info(csric02Info_t* info);
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDestroyCsric02Info(csric02Info_t info);
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup aux_module
+ *  \brief Share a csrilu02 info structure with triangular solves
+ *
+ *  \details
+ *  \p hipsparseShareCsrilu02Info returns a csrsv2 info structure that refers to the
+ *  same analysis data as the csrilu02 info structure \p source. If the analysis policy
+ *  is \ref HIPSPARSE_ANALYSIS_POLICY_REUSE, hipsparseXcsrsv2_analysis() of the lower
+ *  triangular factor then re-uses the analysis of hipsparseXcsrilu02_analysis() instead
+ *  of recomputing it. Both structures have to be destroyed; the analysis data is
+ *  released together with the last one.
+ *
+ *  \note
+ *  Shared info structures also share the zero pivot, i.e. hipsparseXcsrsv2_zeroPivot()
+ *  and hipsparseXcsrilu02_zeroPivot() report the result of the most recent call.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseShareCsrilu02Info(csrilu02Info_t source, csrsv2Info_t* info);
+
+/*! \ingroup aux_module
+ *  \brief Share a csric02 info structure with triangular solves
+ *
+ *  \details
+ *  \p hipsparseShareCsric02Info returns a csrsv2 info structure that refers to the same
+ *  analysis data as the csric02 info structure \p source, see
+ *  hipsparseShareCsrilu02Info().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseShareCsric02Info(csric02Info_t source, csrsv2Info_t* info);
+#endif
+
 /* Info structures */
 /*! \ingroup aux_module
  *  \brief Create a csru2csr info structure
@@ -772,6 +1093,34 @@ hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info);
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info);
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup aux_module
+ *  \brief Specify whether a csru2csr info structure keeps the permutation
+ *
+ *  \details
+ *  \p hipsparseSetCsru2csrInfoPermutation specifies whether hipsparseXcsru2csr() keeps
+ *  the sorting permutation in the csru2csr info structure. By default, the permutation
+ *  is kept. If the permutation is discarded, hipsparseXcsru2csr() does not allocate
+ *  memory for the info structure and hipsparseXcsr2csru() cannot be called with it.
+ *  Switching to \ref HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD releases a permutation that
+ *  is currently held.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetCsru2csrInfoPermutation(csru2csrInfo_t                 info,
+                                                      hipsparseCsru2csrPermutation_t permutation);
+
+/*! \ingroup aux_module
+ *  \brief Get whether a csru2csr info structure keeps the permutation
+ *
+ *  \details
+ *  \p hipsparseGetCsru2csrInfoPermutation returns whether the csru2csr info structure
+ *  keeps the sorting permutation.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetCsru2csrInfoPermutation(csru2csrInfo_t                  info,
+                                                      hipsparseCsru2csrPermutation_t* permutation);
+#endif
+
 /* Info structures */
 /*! \ingroup aux_module
  *  \brief Create a color info structure
@@ -9459,6 +9808,35 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr);
 #endif
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup generic_module
+ *  \brief Specify scalar hints of a SpGEMM descriptor
+ *
+ *  \details
+ *  \p hipsparseSpGEMM_setScalarHints specifies whether \p alpha and \p beta, that are
+ *  passed to the SpGEMM routines in \ref HIPSPARSE_POINTER_MODE_DEVICE, are known to
+ *  be zero or non-zero. Without a hint (\ref HIPSPARSE_SCALAR_HINT_UNKNOWN, default),
+ *  the scalars are read from device memory to determine which parts of the product
+ *  have to be computed, which synchronizes the stream. The hints are ignored in
+ *  \ref HIPSPARSE_POINTER_MODE_HOST.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_setScalarHints(hipsparseSpGEMMDescr_t descr,
+                                                 hipsparseScalarHint_t  alphaHint,
+                                                 hipsparseScalarHint_t  betaHint);
+
+/*! \ingroup generic_module
+ *  \brief Get scalar hints of a SpGEMM descriptor
+ *
+ *  \details
+ *  \p hipsparseSpGEMM_getScalarHints returns the scalar hints of a SpGEMM descriptor.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_getScalarHints(hipsparseSpGEMMDescr_t descr,
+                                                 hipsparseScalarHint_t* alphaHint,
+                                                 hipsparseScalarHint_t* betaHint);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
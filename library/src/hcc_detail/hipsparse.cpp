@@ -29,11 +29,570 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "logging.hpp"
+#include "workspace_pool.hpp"
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
 
+// Complex scalars that are passed by value are traced as (real,imag). The overloads are
+// file-scope statics of this translation unit. As the HIP complex types are declared in the
+// global namespace, argument-dependent lookup finds them when the log_args() templates of
+// logging.hpp are instantiated below.
+static void log_arg(std::ostream& os, const hipComplex& arg)
+{
+    os << '(' << hipCrealf(arg) << ',' << hipCimagf(arg) << ')';
+}
+
+static void log_arg(std::ostream& os, const hipDoubleComplex& arg)
+{
+    os << '(' << hipCreal(arg) << ',' << hipCimag(arg) << ')';
+}
+
+namespace
+{
+    void* workspace_device_allocate(size_t size, void* user_data)
+    {
+        void* ptr = nullptr;
+        return (hipMalloc(&ptr, size) == hipSuccess) ? ptr : nullptr;
+    }
+
+    void workspace_device_deallocate(void* ptr, void* user_data)
+    {
+        (void)hipFree(ptr);
+    }
+
+    // Constants 0 and 1 of all precisions, for routines that need to pass synthetic
+    // scalars to rocSPARSE
+    struct scalar_constants
+    {
+        float            s[2];
+        double           d[2];
+        hipComplex       c[2];
+        hipDoubleComplex z[2];
+    };
+
+    scalar_constants make_scalar_constants()
+    {
+        scalar_constants constants;
+
+        constants.s[0] = 0.0f;
+        constants.s[1] = 1.0f;
+        constants.d[0] = 0.0;
+        constants.d[1] = 1.0;
+        constants.c[0] = make_hipComplex(0.0f, 0.0f);
+        constants.c[1] = make_hipComplex(1.0f, 0.0f);
+        constants.z[0] = make_hipDoubleComplex(0.0, 0.0);
+        constants.z[1] = make_hipDoubleComplex(1.0, 0.0);
+
+        return constants;
+    }
+
+    const scalar_constants host_constants = make_scalar_constants();
+
+    // Profiled call whose device work has not been timed yet
+    struct profile_record
+    {
+        const char* name;
+        double      host_us;
+        hipEvent_t  start;
+        hipEvent_t  stop;
+    };
+
+    // hipSPARSE specific state that is attached to a rocSPARSE handle
+    struct handle_data
+    {
+        handle_data()
+            : workspace({workspace_device_allocate, workspace_device_deallocate, nullptr})
+        {
+        }
+
+        ~handle_data()
+        {
+            if(device_constants != nullptr)
+            {
+                (void)hipFree(device_constants);
+            }
+
+            for(const profile_record& record : profile_pending)
+            {
+                (void)hipEventDestroy(record.start);
+                (void)hipEventDestroy(record.stop);
+            }
+
+            for(hipEvent_t event : profile_events)
+            {
+                (void)hipEventDestroy(event);
+            }
+        }
+
+        // Device workspace for internally allocated temporary buffers
+        hipsparse::workspace_pool workspace;
+
+        // Whether routines block like their cuSPARSE counterparts
+        hipsparseExecutionMode_t exec_mode = HIPSPARSE_EXEC_BLOCKING;
+
+        // Whether analysis routines may re-use existing meta data
+        hipsparseAnalysisPolicy_t analysis_policy = HIPSPARSE_ANALYSIS_POLICY_FORCE;
+
+        // Immutable copy of host_constants in device memory, created on first use
+        scalar_constants* device_constants = nullptr;
+
+        // Profiled calls in the order they have been issued, and events for re-use
+        std::vector<profile_record> profile_pending;
+        std::vector<hipEvent_t>     profile_events;
+    };
+
+    std::mutex                                              handle_registry_mutex;
+    std::unordered_map<void*, std::unique_ptr<handle_data>> handle_registry;
+
+    // Returns nullptr if the handle has not been created by hipsparseCreate()
+    handle_data* get_handle_data(void* handle)
+    {
+        std::lock_guard<std::mutex> lock(handle_registry_mutex);
+
+        auto it = handle_registry.find(handle);
+        return (it != handle_registry.end()) ? it->second.get() : nullptr;
+    }
+
+    // csrmv analysis that is kept with a matrix descriptor, together with the
+    // properties of the matrix it has been computed for
+    struct csrmv_analysis
+    {
+        ~csrmv_analysis()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            if(info != nullptr)
+            {
+                rocsparse_destroy_mat_info(info);
+                info = nullptr;
+            }
+        }
+
+        bool matches(int        m_,
+                     int        n_,
+                     int        nnz_,
+                     const int* csr_row_ptr_,
+                     const int* csr_col_ind_,
+                     int64_t    generation_) const
+        {
+            return info != nullptr && m == m_ && n == n_ && nnz == nnz_
+                   && csr_row_ptr == csr_row_ptr_ && csr_col_ind == csr_col_ind_
+                   && generation == generation_;
+        }
+
+        rocsparse_mat_info info = nullptr;
+        int                m;
+        int                n;
+        int                nnz;
+        const int*         csr_row_ptr;
+        const int*         csr_col_ind;
+        int64_t            generation;
+    };
+
+    // hipSPARSE specific state that is attached to a rocSPARSE matrix descriptor
+    struct descr_data
+    {
+        hipsparseAnalysisCache_t analysis_cache = HIPSPARSE_ANALYSIS_CACHE_OFF;
+        int64_t                  generation     = 0;
+        csrmv_analysis           csrmv;
+
+        // Whether hipsparseSpMV_preprocess() has analysed the sparse matrix
+        bool spmv_preprocessed = false;
+
+        // SpGEMM descriptor, whose storage the arrays of the sparse matrix refer to after
+        // hipsparseSpGEMM_compute()
+        void* spgemm_descr = nullptr;
+
+        // Storage of an SpGEMM descriptor that has been destroyed or re-used while the
+        // arrays of the sparse matrix still referred to it
+        void* spgemm_storage = nullptr;
+    };
+
+    std::mutex                                             descr_registry_mutex;
+    std::unordered_map<void*, std::unique_ptr<descr_data>> descr_registry;
+
+    // Returns nullptr if no state has been attached to the descriptor yet, unless
+    // create is set
+    descr_data* get_descr_data(void* descr, bool create = false)
+    {
+        std::lock_guard<std::mutex> lock(descr_registry_mutex);
+
+        auto it = descr_registry.find(descr);
+        if(it != descr_registry.end())
+        {
+            return it->second.get();
+        }
+
+        if(!create)
+        {
+            return nullptr;
+        }
+
+        descr_data* data = new descr_data;
+        descr_registry[descr].reset(data);
+
+        return data;
+    }
+
+    // Number of additional owners of a rocSPARSE matrix info that is shared between
+    // csrilu02, csric02 and csrsv2 info structures
+    std::mutex                     info_registry_mutex;
+    std::unordered_map<void*, int> info_references;
+
+    void acquire_info_reference(void* info)
+    {
+        std::lock_guard<std::mutex> lock(info_registry_mutex);
+
+        ++info_references[info];
+    }
+
+    // Returns true if the info is still owned by another structure and must not be
+    // destroyed yet
+    bool release_info_reference(void* info)
+    {
+        std::lock_guard<std::mutex> lock(info_registry_mutex);
+
+        auto it = info_references.find(info);
+        if(it == info_references.end())
+        {
+            return false;
+        }
+
+        if(--it->second == 0)
+        {
+            info_references.erase(it);
+        }
+
+        return true;
+    }
+
+    // Nesting depth of API calls on this thread, such that routines calling other
+    // hipSPARSE routines internally are only logged once
+    thread_local int api_depth = 0;
+
+    // Returns an event for timing device work, nullptr if none can be created
+    hipEvent_t profile_event(handle_data* data)
+    {
+        if(!data->profile_events.empty())
+        {
+            hipEvent_t event = data->profile_events.back();
+            data->profile_events.pop_back();
+            return event;
+        }
+
+        hipEvent_t event;
+        return (hipEventCreate(&event) == hipSuccess) ? event : nullptr;
+    }
+
+    // Accounts the profiled calls of handle whose device work has completed. A call takes
+    // the longer of its host time and the device time between its events. If wait is set,
+    // all pending calls are accounted.
+    void profile_resolve(hipsparseHandle_t handle, handle_data* data, bool wait)
+    {
+        std::vector<profile_record>& pending = data->profile_pending;
+
+        size_t done = 0;
+        for(; done < pending.size(); ++done)
+        {
+            const profile_record& record = pending[done];
+
+            hipError_t status
+                = wait ? hipEventSynchronize(record.stop) : hipEventQuery(record.stop);
+            if(status == hipErrorNotReady)
+            {
+                break;
+            }
+
+            float device_ms = 0.0f;
+            if(status == hipSuccess)
+            {
+                (void)hipEventElapsedTime(&device_ms, record.start, record.stop);
+            }
+
+            hipsparse::logger::instance().profile(
+                handle, record.name, std::max(record.host_us, 1000.0 * device_ms));
+
+            data->profile_events.push_back(record.start);
+            data->profile_events.push_back(record.stop);
+        }
+
+        pending.erase(pending.begin(), pending.begin() + done);
+    }
+
+    // Traces and profiles an API call for its lifetime, depending on HIPSPARSE_LAYER.
+    //
+    // Profiling does not block the host. The device work of a call is timed by events that
+    // are recorded on the stream, and is accounted by a later call on the handle once it has
+    // completed, or by hipsparseDestroy(). Events cannot be queried while the stream is
+    // being captured, such that calls in capture safe mode are accounted by host time.
+    class api_logger
+    {
+    public:
+        template <typename... Ts>
+        api_logger(hipsparseHandle_t handle, const char* name, const Ts&... args)
+            : handle_(handle)
+            , name_(name)
+            , mode_(api_depth++ == 0 ? hipsparse::logger::instance().mode()
+                                     : hipsparse::layer_mode_none)
+        {
+            if(mode_ & hipsparse::layer_mode_log_trace)
+            {
+                hipsparse::logger::instance().trace(hipsparse::log_line(name, handle, args...));
+            }
+
+            if(!(mode_ & hipsparse::layer_mode_log_profile))
+            {
+                return;
+            }
+
+            start_ = std::chrono::steady_clock::now();
+
+            handle_data* data = get_handle_data(handle_);
+            if(data == nullptr || data->exec_mode == HIPSPARSE_EXEC_CAPTURE_SAFE
+               || rocsparse_get_stream((rocsparse_handle)handle_, &stream_)
+                      != rocsparse_status_success)
+            {
+                return;
+            }
+
+            event_ = profile_event(data);
+            if(event_ != nullptr && hipEventRecord(event_, stream_) != hipSuccess)
+            {
+                data->profile_events.push_back(event_);
+                event_ = nullptr;
+            }
+        }
+
+        ~api_logger()
+        {
+            --api_depth;
+
+            if(!(mode_ & hipsparse::layer_mode_log_profile))
+            {
+                return;
+            }
+
+            std::chrono::duration<double, std::micro> time
+                = std::chrono::steady_clock::now() - start_;
+
+            // The handle is gone if this call has destroyed it
+            handle_data* data = get_handle_data(handle_);
+            if(data == nullptr)
+            {
+                if(event_ != nullptr)
+                {
+                    (void)hipEventDestroy(event_);
+                }
+
+                return;
+            }
+
+            hipEvent_t stop = (event_ != nullptr) ? profile_event(data) : nullptr;
+            if(stop == nullptr || hipEventRecord(stop, stream_) != hipSuccess)
+            {
+                if(event_ != nullptr)
+                {
+                    data->profile_events.push_back(event_);
+                }
+
+                if(stop != nullptr)
+                {
+                    data->profile_events.push_back(stop);
+                }
+
+                hipsparse::logger::instance().profile(handle_, name_, time.count());
+                return;
+            }
+
+            data->profile_pending.push_back({name_, time.count(), event_, stop});
+            profile_resolve(handle_, data, false);
+        }
+
+        api_logger(const api_logger&) = delete;
+        api_logger& operator=(const api_logger&) = delete;
+
+        // Whether the call is to be written as benchmark command
+        bool bench() const
+        {
+            return mode_ & hipsparse::layer_mode_log_bench;
+        }
+
+    private:
+        hipsparseHandle_t                     handle_;
+        const char*                           name_;
+        int                                   mode_;
+        std::chrono::steady_clock::time_point start_;
+        hipStream_t                           stream_ = nullptr;
+        hipEvent_t                            event_  = nullptr;
+    };
+
+    // Benchmark command line arguments. Scalars are only known in host pointer mode,
+    // otherwise the benchmark client falls back to its defaults.
+    std::string bench_value(const char* flag, double value)
+    {
+        std::ostringstream os;
+        os << flag << ' ' << value;
+        return os.str();
+    }
+
+    std::string bench_scalar(hipsparseHandle_t handle, const char* flag, const float* x)
+    {
+        hipsparsePointerMode_t mode;
+        if(x == nullptr || hipsparseGetPointerMode(handle, &mode) != HIPSPARSE_STATUS_SUCCESS
+           || mode != HIPSPARSE_POINTER_MODE_HOST)
+        {
+            return "";
+        }
+
+        return bench_value(flag, *x);
+    }
+
+    std::string bench_scalar(hipsparseHandle_t handle, const char* flag, const double* x)
+    {
+        hipsparsePointerMode_t mode;
+        if(x == nullptr || hipsparseGetPointerMode(handle, &mode) != HIPSPARSE_STATUS_SUCCESS
+           || mode != HIPSPARSE_POINTER_MODE_HOST)
+        {
+            return "";
+        }
+
+        return bench_value(flag, *x);
+    }
+
+    std::string bench_scalar(hipsparseHandle_t handle, const char* flag, const hipComplex* x)
+    {
+        hipsparsePointerMode_t mode;
+        if(x == nullptr || hipsparseGetPointerMode(handle, &mode) != HIPSPARSE_STATUS_SUCCESS
+           || mode != HIPSPARSE_POINTER_MODE_HOST)
+        {
+            return "";
+        }
+
+        return bench_value(flag, hipCrealf(*x)) + " "
+               + bench_value((std::string(flag) + "i").c_str(), hipCimagf(*x));
+    }
+
+    std::string
+        bench_scalar(hipsparseHandle_t handle, const char* flag, const hipDoubleComplex* x)
+    {
+        hipsparsePointerMode_t mode;
+        if(x == nullptr || hipsparseGetPointerMode(handle, &mode) != HIPSPARSE_STATUS_SUCCESS
+           || mode != HIPSPARSE_POINTER_MODE_HOST)
+        {
+            return "";
+        }
+
+        return bench_value(flag, hipCreal(*x)) + " "
+               + bench_value((std::string(flag) + "i").c_str(), hipCimag(*x));
+    }
+
+    const char* bench_operation(hipsparseOperation_t op)
+    {
+        switch(op)
+        {
+        case HIPSPARSE_OPERATION_NON_TRANSPOSE:
+            return "N";
+        case HIPSPARSE_OPERATION_TRANSPOSE:
+            return "T";
+        case HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE:
+            return "C";
+        }
+
+        return "N";
+    }
+
+    const char* bench_fill_mode(hipsparseFillMode_t fill)
+    {
+        return (fill == HIPSPARSE_FILL_MODE_UPPER) ? "U" : "L";
+    }
+
+    const char* bench_diag_type(hipsparseDiagType_t diag)
+    {
+        return (diag == HIPSPARSE_DIAG_TYPE_UNIT) ? "U" : "N";
+    }
+
+    // Precision of the benchmark client, nullptr if it has none for the compute type
+    const char* bench_precision(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return "s";
+        case HIP_R_64F:
+            return "d";
+        case HIP_C_32F:
+            return "c";
+        case HIP_C_64F:
+            return "z";
+        default:
+            return nullptr;
+        }
+    }
+
+    std::string
+        bench_scalar(hipsparseHandle_t handle, const char* flag, const void* x, hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return bench_scalar(handle, flag, (const float*)x);
+        case HIP_R_64F:
+            return bench_scalar(handle, flag, (const double*)x);
+        case HIP_C_32F:
+            return bench_scalar(handle, flag, (const hipComplex*)x);
+        case HIP_C_64F:
+            return bench_scalar(handle, flag, (const hipDoubleComplex*)x);
+        default:
+            return "";
+        }
+    }
+
+    // Dimensions of a generic sparse matrix, as they are passed to the benchmark client.
+    // Empty if the matrix is not in CSR format, which is the only one the client generates.
+    std::string bench_csr_matrix(hipsparseSpMatDescr_t descr, const char* cols_flag)
+    {
+        hipsparseFormat_t    format;
+        hipsparseIndexBase_t base;
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+
+        if(hipsparseSpMatGetFormat(descr, &format) != HIPSPARSE_STATUS_SUCCESS
+           || format != HIPSPARSE_FORMAT_CSR
+           || hipsparseSpMatGetIndexBase(descr, &base) != HIPSPARSE_STATUS_SUCCESS
+           || hipsparseSpMatGetSize(descr, &rows, &cols, &nnz) != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return "";
+        }
+
+        std::ostringstream os;
+        os << "--sizem " << rows << ' ' << cols_flag << ' ' << cols << " --sizennz " << nnz
+           << " --indexbaseA " << base;
+        return os.str();
+    }
+
+    template <typename... Ts>
+    void log_bench(const Ts&... args)
+    {
+        hipsparse::logger::instance().bench(hipsparse::log_command(args...));
+    }
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,8 +627,11 @@ extern "C" {
 // csru2csr struct - to hold permutation array
 struct csru2csrInfo
 {
-    int  size = 0;
-    int* P    = nullptr;
+    int  size     = 0;
+    int  capacity = 0;
+    int* P        = nullptr;
+
+    hipsparseCsru2csrPermutation_t permutation = HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP;
 };
 
 hipsparseStatus_t hipErrorToHIPSPARSEStatus(hipError_t status)
@@ -448,6 +1010,36 @@ hipDataType HCCDataTypeToHIPDataType(rocsparse_datatype_ datatype)
     }
 }
 
+size_t HCCIndexTypeSize(rocsparse_indextype_ indextype)
+{
+    switch(indextype)
+    {
+    case rocsparse_indextype_i32:
+        return sizeof(int32_t);
+    case rocsparse_indextype_i64:
+        return sizeof(int64_t);
+    default:
+        throw "Non existent rocsparse_indextype";
+    }
+}
+
+size_t HCCDataTypeSize(rocsparse_datatype_ datatype)
+{
+    switch(datatype)
+    {
+    case rocsparse_datatype_f32_r:
+        return sizeof(float);
+    case rocsparse_datatype_f64_r:
+        return sizeof(double);
+    case rocsparse_datatype_f32_c:
+        return sizeof(hipComplex);
+    case rocsparse_datatype_f64_c:
+        return sizeof(hipDoubleComplex);
+    default:
+        throw "Non existent rocsparse_datatype";
+    }
+}
+
 rocsparse_spmv_alg_ hipSpMVAlgToHCCSpMVAlg(hipsparseSpMVAlg_t alg)
 {
     switch(alg)
@@ -626,105 +1218,540 @@ hipsparseFormat_t HCCFormatToHIPFormat(rocsparse_format_ format)
     }
 }
 
-hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
+// In capture safe mode, device memory must not be allocated or freed and the stream
+// must not be synchronized, as this would invalidate a stream capture
+static bool capture_safe(hipsparseHandle_t handle)
 {
-    // Check if handle is valid
-    if(handle == nullptr)
-    {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
-
-    int               deviceId;
-    hipError_t        err;
-    hipsparseStatus_t retval = HIPSPARSE_STATUS_SUCCESS;
+    handle_data* data = get_handle_data(handle);
 
-    err = hipGetDevice(&deviceId);
-    if(err == hipSuccess)
-    {
-        retval = rocSPARSEStatusToHIPStatus(rocsparse_create_handle((rocsparse_handle*)handle));
-    }
-    return retval;
+    return data != nullptr && data->exec_mode == HIPSPARSE_EXEC_CAPTURE_SAFE;
 }
 
-hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
+// Building an analysis allocates device memory inside rocSPARSE, which is not supported
+// in capture safe mode. The analysis has to be done before the capture starts.
+static hipsparseStatus_t analysis_capture_check(hipsparseHandle_t handle)
 {
-    return rocSPARSEStatusToHIPStatus(rocsparse_destroy_handle((rocsparse_handle)handle));
+    return capture_safe(handle) ? HIPSPARSE_STATUS_NOT_SUPPORTED : HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
+// With host pointer mode, the zero pivot is copied to the host, which synchronizes the
+// stream and is therefore not supported in capture safe mode
+static hipsparseStatus_t zero_pivot_capture_check(hipsparseHandle_t handle)
 {
-    if(handle == nullptr)
+    if(!capture_safe(handle))
     {
-        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+        return HIPSPARSE_STATUS_SUCCESS;
     }
 
-    *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return (mode == HIPSPARSE_POINTER_MODE_HOST) ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                                                 : HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
+// Obtain a temporary device buffer from the handle workspace. In capture safe mode,
+// only memory that has been reserved up front can be handed out.
+static hipsparseStatus_t workspace_acquire(hipsparseHandle_t handle, size_t size, void** ptr)
 {
-    // Get hipSPARSE revision
-    if(handle == nullptr)
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
     {
-        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, size));
+        return HIPSPARSE_STATUS_SUCCESS;
     }
 
-    if(rev == nullptr)
+    if(data->workspace.acquire(size, ptr))
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return HIPSPARSE_STATUS_SUCCESS;
     }
 
-    static constexpr char v[] = TO_STR(hipsparseVersionTweak);
-
-    char hipsparse_rev[64];
-    memcpy(hipsparse_rev, v, sizeof(v));
+    return data->workspace.frozen() ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                                    : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
 
-    // Get rocSPARSE revision
-    char rocsparse_rev[64];
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_git_rev((rocsparse_handle)handle, rocsparse_rev));
+// Hand a temporary device buffer back to the handle workspace. Work on the handle
+// stream is ordered, thus the buffer can be re-used without synchronization.
+static hipsparseStatus_t workspace_release(hipsparseHandle_t handle, void* ptr)
+{
+    handle_data* data = get_handle_data(handle);
 
-    // Get rocSPARSE version
-    int rocsparse_ver;
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_version((rocsparse_handle)handle, &rocsparse_ver));
+    if(data == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
 
-    // Combine
-    sprintf(rev,
-            "%s (rocSPARSE %d.%d.%d-%s)",
-            hipsparse_rev,
-            rocsparse_ver / 100000,
-            rocsparse_ver / 100 % 1000,
-            rocsparse_ver % 100,
-            rocsparse_rev);
+    data->workspace.release(ptr);
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
+// Explicit synchronization of routines that are blocking in cuSPARSE. This is
+// skipped in asynchronous and capture safe execution mode, where results are left
+// on the stream.
+static hipsparseStatus_t blocking_sync(hipsparseHandle_t handle, hipStream_t stream)
 {
-    return rocSPARSEStatusToHIPStatus(rocsparse_set_stream((rocsparse_handle)handle, streamId));
-}
+    handle_data* data = get_handle_data(handle);
 
-hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
-{
-    return rocSPARSEStatusToHIPStatus(rocsparse_get_stream((rocsparse_handle)handle, streamId));
-}
+    if(data != nullptr && data->exec_mode != HIPSPARSE_EXEC_BLOCKING)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Analysis policy of the handle, analysis is always recomputed unless the user opted in
+// to re-use existing meta data
+static rocsparse_analysis_policy analysis_policy(hipsparseHandle_t handle)
+{
+    handle_data* data = get_handle_data(handle);
+
+    if(data != nullptr && data->analysis_policy == HIPSPARSE_ANALYSIS_POLICY_REUSE)
+    {
+        return rocsparse_analysis_policy_reuse;
+    }
+
+    return rocsparse_analysis_policy_force;
+}
+
+// Create the device table of constants of a handle, if not yet available
+static hipsparseStatus_t create_device_constants(handle_data* data)
+{
+    if(data->device_constants == nullptr)
+    {
+        // The table is created when switching to capture safe mode
+        if(data->exec_mode == HIPSPARSE_EXEC_CAPTURE_SAFE)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        scalar_constants* device_constants;
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&device_constants, sizeof(scalar_constants)));
+
+        hipError_t err = hipMemcpy(
+            device_constants, &host_constants, sizeof(scalar_constants), hipMemcpyHostToDevice);
+
+        if(err != hipSuccess)
+        {
+            (void)hipFree(device_constants);
+            return hipErrorToHIPSPARSEStatus(err);
+        }
+
+        data->device_constants = device_constants;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Constants 0 and 1 in host or device memory, depending on the pointer mode of the
+// handle. The device table is created once per handle.
+static hipsparseStatus_t get_scalar_constants(hipsparseHandle_t        handle,
+                                              const scalar_constants** constants)
+{
+    hipsparsePointerMode_t mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+
+    if(mode == HIPSPARSE_POINTER_MODE_HOST)
+    {
+        *constants = &host_constants;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(create_device_constants(data));
+
+    *constants = data->device_constants;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int               deviceId;
+    hipError_t        err;
+    hipsparseStatus_t retval = HIPSPARSE_STATUS_SUCCESS;
+
+    err = hipGetDevice(&deviceId);
+    if(err == hipSuccess)
+    {
+        retval = rocSPARSEStatusToHIPStatus(rocsparse_create_handle((rocsparse_handle*)handle));
+
+        if(retval == HIPSPARSE_STATUS_SUCCESS)
+        {
+            std::lock_guard<std::mutex> lock(handle_registry_mutex);
+            handle_registry[*handle].reset(new handle_data);
+        }
+    }
+    return retval;
+}
+
+hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
+{
+    api_logger logger(handle, __func__);
+
+    if(hipsparse::logger::instance().mode() & hipsparse::layer_mode_log_profile)
+    {
+        handle_data* data = get_handle_data(handle);
+        if(data != nullptr)
+        {
+            profile_resolve(handle, data, true);
+        }
+
+        hipsparse::logger::instance().dump_profile(handle);
+    }
+
+    if(handle != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(handle_registry_mutex);
+        handle_registry.erase(handle);
+    }
+
+    return rocSPARSEStatusToHIPStatus(rocsparse_destroy_handle((rocsparse_handle)handle));
+}
+
+hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
+{
+    api_logger logger(handle, __func__, version);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
+{
+    api_logger logger(handle, __func__, rev);
+
+    // Get hipSPARSE revision
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(rev == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    static constexpr char v[] = TO_STR(hipsparseVersionTweak);
+
+    char hipsparse_rev[64];
+    memcpy(hipsparse_rev, v, sizeof(v));
+
+    // Get rocSPARSE revision
+    char rocsparse_rev[64];
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_git_rev((rocsparse_handle)handle, rocsparse_rev));
+
+    // Get rocSPARSE version
+    int rocsparse_ver;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_version((rocsparse_handle)handle, &rocsparse_ver));
+
+    // Combine
+    sprintf(rev,
+            "%s (rocSPARSE %d.%d.%d-%s)",
+            hipsparse_rev,
+            rocsparse_ver / 100000,
+            rocsparse_ver / 100 % 1000,
+            rocsparse_ver % 100,
+            rocsparse_rev);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
+{
+    api_logger logger(handle, __func__, streamId);
+
+    handle_data* data = get_handle_data(handle);
+
+    // Cached workspace blocks might still be in use by work on the previous stream
+    if(data != nullptr && data->workspace.allocated_bytes() > 0)
+    {
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        if(stream != streamId)
+        {
+            // The previous stream cannot be synchronized while it is being captured
+            if(data->exec_mode == HIPSPARSE_EXEC_CAPTURE_SAFE)
+            {
+                hipStreamCaptureStatus capture_status;
+                RETURN_IF_HIP_ERROR(hipStreamIsCapturing(stream, &capture_status));
+
+                if(capture_status != hipStreamCaptureStatusNone)
+                {
+                    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+                }
+            }
+
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+    }
+
+    return rocSPARSEStatusToHIPStatus(rocsparse_set_stream((rocsparse_handle)handle, streamId));
+}
+
+hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
+{
+    api_logger logger(handle, __func__, streamId);
+
+    return rocSPARSEStatusToHIPStatus(rocsparse_get_stream((rocsparse_handle)handle, streamId));
+}
 
 hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
 {
+    api_logger logger(handle, __func__, mode);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_set_pointer_mode((rocsparse_handle)handle, hipPtrModeToHCCPtrMode(mode)));
 }
 
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
 {
+    api_logger logger(handle, __func__, mode);
+
     rocsparse_pointer_mode_ rocsparse_mode;
     rocsparse_status status = rocsparse_get_pointer_mode((rocsparse_handle)handle, &rocsparse_mode);
     *mode                   = HCCPtrModeToHIPPtrMode(rocsparse_mode);
     return rocSPARSEStatusToHIPStatus(status);
 }
 
+hipsparseStatus_t hipsparseSetExecutionMode(hipsparseHandle_t handle, hipsparseExecutionMode_t mode)
+{
+    api_logger logger(handle, __func__, mode);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode != HIPSPARSE_EXEC_BLOCKING && mode != HIPSPARSE_EXEC_ASYNC
+       && mode != HIPSPARSE_EXEC_CAPTURE_SAFE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Constants in device memory cannot be created during a capture
+    if(mode == HIPSPARSE_EXEC_CAPTURE_SAFE)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(create_device_constants(data));
+    }
+
+    data->exec_mode = mode;
+    data->workspace.set_frozen(mode == HIPSPARSE_EXEC_CAPTURE_SAFE);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetExecutionMode(hipsparseHandle_t         handle,
+                                            hipsparseExecutionMode_t* mode)
+{
+    api_logger logger(handle, __func__, mode);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = data->exec_mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetAnalysisPolicy(hipsparseHandle_t         handle,
+                                             hipsparseAnalysisPolicy_t policy)
+{
+    api_logger logger(handle, __func__, policy);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(policy != HIPSPARSE_ANALYSIS_POLICY_FORCE && policy != HIPSPARSE_ANALYSIS_POLICY_REUSE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    data->analysis_policy = policy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetAnalysisPolicy(hipsparseHandle_t          handle,
+                                             hipsparseAnalysisPolicy_t* policy)
+{
+    api_logger logger(handle, __func__, policy);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = data->analysis_policy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetWorkspacePolicy(hipsparseHandle_t          handle,
+                                              hipsparseWorkspacePolicy_t policy)
+{
+    api_logger logger(handle, __func__, policy);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    switch(policy)
+    {
+    case HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY:
+        data->workspace.set_policy(hipsparse::workspace_pool::grow_only);
+        break;
+    case HIPSPARSE_WORKSPACE_POLICY_TRIM:
+        data->workspace.set_policy(hipsparse::workspace_pool::trim_to_reserve);
+        break;
+    default:
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetWorkspacePolicy(hipsparseHandle_t           handle,
+                                              hipsparseWorkspacePolicy_t* policy)
+{
+    api_logger logger(handle, __func__, policy);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = (data->workspace.get_policy() == hipsparse::workspace_pool::grow_only)
+                  ? HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY
+                  : HIPSPARSE_WORKSPACE_POLICY_TRIM;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetWorkspaceSize(hipsparseHandle_t handle, size_t* size)
+{
+    api_logger logger(handle, __func__, size);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(size == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *size = data->workspace.allocated_bytes();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseReserveWorkspace(hipsparseHandle_t handle, size_t size)
+{
+    api_logger logger(handle, __func__, size);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    // The workspace has to be reserved before entering capture safe mode
+    if(data->exec_mode == HIPSPARSE_EXEC_CAPTURE_SAFE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return data->workspace.reserve(size) ? HIPSPARSE_STATUS_SUCCESS
+                                         : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseReleaseWorkspace(hipsparseHandle_t handle)
+{
+    api_logger logger(handle, __func__);
+
+    handle_data* data = get_handle_data(handle);
+
+    if(data == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(data->exec_mode == HIPSPARSE_EXEC_CAPTURE_SAFE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // Idle blocks might still be referenced by work in flight
+    hipStream_t stream;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    data->workspace.release_all();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
     return rocSPARSEStatusToHIPStatus(rocsparse_create_mat_descr((rocsparse_mat_descr*)descrA));
@@ -732,13 +1759,38 @@ hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 
 hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
 {
+    if(descrA != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(descr_registry_mutex);
+        descr_registry.erase(descrA);
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_destroy_mat_descr((rocsparse_mat_descr)descrA));
 }
 
 hipsparseStatus_t hipsparseCopyMatDescr(hipsparseMatDescr_t dest, const hipsparseMatDescr_t src)
 {
-    return rocSPARSEStatusToHIPStatus(
+    RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_copy_mat_descr((rocsparse_mat_descr)dest, (const rocsparse_mat_descr)src));
+
+    // Cache settings are copied, cached analysis data is not
+    descr_data* src_data = get_descr_data(src);
+    descr_data* dst_data = get_descr_data(dest, src_data != nullptr);
+
+    if(dst_data != nullptr)
+    {
+        dst_data->analysis_cache = HIPSPARSE_ANALYSIS_CACHE_OFF;
+        dst_data->generation     = 0;
+        dst_data->csrmv.clear();
+
+        if(src_data != nullptr)
+        {
+            dst_data->analysis_cache = src_data->analysis_cache;
+            dst_data->generation     = src_data->generation;
+        }
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseSetMatType(hipsparseMatDescr_t descrA, hipsparseMatrixType_t type)
@@ -785,6 +1837,93 @@ hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
     return HCCBaseToHIPBase(rocsparse_get_mat_index_base((rocsparse_mat_descr)descrA));
 }
 
+hipsparseStatus_t hipsparseSetMatAnalysisCache(hipsparseMatDescr_t      descrA,
+                                               hipsparseAnalysisCache_t cache)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(cache != HIPSPARSE_ANALYSIS_CACHE_OFF && cache != HIPSPARSE_ANALYSIS_CACHE_ON)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr_data* data = get_descr_data(descrA, cache == HIPSPARSE_ANALYSIS_CACHE_ON);
+
+    if(data != nullptr)
+    {
+        data->analysis_cache = cache;
+
+        if(cache == HIPSPARSE_ANALYSIS_CACHE_OFF)
+        {
+            data->csrmv.clear();
+        }
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetMatAnalysisCache(const hipsparseMatDescr_t descrA,
+                                               hipsparseAnalysisCache_t* cache)
+{
+    if(descrA == nullptr || cache == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr_data* data = get_descr_data(descrA);
+
+    *cache = (data != nullptr) ? data->analysis_cache : HIPSPARSE_ANALYSIS_CACHE_OFF;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetMatGeneration(hipsparseMatDescr_t descrA, int64_t generation)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    get_descr_data(descrA, true)->generation = generation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetMatGeneration(const hipsparseMatDescr_t descrA,
+                                            int64_t*                  generation)
+{
+    if(descrA == nullptr || generation == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr_data* data = get_descr_data(descrA);
+
+    *generation = (data != nullptr) ? data->generation : 0;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseInvalidateMatAnalysis(hipsparseMatDescr_t descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr_data* data = get_descr_data(descrA);
+
+    if(data != nullptr)
+    {
+        data->csrmv.clear();
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreateHybMat(hipsparseHybMat_t* hybA)
 {
     return rocSPARSEStatusToHIPStatus(rocsparse_create_hyb_mat((rocsparse_hyb_mat*)hybA));
@@ -822,6 +1961,12 @@ hipsparseStatus_t hipsparseCreateCsrsv2Info(csrsv2Info_t* info)
 
 hipsparseStatus_t hipsparseDestroyCsrsv2Info(csrsv2Info_t info)
 {
+    // Shared info structures are destroyed by their last owner
+    if(release_info_reference(info))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_destroy_mat_info((rocsparse_mat_info)info));
 }
 
@@ -862,6 +2007,12 @@ hipsparseStatus_t hipsparseCreateCsrilu02Info(csrilu02Info_t* info)
 
 hipsparseStatus_t hipsparseDestroyCsrilu02Info(csrilu02Info_t info)
 {
+    // Shared info structures are destroyed by their last owner
+    if(release_info_reference(info))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_destroy_mat_info((rocsparse_mat_info)info));
 }
 
@@ -882,9 +2033,41 @@ hipsparseStatus_t hipsparseCreateCsric02Info(csric02Info_t* info)
 
 hipsparseStatus_t hipsparseDestroyCsric02Info(csric02Info_t info)
 {
+    // Shared info structures are destroyed by their last owner
+    if(release_info_reference(info))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_destroy_mat_info((rocsparse_mat_info)info));
 }
 
+hipsparseStatus_t hipsparseShareCsrilu02Info(csrilu02Info_t source, csrsv2Info_t* info)
+{
+    if(source == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    acquire_info_reference(source);
+    *info = (csrsv2Info_t)source;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseShareCsric02Info(csric02Info_t source, csrsv2Info_t* info)
+{
+    if(source == nullptr || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    acquire_info_reference(source);
+    *info = (csrsv2Info_t)source;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreateCsrgemm2Info(csrgemm2Info_t* info)
 {
     return rocSPARSEStatusToHIPStatus(rocsparse_create_mat_info((rocsparse_mat_info*)info));
@@ -915,8 +2098,9 @@ hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info)
     *info = new csru2csrInfo;
 
     // Initialize permutation array with nullptr
-    (*info)->size = 0;
-    (*info)->P    = nullptr;
+    (*info)->size     = 0;
+    (*info)->capacity = 0;
+    (*info)->P        = nullptr;
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -930,7 +2114,8 @@ hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
         if(info->P != nullptr)
         {
             RETURN_IF_HIP_ERROR(hipFree(info->P));
-            info->size = 0;
+            info->size     = 0;
+            info->capacity = 0;
         }
 
         delete info;
@@ -939,6 +2124,47 @@ hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparseSetCsru2csrInfoPermutation(csru2csrInfo_t                 info,
+                                                      hipsparseCsru2csrPermutation_t permutation)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(permutation != HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP
+       && permutation != HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // A permutation that is not kept does not need to occupy memory
+    if(permutation == HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD && info->P != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->P));
+        info->P        = nullptr;
+        info->size     = 0;
+        info->capacity = 0;
+    }
+
+    info->permutation = permutation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetCsru2csrInfoPermutation(csru2csrInfo_t                  info,
+                                                      hipsparseCsru2csrPermutation_t* permutation)
+{
+    if(info == nullptr || permutation == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *permutation = info->permutation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   int                  nnz,
                                   const float*         alpha,
@@ -947,6 +2173,21 @@ hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   float*               y,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, alpha, xVal, xInd, y, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "axpyi",
+                  "-r",
+                  "s",
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_saxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipBaseToHCCBase(idxBase)));
 }
@@ -959,6 +2200,21 @@ hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
                                   double*              y,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, alpha, xVal, xInd, y, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "axpyi",
+                  "-r",
+                  "d",
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_daxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipBaseToHCCBase(idxBase)));
 }
@@ -971,6 +2227,21 @@ hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
                                   hipComplex*          y,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, alpha, xVal, xInd, y, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "axpyi",
+                  "-r",
+                  "c",
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_caxpyi((rocsparse_handle)handle,
                                                        nnz,
                                                        (const rocsparse_float_complex*)alpha,
@@ -988,6 +2259,21 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       y,
                                   hipsparseIndexBase_t    idxBase)
 {
+    api_logger logger(handle, __func__, nnz, alpha, xVal, xInd, y, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "axpyi",
+                  "-r",
+                  "z",
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zaxpyi((rocsparse_handle)handle,
                                                        nnz,
                                                        (const rocsparse_double_complex*)alpha,
@@ -1005,6 +2291,20 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                  float*               result,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, result, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "doti",
+                  "-r",
+                  "s",
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1014,7 +2314,7 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
         (rocsparse_handle)handle, nnz, xVal, xInd, y, result, hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1027,6 +2327,20 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                  double*              result,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, result, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "doti",
+                  "-r",
+                  "d",
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1036,7 +2350,7 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
         (rocsparse_handle)handle, nnz, xVal, xInd, y, result, hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1049,6 +2363,20 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                  hipComplex*          result,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, result, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "doti",
+                  "-r",
+                  "c",
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1063,7 +2391,7 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                               hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1076,6 +2404,20 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       result,
                                  hipsparseIndexBase_t    idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, result, idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "doti",
+                  "-r",
+                  "z",
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1090,7 +2432,7 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                               hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1103,6 +2445,8 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                   hipComplex*          result,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1117,7 +2461,7 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                                hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1130,6 +2474,8 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       result,
                                   hipsparseIndexBase_t    idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1144,7 +2490,7 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                                hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1156,6 +2502,8 @@ hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sgthr((rocsparse_handle)handle, nnz, y, xVal, xInd, hipBaseToHCCBase(idxBase)));
 }
@@ -1167,6 +2515,8 @@ hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dgthr((rocsparse_handle)handle, nnz, y, xVal, xInd, hipBaseToHCCBase(idxBase)));
 }
@@ -1178,6 +2528,8 @@ hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cgthr((rocsparse_handle)handle,
                                                       nnz,
                                                       (const rocsparse_float_complex*)y,
@@ -1193,6 +2545,8 @@ hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
                                  const int*              xInd,
                                  hipsparseIndexBase_t    idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zgthr((rocsparse_handle)handle,
                                                       nnz,
                                                       (const rocsparse_double_complex*)y,
@@ -1208,6 +2562,8 @@ hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sgthrz((rocsparse_handle)handle, nnz, y, xVal, xInd, hipBaseToHCCBase(idxBase)));
 }
@@ -1219,6 +2575,8 @@ hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dgthrz((rocsparse_handle)handle, nnz, y, xVal, xInd, hipBaseToHCCBase(idxBase)));
 }
@@ -1230,6 +2588,8 @@ hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cgthrz((rocsparse_handle)handle,
                                                        nnz,
                                                        (rocsparse_float_complex*)y,
@@ -1245,6 +2605,8 @@ hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, y, xVal, xInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zgthrz((rocsparse_handle)handle,
                                                        nnz,
                                                        (rocsparse_double_complex*)y,
@@ -1262,6 +2624,8 @@ hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
                                  const float*         s,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, c, s, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sroti(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipBaseToHCCBase(idxBase)));
 }
@@ -1275,6 +2639,8 @@ hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
                                  const double*        s,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, c, s, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_droti(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipBaseToHCCBase(idxBase)));
 }
@@ -1286,6 +2652,8 @@ hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
                                  float*               y,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, idxBase);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ssctr((rocsparse_handle)handle, nnz, xVal, xInd, y, hipBaseToHCCBase(idxBase)));
 }
@@ -1297,6 +2665,8 @@ hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
                                  double*              y,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, idxBase);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dsctr((rocsparse_handle)handle, nnz, xVal, xInd, y, hipBaseToHCCBase(idxBase)));
 }
@@ -1308,6 +2678,8 @@ hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
                                  hipComplex*          y,
                                  hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csctr((rocsparse_handle)handle,
                                                       nnz,
                                                       (const rocsparse_float_complex*)xVal,
@@ -1323,6 +2695,8 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       y,
                                  hipsparseIndexBase_t    idxBase)
 {
+    api_logger logger(handle, __func__, nnz, xVal, xInd, y, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zsctr((rocsparse_handle)handle,
                                                       nnz,
                                                       (const rocsparse_double_complex*)xVal,
@@ -1331,6 +2705,76 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                                       hipBaseToHCCBase(idxBase)));
 }
 
+// Looks up the csrmv analysis cached with the matrix descriptor. info is nullptr if
+// the analysis cache is disabled or the analysis does not apply (transposed or
+// non-general matrices). If the cached analysis does not match the matrix, a new
+// (empty) rocsparse_mat_info is returned and analyse is set, the caller then has to
+// run csrmv analysis and call csrmv_analysis_failed() on error. Building the analysis
+// allocates device memory, which is not supported in capture safe mode.
+static hipsparseStatus_t csrmv_cached_analysis(hipsparseHandle_t    handle,
+                                               hipsparseMatDescr_t  descrA,
+                                               hipsparseOperation_t transA,
+                                               int                  m,
+                                               int                  n,
+                                               int                  nnz,
+                                               const int*           csrSortedRowPtrA,
+                                               const int*           csrSortedColIndA,
+                                               rocsparse_mat_info*  info,
+                                               bool*                analyse)
+{
+    *info    = nullptr;
+    *analyse = false;
+
+    descr_data* data = (descrA != nullptr) ? get_descr_data(descrA) : nullptr;
+
+    if(data == nullptr || data->analysis_cache == HIPSPARSE_ANALYSIS_CACHE_OFF)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE
+       || hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    csrmv_analysis& csrmv = data->csrmv;
+
+    if(!csrmv.matches(m, n, nnz, csrSortedRowPtrA, csrSortedColIndA, data->generation))
+    {
+        if(capture_safe(handle))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        // Start over with a fresh info structure
+        csrmv.clear();
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&csrmv.info));
+
+        csrmv.m           = m;
+        csrmv.n           = n;
+        csrmv.nnz         = nnz;
+        csrmv.csr_row_ptr = csrSortedRowPtrA;
+        csrmv.csr_col_ind = csrSortedColIndA;
+        csrmv.generation  = data->generation;
+
+        *analyse = true;
+    }
+
+    *info = csrmv.info;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Drops the incomplete analysis, csrmv then falls back to the non-analysed algorithm
+// which also reports invalid arguments
+static rocsparse_mat_info csrmv_analysis_failed(hipsparseMatDescr_t descrA)
+{
+    hipsparseInvalidateMatAnalysis(descrA);
+
+    return nullptr;
+}
+
 hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   hipsparseOperation_t      transA,
                                   int                       m,
@@ -1345,6 +2789,65 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      x,
+                      beta,
+                      y);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmv",
+                  "-r",
+                  "s",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
+    rocsparse_mat_info info;
+    bool               analyse;
+    RETURN_IF_HIPSPARSE_ERROR(csrmv_cached_analysis(
+        handle, descrA, transA, m, n, nnz, csrSortedRowPtrA, csrSortedColIndA, &info, &analyse));
+
+    if(analyse)
+    {
+        rocsparse_status status = rocsparse_scsrmv_analysis((rocsparse_handle)handle,
+                                                             hipOperationToHCCOperation(transA),
+                                                             m,
+                                                             n,
+                                                             nnz,
+                                                             (rocsparse_mat_descr)descrA,
+                                                             csrSortedValA,
+                                                             csrSortedRowPtrA,
+                                                             csrSortedColIndA,
+                                                             info);
+
+        if(status != rocsparse_status_success)
+        {
+            info = csrmv_analysis_failed(descrA);
+        }
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrmv((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        m,
@@ -1355,7 +2858,7 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                                        csrSortedValA,
                                                        csrSortedRowPtrA,
                                                        csrSortedColIndA,
-                                                       nullptr,
+                                                       info,
                                                        x,
                                                        beta,
                                                        y));
@@ -1375,6 +2878,65 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      x,
+                      beta,
+                      y);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmv",
+                  "-r",
+                  "d",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
+    rocsparse_mat_info info;
+    bool               analyse;
+    RETURN_IF_HIPSPARSE_ERROR(csrmv_cached_analysis(
+        handle, descrA, transA, m, n, nnz, csrSortedRowPtrA, csrSortedColIndA, &info, &analyse));
+
+    if(analyse)
+    {
+        rocsparse_status status = rocsparse_dcsrmv_analysis((rocsparse_handle)handle,
+                                                             hipOperationToHCCOperation(transA),
+                                                             m,
+                                                             n,
+                                                             nnz,
+                                                             (rocsparse_mat_descr)descrA,
+                                                             csrSortedValA,
+                                                             csrSortedRowPtrA,
+                                                             csrSortedColIndA,
+                                                             info);
+
+        if(status != rocsparse_status_success)
+        {
+            info = csrmv_analysis_failed(descrA);
+        }
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrmv((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        m,
@@ -1385,7 +2947,7 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                                        csrSortedValA,
                                                        csrSortedRowPtrA,
                                                        csrSortedColIndA,
-                                                       nullptr,
+                                                       info,
                                                        x,
                                                        beta,
                                                        y));
@@ -1405,6 +2967,66 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      x,
+                      beta,
+                      y);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmv",
+                  "-r",
+                  "c",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
+    rocsparse_mat_info info;
+    bool               analyse;
+    RETURN_IF_HIPSPARSE_ERROR(csrmv_cached_analysis(
+        handle, descrA, transA, m, n, nnz, csrSortedRowPtrA, csrSortedColIndA, &info, &analyse));
+
+    if(analyse)
+    {
+        rocsparse_status status
+            = rocsparse_ccsrmv_analysis((rocsparse_handle)handle,
+                                        hipOperationToHCCOperation(transA),
+                                        m,
+                                        n,
+                                        nnz,
+                                        (rocsparse_mat_descr)descrA,
+                                        (const rocsparse_float_complex*)csrSortedValA,
+                                        csrSortedRowPtrA,
+                                        csrSortedColIndA,
+                                        info);
+
+        if(status != rocsparse_status_success)
+        {
+            info = csrmv_analysis_failed(descrA);
+        }
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmv((rocsparse_handle)handle,
                          hipOperationToHCCOperation(transA),
@@ -1416,7 +3038,7 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                          (const rocsparse_float_complex*)csrSortedValA,
                          csrSortedRowPtrA,
                          csrSortedColIndA,
-                         nullptr,
+                         info,
                          (const rocsparse_float_complex*)x,
                          (const rocsparse_float_complex*)beta,
                          (rocsparse_float_complex*)y));
@@ -1436,6 +3058,66 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      x,
+                      beta,
+                      y);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmv",
+                  "-r",
+                  "z",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
+    rocsparse_mat_info info;
+    bool               analyse;
+    RETURN_IF_HIPSPARSE_ERROR(csrmv_cached_analysis(
+        handle, descrA, transA, m, n, nnz, csrSortedRowPtrA, csrSortedColIndA, &info, &analyse));
+
+    if(analyse)
+    {
+        rocsparse_status status
+            = rocsparse_zcsrmv_analysis((rocsparse_handle)handle,
+                                        hipOperationToHCCOperation(transA),
+                                        m,
+                                        n,
+                                        nnz,
+                                        (rocsparse_mat_descr)descrA,
+                                        (const rocsparse_double_complex*)csrSortedValA,
+                                        csrSortedRowPtrA,
+                                        csrSortedColIndA,
+                                        info);
+
+        if(status != rocsparse_status_success)
+        {
+            info = csrmv_analysis_failed(descrA);
+        }
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmv((rocsparse_handle)handle,
                          hipOperationToHCCOperation(transA),
@@ -1447,7 +3129,7 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                          (const rocsparse_double_complex*)csrSortedValA,
                          csrSortedRowPtrA,
                          csrSortedColIndA,
-                         nullptr,
+                         info,
                          (const rocsparse_double_complex*)x,
                          (const rocsparse_double_complex*)beta,
                          (rocsparse_double_complex*)y));
@@ -1456,6 +3138,10 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1465,7 +3151,7 @@ hipsparseStatus_t
         (rocsparse_handle)handle, nullptr, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1481,6 +3167,18 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1516,6 +3214,18 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1551,6 +3261,18 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1586,6 +3308,18 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1621,6 +3355,18 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -1645,6 +3391,18 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -1669,6 +3427,18 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -1693,6 +3463,18 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -1718,6 +3500,21 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1732,12 +3529,12 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                                         csrSortedRowPtrA,
                                                         csrSortedColIndA,
                                                         (rocsparse_mat_info)info,
-                                                        rocsparse_analysis_policy_force,
+                                                        analysis_policy(handle),
                                                         rocsparse_solve_policy_auto,
                                                         pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1754,6 +3551,21 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1768,12 +3580,12 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                                         csrSortedRowPtrA,
                                                         csrSortedColIndA,
                                                         (rocsparse_mat_info)info,
-                                                        rocsparse_analysis_policy_force,
+                                                        analysis_policy(handle),
                                                         rocsparse_solve_policy_auto,
                                                         pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1790,6 +3602,21 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1805,12 +3632,12 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                   csrSortedRowPtrA,
                                   csrSortedColIndA,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1827,6 +3654,21 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1842,12 +3684,12 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                   csrSortedRowPtrA,
                                   csrSortedColIndA,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1867,6 +3709,45 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrsv2",
+                  "-r",
+                  "s",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--uplo",
+                  bench_fill_mode(hipsparseGetMatFillMode(descrA)),
+                  "--diag",
+                  bench_diag_type(hipsparseGetMatDiagType(descrA)),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrsv_solve((rocsparse_handle)handle,
                                                              hipOperationToHCCOperation(transA),
                                                              m,
@@ -1898,6 +3779,45 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrsv2",
+                  "-r",
+                  "d",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--uplo",
+                  bench_fill_mode(hipsparseGetMatFillMode(descrA)),
+                  "--diag",
+                  bench_diag_type(hipsparseGetMatDiagType(descrA)),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrsv_solve((rocsparse_handle)handle,
                                                              hipOperationToHCCOperation(transA),
                                                              m,
@@ -1929,6 +3849,45 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrsv2",
+                  "-r",
+                  "c",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--uplo",
+                  bench_fill_mode(hipsparseGetMatFillMode(descrA)),
+                  "--diag",
+                  bench_diag_type(hipsparseGetMatDiagType(descrA)),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_solve((rocsparse_handle)handle,
                                hipOperationToHCCOperation(transA),
@@ -1961,6 +3920,45 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrsv2",
+                  "-r",
+                  "z",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  "--uplo",
+                  bench_fill_mode(hipsparseGetMatFillMode(descrA)),
+                  "--diag",
+                  bench_diag_type(hipsparseGetMatDiagType(descrA)),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_solve((rocsparse_handle)handle,
                                hipOperationToHCCOperation(transA),
@@ -1987,6 +3985,8 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    api_logger logger(handle, __func__, transA, alpha, descrA, hybA, x, beta, y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_shybmv((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        alpha,
@@ -2006,6 +4006,8 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    api_logger logger(handle, __func__, transA, alpha, descrA, hybA, x, beta, y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dhybmv((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        alpha,
@@ -2025,6 +4027,8 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    api_logger logger(handle, __func__, transA, alpha, descrA, hybA, x, beta, y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_chybmv((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        (const rocsparse_float_complex*)alpha,
@@ -2044,6 +4048,8 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    api_logger logger(handle, __func__, transA, alpha, descrA, hybA, x, beta, y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zhybmv((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        (const rocsparse_double_complex*)alpha,
@@ -2070,6 +4076,23 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrmv((rocsparse_handle)handle,
                                                        hipDirectionToHCCDirection(dirA),
                                                        hipOperationToHCCOperation(transA),
@@ -2103,6 +4126,23 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrmv((rocsparse_handle)handle,
                                                        hipDirectionToHCCDirection(dirA),
                                                        hipOperationToHCCOperation(transA),
@@ -2136,6 +4176,23 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmv((rocsparse_handle)handle,
                          hipDirectionToHCCDirection(dirA),
@@ -2170,6 +4227,23 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmv((rocsparse_handle)handle,
                          hipDirectionToHCCDirection(dirA),
@@ -2207,6 +4281,26 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                                    const float*              beta,
                                    float*                    y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      trans,
+                      sizeOfMask,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descr,
+                      bsrVal,
+                      bsrMaskPtr,
+                      bsrRowPtr,
+                      bsrEndPtr,
+                      bsrColInd,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrxmv((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dir),
                                                         hipOperationToHCCOperation(trans),
@@ -2246,6 +4340,26 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                                    const double*             beta,
                                    double*                   y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      trans,
+                      sizeOfMask,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descr,
+                      bsrVal,
+                      bsrMaskPtr,
+                      bsrRowPtr,
+                      bsrEndPtr,
+                      bsrColInd,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrxmv((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dir),
                                                         hipOperationToHCCOperation(trans),
@@ -2285,6 +4399,26 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                                    const hipComplex*         beta,
                                    hipComplex*               y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      trans,
+                      sizeOfMask,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descr,
+                      bsrVal,
+                      bsrMaskPtr,
+                      bsrRowPtr,
+                      bsrEndPtr,
+                      bsrColInd,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cbsrxmv((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dir),
                                                         hipOperationToHCCOperation(trans),
@@ -2324,6 +4458,26 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                                    const hipDoubleComplex*   beta,
                                    hipDoubleComplex*         y)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      trans,
+                      sizeOfMask,
+                      mb,
+                      nb,
+                      nnzb,
+                      alpha,
+                      descr,
+                      bsrVal,
+                      bsrMaskPtr,
+                      bsrRowPtr,
+                      bsrEndPtr,
+                      bsrColInd,
+                      blockDim,
+                      x,
+                      beta,
+                      y);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zbsrxmv((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dir),
                                                         hipOperationToHCCOperation(trans),
@@ -2347,6 +4501,10 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle, bsrsv2Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_bsrsv_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 }
@@ -2364,6 +4522,20 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2403,6 +4575,20 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2442,6 +4628,20 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2481,6 +4681,20 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2520,6 +4734,20 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipDirectionToHCCDirection(dir),
@@ -2548,6 +4776,20 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipDirectionToHCCDirection(dir),
@@ -2576,6 +4818,20 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipDirectionToHCCDirection(dir),
@@ -2604,6 +4860,20 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipDirectionToHCCDirection(dir),
@@ -2633,6 +4903,23 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrsv_analysis((rocsparse_handle)handle,
                                                                 hipDirectionToHCCDirection(dir),
                                                                 hipOperationToHCCOperation(transA),
@@ -2644,7 +4931,7 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                                                 bsrSortedColIndA,
                                                                 blockDim,
                                                                 (rocsparse_mat_info)info,
-                                                                rocsparse_analysis_policy_force,
+                                                                analysis_policy(handle),
                                                                 rocsparse_solve_policy_auto,
                                                                 pBuffer));
 }
@@ -2663,6 +4950,23 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrsv_analysis((rocsparse_handle)handle,
                                                                 hipDirectionToHCCDirection(dir),
                                                                 hipOperationToHCCOperation(transA),
@@ -2674,7 +4978,7 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                                                 bsrSortedColIndA,
                                                                 blockDim,
                                                                 (rocsparse_mat_info)info,
-                                                                rocsparse_analysis_policy_force,
+                                                                analysis_policy(handle),
                                                                 rocsparse_solve_policy_auto,
                                                                 pBuffer));
 }
@@ -2693,6 +4997,23 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_analysis((rocsparse_handle)handle,
                                   hipDirectionToHCCDirection(dir),
@@ -2705,7 +5026,7 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                   bsrSortedColIndA,
                                   blockDim,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 }
@@ -2724,6 +5045,23 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_analysis((rocsparse_handle)handle,
                                   hipDirectionToHCCDirection(dir),
@@ -2736,7 +5074,7 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                   bsrSortedColIndA,
                                   blockDim,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 }
@@ -2758,6 +5096,24 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrsv_solve((rocsparse_handle)handle,
                                                              hipDirectionToHCCDirection(dir),
                                                              hipOperationToHCCOperation(transA),
@@ -2793,6 +5149,24 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrsv_solve((rocsparse_handle)handle,
                                                              hipDirectionToHCCDirection(dir),
                                                              hipOperationToHCCOperation(transA),
@@ -2828,6 +5202,24 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_solve((rocsparse_handle)handle,
                                hipDirectionToHCCDirection(dir),
@@ -2864,6 +5256,24 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      transA,
+                      mb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      f,
+                      x,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_solve((rocsparse_handle)handle,
                                hipDirectionToHCCDirection(dir),
@@ -2886,6 +5296,8 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
 hipsparseStatus_t hipsparseSgemvi_bufferSize(
     hipsparseHandle_t handle, hipsparseOperation_t transA, int m, int n, int nnz, int* pBufferSize)
 {
+    api_logger logger(handle, __func__, transA, m, n, nnz, pBufferSize);
+
     if(pBufferSize == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2904,6 +5316,8 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(
 hipsparseStatus_t hipsparseDgemvi_bufferSize(
     hipsparseHandle_t handle, hipsparseOperation_t transA, int m, int n, int nnz, int* pBufferSize)
 {
+    api_logger logger(handle, __func__, transA, m, n, nnz, pBufferSize);
+
     if(pBufferSize == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2922,6 +5336,8 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(
 hipsparseStatus_t hipsparseCgemvi_bufferSize(
     hipsparseHandle_t handle, hipsparseOperation_t transA, int m, int n, int nnz, int* pBufferSize)
 {
+    api_logger logger(handle, __func__, transA, m, n, nnz, pBufferSize);
+
     if(pBufferSize == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2940,6 +5356,8 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(
 hipsparseStatus_t hipsparseZgemvi_bufferSize(
     hipsparseHandle_t handle, hipsparseOperation_t transA, int m, int n, int nnz, int* pBufferSize)
 {
+    api_logger logger(handle, __func__, transA, m, n, nnz, pBufferSize);
+
     if(pBufferSize == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2970,6 +5388,22 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      alpha,
+                      A,
+                      lda,
+                      nnz,
+                      x,
+                      xInd,
+                      beta,
+                      y,
+                      idxBase,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sgemvi((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        m,
@@ -3001,6 +5435,22 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      alpha,
+                      A,
+                      lda,
+                      nnz,
+                      x,
+                      xInd,
+                      beta,
+                      y,
+                      idxBase,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dgemvi((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        m,
@@ -3032,6 +5482,22 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      alpha,
+                      A,
+                      lda,
+                      nnz,
+                      x,
+                      xInd,
+                      beta,
+                      y,
+                      idxBase,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cgemvi((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        m,
@@ -3063,6 +5529,22 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                                   hipsparseIndexBase_t    idxBase,
                                   void*                   pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      alpha,
+                      A,
+                      lda,
+                      nnz,
+                      x,
+                      xInd,
+                      beta,
+                      y,
+                      idxBase,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zgemvi((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        m,
@@ -3099,6 +5581,27 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transB,
+                      mb,
+                      n,
+                      kb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrmm((rocsparse_handle)handle,
                                                        hipDirectionToHCCDirection(dirA),
                                                        hipOperationToHCCOperation(transA),
@@ -3140,6 +5643,27 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transB,
+                      mb,
+                      n,
+                      kb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrmm((rocsparse_handle)handle,
                                                        hipDirectionToHCCDirection(dirA),
                                                        hipOperationToHCCOperation(transA),
@@ -3181,6 +5705,27 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transB,
+                      mb,
+                      n,
+                      kb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cbsrmm((rocsparse_handle)handle,
                                                        hipDirectionToHCCDirection(dirA),
                                                        hipOperationToHCCOperation(transA),
@@ -3222,6 +5767,27 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transB,
+                      mb,
+                      n,
+                      kb,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zbsrmm((rocsparse_handle)handle,
                                                        hipDirectionToHCCDirection(dirA),
                                                        hipOperationToHCCOperation(transA),
@@ -3260,6 +5826,46 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmm",
+                  "-r",
+                  "s",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizek",
+                  k,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrmm((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        rocsparse_operation_none,
@@ -3296,6 +5902,46 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmm",
+                  "-r",
+                  "d",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizek",
+                  k,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrmm((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        rocsparse_operation_none,
@@ -3332,6 +5978,46 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmm",
+                  "-r",
+                  "c",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizek",
+                  k,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipOperationToHCCOperation(transA),
@@ -3369,6 +6055,46 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrmm",
+                  "-r",
+                  "z",
+                  "--transposeA",
+                  bench_operation(transA),
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizek",
+                  k,
+                  "--sizennz",
+                  nnz,
+                  bench_scalar(handle, "--alpha", alpha),
+                  bench_scalar(handle, "--beta", beta),
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipOperationToHCCOperation(transA),
@@ -3407,6 +6133,25 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                                    float*                    C,
                                    int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrmm((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        hipOperationToHCCOperation(transB),
@@ -3444,6 +6189,25 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                                    double*                   C,
                                    int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrmm((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(transA),
                                                        hipOperationToHCCOperation(transB),
@@ -3481,6 +6245,25 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                                    hipComplex*               C,
                                    int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipOperationToHCCOperation(transA),
@@ -3519,6 +6302,25 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                                    hipDoubleComplex*         C,
                                    int                       ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      beta,
+                      C,
+                      ldc);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipOperationToHCCOperation(transA),
@@ -3542,6 +6344,10 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle, bsrsm2Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -3551,7 +6357,7 @@ hipsparseStatus_t
         rocsparse_bsrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -3571,6 +6377,22 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3614,6 +6436,22 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3657,6 +6495,22 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3700,6 +6554,22 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3744,6 +6614,25 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrsm_analysis((rocsparse_handle)handle,
                                                                 hipDirectionToHCCDirection(dirA),
                                                                 hipOperationToHCCOperation(transA),
@@ -3757,7 +6646,7 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                                                 bsrSortedColIndA,
                                                                 blockDim,
                                                                 (rocsparse_mat_info)info,
-                                                                rocsparse_analysis_policy_force,
+                                                                analysis_policy(handle),
                                                                 rocsparse_solve_policy_auto,
                                                                 pBuffer));
 }
@@ -3778,6 +6667,25 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrsm_analysis((rocsparse_handle)handle,
                                                                 hipDirectionToHCCDirection(dirA),
                                                                 hipOperationToHCCOperation(transA),
@@ -3791,7 +6699,7 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                                                 bsrSortedColIndA,
                                                                 blockDim,
                                                                 (rocsparse_mat_info)info,
-                                                                rocsparse_analysis_policy_force,
+                                                                analysis_policy(handle),
                                                                 rocsparse_solve_policy_auto,
                                                                 pBuffer));
 }
@@ -3812,6 +6720,25 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_analysis((rocsparse_handle)handle,
                                   hipDirectionToHCCDirection(dirA),
@@ -3826,7 +6753,7 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                   bsrSortedColIndA,
                                   blockDim,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 }
@@ -3847,6 +6774,25 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_analysis((rocsparse_handle)handle,
                                   hipDirectionToHCCDirection(dirA),
@@ -3861,7 +6807,7 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                   bsrSortedColIndA,
                                   blockDim,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 }
@@ -3887,6 +6833,28 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      B,
+                      ldb,
+                      X,
+                      ldx,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrsm_solve((rocsparse_handle)handle,
                                                              hipDirectionToHCCDirection(dirA),
                                                              hipOperationToHCCOperation(transA),
@@ -3930,6 +6898,28 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      B,
+                      ldb,
+                      X,
+                      ldx,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrsm_solve((rocsparse_handle)handle,
                                                              hipDirectionToHCCDirection(dirA),
                                                              hipOperationToHCCOperation(transA),
@@ -3973,6 +6963,28 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      B,
+                      ldb,
+                      X,
+                      ldx,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_solve((rocsparse_handle)handle,
                                hipDirectionToHCCDirection(dirA),
@@ -4017,6 +7029,28 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      transA,
+                      transX,
+                      mb,
+                      nrhs,
+                      nnzb,
+                      alpha,
+                      descrA,
+                      bsrSortedValA,
+                      bsrSortedRowPtrA,
+                      bsrSortedColIndA,
+                      blockDim,
+                      info,
+                      B,
+                      ldb,
+                      X,
+                      ldx,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_solve((rocsparse_handle)handle,
                                hipDirectionToHCCDirection(dirA),
@@ -4043,6 +7077,10 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle, csrsm2Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -4052,7 +7090,7 @@ hipsparseStatus_t
         rocsparse_csrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -4075,6 +7113,25 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -4112,6 +7169,25 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -4149,6 +7225,25 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -4186,6 +7281,25 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipOperationToHCCOperation(transA),
@@ -4223,6 +7337,27 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrsm_analysis((rocsparse_handle)handle,
                                                                 hipOperationToHCCOperation(transA),
                                                                 hipOperationToHCCOperation(transB),
@@ -4237,7 +7372,7 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                                                 B,
                                                                 ldb,
                                                                 (rocsparse_mat_info)info,
-                                                                rocsparse_analysis_policy_force,
+                                                                analysis_policy(handle),
                                                                 rocsparse_solve_policy_auto,
                                                                 pBuffer));
 }
@@ -4260,6 +7395,27 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrsm_analysis((rocsparse_handle)handle,
                                                                 hipOperationToHCCOperation(transA),
                                                                 hipOperationToHCCOperation(transB),
@@ -4274,7 +7430,7 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                                                 B,
                                                                 ldb,
                                                                 (rocsparse_mat_info)info,
-                                                                rocsparse_analysis_policy_force,
+                                                                analysis_policy(handle),
                                                                 rocsparse_solve_policy_auto,
                                                                 pBuffer));
 }
@@ -4297,6 +7453,27 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_analysis((rocsparse_handle)handle,
                                   hipOperationToHCCOperation(transA),
@@ -4312,7 +7489,7 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                   (const rocsparse_float_complex*)B,
                                   ldb,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 }
@@ -4335,6 +7512,27 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_analysis((rocsparse_handle)handle,
                                   hipOperationToHCCOperation(transA),
@@ -4350,7 +7548,7 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                   (const rocsparse_double_complex*)B,
                                   ldb,
                                   (rocsparse_mat_info)info,
-                                  rocsparse_analysis_policy_force,
+                                  analysis_policy(handle),
                                   rocsparse_solve_policy_auto,
                                   pBuffer));
 }
@@ -4373,6 +7571,25 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrsm_solve((rocsparse_handle)handle,
                                                              hipOperationToHCCOperation(transA),
                                                              hipOperationToHCCOperation(transB),
@@ -4409,6 +7626,25 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrsm_solve((rocsparse_handle)handle,
                                                              hipOperationToHCCOperation(transA),
                                                              hipOperationToHCCOperation(transB),
@@ -4445,6 +7681,25 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_solve((rocsparse_handle)handle,
                                hipOperationToHCCOperation(transA),
@@ -4482,6 +7737,25 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      transA,
+                      transB,
+                      m,
+                      nrhs,
+                      nnz,
+                      alpha,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      B,
+                      ldb,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_solve((rocsparse_handle)handle,
                                hipOperationToHCCOperation(transA),
@@ -4516,6 +7790,22 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
                                   float*            C,
                                   int               ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      A,
+                      lda,
+                      cscValB,
+                      cscColPtrB,
+                      cscRowIndB,
+                      beta,
+                      C,
+                      ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4564,6 +7854,22 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
                                   double*           C,
                                   int               ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      A,
+                      lda,
+                      cscValB,
+                      cscColPtrB,
+                      cscRowIndB,
+                      beta,
+                      C,
+                      ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4612,6 +7918,22 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
                                   hipComplex*       C,
                                   int               ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      A,
+                      lda,
+                      cscValB,
+                      cscColPtrB,
+                      cscRowIndB,
+                      beta,
+                      C,
+                      ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4660,6 +7982,22 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       C,
                                   int                     ldc)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      nnz,
+                      alpha,
+                      A,
+                      lda,
+                      cscValB,
+                      cscColPtrB,
+                      cscRowIndB,
+                      beta,
+                      C,
+                      ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4708,6 +8046,22 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                                                             m,
                                                             n,
@@ -4744,6 +8098,27 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrgeam((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -4785,6 +8160,27 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrgeam((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -4826,6 +8222,27 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_ccsrgeam((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -4867,6 +8284,27 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zcsrgeam((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -4909,6 +8347,28 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -4935,6 +8395,28 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -4961,6 +8443,28 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -4987,6 +8491,28 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5008,6 +8534,23 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      nnzA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      descrB,
+                      nnzB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedRowPtrC,
+                      nnzTotalDevHostPtr,
+                      workspace);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                                                             m,
                                                             n,
@@ -5045,6 +8588,28 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrgeam((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -5087,6 +8652,28 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrgeam((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -5129,6 +8716,28 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -5172,6 +8781,28 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      beta,
+                      descrB,
+                      nnzB,
+                      csrSortedValB,
+                      csrSortedRowPtrB,
+                      csrSortedColIndB,
+                      descrC,
+                      csrSortedValC,
+                      csrSortedRowPtrC,
+                      csrSortedColIndC,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5212,43 +8843,40 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr);
+
+    // Constant alpha = 1.0, in host or device memory depending on the pointer mode
+    const scalar_constants* constants;
+    RETURN_IF_HIPSPARSE_ERROR(get_scalar_constants(handle, &constants));
+
+    const hipDoubleComplex* alpha = &constants->z[1];
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
 
-    // Buffer
-    size_t buffer_size;
-    void*  temp_buffer;
-
-    // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
-
-    hipsparseStatus_t status;
-
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
-    }
+    // Buffer
+    size_t buffer_size;
+    void*  temp_buffer;
+
+    hipsparseStatus_t status;
 
     // Obtain temporary buffer size
     status = rocSPARSEStatusToHIPStatus(
@@ -5277,21 +8905,12 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &temp_buffer));
 
     // Determine nnz
     status = rocSPARSEStatusToHIPStatus(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
@@ -5318,16 +8937,7 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                                               info,
                                                               temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, temp_buffer));
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
@@ -5362,6 +8972,34 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
+    // Constant alpha = 1.0, in host or device memory depending on the pointer mode
+    const scalar_constants* constants;
+    RETURN_IF_HIPSPARSE_ERROR(get_scalar_constants(handle, &constants));
+
+    const float* alpha = &constants->s[1];
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5370,35 +9008,8 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    float  one = 1.0f;
-    float* alpha;
-
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (float*)malloc(sizeof(float));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(float)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(float), hipMemcpyHostToDevice));
-    }
-
     // Obtain temporary buffer size
     status = rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
@@ -5426,21 +9037,12 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm((rocsparse_handle)handle,
@@ -5473,16 +9075,7 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                                            info,
                                                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, temp_buffer));
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
@@ -5517,6 +9110,34 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
+    // Constant alpha = 1.0, in host or device memory depending on the pointer mode
+    const scalar_constants* constants;
+    RETURN_IF_HIPSPARSE_ERROR(get_scalar_constants(handle, &constants));
+
+    const double* alpha = &constants->d[1];
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5525,35 +9146,8 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    double  one = 1.0;
-    double* alpha;
-
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (double*)malloc(sizeof(double));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(double)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(double), hipMemcpyHostToDevice));
-    }
-
     // Obtain temporary buffer size
     status = rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
@@ -5581,21 +9175,12 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm((rocsparse_handle)handle,
@@ -5628,16 +9213,7 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                                            info,
                                                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, temp_buffer));
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
@@ -5672,6 +9248,34 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
+    // Constant alpha = 1.0, in host or device memory depending on the pointer mode
+    const scalar_constants* constants;
+    RETURN_IF_HIPSPARSE_ERROR(get_scalar_constants(handle, &constants));
+
+    const hipComplex* alpha = &constants->c[1];
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5680,35 +9284,8 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    hipComplex  one = make_hipComplex(1.0f, 0.0f);
-    hipComplex* alpha;
-
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipComplex*)malloc(sizeof(hipComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipComplex)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(hipComplex), hipMemcpyHostToDevice));
-    }
-
     // Obtain temporary buffer size
     status = rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
@@ -5736,21 +9313,12 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = rocSPARSEStatusToHIPStatus(rocsparse_ccsrgemm((rocsparse_handle)handle,
@@ -5783,16 +9351,7 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                                            info,
                                                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, temp_buffer));
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
@@ -5827,6 +9386,34 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
+    // Constant alpha = 1.0, in host or device memory depending on the pointer mode
+    const scalar_constants* constants;
+    RETURN_IF_HIPSPARSE_ERROR(get_scalar_constants(handle, &constants));
+
+    const hipDoubleComplex* alpha = &constants->z[1];
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5835,36 +9422,8 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
-
     hipsparseStatus_t status;
 
-    // Get pointer mode
-    rocsparse_pointer_mode pointer_mode;
-    status = rocSPARSEStatusToHIPStatus(
-        rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
-
-    if(status != HIPSPARSE_STATUS_SUCCESS)
-    {
-        rocsparse_destroy_mat_info(info);
-
-        return status;
-    }
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
-    }
-
     // Obtain temporary buffer size
     status = rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
@@ -5892,21 +9451,12 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = rocSPARSEStatusToHIPStatus(rocsparse_zcsrgemm((rocsparse_handle)handle,
@@ -5939,16 +9489,7 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                                            info,
                                                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, temp_buffer));
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
@@ -5983,6 +9524,28 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      info,
+                      pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
                                                                      rocsparse_operation_none,
                                                                      rocsparse_operation_none,
@@ -6028,6 +9591,28 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      info,
+                      pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
                                                                      rocsparse_operation_none,
                                                                      rocsparse_operation_none,
@@ -6073,6 +9658,28 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      info,
+                      pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6119,6 +9726,28 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      info,
+                      pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6166,6 +9795,29 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                                         const csrgemm2Info_t      info,
                                         void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      descrA,
+                      nnzA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      descrD,
+                      nnzD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr,
+                      info,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
                                                             rocsparse_operation_none,
                                                             rocsparse_operation_none,
@@ -6219,6 +9871,35 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrValD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm((rocsparse_handle)handle,
                                                          rocsparse_operation_none,
                                                          rocsparse_operation_none,
@@ -6278,6 +9959,35 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrValD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm((rocsparse_handle)handle,
                                                          rocsparse_operation_none,
                                                          rocsparse_operation_none,
@@ -6337,6 +10047,35 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrValD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_ccsrgemm((rocsparse_handle)handle,
                                                          rocsparse_operation_none,
                                                          rocsparse_operation_none,
@@ -6396,6 +10135,35 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      descrA,
+                      nnzA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      descrB,
+                      nnzB,
+                      csrValB,
+                      csrRowPtrB,
+                      csrColIndB,
+                      beta,
+                      descrD,
+                      nnzD,
+                      csrValD,
+                      csrRowPtrD,
+                      csrColIndD,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zcsrgemm((rocsparse_handle)handle,
                                                          rocsparse_operation_none,
                                                          rocsparse_operation_none,
@@ -6430,6 +10198,10 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6439,7 +10211,7 @@ hipsparseStatus_t
         rocsparse_bsrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6447,6 +10219,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dsbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6454,6 +10228,8 @@ hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6464,6 +10240,8 @@ hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dcbsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -6478,6 +10256,8 @@ hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -6498,6 +10278,19 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6535,6 +10328,19 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6572,6 +10378,19 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6609,6 +10428,19 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6647,6 +10479,22 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6662,12 +10510,12 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                                           bsrColIndA,
                                                           blockDim,
                                                           (rocsparse_mat_info)info,
-                                                          rocsparse_analysis_policy_force,
+                                                          analysis_policy(handle),
                                                           rocsparse_solve_policy_auto,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6685,6 +10533,22 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6700,12 +10564,12 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                                           bsrColIndA,
                                                           blockDim,
                                                           (rocsparse_mat_info)info,
-                                                          rocsparse_analysis_policy_force,
+                                                          analysis_policy(handle),
                                                           rocsparse_solve_policy_auto,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6723,6 +10587,22 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6738,12 +10618,12 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                                           bsrColIndA,
                                                           blockDim,
                                                           (rocsparse_mat_info)info,
-                                                          rocsparse_analysis_policy_force,
+                                                          analysis_policy(handle),
                                                           rocsparse_solve_policy_auto,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6761,6 +10641,22 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6776,12 +10672,12 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                                           bsrColIndA,
                                                           blockDim,
                                                           (rocsparse_mat_info)info,
-                                                          rocsparse_analysis_policy_force,
+                                                          analysis_policy(handle),
                                                           rocsparse_solve_policy_auto,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6799,6 +10695,20 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsrilu0((rocsparse_handle)handle,
                                                          hipDirectionToHCCDirection(dirA),
                                                          mb,
@@ -6826,6 +10736,20 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0((rocsparse_handle)handle,
                                                          hipDirectionToHCCDirection(dirA),
                                                          mb,
@@ -6853,6 +10777,20 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cbsrilu0((rocsparse_handle)handle,
                                                          hipDirectionToHCCDirection(dirA),
                                                          mb,
@@ -6880,6 +10818,20 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zbsrilu0((rocsparse_handle)handle,
                                                          hipDirectionToHCCDirection(dirA),
                                                          mb,
@@ -6897,6 +10849,10 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle, csrilu02Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6906,7 +10862,7 @@ hipsparseStatus_t
         rocsparse_csrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6914,6 +10870,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseScsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dscsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6921,6 +10879,8 @@ hipsparseStatus_t hipsparseScsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDcsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6931,6 +10891,8 @@ hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dccsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -6945,6 +10907,8 @@ hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    api_logger logger(handle, __func__, info, enable_boost, tol, boost_val);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -6963,6 +10927,17 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6996,6 +10971,17 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7029,6 +11015,17 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7062,6 +11059,17 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7095,6 +11103,17 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrilu0_buffer_size((rocsparse_handle)handle,
                                                                      m,
                                                                      nnz,
@@ -7116,6 +11135,17 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0_buffer_size((rocsparse_handle)handle,
                                                                      m,
                                                                      nnz,
@@ -7137,6 +11167,17 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7159,6 +11200,17 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7182,6 +11234,20 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7195,12 +11261,12 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                                           csrSortedRowPtrA,
                                                           csrSortedColIndA,
                                                           (rocsparse_mat_info)info,
-                                                          rocsparse_analysis_policy_force,
+                                                          analysis_policy(handle),
                                                           rocsparse_solve_policy_auto,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7216,6 +11282,20 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7229,12 +11309,12 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                                           csrSortedRowPtrA,
                                                           csrSortedColIndA,
                                                           (rocsparse_mat_info)info,
-                                                          rocsparse_analysis_policy_force,
+                                                          analysis_policy(handle),
                                                           rocsparse_solve_policy_auto,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7250,6 +11330,20 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7264,12 +11358,12 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                     csrSortedRowPtrA,
                                     csrSortedColIndA,
                                     (rocsparse_mat_info)info,
-                                    rocsparse_analysis_policy_force,
+                                    analysis_policy(handle),
                                     rocsparse_solve_policy_auto,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7285,6 +11379,20 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7299,12 +11407,12 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                     csrSortedRowPtrA,
                                     csrSortedColIndA,
                                     (rocsparse_mat_info)info,
-                                    rocsparse_analysis_policy_force,
+                                    analysis_policy(handle),
                                     rocsparse_solve_policy_auto,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7322,6 +11430,34 @@ hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrilu02",
+                  "-r",
+                  "s",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrilu0((rocsparse_handle)handle,
                                                          m,
                                                          nnz,
@@ -7347,6 +11483,34 @@ hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrilu02",
+                  "-r",
+                  "d",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0((rocsparse_handle)handle,
                                                          m,
                                                          nnz,
@@ -7372,6 +11536,34 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrilu02",
+                  "-r",
+                  "c",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0((rocsparse_handle)handle,
                            m,
@@ -7398,6 +11590,34 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csrilu02",
+                  "-r",
+                  "z",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  m,
+                  "--sizennz",
+                  nnz,
+                  "--indexbaseA",
+                  hipsparseGetMatIndexBase(descrA));
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0((rocsparse_handle)handle,
                            m,
@@ -7414,6 +11634,10 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7423,7 +11647,7 @@ hipsparseStatus_t
         rocsparse_bsric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7440,6 +11664,19 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7477,6 +11714,19 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7514,6 +11764,19 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7551,6 +11814,19 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7589,6 +11865,22 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7604,12 +11896,12 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                                          bsrColIndA,
                                                          blockDim,
                                                          (rocsparse_mat_info)info,
-                                                         rocsparse_analysis_policy_force,
+                                                         analysis_policy(handle),
                                                          rocsparse_solve_policy_auto,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7627,6 +11919,22 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7642,12 +11950,12 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                                          bsrColIndA,
                                                          blockDim,
                                                          (rocsparse_mat_info)info,
-                                                         rocsparse_analysis_policy_force,
+                                                         analysis_policy(handle),
                                                          rocsparse_solve_policy_auto,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7665,6 +11973,22 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7680,12 +12004,12 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                                          bsrColIndA,
                                                          blockDim,
                                                          (rocsparse_mat_info)info,
-                                                         rocsparse_analysis_policy_force,
+                                                         analysis_policy(handle),
                                                          rocsparse_solve_policy_auto,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7703,6 +12027,22 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7718,12 +12058,12 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                                          bsrColIndA,
                                                          blockDim,
                                                          (rocsparse_mat_info)info,
-                                                         rocsparse_analysis_policy_force,
+                                                         analysis_policy(handle),
                                                          rocsparse_solve_policy_auto,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7741,6 +12081,20 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sbsric0((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -7768,6 +12122,20 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dbsric0((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -7795,6 +12163,20 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cbsric0((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -7822,6 +12204,20 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zbsric0((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -7839,6 +12235,10 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle, csric02Info_t info, int* position)
 {
+    api_logger logger(handle, __func__, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(zero_pivot_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7848,7 +12248,7 @@ hipsparseStatus_t
         rocsparse_csric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7863,6 +12263,17 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7896,6 +12307,17 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7929,6 +12351,17 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7962,6 +12395,17 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7995,6 +12439,17 @@ hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsric0_buffer_size((rocsparse_handle)handle,
                                                                     m,
                                                                     nnz,
@@ -8016,6 +12471,17 @@ hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsric0_buffer_size((rocsparse_handle)handle,
                                                                     m,
                                                                     nnz,
@@ -8037,6 +12503,17 @@ hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8059,6 +12536,17 @@ hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      pBufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8082,6 +12570,20 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8095,12 +12597,12 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                                          csrSortedRowPtrA,
                                                          csrSortedColIndA,
                                                          (rocsparse_mat_info)info,
-                                                         rocsparse_analysis_policy_force,
+                                                         analysis_policy(handle),
                                                          rocsparse_solve_policy_auto,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8116,6 +12618,20 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8129,12 +12645,12 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                                          csrSortedRowPtrA,
                                                          csrSortedColIndA,
                                                          (rocsparse_mat_info)info,
-                                                         rocsparse_analysis_policy_force,
+                                                         analysis_policy(handle),
                                                          rocsparse_solve_policy_auto,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8150,6 +12666,20 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8164,12 +12694,12 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                    csrSortedRowPtrA,
                                    csrSortedColIndA,
                                    (rocsparse_mat_info)info,
-                                   rocsparse_analysis_policy_force,
+                                   analysis_policy(handle),
                                    rocsparse_solve_policy_auto,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8185,6 +12715,20 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8199,12 +12743,12 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                    csrSortedRowPtrA,
                                    csrSortedColIndA,
                                    (rocsparse_mat_info)info,
-                                   rocsparse_analysis_policy_force,
+                                   analysis_policy(handle),
                                    rocsparse_solve_policy_auto,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8222,6 +12766,18 @@ hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsric0((rocsparse_handle)handle,
                                                         m,
                                                         nnz,
@@ -8247,6 +12803,18 @@ hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsric0((rocsparse_handle)handle,
                                                         m,
                                                         nnz,
@@ -8272,6 +12840,18 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0((rocsparse_handle)handle,
                           m,
@@ -8298,6 +12878,18 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrSortedValA_valM,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      info,
+                      policy,
+                      pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0((rocsparse_handle)handle,
                           m,
@@ -8318,6 +12910,8 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, csrRowPtr, nnz, m, cooRowInd, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csr2coo(
         (rocsparse_handle)handle, csrRowPtr, nnz, m, cooRowInd, hipBaseToHCCBase(idxBase)));
 }
@@ -8335,6 +12929,38 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrSortedVal,
+                      csrSortedRowPtr,
+                      csrSortedColInd,
+                      cscSortedVal,
+                      cscSortedRowInd,
+                      cscSortedColPtr,
+                      copyValues,
+                      idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csr2csc",
+                  "-r",
+                  "s",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  "--action",
+                  copyValues,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
@@ -8348,7 +12974,7 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8356,7 +12982,7 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
         return status;
     }
@@ -8377,10 +13003,10 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                                            buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return status;
 }
@@ -8398,6 +13024,38 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrSortedVal,
+                      csrSortedRowPtr,
+                      csrSortedColInd,
+                      cscSortedVal,
+                      cscSortedRowInd,
+                      cscSortedColPtr,
+                      copyValues,
+                      idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csr2csc",
+                  "-r",
+                  "d",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  "--action",
+                  copyValues,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
@@ -8411,7 +13069,7 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8419,7 +13077,7 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
         return status;
     }
@@ -8440,10 +13098,10 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                                            buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return status;
 }
@@ -8461,6 +13119,38 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrSortedVal,
+                      csrSortedRowPtr,
+                      csrSortedColInd,
+                      cscSortedVal,
+                      cscSortedRowInd,
+                      cscSortedColPtr,
+                      copyValues,
+                      idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csr2csc",
+                  "-r",
+                  "c",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  "--action",
+                  copyValues,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
@@ -8474,7 +13164,7 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8482,7 +13172,7 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
         return status;
     }
@@ -8504,10 +13194,10 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                            buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return status;
 }
@@ -8525,6 +13215,38 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                     hipsparseAction_t       copyValues,
                                     hipsparseIndexBase_t    idxBase)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrSortedVal,
+                      csrSortedRowPtr,
+                      csrSortedColInd,
+                      cscSortedVal,
+                      cscSortedRowInd,
+                      cscSortedColPtr,
+                      copyValues,
+                      idxBase);
+
+    if(logger.bench())
+    {
+        log_bench("-f",
+                  "csr2csc",
+                  "-r",
+                  "z",
+                  "--sizem",
+                  m,
+                  "--sizen",
+                  n,
+                  "--sizennz",
+                  nnz,
+                  "--action",
+                  copyValues,
+                  "--indexbaseA",
+                  idxBase);
+    }
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
@@ -8538,7 +13260,7 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8546,7 +13268,7 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
         return status;
     }
@@ -8568,10 +13290,10 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                            buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(blocking_sync(handle, stream));
 
     return status;
 }
@@ -8587,6 +13309,18 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      hybA,
+                      userEllWidth,
+                      partitionType);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsr2hyb((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -8610,6 +13344,18 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      hybA,
+                      userEllWidth,
+                      partitionType);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsr2hyb((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -8633,6 +13379,18 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      hybA,
+                      userEllWidth,
+                      partitionType);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2hyb((rocsparse_handle)handle,
                            m,
@@ -8657,6 +13415,18 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA,
+                      hybA,
+                      userEllWidth,
+                      partitionType);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -8681,6 +13451,18 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               col_block_dim,
                                                    size_t*           p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -8705,6 +13487,18 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               col_block_dim,
                                                    size_t*           p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -8729,6 +13523,18 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               col_block_dim,
                                                    size_t*           p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -8755,6 +13561,18 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                                    int                     col_block_dim,
                                                    size_t*                 p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -8786,6 +13604,23 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      bsc_val,
+                      bsc_row_ind,
+                      bsc_col_ptr,
+                      copy_values,
+                      idx_base,
+                      temp_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
                                                      nb,
@@ -8820,6 +13655,23 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      bsc_val,
+                      bsc_row_ind,
+                      bsc_col_ptr,
+                      copy_values,
+                      idx_base,
+                      temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -8855,6 +13707,23 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      bsc_val,
+                      bsc_row_ind,
+                      bsc_col_ptr,
+                      copy_values,
+                      idx_base,
+                      temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -8890,6 +13759,23 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                         hipsparseIndexBase_t    idx_base,
                                         void*                   temp_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      bsc_val,
+                      bsc_row_ind,
+                      bsc_col_ptr,
+                      copy_values,
+                      idx_base,
+                      temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -8921,6 +13807,19 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2gebsr_buffer_size((rocsparse_handle)handle,
                                                                hipDirectionToHCCDirection(dir),
                                                                m,
@@ -8947,6 +13846,19 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                                                hipDirectionToHCCDirection(dir),
                                                                m,
@@ -8973,6 +13885,19 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_ccsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipDirectionToHCCDirection(dir),
@@ -9000,6 +13925,19 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipDirectionToHCCDirection(dir),
@@ -9029,6 +13967,21 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                          int*                      bsr_nnz_devhost,
                                          void*                     p_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      bsr_descr,
+                      bsr_row_ptr,
+                      row_block_dim,
+                      col_block_dim,
+                      bsr_nnz_devhost,
+                      p_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz((rocsparse_handle)handle,
                                                       hipDirectionToHCCDirection(dir),
@@ -9062,6 +14015,23 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      bsr_descr,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2gebsr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9096,6 +14066,23 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      bsr_descr,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2gebsr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9130,6 +14117,23 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      bsr_descr,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2gebsr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9164,6 +14168,23 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dir,
+                      m,
+                      n,
+                      csr_descr,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      bsr_descr,
+                      bsr_val,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      row_block_dim,
+                      col_block_dim,
+                      p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2gebsr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9196,6 +14217,21 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      blockDim,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2bsr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9226,6 +14262,21 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      blockDim,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2bsr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9256,6 +14307,21 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      blockDim,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2bsr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9286,6 +14352,21 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      blockDim,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2bsr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9316,6 +14397,21 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sbsr2csr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9346,6 +14442,21 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dbsr2csr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9376,6 +14487,21 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cbsr2csr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9406,6 +14532,21 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      blockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zbsr2csr((rocsparse_handle)handle,
                                                  hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9437,6 +14578,22 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDim,
+                      colBlockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2csr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9469,6 +14626,22 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDim,
+                      colBlockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2csr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9501,6 +14674,22 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDim,
+                      colBlockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2csr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9533,6 +14722,22 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDim,
+                      colBlockDim,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2csr((rocsparse_handle)handle,
                                                    hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9564,6 +14769,21 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              float                     tol)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrColIndA,
+                      csrRowPtrA,
+                      nnzA,
+                      nnzPerRow,
+                      csrValC,
+                      csrColIndC,
+                      csrRowPtrC,
+                      tol);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsr2csr_compress((rocsparse_handle)handle,
                                                                   m,
                                                                   n,
@@ -9593,6 +14813,21 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              double                    tol)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrColIndA,
+                      csrRowPtrA,
+                      nnzA,
+                      nnzPerRow,
+                      csrValC,
+                      csrColIndC,
+                      csrRowPtrC,
+                      tol);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsr2csr_compress((rocsparse_handle)handle,
                                                                   m,
                                                                   n,
@@ -9622,6 +14857,21 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipComplex                tol)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrColIndA,
+                      csrRowPtrA,
+                      nnzA,
+                      nnzPerRow,
+                      csrValC,
+                      csrColIndC,
+                      csrRowPtrC,
+                      tol);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -9652,6 +14902,21 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipDoubleComplex          tol)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descrA,
+                      csrValA,
+                      csrColIndA,
+                      csrRowPtrA,
+                      nnzA,
+                      nnzPerRow,
+                      csrValC,
+                      csrColIndC,
+                      csrRowPtrC,
+                      tol);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -9683,6 +14948,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -9715,6 +14996,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -9747,6 +15044,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -9779,6 +15092,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -9810,6 +15139,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -9840,6 +15184,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -9871,6 +15230,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sprune_csr2csr((rocsparse_handle)handle,
                                                                m,
                                                                n,
@@ -9902,6 +15277,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      threshold,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dprune_csr2csr((rocsparse_handle)handle,
                                                                m,
                                                                n,
@@ -9934,6 +15325,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -9968,6 +15376,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10002,6 +15427,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t  info,
                                                                    size_t*      bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10036,6 +15478,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t   info,
                                                                    size_t*       bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10069,6 +15528,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr,
+                      info,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -10101,6 +15576,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrRowPtrC,
+                      nnzTotalDevHostPtr,
+                      info,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -10134,6 +15625,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -10168,6 +15676,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnzA,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      percentage,
+                      descrC,
+                      csrValC,
+                      csrRowPtrC,
+                      csrColIndC,
+                      info,
+                      buffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -10193,6 +15718,14 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    api_logger logger(handle,
+                      __func__,
+                      descrA,
+                      hybA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10203,7 +15736,7 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status
@@ -10216,7 +15749,7 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                                         buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     return status;
 }
@@ -10228,6 +15761,14 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    api_logger logger(handle,
+                      __func__,
+                      descrA,
+                      hybA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10238,7 +15779,7 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status
@@ -10251,7 +15792,7 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                                         buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     return status;
 }
@@ -10263,6 +15804,14 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    api_logger logger(handle,
+                      __func__,
+                      descrA,
+                      hybA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10273,7 +15822,7 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status
@@ -10286,7 +15835,7 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                                         buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     return status;
 }
@@ -10298,6 +15847,14 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    api_logger logger(handle,
+                      __func__,
+                      descrA,
+                      hybA,
+                      csrSortedValA,
+                      csrSortedRowPtrA,
+                      csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10308,7 +15865,7 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status
@@ -10321,7 +15878,7 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                                         buffer));
 
     // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     return status;
 }
@@ -10336,6 +15893,17 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      A,
+                      lda,
+                      nnzPerRowColumn,
+                      nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz((rocsparse_handle)handle,
                                              hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10358,6 +15926,17 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      A,
+                      lda,
+                      nnzPerRowColumn,
+                      nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz((rocsparse_handle)handle,
                                              hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10380,6 +15959,17 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      A,
+                      lda,
+                      nnzPerRowColumn,
+                      nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz((rocsparse_handle)handle,
                                              hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10402,6 +15992,17 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      A,
+                      lda,
+                      nnzPerRowColumn,
+                      nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz((rocsparse_handle)handle,
                                              hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10425,6 +16026,18 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnzPerRow,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10449,6 +16062,18 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnzPerRow,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10473,6 +16098,18 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnzPerRow,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10497,6 +16134,18 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnzPerRow,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10522,6 +16171,19 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10550,6 +16212,19 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10578,6 +16253,19 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10606,6 +16294,19 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10633,6 +16334,18 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrRowPtr,
+                      nnzTotalDevHostPtr,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -10658,6 +16371,18 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrRowPtr,
+                      nnzTotalDevHostPtr,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -10684,6 +16409,19 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -10711,6 +16449,19 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      threshold,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -10739,6 +16490,20 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -10769,6 +16534,20 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -10800,6 +16579,20 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -10831,6 +16624,20 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -10860,6 +16667,19 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrRowPtr,
+                      nnzTotalDevHostPtr,
+                      info,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -10888,6 +16708,19 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrRowPtr,
+                      nnzTotalDevHostPtr,
+                      info,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -10917,6 +16750,20 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -10947,6 +16794,20 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      A,
+                      lda,
+                      percentage,
+                      descr,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -10975,6 +16836,18 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnz_per_columns,
+                      cscVal,
+                      cscRowInd,
+                      cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10999,6 +16872,18 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnz_per_columns,
+                      cscVal,
+                      cscRowInd,
+                      cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11023,6 +16908,18 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnz_per_columns,
+                      cscVal,
+                      cscRowInd,
+                      cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11047,6 +16944,18 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      descr,
+                      A,
+                      ld,
+                      nnz_per_columns,
+                      cscVal,
+                      cscRowInd,
+                      cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11070,6 +16979,8 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11092,6 +17003,8 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11114,6 +17027,8 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11136,6 +17051,8 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11158,6 +17075,8 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11180,6 +17099,8 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11202,6 +17123,8 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11224,6 +17147,8 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    api_logger logger(handle, __func__, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11248,6 +17173,19 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                        int*                      bsrRowPtrC,
                                        int*                      bsrNnzb)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      m,
+                      n,
+                      descrA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      blockDim,
+                      descrC,
+                      bsrRowPtrC,
+                      bsrNnzb);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz((rocsparse_handle)handle,
                                                     hipDirectionToHCCDirection(dirA),
                                                     m,
@@ -11272,6 +17210,8 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          float                     tol)
 {
+    api_logger logger(handle, __func__, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11292,6 +17232,8 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          double                    tol)
 {
+    api_logger logger(handle, __func__, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11312,6 +17254,8 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipComplex                tol)
 {
+    api_logger logger(handle, __func__, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11332,6 +17276,8 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipDoubleComplex          tol)
 {
+    api_logger logger(handle, __func__, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11350,12 +17296,16 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
                                     int*                 csrRowPtr,
                                     hipsparseIndexBase_t idxBase)
 {
+    api_logger logger(handle, __func__, cooRowInd, nnz, m, csrRowPtr, idxBase);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_coo2csr(
         (rocsparse_handle)handle, cooRowInd, nnz, m, csrRowPtr, hipBaseToHCCBase(idxBase)));
 }
 
 hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
+    api_logger logger(handle, __func__, n, p);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_create_identity_permutation((rocsparse_handle)handle, n, p));
 }
@@ -11368,6 +17318,8 @@ hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        csrColInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csrsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
 }
@@ -11382,6 +17334,8 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    api_logger logger(handle, __func__, m, n, nnz, descrA, csrRowPtr, csrColInd, P, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_csrsort((rocsparse_handle)handle,
                                                         m,
                                                         n,
@@ -11401,6 +17355,8 @@ hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cscRowInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cscsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
 }
@@ -11415,6 +17371,8 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    api_logger logger(handle, __func__, m, n, nnz, descrA, cscColPtr, cscRowInd, P, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cscsort((rocsparse_handle)handle,
                                                         m,
                                                         n,
@@ -11434,6 +17392,8 @@ hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cooCols,
                                                   size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_coosort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
 }
@@ -11447,6 +17407,8 @@ hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
                                          int*              P,
                                          void*             pBuffer)
 {
+    api_logger logger(handle, __func__, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_row(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
@@ -11460,6 +17422,8 @@ hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
                                             int*              P,
                                             void*             pBuffer)
 {
+    api_logger logger(handle, __func__, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_column(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
@@ -11479,6 +17443,22 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11518,6 +17498,22 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11556,6 +17552,22 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11594,6 +17606,22 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11634,6 +17662,24 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                            int*                      nnzTotalDevHostPtr,
                                            void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      descrC,
+                      bsrRowPtrC,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      nnzTotalDevHostPtr,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr_nnz((rocsparse_handle)handle,
                                                         hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -11672,6 +17718,26 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsr((rocsparse_handle)handle,
                                                      hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -11712,6 +17778,26 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsr((rocsparse_handle)handle,
                                                      hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -11752,6 +17838,26 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsr((rocsparse_handle)handle,
                                                      hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -11792,6 +17898,26 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      dirA,
+                      mb,
+                      nb,
+                      nnzb,
+                      descrA,
+                      bsrValA,
+                      bsrRowPtrA,
+                      bsrColIndA,
+                      rowBlockDimA,
+                      colBlockDimA,
+                      descrC,
+                      bsrValC,
+                      bsrRowPtrC,
+                      bsrColIndC,
+                      rowBlockDimC,
+                      colBlockDimC,
+                      buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsr((rocsparse_handle)handle,
                                                      hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -11823,6 +17949,17 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -11877,6 +18014,17 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -11931,6 +18079,17 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -11985,6 +18144,17 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12029,6 +18199,84 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+// Sorts the column indices of each row and returns the permutation in P. The
+// permutation is kept in the info structure, growing it only if nnz exceeds its
+// capacity, or taken from the handle workspace if it is discarded afterwards. In the
+// latter case, it is handed back by csru2csr_permutation.
+static hipsparseStatus_t csru2csr_sort(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       n,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const int*                csrRowPtr,
+                                       int*                      csrColInd,
+                                       csru2csrInfo_t            info,
+                                       void*                     pBuffer,
+                                       int**                     P)
+{
+    if(info->permutation == HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, sizeof(int) * nnz, (void**)P));
+    }
+    else
+    {
+        if(info->capacity < nnz && capture_safe(handle))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        // Re-allocate permutation array only if it is too small
+        if(info->P != nullptr && info->capacity < nnz)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->P));
+            info->P        = nullptr;
+            info->size     = 0;
+            info->capacity = 0;
+        }
+
+        if(info->P == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+            info->capacity = nnz;
+        }
+
+        info->size = nnz;
+        *P         = info->P;
+    }
+
+    // Initialize permutation with identity
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, *P));
+
+    // Sort CSR columns
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseXcsrsort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, *P, pBuffer));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Permutation of csru2csr, that is handed back to the handle workspace on every return
+// path if it has been taken from there
+struct csru2csr_permutation
+{
+    csru2csr_permutation(hipsparseHandle_t handle_, csru2csrInfo_t info_)
+        : handle(handle_)
+        , info(info_)
+    {
+    }
+
+    ~csru2csr_permutation()
+    {
+        if(P != nullptr && info->permutation == HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD)
+        {
+            workspace_release(handle, P);
+        }
+    }
+
+    hipsparseHandle_t handle;
+    csru2csrInfo_t    info;
+    int*              P = nullptr;
+};
+
 hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      int                       m,
                                      int                       n,
@@ -12040,6 +18288,18 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12071,35 +18331,14 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
-
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
-
-        info->size = nnz;
-    }
-
-    // Initialize permutation with identity
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
-
     // Sort CSR columns
+    csru2csr_permutation perm(handle, info);
     RETURN_IF_HIPSPARSE_ERROR(
-        hipsparseXcsrsort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info->P, pBuffer));
+        csru2csr_sort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info, pBuffer, &perm.P));
 
     // Sort CSR values
     RETURN_IF_HIPSPARSE_ERROR(
-        hipsparseSgthr(handle, nnz, csrVal, (float*)pBuffer, info->P, HIPSPARSE_INDEX_BASE_ZERO));
+        hipsparseSgthr(handle, nnz, csrVal, (float*)pBuffer, perm.P, HIPSPARSE_INDEX_BASE_ZERO));
 
     // Get stream
     hipStream_t stream;
@@ -12123,6 +18362,18 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12154,35 +18405,14 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
-
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
-
-        info->size = nnz;
-    }
-
-    // Initialize permutation with identity
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
-
     // Sort CSR columns
+    csru2csr_permutation perm(handle, info);
     RETURN_IF_HIPSPARSE_ERROR(
-        hipsparseXcsrsort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info->P, pBuffer));
+        csru2csr_sort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info, pBuffer, &perm.P));
 
     // Sort CSR values
     RETURN_IF_HIPSPARSE_ERROR(
-        hipsparseDgthr(handle, nnz, csrVal, (double*)pBuffer, info->P, HIPSPARSE_INDEX_BASE_ZERO));
+        hipsparseDgthr(handle, nnz, csrVal, (double*)pBuffer, perm.P, HIPSPARSE_INDEX_BASE_ZERO));
 
     // Get stream
     hipStream_t stream;
@@ -12206,6 +18436,18 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12237,35 +18479,14 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
-
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
-
-        info->size = nnz;
-    }
-
-    // Initialize permutation with identity
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
-
     // Sort CSR columns
+    csru2csr_permutation perm(handle, info);
     RETURN_IF_HIPSPARSE_ERROR(
-        hipsparseXcsrsort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info->P, pBuffer));
+        csru2csr_sort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info, pBuffer, &perm.P));
 
     // Sort CSR values
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCgthr(
-        handle, nnz, csrVal, (hipComplex*)pBuffer, info->P, HIPSPARSE_INDEX_BASE_ZERO));
+        handle, nnz, csrVal, (hipComplex*)pBuffer, perm.P, HIPSPARSE_INDEX_BASE_ZERO));
 
     // Get stream
     hipStream_t stream;
@@ -12289,6 +18510,18 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12320,35 +18553,14 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
-
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
-
-        info->size = nnz;
-    }
-
-    // Initialize permutation with identity
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
-
     // Sort CSR columns
+    csru2csr_permutation perm(handle, info);
     RETURN_IF_HIPSPARSE_ERROR(
-        hipsparseXcsrsort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info->P, pBuffer));
+        csru2csr_sort(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, info, pBuffer, &perm.P));
 
     // Sort CSR values
     RETURN_IF_HIPSPARSE_ERROR(hipsparseZgthr(
-        handle, nnz, csrVal, (hipDoubleComplex*)pBuffer, info->P, HIPSPARSE_INDEX_BASE_ZERO));
+        handle, nnz, csrVal, (hipDoubleComplex*)pBuffer, perm.P, HIPSPARSE_INDEX_BASE_ZERO));
 
     // Get stream
     hipStream_t stream;
@@ -12372,6 +18584,18 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12447,6 +18671,18 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12522,6 +18758,18 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12597,6 +18845,18 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      n,
+                      nnz,
+                      descrA,
+                      csrVal,
+                      csrRowPtr,
+                      csrColInd,
+                      info,
+                      pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12866,6 +19126,20 @@ hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
 
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseSpMatDescr_t spMatDescr)
 {
+    descr_data* data = (spMatDescr != nullptr) ? get_descr_data(spMatDescr) : nullptr;
+
+    if(data != nullptr && data->spgemm_storage != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->spgemm_storage));
+        data->spgemm_storage = nullptr;
+    }
+
+    if(spMatDescr != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(descr_registry_mutex);
+        descr_registry.erase(spMatDescr);
+    }
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_destroy_spmat_descr((rocsparse_spmat_descr)spMatDescr));
 }
@@ -13255,6 +19529,8 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t     handle,
                                  const void*           beta,
                                  hipsparseDnVecDescr_t vecY)
 {
+    api_logger logger(handle, __func__, alpha, vecX, beta, vecY);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_axpby((rocsparse_handle)handle,
                                                       alpha,
                                                       (rocsparse_spvec_descr)vecX,
@@ -13266,6 +19542,8 @@ hipsparseStatus_t hipsparseGather(hipsparseHandle_t     handle,
                                   hipsparseDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t vecX)
 {
+    api_logger logger(handle, __func__, vecY, vecX);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_gather(
         (rocsparse_handle)handle, (rocsparse_dnvec_descr)vecY, (rocsparse_spvec_descr)vecX));
 }
@@ -13274,6 +19552,8 @@ hipsparseStatus_t hipsparseScatter(hipsparseHandle_t     handle,
                                    hipsparseSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t vecY)
 {
+    api_logger logger(handle, __func__, vecX, vecY);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scatter(
         (rocsparse_handle)handle, (rocsparse_spvec_descr)vecX, (rocsparse_dnvec_descr)vecY));
 }
@@ -13284,6 +19564,8 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                hipsparseSpVecDescr_t vecX,
                                hipsparseDnVecDescr_t vecY)
 {
+    api_logger logger(handle, __func__, c_coeff, s_coeff, vecX, vecY);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_rot((rocsparse_handle)handle,
                                                     c_coeff,
                                                     s_coeff,
@@ -13297,6 +19579,8 @@ hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t*                     bufferSize)
 {
+    api_logger logger(handle, __func__, matA, matB, alg, bufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                                                 (rocsparse_spmat_descr)matA,
                                                                 (rocsparse_dnmat_descr)matB,
@@ -13311,6 +19595,8 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void*                       externalBuffer)
 {
+    api_logger logger(handle, __func__, matA, matB, alg, externalBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                                                 (rocsparse_spmat_descr)matA,
                                                                 (rocsparse_dnmat_descr)matB,
@@ -13325,6 +19611,8 @@ hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t
                                                     hipsparseDenseToSparseAlg_t alg,
                                                     size_t*                     bufferSize)
 {
+    api_logger logger(handle, __func__, matA, matB, alg, bufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                                                 (rocsparse_dnmat_descr)matA,
                                                                 (rocsparse_spmat_descr)matB,
@@ -13339,6 +19627,8 @@ hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           ha
                                                   hipsparseDenseToSparseAlg_t alg,
                                                   void*                       externalBuffer)
 {
+    api_logger logger(handle, __func__, matA, matB, alg, externalBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                                                 (rocsparse_dnmat_descr)matA,
                                                                 (rocsparse_spmat_descr)matB,
@@ -13353,6 +19643,8 @@ hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           han
                                                  hipsparseDenseToSparseAlg_t alg,
                                                  void*                       externalBuffer)
 {
+    api_logger logger(handle, __func__, matA, matB, alg, externalBuffer);
+
     size_t bufferSize = 4;
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
@@ -13371,6 +19663,8 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t     handle,
                                            hipDataType           computeType,
                                            size_t*               bufferSize)
 {
+    api_logger logger(handle, __func__, opX, vecX, vecY, result, computeType, bufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spvv((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opX),
                                                      (rocsparse_spvec_descr)vecX,
@@ -13389,6 +19683,8 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t     handle,
                                 hipDataType           computeType,
                                 void*                 externalBuffer)
 {
+    api_logger logger(handle, __func__, opX, vecX, vecY, result, computeType, externalBuffer);
+
     size_t bufferSize;
 
     // Check for buffer == nullptr as this is not done in rocsparse
@@ -13418,6 +19714,18 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            size_t*                     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      alpha,
+                      matA,
+                      vecX,
+                      beta,
+                      vecY,
+                      computeType,
+                      alg,
+                      bufferSize);
+
     if(handle == nullptr)
     {
         return rocSPARSEStatusToHIPStatus(rocsparse_status_invalid_handle);
@@ -13429,7 +19737,23 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
         return rocSPARSEStatusToHIPStatus(rocsparse_status_invalid_pointer);
     }
 
-    *bufferSize = 4;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_ex((rocsparse_handle)handle,
+                                                hipOperationToHCCOperation(opA),
+                                                alpha,
+                                                (const rocsparse_spmat_descr)matA,
+                                                (const rocsparse_dnvec_descr)vecX,
+                                                beta,
+                                                (const rocsparse_dnvec_descr)vecY,
+                                                hipDataTypeToHCCDataType(computeType),
+                                                hipSpMVAlgToHCCSpMVAlg(alg),
+                                                rocsparse_spmv_stage_buffer_size,
+                                                bufferSize,
+                                                nullptr));
+
+    // hipsparseSpMV() treats a nullptr buffer as a size query, thus make sure the
+    // user always obtains a valid allocation
+    *bufferSize = std::max(*bufferSize, (size_t)4);
+
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -13442,20 +19766,42 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
                                            const hipsparseDnVecDescr_t vecY,
                                            hipDataType                 computeType,
                                            hipsparseSpMVAlg_t          alg,
-                                           void*                       externalBuffer)
-{
-    size_t bufferSize;
-    return rocSPARSEStatusToHIPStatus(rocsparse_spmv((rocsparse_handle)handle,
-                                                     hipOperationToHCCOperation(opA),
-                                                     alpha,
-                                                     (const rocsparse_spmat_descr)matA,
-                                                     (const rocsparse_dnvec_descr)vecX,
-                                                     beta,
-                                                     (const rocsparse_dnvec_descr)vecY,
-                                                     hipDataTypeToHCCDataType(computeType),
-                                                     hipSpMVAlgToHCCSpMVAlg(alg),
-                                                     &bufferSize,
-                                                     nullptr));
+                                           void*                       externalBuffer)
+{
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      alpha,
+                      matA,
+                      vecX,
+                      beta,
+                      vecY,
+                      computeType,
+                      alg,
+                      externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(analysis_capture_check(handle));
+
+    // Run the matrix analysis (e.g. row binning of the adaptive and stream csrmv
+    // algorithms) once. Its result is kept with the matrix descriptor and the
+    // external buffer, such that subsequent SpMV calls skip the analysis.
+    size_t bufferSize;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv_ex((rocsparse_handle)handle,
+                                                hipOperationToHCCOperation(opA),
+                                                alpha,
+                                                (const rocsparse_spmat_descr)matA,
+                                                (const rocsparse_dnvec_descr)vecX,
+                                                beta,
+                                                (const rocsparse_dnvec_descr)vecY,
+                                                hipDataTypeToHCCDataType(computeType),
+                                                hipSpMVAlgToHCCSpMVAlg(alg),
+                                                rocsparse_spmv_stage_preprocess,
+                                                &bufferSize,
+                                                externalBuffer));
+
+    get_descr_data(matA, true)->spmv_preprocessed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
@@ -13469,18 +19815,61 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 hipsparseSpMVAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      alpha,
+                      matA,
+                      vecX,
+                      beta,
+                      vecY,
+                      computeType,
+                      alg,
+                      externalBuffer);
+
+    if(logger.bench())
+    {
+        std::string matrix = bench_csr_matrix(matA, "--sizen");
+        if(!matrix.empty() && bench_precision(computeType) != nullptr)
+        {
+            log_bench("-f",
+                      "spmv",
+                      "-r",
+                      bench_precision(computeType),
+                      "--transposeA",
+                      bench_operation(opA),
+                      matrix,
+                      bench_scalar(handle, "--alpha", alpha, computeType),
+                      bench_scalar(handle, "--beta", beta, computeType),
+                      "--alg",
+                      (int)alg);
+        }
+    }
+
+    // The auto stage only runs the analysis if it has not been performed by
+    // hipsparseSpMV_preprocess() before
+    if(capture_safe(handle))
+    {
+        descr_data* data = get_descr_data(matA);
+        if(data == nullptr || !data->spmv_preprocessed)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     size_t bufferSize;
-    return rocSPARSEStatusToHIPStatus(rocsparse_spmv((rocsparse_handle)handle,
-                                                     hipOperationToHCCOperation(opA),
-                                                     alpha,
-                                                     (const rocsparse_spmat_descr)matA,
-                                                     (const rocsparse_dnvec_descr)vecX,
-                                                     beta,
-                                                     (const rocsparse_dnvec_descr)vecY,
-                                                     hipDataTypeToHCCDataType(computeType),
-                                                     hipSpMVAlgToHCCSpMVAlg(alg),
-                                                     &bufferSize,
-                                                     externalBuffer));
+    return rocSPARSEStatusToHIPStatus(rocsparse_spmv_ex((rocsparse_handle)handle,
+                                                        hipOperationToHCCOperation(opA),
+                                                        alpha,
+                                                        (const rocsparse_spmat_descr)matA,
+                                                        (const rocsparse_dnvec_descr)vecX,
+                                                        beta,
+                                                        (const rocsparse_dnvec_descr)vecY,
+                                                        hipDataTypeToHCCDataType(computeType),
+                                                        hipSpMVAlgToHCCSpMVAlg(alg),
+                                                        rocsparse_spmv_stage_auto,
+                                                        &bufferSize,
+                                                        externalBuffer));
 }
 
 hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
@@ -13495,6 +19884,19 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            size_t*                     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spmm_ex((rocsparse_handle)handle,
                                                         hipOperationToHCCOperation(opA),
                                                         hipOperationToHCCOperation(opB),
@@ -13522,6 +19924,19 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      externalBuffer);
+
     size_t bufferSize;
     return rocSPARSEStatusToHIPStatus(rocsparse_spmm_ex((rocsparse_handle)handle,
                                                         hipOperationToHCCOperation(opA),
@@ -13550,6 +19965,51 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 hipsparseSpMMAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      externalBuffer);
+
+    if(logger.bench())
+    {
+        std::string matrix = bench_csr_matrix(matA, "--sizek");
+
+        int64_t          rowsC;
+        int64_t          colsC;
+        int64_t          ldC;
+        void*            valC;
+        hipDataType      typeC;
+        hipsparseOrder_t orderC;
+
+        if(!matrix.empty() && bench_precision(computeType) != nullptr
+           && opB == HIPSPARSE_OPERATION_NON_TRANSPOSE
+           && hipsparseDnMatGet(matC, &rowsC, &colsC, &ldC, &valC, &typeC, &orderC)
+                  == HIPSPARSE_STATUS_SUCCESS)
+        {
+            log_bench("-f",
+                      "spmm",
+                      "-r",
+                      bench_precision(computeType),
+                      "--transposeA",
+                      bench_operation(opA),
+                      matrix,
+                      "--sizen",
+                      colsC,
+                      bench_scalar(handle, "--alpha", alpha, computeType),
+                      bench_scalar(handle, "--beta", beta, computeType),
+                      "--alg",
+                      (int)alg);
+        }
+    }
+
     size_t bufferSize;
     return rocSPARSEStatusToHIPStatus(rocsparse_spmm_ex((rocsparse_handle)handle,
                                                         hipOperationToHCCOperation(opA),
@@ -13570,6 +20030,27 @@ struct hipsparseSpGEMMDescr
 {
     size_t bufferSize{};
     void*  externalBuffer{};
+
+    // Product computed by hipsparseSpGEMM_compute(), consumed by hipsparseSpGEMM_copy()
+    bool    computed{};
+    int64_t rowsC{};
+    int64_t nnzC{};
+    size_t  rowPtrSizeC{};
+    size_t  colIndSizeC{};
+    size_t  valSizeC{};
+    void*   csrRowPtrC{};
+    void*   csrColIndC{};
+    void*   csrValC{};
+
+    // Device storage holding column indices and values of the product. It is never
+    // handed to the user, but matC refers to it until the user sets its own arrays.
+    size_t                storageSize{};
+    void*                 storage{};
+    hipsparseSpMatDescr_t storageUser{};
+
+    // What is known about alpha and beta in device pointer mode
+    hipsparseScalarHint_t alphaHint = HIPSPARSE_SCALAR_HINT_UNKNOWN;
+    hipsparseScalarHint_t betaHint  = HIPSPARSE_SCALAR_HINT_UNKNOWN;
 };
 
 hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
@@ -13578,17 +20059,139 @@ hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+// Returns true if the arrays of the matrix, that the product has last been computed into,
+// still refer to the storage of the SpGEMM descriptor
+static bool spgemm_storage_referenced(hipsparseSpGEMMDescr_t descr)
+{
+    // The matrix has been destroyed or has been computed into by another descriptor
+    descr_data* data = (descr->storageUser != nullptr) ? get_descr_data(descr->storageUser)
+                                                       : nullptr;
+    if(data == nullptr || data->spgemm_descr != descr)
+    {
+        return false;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    void*                csr_row_ptr;
+    void*                csr_col_ind;
+    void*                csr_val;
+    rocsparse_indextype  row_ptr_type;
+    rocsparse_indextype  col_ind_type;
+    rocsparse_index_base idx_base;
+    rocsparse_datatype   data_type;
+    if(rocsparse_csr_get((rocsparse_spmat_descr)descr->storageUser,
+                         &rows,
+                         &cols,
+                         &nnz,
+                         &csr_row_ptr,
+                         &csr_col_ind,
+                         &csr_val,
+                         &row_ptr_type,
+                         &col_ind_type,
+                         &idx_base,
+                         &data_type)
+       != rocsparse_status_success)
+    {
+        return false;
+    }
+
+    return csr_col_ind == descr->storage;
+}
+
+// Releases the storage of the SpGEMM descriptor. If a matrix still refers to it, it is
+// handed over to the matrix and freed by hipsparseDestroySpMat().
+static hipsparseStatus_t spgemm_release_storage(hipsparseSpGEMMDescr_t descr)
+{
+    if(descr->storage == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(spgemm_storage_referenced(descr))
+    {
+        descr_data* data = get_descr_data(descr->storageUser);
+
+        // Storage handed over earlier is not referred to anymore
+        if(data->spgemm_storage != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(data->spgemm_storage));
+        }
+
+        data->spgemm_storage = descr->storage;
+        data->spgemm_descr   = nullptr;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipFree(descr->storage));
+    }
+
+    descr->storage     = nullptr;
+    descr->storageSize = 0;
+    descr->storageUser = nullptr;
+    descr->csrColIndC  = nullptr;
+    descr->csrValC     = nullptr;
+    descr->computed    = false;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
 {
     // Check if info structure has been created
     if(descr != nullptr)
     {
+        RETURN_IF_HIPSPARSE_ERROR(spgemm_release_storage(descr));
+
         delete descr;
     }
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparseSpGEMM_setScalarHints(hipsparseSpGEMMDescr_t descr,
+                                                 hipsparseScalarHint_t  alphaHint,
+                                                 hipsparseScalarHint_t  betaHint)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alphaHint != HIPSPARSE_SCALAR_HINT_UNKNOWN && alphaHint != HIPSPARSE_SCALAR_HINT_ZERO
+       && alphaHint != HIPSPARSE_SCALAR_HINT_NONZERO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(betaHint != HIPSPARSE_SCALAR_HINT_UNKNOWN && betaHint != HIPSPARSE_SCALAR_HINT_ZERO
+       && betaHint != HIPSPARSE_SCALAR_HINT_NONZERO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->alphaHint = alphaHint;
+    descr->betaHint  = betaHint;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_getScalarHints(hipsparseSpGEMMDescr_t descr,
+                                                 hipsparseScalarHint_t* alphaHint,
+                                                 hipsparseScalarHint_t* betaHint)
+{
+    if(descr == nullptr || alphaHint == nullptr || betaHint == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *alphaHint = descr->alphaHint;
+    *betaHint  = descr->betaHint;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
                                                  hipsparseOperation_t   opA,
                                                  hipsparseOperation_t   opB,
@@ -13603,6 +20206,21 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
                                                  size_t*                bufferSize1,
                                                  void*                  externalBuffer1)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      spgemmDescr,
+                      bufferSize1,
+                      externalBuffer1);
+
     // Match cusparse error handling
     if(handle == nullptr)
     {
@@ -13632,11 +20250,42 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
-static const void*
-    spgemm_get_ptr(hipsparsePointerMode_t mode, hipDataType computeType, const void* ptr)
+// In capture safe mode, scalars in device memory cannot be read, thus their hints are
+// required
+static hipsparseStatus_t spgemm_check_hints(hipsparseHandle_t      handle,
+                                            hipsparsePointerMode_t mode,
+                                            hipsparseScalarHint_t  alpha_hint,
+                                            hipsparseScalarHint_t  beta_hint)
+{
+    if(mode == HIPSPARSE_POINTER_MODE_DEVICE && capture_safe(handle)
+       && (alpha_hint == HIPSPARSE_SCALAR_HINT_UNKNOWN
+           || beta_hint == HIPSPARSE_SCALAR_HINT_UNKNOWN))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// Returns ptr if the scalar is non-zero, nullptr otherwise. In device pointer mode, this
+// requires a blocking read of the scalar, unless the hint tells the answer.
+static const void* spgemm_get_ptr(hipsparsePointerMode_t mode,
+                                  hipDataType            computeType,
+                                  const void*            ptr,
+                                  hipsparseScalarHint_t  hint)
 {
     const void* cast_ptr = nullptr;
 
+    if(mode == HIPSPARSE_POINTER_MODE_DEVICE && hint == HIPSPARSE_SCALAR_HINT_ZERO)
+    {
+        return nullptr;
+    }
+
+    if(mode == HIPSPARSE_POINTER_MODE_DEVICE && hint == HIPSPARSE_SCALAR_HINT_NONZERO)
+    {
+        return ptr;
+    }
+
     if(mode == HIPSPARSE_POINTER_MODE_HOST)
     {
         if(computeType == HIP_R_32F)
@@ -13694,6 +20343,38 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t      handle,
                                           size_t*                bufferSize2,
                                           void*                  externalBuffer2)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      spgemmDescr,
+                      bufferSize2,
+                      externalBuffer2);
+
+    // The benchmark client squares A, the buffer size query is not logged
+    if(logger.bench() && externalBuffer2 != nullptr && matA == matB)
+    {
+        std::string matrix = bench_csr_matrix(matA, "--sizen");
+        if(!matrix.empty() && bench_precision(computeType) != nullptr)
+        {
+            log_bench("-f",
+                      "spgemm",
+                      "-r",
+                      bench_precision(computeType),
+                      matrix,
+                      bench_scalar(handle, "--alpha", alpha, computeType),
+                      "--alg",
+                      (int)alg);
+        }
+    }
+
     if(handle == nullptr || bufferSize2 == nullptr || alpha == nullptr || beta == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -13702,23 +20383,165 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t      handle,
     hipsparsePointerMode_t mode;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
 
-    const void* alpha_ptr = spgemm_get_ptr(mode, computeType, alpha);
-    const void* beta_ptr  = spgemm_get_ptr(mode, computeType, beta);
+    hipsparseScalarHint_t alpha_hint
+        = (spgemmDescr != nullptr) ? spgemmDescr->alphaHint : HIPSPARSE_SCALAR_HINT_UNKNOWN;
+    hipsparseScalarHint_t beta_hint
+        = (spgemmDescr != nullptr) ? spgemmDescr->betaHint : HIPSPARSE_SCALAR_HINT_UNKNOWN;
 
-    return rocSPARSEStatusToHIPStatus(rocsparse_spgemm((rocsparse_handle)handle,
-                                                       hipOperationToHCCOperation(opA),
-                                                       hipOperationToHCCOperation(opB),
-                                                       alpha_ptr,
-                                                       (rocsparse_spmat_descr)matA,
-                                                       (rocsparse_spmat_descr)matB,
-                                                       beta_ptr,
-                                                       (rocsparse_spmat_descr)matC,
-                                                       (rocsparse_spmat_descr)matC,
-                                                       hipDataTypeToHCCDataType(computeType),
-                                                       hipSpGEMMAlgToHCCSpGEMMAlg(alg),
-                                                       rocsparse_spgemm_stage_auto,
-                                                       bufferSize2,
-                                                       externalBuffer2));
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_check_hints(handle, mode, alpha_hint, beta_hint));
+
+    const void* alpha_ptr = spgemm_get_ptr(mode, computeType, alpha, alpha_hint);
+    const void* beta_ptr  = spgemm_get_ptr(mode, computeType, beta, beta_hint);
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    void*                csr_row_ptr = nullptr;
+    void*                csr_col_ind = nullptr;
+    void*                csr_val     = nullptr;
+    rocsparse_indextype  row_ptr_type;
+    rocsparse_indextype  col_ind_type;
+    rocsparse_index_base idx_base;
+    rocsparse_datatype   data_type;
+
+    if(spgemmDescr != nullptr && matC != nullptr)
+    {
+        spgemmDescr->computed = false;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_get((rocsparse_spmat_descr)matC,
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &csr_row_ptr,
+                                                    &csr_col_ind,
+                                                    &csr_val,
+                                                    &row_ptr_type,
+                                                    &col_ind_type,
+                                                    &idx_base,
+                                                    &data_type));
+    }
+
+    // Buffer size query. Otherwise, the product is always computed into the descriptor
+    // storage, as the sparsity pattern of C might have changed since the last call.
+    if(spgemmDescr == nullptr || externalBuffer2 == nullptr)
+    {
+        return rocSPARSEStatusToHIPStatus(rocsparse_spgemm((rocsparse_handle)handle,
+                                                           hipOperationToHCCOperation(opA),
+                                                           hipOperationToHCCOperation(opB),
+                                                           alpha_ptr,
+                                                           (rocsparse_spmat_descr)matA,
+                                                           (rocsparse_spmat_descr)matB,
+                                                           beta_ptr,
+                                                           (rocsparse_spmat_descr)matC,
+                                                           (rocsparse_spmat_descr)matC,
+                                                           hipDataTypeToHCCDataType(computeType),
+                                                           hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+                                                           rocsparse_spgemm_stage_auto,
+                                                           bufferSize2,
+                                                           externalBuffer2));
+    }
+
+    // The number of non-zeros of C has to be read back to the host, which cannot be
+    // captured. Only hipsparseSpGEMMreuse_compute() can be captured.
+    if(capture_safe(handle))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // Determine the row pointer array and the number of non-zeros of C
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                               hipOperationToHCCOperation(opA),
+                                               hipOperationToHCCOperation(opB),
+                                               alpha_ptr,
+                                               (rocsparse_spmat_descr)matA,
+                                               (rocsparse_spmat_descr)matB,
+                                               beta_ptr,
+                                               (rocsparse_spmat_descr)matC,
+                                               (rocsparse_spmat_descr)matC,
+                                               hipDataTypeToHCCDataType(computeType),
+                                               hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+                                               rocsparse_spgemm_stage_nnz,
+                                               bufferSize2,
+                                               externalBuffer2));
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_size((rocsparse_spmat_descr)matC, &rows, &cols, &nnz));
+
+    // Column indices and values of the product are computed into storage owned by
+    // the SpGEMM descriptor, while the user buffer is still valid. Reallocate only
+    // if the previous storage is too small, or if another matrix still refers to it.
+    size_t col_ind_bytes = (HCCIndexTypeSize(col_ind_type) * nnz + 255) / 256 * 256;
+    size_t storage_size  = col_ind_bytes + HCCDataTypeSize(data_type) * nnz;
+
+    if(nnz > 0
+       && (storage_size > spgemmDescr->storageSize
+           || (spgemmDescr->storageUser != matC && spgemm_storage_referenced(spgemmDescr))))
+    {
+        void* storage;
+        RETURN_IF_HIP_ERROR(hipMalloc(&storage, storage_size));
+
+        hipsparseStatus_t status = spgemm_release_storage(spgemmDescr);
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            hipFree(storage);
+            return status;
+        }
+
+        spgemmDescr->storage     = storage;
+        spgemmDescr->storageSize = storage_size;
+    }
+
+    spgemmDescr->rowsC       = rows;
+    spgemmDescr->nnzC        = nnz;
+    spgemmDescr->rowPtrSizeC = HCCIndexTypeSize(row_ptr_type);
+    spgemmDescr->colIndSizeC = HCCIndexTypeSize(col_ind_type);
+    spgemmDescr->valSizeC    = HCCDataTypeSize(data_type);
+    spgemmDescr->csrRowPtrC  = csr_row_ptr;
+    spgemmDescr->csrColIndC  = nullptr;
+    spgemmDescr->csrValC     = nullptr;
+
+    if(nnz > 0)
+    {
+        spgemmDescr->csrColIndC = spgemmDescr->storage;
+        spgemmDescr->csrValC    = (char*)spgemmDescr->storage + col_ind_bytes;
+
+        // C refers to the descriptor storage until the user sets its own arrays
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_set_pointers((rocsparse_spmat_descr)matC,
+                                                             csr_row_ptr,
+                                                             spgemmDescr->csrColIndC,
+                                                             spgemmDescr->csrValC));
+
+        descr_data* data = get_descr_data(matC, true);
+
+        // Storage handed over to C earlier is not referred to anymore
+        if(data->spgemm_storage != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(data->spgemm_storage));
+            data->spgemm_storage = nullptr;
+        }
+
+        data->spgemm_descr       = spgemmDescr;
+        spgemmDescr->storageUser = matC;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                                   hipOperationToHCCOperation(opA),
+                                                   hipOperationToHCCOperation(opB),
+                                                   alpha_ptr,
+                                                   (rocsparse_spmat_descr)matA,
+                                                   (rocsparse_spmat_descr)matB,
+                                                   beta_ptr,
+                                                   (rocsparse_spmat_descr)matC,
+                                                   (rocsparse_spmat_descr)matC,
+                                                   hipDataTypeToHCCDataType(computeType),
+                                                   hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+                                                   rocsparse_spgemm_stage_compute,
+                                                   bufferSize2,
+                                                   externalBuffer2));
+    }
+
+    spgemmDescr->computed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
@@ -13733,6 +20556,19 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
                                        hipsparseSpGEMMAlg_t   alg,
                                        hipsparseSpGEMMDescr_t spgemmDescr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -13741,12 +20577,83 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
     hipsparsePointerMode_t mode;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
 
-    const void* alpha_ptr = spgemm_get_ptr(mode, computeType, alpha);
-    const void* beta_ptr  = spgemm_get_ptr(mode, computeType, beta);
+    // The product has already been computed by hipsparseSpGEMM_compute(), only
+    // copy it into the arrays of C
+    if(spgemmDescr != nullptr && spgemmDescr->computed)
+    {
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        void*                csr_row_ptr;
+        void*                csr_col_ind;
+        void*                csr_val;
+        rocsparse_indextype  row_ptr_type;
+        rocsparse_indextype  col_ind_type;
+        rocsparse_index_base idx_base;
+        rocsparse_datatype   data_type;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_get((rocsparse_spmat_descr)matC,
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &csr_row_ptr,
+                                                    &csr_col_ind,
+                                                    &csr_val,
+                                                    &row_ptr_type,
+                                                    &col_ind_type,
+                                                    &idx_base,
+                                                    &data_type));
+
+        if(rows != spgemmDescr->rowsC || nnz != spgemmDescr->nnzC)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        if(csr_row_ptr != spgemmDescr->csrRowPtrC)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_row_ptr,
+                                               spgemmDescr->csrRowPtrC,
+                                               spgemmDescr->rowPtrSizeC * (rows + 1),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        if(nnz > 0 && csr_col_ind != spgemmDescr->csrColIndC)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind,
+                                               spgemmDescr->csrColIndC,
+                                               spgemmDescr->colIndSizeC * nnz,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        if(nnz > 0 && csr_val != spgemmDescr->csrValC)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_val,
+                                               spgemmDescr->csrValC,
+                                               spgemmDescr->valSizeC * nnz,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseScalarHint_t alpha_hint
+        = (spgemmDescr != nullptr) ? spgemmDescr->alphaHint : HIPSPARSE_SCALAR_HINT_UNKNOWN;
+    hipsparseScalarHint_t beta_hint
+        = (spgemmDescr != nullptr) ? spgemmDescr->betaHint : HIPSPARSE_SCALAR_HINT_UNKNOWN;
+
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_check_hints(handle, mode, alpha_hint, beta_hint));
 
-    // cuSPARSE API does not carry over the temporary storage buffer, therefore
-    // we need to allocate additional memory. This will lead to lower performance
-    // and thus we highly recommand to use rocSPARSE API instead!!!
+    const void* alpha_ptr = spgemm_get_ptr(mode, computeType, alpha, alpha_hint);
+    const void* beta_ptr  = spgemm_get_ptr(mode, computeType, beta, beta_hint);
+
+    // Without a product computed by hipsparseSpGEMM_compute(), the temporary
+    // storage buffer is not available anymore, therefore we need to allocate
+    // additional memory and compute the product here.
 
     // Query for required buffer size
     size_t bufferSize;
@@ -13766,7 +20673,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
                                                nullptr));
 
     void* buffer;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_acquire(handle, bufferSize, &buffer));
 
     hipsparseStatus_t status
         = rocSPARSEStatusToHIPStatus(rocsparse_spgemm((rocsparse_handle)handle,
@@ -13784,7 +20691,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
                                                       &bufferSize,
                                                       buffer));
 
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
+    RETURN_IF_HIPSPARSE_ERROR(workspace_release(handle, buffer));
 
     return status;
 }
@@ -13800,6 +20707,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t      han
                                                       size_t*                bufferSize1,
                                                       void*                  externalBuffer1)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      matA,
+                      matB,
+                      matC,
+                      alg,
+                      spgemmDescr,
+                      bufferSize1,
+                      externalBuffer1);
+
     // Match cusparse error handling
     if(handle == nullptr)
     {
@@ -13839,6 +20758,22 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t      handle,
                                            size_t*                bufferSize4,
                                            void*                  externalBuffer4)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      matA,
+                      matB,
+                      matC,
+                      alg,
+                      spgemmDescr,
+                      bufferSize2,
+                      externalBuffer2,
+                      bufferSize3,
+                      externalBuffer3,
+                      bufferSize4,
+                      externalBuffer4);
+
     // Match cusparse error handling
     if(handle == nullptr)
     {
@@ -13944,6 +20879,19 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t      handle,
                                                hipsparseSpGEMMAlg_t   alg,
                                                hipsparseSpGEMMDescr_t spgemmDescr)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || spgemmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -13951,8 +20899,15 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t      handle,
     hipsparsePointerMode_t mode;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
 
-    const void* alpha_ptr = spgemm_get_ptr(mode, computeType, alpha);
-    const void* beta_ptr  = spgemm_get_ptr(mode, computeType, beta);
+    hipsparseScalarHint_t alpha_hint
+        = (spgemmDescr != nullptr) ? spgemmDescr->alphaHint : HIPSPARSE_SCALAR_HINT_UNKNOWN;
+    hipsparseScalarHint_t beta_hint
+        = (spgemmDescr != nullptr) ? spgemmDescr->betaHint : HIPSPARSE_SCALAR_HINT_UNKNOWN;
+
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_check_hints(handle, mode, alpha_hint, beta_hint));
+
+    const void* alpha_ptr = spgemm_get_ptr(mode, computeType, alpha, alpha_hint);
+    const void* beta_ptr  = spgemm_get_ptr(mode, computeType, beta, beta_hint);
 
     return rocSPARSEStatusToHIPStatus(rocsparse_spgemm((rocsparse_handle)handle,
                                                        hipOperationToHCCOperation(opA),
@@ -13981,6 +20936,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t      handle,
                                             size_t*                bufferSize5,
                                             void*                  externalBuffer5)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      matA,
+                      matB,
+                      matC,
+                      alg,
+                      spgemmDescr,
+                      bufferSize5,
+                      externalBuffer5);
+
     //
     // This routine performs the symbolic calculation..
     //
@@ -14079,6 +21046,19 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t           handle,
                                  hipsparseSDDMMAlg_t         alg,
                                  void*                       tempBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      tempBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sddmm((rocsparse_handle)handle,
                                                       hipOperationToHCCOperation(opA),
                                                       hipOperationToHCCOperation(opB),
@@ -14104,6 +21084,19 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t           handle,
                                             hipsparseSDDMMAlg_t         alg,
                                             size_t*                     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_buffer_size((rocsparse_handle)handle,
                                     hipOperationToHCCOperation(opA),
@@ -14130,6 +21123,19 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t           handle,
                                             hipsparseSDDMMAlg_t         alg,
                                             void*                       tempBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      beta,
+                      matC,
+                      computeType,
+                      alg,
+                      tempBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_preprocess((rocsparse_handle)handle,
                                    hipOperationToHCCOperation(opA),
@@ -14167,6 +21173,18 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      alpha,
+                      matA,
+                      x,
+                      y,
+                      computeType,
+                      alg,
+                      spsvDescr,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spsv((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opA),
                                                      alpha,
@@ -14191,6 +21209,18 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      alpha,
+                      matA,
+                      x,
+                      y,
+                      computeType,
+                      alg,
+                      spsvDescr,
+                      externalBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spsv((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opA),
                                                      alpha,
@@ -14215,6 +21245,45 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVDescr_t        spsvDescr,
                                       void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      alpha,
+                      matA,
+                      x,
+                      y,
+                      computeType,
+                      alg,
+                      spsvDescr,
+                      externalBuffer);
+
+    if(logger.bench())
+    {
+        std::string         matrix = bench_csr_matrix(matA, "--sizen");
+        hipsparseFillMode_t fill   = HIPSPARSE_FILL_MODE_LOWER;
+        hipsparseDiagType_t diag   = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+
+        if(!matrix.empty() && bench_precision(computeType) != nullptr
+           && hipsparseSpMatGetAttribute(matA, HIPSPARSE_SPMAT_FILL_MODE, &fill, sizeof(fill))
+                  == HIPSPARSE_STATUS_SUCCESS
+           && hipsparseSpMatGetAttribute(matA, HIPSPARSE_SPMAT_DIAG_TYPE, &diag, sizeof(diag))
+                  == HIPSPARSE_STATUS_SUCCESS)
+        {
+            log_bench("-f",
+                      "spsv",
+                      "-r",
+                      bench_precision(computeType),
+                      "--transposeA",
+                      bench_operation(opA),
+                      matrix,
+                      bench_scalar(handle, "--alpha", alpha, computeType),
+                      "--uplo",
+                      bench_fill_mode(fill),
+                      "--diag",
+                      bench_diag_type(diag));
+        }
+    }
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spsv((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opA),
                                                      alpha,
@@ -14252,6 +21321,19 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSMDescr_t        spsmDescr,
                                            size_t*                     bufferSize)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      matC,
+                      computeType,
+                      alg,
+                      spsmDescr,
+                      bufferSize);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spsm((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opA),
                                                      hipOperationToHCCOperation(opB),
@@ -14278,6 +21360,19 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSMDescr_t        spsmDescr,
                                          void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      matC,
+                      computeType,
+                      alg,
+                      spsmDescr,
+                      externalBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spsm((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opA),
                                                      hipOperationToHCCOperation(opB),
@@ -14304,6 +21399,19 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSMDescr_t        spsmDescr,
                                       void*                       externalBuffer)
 {
+    api_logger logger(handle,
+                      __func__,
+                      opA,
+                      opB,
+                      alpha,
+                      matA,
+                      matB,
+                      matC,
+                      computeType,
+                      alg,
+                      spsmDescr,
+                      externalBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_spsm((rocsparse_handle)handle,
                                                      hipOperationToHCCOperation(opA),
                                                      hipOperationToHCCOperation(opB),
@@ -14328,6 +21436,17 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      dl,
+                      d,
+                      du,
+                      x,
+                      batchCount,
+                      batchStride,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14355,6 +21474,17 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      dl,
+                      d,
+                      du,
+                      x,
+                      batchCount,
+                      batchStride,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14382,6 +21512,17 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      dl,
+                      d,
+                      du,
+                      x,
+                      batchCount,
+                      batchStride,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14409,6 +21550,17 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                             int                     batchStride,
                                                             size_t* pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      dl,
+                      d,
+                      du,
+                      x,
+                      batchCount,
+                      batchStride,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14437,6 +21589,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -14452,6 +21606,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -14466,6 +21622,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                               int               batchStride,
                                               void*             pBuffer)
 {
+    api_logger logger(handle, __func__, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -14489,6 +21647,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                               void*                   pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -14511,6 +21671,8 @@ hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14530,6 +21692,8 @@ hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14549,6 +21713,8 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14576,6 +21742,8 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                                 int                     ldb,
                                                 size_t*                 pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14604,6 +21772,8 @@ hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -14619,6 +21789,8 @@ hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -14633,6 +21805,8 @@ hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
                                   int               ldb,
                                   void*             pBuffer)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cgtsv((rocsparse_handle)handle,
                                                       m,
                                                       n,
@@ -14655,6 +21829,8 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                                   void*                   pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zgtsv((rocsparse_handle)handle,
                                                       m,
                                                       n,
@@ -14676,6 +21852,8 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14695,6 +21873,8 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14714,6 +21894,8 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14741,6 +21923,8 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                                         int                     ldb,
                                                         size_t*                 pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14769,6 +21953,8 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -14784,6 +21970,8 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -14799,6 +21987,8 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_cgtsv_no_pivot((rocsparse_handle)handle,
                                                                m,
                                                                n,
@@ -14821,6 +22011,8 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                           void*                   pBuffer)
 
 {
+    api_logger logger(handle, __func__, m, n, dl, d, du, B, ldb, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zgtsv_no_pivot((rocsparse_handle)handle,
                                                                m,
                                                                n,
@@ -14842,6 +22034,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14870,6 +22064,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14898,6 +22094,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14926,6 +22124,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -14955,6 +22155,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -14979,6 +22181,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -15002,6 +22206,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -15026,6 +22232,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    api_logger logger(handle, __func__, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -15051,6 +22259,19 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      m,
+                      ds,
+                      dl,
+                      d,
+                      du,
+                      dw,
+                      x,
+                      batchCount,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15083,6 +22304,19 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      m,
+                      ds,
+                      dl,
+                      d,
+                      du,
+                      dw,
+                      x,
+                      batchCount,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15115,6 +22349,19 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      m,
+                      ds,
+                      dl,
+                      d,
+                      du,
+                      dw,
+                      x,
+                      batchCount,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15147,6 +22394,19 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    api_logger logger(handle,
+                      __func__,
+                      algo,
+                      m,
+                      ds,
+                      dl,
+                      d,
+                      du,
+                      dw,
+                      x,
+                      batchCount,
+                      pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15179,6 +22439,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    api_logger logger(handle, __func__, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_sgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -15206,6 +22468,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    api_logger logger(handle, __func__, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_dgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -15233,6 +22497,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    api_logger logger(handle, __func__, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_cgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -15260,6 +22526,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    api_logger logger(handle, __func__, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return rocSPARSEStatusToHIPStatus(
         rocsparse_zgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -15288,6 +22556,20 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      fractionToColor,
+                      ncolors,
+                      coloring,
+                      reordering,
+                      info);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_scsrcolor((rocsparse_handle)handle,
                                                           m,
                                                           nnz,
@@ -15315,6 +22597,20 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      fractionToColor,
+                      ncolors,
+                      coloring,
+                      reordering,
+                      info);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_dcsrcolor((rocsparse_handle)handle,
                                                           m,
                                                           nnz,
@@ -15342,6 +22638,20 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      fractionToColor,
+                      ncolors,
+                      coloring,
+                      reordering,
+                      info);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_ccsrcolor((rocsparse_handle)handle,
                                                           m,
                                                           nnz,
@@ -15369,6 +22679,20 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    api_logger logger(handle,
+                      __func__,
+                      m,
+                      nnz,
+                      descrA,
+                      csrValA,
+                      csrRowPtrA,
+                      csrColIndA,
+                      fractionToColor,
+                      ncolors,
+                      coloring,
+                      reordering,
+                      info);
+
     return rocSPARSEStatusToHIPStatus(rocsparse_zcsrcolor((rocsparse_handle)handle,
                                                           m,
                                                           nnz,
@@ -0,0 +1,6422 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+// Host (CPU) backend. All routines execute on the calling thread, parallelized with
+// OpenMP if available. Device memory is expected to be host accessible, as provided
+// by HIP runtimes for the CPU, such as HIP-CPU.
+//
+// Streams are treated as in-order queues: a routine first waits for the work that
+// has been queued on the handle stream, e.g. asynchronous copies of its input data,
+// and has completed its own work when it returns.
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "host_bsrmv.hpp"
+#include "host_csrgemm.hpp"
+#include "host_csrmv.hpp"
+#include "host_csrsv.hpp"
+#include "host_gtsv.hpp"
+#include "workspace_pool.hpp"
+
+#define TO_STR2(x) #x
+#define TO_STR(x) TO_STR2(x)
+
+#define RETURN_IF_HIPSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                    \
+        hipsparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != HIPSPARSE_STATUS_SUCCESS)             \
+        {                                                                \
+            return TMP_STATUS_FOR_CHECK;                                 \
+        }                                                                \
+    }
+
+namespace
+{
+    hipsparseStatus_t hipErrorToHIPSPARSEStatus(hipError_t status)
+    {
+        switch(status)
+        {
+        case hipSuccess:
+            return HIPSPARSE_STATUS_SUCCESS;
+        case hipErrorOutOfMemory:
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        case hipErrorInvalidValue:
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        default:
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    // Temporary arrays are host memory, independent of the HIP runtime
+    void* workspace_host_allocate(size_t size, void* user_data)
+    {
+        return malloc(size);
+    }
+
+    void workspace_host_deallocate(void* ptr, void* user_data)
+    {
+        free(ptr);
+    }
+
+    struct handle_data
+    {
+        handle_data()
+            : workspace({workspace_host_allocate, workspace_host_deallocate, nullptr})
+        {
+        }
+
+        hipStream_t            stream       = nullptr;
+        hipsparsePointerMode_t pointer_mode = HIPSPARSE_POINTER_MODE_HOST;
+
+        // Routines always complete before they return, the asynchronous mode is
+        // accepted for compatibility
+        hipsparseExecutionMode_t exec_mode = HIPSPARSE_EXEC_BLOCKING;
+
+        hipsparseAnalysisPolicy_t analysis_policy = HIPSPARSE_ANALYSIS_POLICY_FORCE;
+
+        // Host workspace for internally allocated temporary arrays
+        hipsparse::workspace_pool workspace;
+    };
+
+    // Wait for the work queued on the handle stream
+    hipsparseStatus_t wait_stream(handle_data* handle)
+    {
+        return hipErrorToHIPSPARSEStatus(hipStreamSynchronize(handle->stream));
+    }
+
+    // Temporary array from the handle workspace, the memory is not initialized
+    template <typename T>
+    class workspace_array
+    {
+    public:
+        workspace_array(handle_data* handle, int64_t size)
+            : handle_(handle)
+        {
+            void* ptr;
+            valid_ = handle_->workspace.acquire(sizeof(T) * size, &ptr);
+            ptr_   = (T*)ptr;
+        }
+
+        ~workspace_array()
+        {
+            handle_->workspace.release(ptr_);
+        }
+
+        workspace_array(const workspace_array&) = delete;
+        workspace_array& operator=(const workspace_array&) = delete;
+
+        bool valid() const
+        {
+            return valid_;
+        }
+
+        T* data() const
+        {
+            return ptr_;
+        }
+
+        T& operator[](int64_t i) const
+        {
+            return ptr_[i];
+        }
+
+    private:
+        handle_data* handle_;
+        T*           ptr_;
+        bool         valid_;
+    };
+
+    // Placeholder for routines that do not need a user buffer, such that callers that
+    // allocate the reported size do not end up with a null pointer
+    constexpr size_t min_buffer_size = 4;
+
+    // Matrix descriptor of the legacy API
+    struct mat_descr
+    {
+        hipsparseMatrixType_t    type           = HIPSPARSE_MATRIX_TYPE_GENERAL;
+        hipsparseFillMode_t      fill_mode      = HIPSPARSE_FILL_MODE_LOWER;
+        hipsparseDiagType_t      diag_type      = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+        hipsparseIndexBase_t     base           = HIPSPARSE_INDEX_BASE_ZERO;
+        hipsparseAnalysisCache_t analysis_cache = HIPSPARSE_ANALYSIS_CACHE_OFF;
+        int64_t                  generation     = 0;
+    };
+
+    // Common structure behind all info types of the legacy API. Info structures
+    // shared between csrilu02, csric02 and csrsv2 are destroyed by their last owner.
+    struct mat_info
+    {
+        int references = 1;
+    };
+
+    template <typename T>
+    hipsparseStatus_t create_info(T* info)
+    {
+        if(info == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *info = (T) new mat_info;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t destroy_info(void* info)
+    {
+        mat_info* data = (mat_info*)info;
+
+        if(data != nullptr && --data->references == 0)
+        {
+            delete data;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t share_info(void* source, csrsv2Info_t* info)
+    {
+        if(source == nullptr || info == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        ++((mat_info*)source)->references;
+        *info = (csrsv2Info_t)source;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    struct spvec_descr
+    {
+        int64_t              size;
+        int64_t              nnz;
+        void*                ind;
+        void*                val;
+        hipsparseIndexType_t idx_type;
+        hipsparseIndexBase_t idx_base;
+        hipDataType          data_type;
+    };
+
+    struct spmat_descr
+    {
+        hipsparseFormat_t format;
+
+        int64_t rows;
+        int64_t cols;
+        int64_t nnz;
+
+        // CSR row offsets or CSC column offsets
+        void* offsets;
+        // COO and CSC row indices, or the (row, column) pairs of COO AoS
+        void* row_ind;
+        // CSR and COO column indices, or the block column indices of Blocked ELL
+        void* col_ind;
+        void* values;
+
+        hipsparseIndexType_t offsets_type;
+        hipsparseIndexType_t ind_type;
+        hipsparseIndexBase_t idx_base;
+        hipDataType          data_type;
+
+        int64_t ell_block_dim;
+        int64_t ell_cols;
+
+        // The COO batch stride is kept as columns_values_batch_stride
+        int     batch_count                 = 1;
+        int64_t offsets_batch_stride        = 0;
+        int64_t columns_values_batch_stride = 0;
+
+        hipsparseFillMode_t fill_mode = HIPSPARSE_FILL_MODE_LOWER;
+        hipsparseDiagType_t diag_type = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+    };
+
+    struct dnvec_descr
+    {
+        int64_t     size;
+        void*       values;
+        hipDataType data_type;
+    };
+
+    struct dnmat_descr
+    {
+        int64_t          rows;
+        int64_t          cols;
+        int64_t          ld;
+        void*            values;
+        hipDataType      data_type;
+        hipsparseOrder_t order;
+
+        int     batch_count  = 1;
+        int64_t batch_stride = 0;
+    };
+
+    template <typename T>
+    struct type_tag
+    {
+        using type = T;
+    };
+
+    template <typename F>
+    hipsparseStatus_t dispatch_value(hipDataType type, F&& f)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return f(type_tag<float>{});
+        case HIP_R_64F:
+            return f(type_tag<double>{});
+        case HIP_C_32F:
+            return f(type_tag<std::complex<float>>{});
+        case HIP_C_64F:
+            return f(type_tag<std::complex<double>>{});
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    template <typename F>
+    hipsparseStatus_t dispatch_index(hipsparseIndexType_t type, F&& f)
+    {
+        switch(type)
+        {
+        case HIPSPARSE_INDEX_32I:
+            return f(type_tag<int32_t>{});
+        case HIPSPARSE_INDEX_64I:
+            return f(type_tag<int64_t>{});
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    size_t value_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return sizeof(float);
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return sizeof(double);
+        case HIP_C_64F:
+            return 2 * sizeof(double);
+        default:
+            return 0;
+        }
+    }
+
+    bool valid_index_base(hipsparseIndexBase_t base)
+    {
+        return base == HIPSPARSE_INDEX_BASE_ZERO || base == HIPSPARSE_INDEX_BASE_ONE;
+    }
+
+    bool valid_operation(hipsparseOperation_t op)
+    {
+        return op == HIPSPARSE_OPERATION_NON_TRANSPOSE || op == HIPSPARSE_OPERATION_TRANSPOSE
+               || op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE;
+    }
+
+    template <typename T>
+    T conj_value(const T& x)
+    {
+        return x;
+    }
+
+    template <typename T>
+    std::complex<T> conj_value(const std::complex<T>& x)
+    {
+        return std::conj(x);
+    }
+
+    template <typename T>
+    T op_value(const T& x, bool conj)
+    {
+        return conj ? conj_value(x) : x;
+    }
+
+    // Element (i, j) of op(A) for a dense matrix A
+    template <typename T>
+    struct dense_view
+    {
+        dense_view(const dnmat_descr* A, int64_t batch, hipsparseOperation_t op)
+            : val((T*)A->values + ((A->batch_count > 1) ? batch * A->batch_stride : 0))
+            , ld(A->ld)
+            , row_major(A->order == HIPSPARSE_ORDER_ROW)
+            , trans(op != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+            , conj(op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        {
+        }
+
+        T& at(int64_t i, int64_t j) const
+        {
+            int64_t r = trans ? j : i;
+            int64_t c = trans ? i : j;
+
+            return row_major ? val[r * ld + c] : val[r + c * ld];
+        }
+
+        T operator()(int64_t i, int64_t j) const
+        {
+            return op_value(at(i, j), conj);
+        }
+
+        T*      val;
+        int64_t ld;
+        bool    row_major;
+        bool    trans;
+        bool    conj;
+    };
+
+    using hipsparse::csr_view;
+
+    // Offset of batch b into the index and value arrays of a sparse matrix
+    int64_t offsets_offset(const spmat_descr* A, int64_t batch)
+    {
+        return (A->batch_count > 1) ? batch * A->offsets_batch_stride : 0;
+    }
+
+    int64_t entries_offset(const spmat_descr* A, int64_t batch)
+    {
+        return (A->batch_count > 1) ? batch * A->columns_values_batch_stride : 0;
+    }
+
+    void* batch_values(const spmat_descr* A, int64_t batch)
+    {
+        return (char*)A->values + value_size(A->data_type) * entries_offset(A, batch);
+    }
+
+    // Call f(row, col, pos) for all stored entries of A, with zero based indices.
+    // Entries are processed in parallel.
+    template <typename F>
+    hipsparseStatus_t for_each_entry(const spmat_descr* A, int64_t batch, F&& f)
+    {
+        int64_t base = A->idx_base;
+
+        switch(A->format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            bool    csc   = (A->format == HIPSPARSE_FORMAT_CSC);
+            int64_t outer = csc ? A->cols : A->rows;
+
+            return dispatch_index(A->offsets_type, [&](auto ptr_tag) {
+                using I = typename decltype(ptr_tag)::type;
+
+                return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                    using J = typename decltype(ind_tag)::type;
+
+                    const I* ptr = (const I*)A->offsets + offsets_offset(A, batch);
+                    const J* ind = (const J*)(csc ? A->row_ind : A->col_ind)
+                                   + entries_offset(A, batch);
+
+#pragma omp parallel for schedule(dynamic, 256)
+                    for(int64_t i = 0; i < outer; ++i)
+                    {
+                        for(int64_t k = ptr[i] - base; k < ptr[i + 1] - base; ++k)
+                        {
+                            int64_t j = ind[k] - base;
+
+                            csc ? f(j, i, k) : f(i, j, k);
+                        }
+                    }
+
+                    return HIPSPARSE_STATUS_SUCCESS;
+                });
+            });
+        }
+        case HIPSPARSE_FORMAT_COO:
+        case HIPSPARSE_FORMAT_COO_AOS:
+        {
+            bool aos = (A->format == HIPSPARSE_FORMAT_COO_AOS);
+
+            return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                using I = typename decltype(ind_tag)::type;
+
+                const I* row    = (const I*)A->row_ind + (aos ? 0 : entries_offset(A, batch));
+                const I* col    = aos ? row + 1 : (const I*)A->col_ind + entries_offset(A, batch);
+                int64_t  stride = aos ? 2 : 1;
+
+#pragma omp parallel for
+                for(int64_t k = 0; k < A->nnz; ++k)
+                {
+                    f(row[stride * k] - base, col[stride * k] - base, k);
+                }
+
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        }
+        case HIPSPARSE_FORMAT_BLOCKED_ELL:
+        {
+            return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                using I = typename decltype(ind_tag)::type;
+
+                const I* ell_ind = (const I*)A->col_ind;
+                int64_t  bdim    = A->ell_block_dim;
+                int64_t  mb      = (A->rows + bdim - 1) / bdim;
+                int64_t  width   = A->ell_cols / bdim;
+
+                // Blocks are stored column-major in the ELL structure of the block rows,
+                // entries of a block are stored column-major as well
+#pragma omp parallel for
+                for(int64_t i = 0; i < A->rows; ++i)
+                {
+                    int64_t bi = i / bdim;
+
+                    for(int64_t s = 0; s < width; ++s)
+                    {
+                        // Negative block column indices mark padding
+                        int64_t bcol = ell_ind[s * mb + bi] - base;
+                        if(bcol < 0)
+                        {
+                            continue;
+                        }
+
+                        for(int64_t c = 0; c < bdim && bcol * bdim + c < A->cols; ++c)
+                        {
+                            f(i, bcol * bdim + c, ((s * mb + bi) * bdim + c) * bdim + i % bdim);
+                        }
+                    }
+                }
+
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        }
+        }
+
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // Number of entries that for_each_entry() visits
+    int64_t entry_count(const spmat_descr* A)
+    {
+        if(A->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            int64_t bdim = A->ell_block_dim;
+
+            return (A->rows + bdim - 1) / bdim * bdim * A->ell_cols;
+        }
+
+        return A->nnz;
+    }
+
+    // Calls f(view) with a row compressed view of op(A). CSR and transposed CSC
+    // matrices are accessed directly, sorted COO matrices only require the row
+    // offsets. All other cases are compressed into temporary arrays.
+    template <typename F>
+    hipsparseStatus_t with_csr_view(
+        handle_data* handle, const spmat_descr* A, int64_t batch, bool trans, F&& f)
+    {
+        int64_t m    = trans ? A->cols : A->rows;
+        int64_t n    = trans ? A->rows : A->cols;
+        int64_t base = A->idx_base;
+        void*   val  = batch_values(A, batch);
+
+        if((A->format == HIPSPARSE_FORMAT_CSR && !trans)
+           || (A->format == HIPSPARSE_FORMAT_CSC && trans))
+        {
+            return dispatch_index(A->offsets_type, [&](auto ptr_tag) {
+                using I = typename decltype(ptr_tag)::type;
+
+                return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                    using J = typename decltype(ind_tag)::type;
+
+                    const void* ind = trans ? A->row_ind : A->col_ind;
+
+                    csr_view<I, J> view{m,
+                                        n,
+                                        (const I*)A->offsets + offsets_offset(A, batch),
+                                        (const J*)ind + entries_offset(A, batch),
+                                        nullptr,
+                                        base,
+                                        base,
+                                        val};
+
+                    f(view);
+
+                    return HIPSPARSE_STATUS_SUCCESS;
+                });
+            });
+        }
+
+        if(A->format == HIPSPARSE_FORMAT_COO && !trans)
+        {
+            return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                using I = typename decltype(ind_tag)::type;
+
+                const I* row = (const I*)A->row_ind + entries_offset(A, batch);
+                const I* col = (const I*)A->col_ind + entries_offset(A, batch);
+
+                workspace_array<int64_t> ptr(handle, m + 1);
+                if(!ptr.valid())
+                {
+                    return HIPSPARSE_STATUS_ALLOC_FAILED;
+                }
+
+                // Row indices are sorted
+#pragma omp parallel for
+                for(int64_t i = 0; i <= m; ++i)
+                {
+                    ptr[i] = std::lower_bound(row, row + A->nnz, i + base) - row;
+                }
+
+                csr_view<int64_t, I> view{m, n, ptr.data(), col, nullptr, 0, base, val};
+
+                f(view);
+
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        }
+
+        // Compress the entries of op(A) by rows, with a stable counting sort
+        int64_t count = entry_count(A);
+
+        workspace_array<int64_t> row(handle, count);
+        workspace_array<int64_t> col(handle, count);
+        workspace_array<int64_t> pos(handle, count);
+        workspace_array<int64_t> ptr(handle, m + 1);
+        workspace_array<int64_t> ind(handle, count);
+        workspace_array<int64_t> perm(handle, count);
+
+        if(!row.valid() || !col.valid() || !pos.valid() || !ptr.valid() || !ind.valid()
+           || !perm.valid())
+        {
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+
+        // Padding of Blocked ELL matrices is marked by negative rows
+        for(int64_t k = 0; k < count; ++k)
+        {
+            row[k] = -1;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(for_each_entry(A, batch, [&](int64_t i, int64_t j, int64_t k) {
+            row[k] = trans ? j : i;
+            col[k] = trans ? i : j;
+            pos[k] = k;
+        }));
+
+        for(int64_t i = 0; i <= m; ++i)
+        {
+            ptr[i] = 0;
+        }
+
+        for(int64_t k = 0; k < count; ++k)
+        {
+            if(row[k] >= 0)
+            {
+                ++ptr[row[k] + 1];
+            }
+        }
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            ptr[i + 1] += ptr[i];
+        }
+
+        for(int64_t k = 0; k < count; ++k)
+        {
+            if(row[k] >= 0)
+            {
+                int64_t idx = ptr[row[k]]++;
+
+                ind[idx]  = col[k];
+                perm[idx] = pos[k];
+            }
+        }
+
+        for(int64_t i = m; i > 0; --i)
+        {
+            ptr[i] = ptr[i - 1];
+        }
+
+        ptr[0] = 0;
+
+        csr_view<int64_t, int64_t> view{m, n, ptr.data(), ind.data(), perm.data(), 0, 0, val};
+
+        f(view);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // y = alpha * op(A) * x + beta * y
+    template <typename T, typename V>
+    void host_csrmv(const V& A, bool conj, T alpha, const T* x, T beta, T* y)
+    {
+        const T* val = (const T*)A.val;
+
+        if(conj)
+        {
+            hipsparse::host_csrmv_merge_path(
+                A, [&](int64_t k) { return conj_value(val[A.pos(k)]); }, alpha, x, beta, y);
+        }
+        else
+        {
+            hipsparse::host_csrmv_merge_path(
+                A, [&](int64_t k) { return val[A.pos(k)]; }, alpha, x, beta, y);
+        }
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C
+    template <typename T, typename V>
+    void host_csrmm(const V&             A,
+                    bool                 conj,
+                    T                    alpha,
+                    const dense_view<T>& B,
+                    T                    beta,
+                    const dense_view<T>& C,
+                    int64_t              n)
+    {
+        const T* val = (const T*)A.val;
+
+#pragma omp parallel for schedule(dynamic, 64)
+        for(int64_t i = 0; i < A.m; ++i)
+        {
+            for(int64_t j = 0; j < n; ++j)
+            {
+                T sum = static_cast<T>(0);
+
+                for(int64_t k = A.begin(i); k < A.end(i); ++k)
+                {
+                    sum += op_value(val[A.pos(k)], conj) * B(A.col(k), j);
+                }
+
+                T& c = C.at(i, j);
+                c    = (beta == static_cast<T>(0)) ? alpha * sum : alpha * sum + beta * c;
+            }
+        }
+    }
+
+    // View of a non-transposed, non-batched CSR matrix
+    template <typename I, typename J>
+    csr_view<I, J> spgemm_view(const spmat_descr* A)
+    {
+        return csr_view<I, J>{A->rows,
+                              A->cols,
+                              (const I*)A->offsets,
+                              (const J*)A->col_ind,
+                              nullptr,
+                              A->idx_base,
+                              A->idx_base,
+                              A->values};
+    }
+
+    // Number of non-zero entries per row, or per column if by_cols is set
+    template <typename T>
+    void dense_nnz(const dense_view<T>& A, int64_t m, int64_t n, bool by_cols, int64_t* nnz)
+    {
+        int64_t outer = by_cols ? n : m;
+        int64_t inner = by_cols ? m : n;
+
+#pragma omp parallel for
+        for(int64_t o = 0; o < outer; ++o)
+        {
+            int64_t count = 0;
+
+            for(int64_t i = 0; i < inner; ++i)
+            {
+                T a = by_cols ? A(i, o) : A(o, i);
+
+                count += (a != static_cast<T>(0)) ? 1 : 0;
+            }
+
+            nnz[o] = count;
+        }
+    }
+
+    // Write row offsets or indices with the index type and base of a matrix
+    hipsparseStatus_t store_indices(
+        hipsparseIndexType_t type, int64_t base, const int64_t* src, int64_t n, void* dst)
+    {
+        return dispatch_index(type, [&](auto tag) {
+            using I = typename decltype(tag)::type;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < n; ++i)
+            {
+                ((I*)dst)[i] = static_cast<I>(src[i] + base);
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+
+    bool is_zero(const void* scalar, hipDataType type)
+    {
+        bool zero = false;
+
+        dispatch_value(type, [&](auto tag) {
+            using T = typename decltype(tag)::type;
+
+            zero = (*(const T*)scalar == static_cast<T>(0));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+
+        return zero;
+    }
+
+    // The triangle of op(A) is the opposite one of A if A is transposed
+    bool lower_triangle(const spmat_descr* A, hipsparseOperation_t op)
+    {
+        bool trans = (op != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+        return (A->fill_mode == HIPSPARSE_FILL_MODE_LOWER) != trans;
+    }
+
+    // Level set analysis of the triangle of op(A)
+    hipsparseStatus_t csrsv_analysis(handle_data*           data,
+                                     const spmat_descr*     A,
+                                     hipsparseOperation_t   op,
+                                     hipsparse::csrsv_info& info)
+    {
+        bool trans = (op != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+        return with_csr_view(data, A, 0, trans, [&](const auto& view) {
+            hipsparse::host_csrsv_analysis(view, lower_triangle(A, op), info);
+        });
+    }
+
+    // Solve op(A) * Y = Y in place for nrhs columns of Y, where info holds the
+    // analysis of op(A)
+    template <typename T, typename Y>
+    hipsparseStatus_t csrsv_solve(handle_data*                 data,
+                                  const spmat_descr*           A,
+                                  hipsparseOperation_t         op,
+                                  const hipsparse::csrsv_info& info,
+                                  int64_t                      nrhs,
+                                  Y                            y)
+    {
+        bool trans = (op != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        bool conj  = (op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+        bool unit  = (A->diag_type == HIPSPARSE_DIAG_TYPE_UNIT);
+
+        return with_csr_view(data, A, 0, trans, [&](const auto& view) {
+            const T* val = (const T*)view.val;
+
+            hipsparse::host_csrsv_solve<T>(
+                info,
+                view,
+                [&](int64_t k) { return op_value(val[view.pos(k)], conj); },
+                unit,
+                nrhs,
+                y);
+        });
+    }
+
+    // Analysis held by a triangular solve descriptor if it matches op(A), otherwise a
+    // new analysis into local
+    template <typename D>
+    hipsparseStatus_t csrsv_lookup(handle_data*                  data,
+                                   const spmat_descr*            A,
+                                   hipsparseOperation_t          op,
+                                   const D*                      descr,
+                                   hipsparse::csrsv_info&        local,
+                                   const hipsparse::csrsv_info** info)
+    {
+        *info = &descr->info;
+
+        if(descr->analysed && descr->op == op && descr->info.m == A->rows
+           && descr->info.lower == lower_triangle(A, op))
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        *info = &local;
+
+        return csrsv_analysis(data, A, op, local);
+    }
+
+    // Value type of the host kernels for the value types of the legacy API
+    template <typename T>
+    struct host_value
+    {
+        using type = T;
+    };
+
+    template <>
+    struct host_value<hipComplex>
+    {
+        using type = std::complex<float>;
+    };
+
+    template <>
+    struct host_value<hipDoubleComplex>
+    {
+        using type = std::complex<double>;
+    };
+
+    bool valid_direction(hipsparseDirection_t dir)
+    {
+        return dir == HIPSPARSE_DIRECTION_ROW || dir == HIPSPARSE_DIRECTION_COLUMN;
+    }
+
+    // Arguments shared by bsrmv and bsrxmv
+    template <typename T>
+    hipsparseStatus_t bsrmv_check(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dir,
+                                  hipsparseOperation_t      trans,
+                                  int                       mb,
+                                  int                       nb,
+                                  int                       nnzb,
+                                  const T*                  alpha,
+                                  const hipsparseMatDescr_t descr,
+                                  const T*                  bsr_val,
+                                  const int*                bsr_row_ptr,
+                                  const int*                bsr_col_ind,
+                                  int                       block_dim,
+                                  const T*                  x,
+                                  const T*                  beta,
+                                  T*                        y)
+    {
+        if(handle == nullptr || descr == nullptr || !valid_direction(dir)
+           || !valid_operation(trans))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(mb < 0 || nb < 0 || nnzb < 0 || block_dim <= 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(trans != HIPSPARSE_OPERATION_NON_TRANSPOSE
+           || ((const mat_descr*)descr)->type != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(alpha == nullptr || beta == nullptr || bsr_row_ptr == nullptr || x == nullptr
+           || y == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnzb > 0 && (bsr_val == nullptr || bsr_col_ind == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // y = alpha * A * x + beta * y for the block rows of mask, or all block rows if mask
+    // is null
+    template <typename T>
+    hipsparseStatus_t bsrmv_compute(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dir,
+                                    int                       size_of_mask,
+                                    int                       mb,
+                                    const T*                  alpha,
+                                    const hipsparseMatDescr_t descr,
+                                    const T*                  bsr_val,
+                                    const int*                bsr_mask_ptr,
+                                    const int*                bsr_row_ptr,
+                                    const int*                bsr_end_ptr,
+                                    const int*                bsr_col_ind,
+                                    int                       block_dim,
+                                    const T*                  x,
+                                    const T*                  beta,
+                                    T*                        y)
+    {
+        using V = typename host_value<T>::type;
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        hipsparse::bsr_view<int, int> A = {mb,
+                                           block_dim,
+                                           dir == HIPSPARSE_DIRECTION_ROW,
+                                           bsr_row_ptr,
+                                           bsr_end_ptr,
+                                           bsr_col_ind,
+                                           ((const mat_descr*)descr)->base,
+                                           bsr_val};
+
+        hipsparse::host_bsrmv(
+            A, bsr_mask_ptr, size_of_mask, *(const V*)alpha, (const V*)x, *(const V*)beta, (V*)y);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t bsrmv_template(hipsparseHandle_t         handle,
+                                     hipsparseDirection_t      dir,
+                                     hipsparseOperation_t      trans,
+                                     int                       mb,
+                                     int                       nb,
+                                     int                       nnzb,
+                                     const T*                  alpha,
+                                     const hipsparseMatDescr_t descr,
+                                     const T*                  bsr_val,
+                                     const int*                bsr_row_ptr,
+                                     const int*                bsr_col_ind,
+                                     int                       block_dim,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y)
+    {
+        if(handle != nullptr && descr != nullptr && (mb == 0 || nb == 0) && mb >= 0 && nb >= 0
+           && nnzb >= 0 && block_dim > 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(bsrmv_check(handle,
+                                              dir,
+                                              trans,
+                                              mb,
+                                              nb,
+                                              nnzb,
+                                              alpha,
+                                              descr,
+                                              bsr_val,
+                                              bsr_row_ptr,
+                                              bsr_col_ind,
+                                              block_dim,
+                                              x,
+                                              beta,
+                                              y));
+
+        return bsrmv_compute(handle,
+                             dir,
+                             0,
+                             mb,
+                             alpha,
+                             descr,
+                             bsr_val,
+                             (const int*)nullptr,
+                             bsr_row_ptr,
+                             bsr_row_ptr + 1,
+                             bsr_col_ind,
+                             block_dim,
+                             x,
+                             beta,
+                             y);
+    }
+
+    template <typename T>
+    hipsparseStatus_t bsrxmv_template(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      hipsparseOperation_t      trans,
+                                      int                       size_of_mask,
+                                      int                       mb,
+                                      int                       nb,
+                                      int                       nnzb,
+                                      const T*                  alpha,
+                                      const hipsparseMatDescr_t descr,
+                                      const T*                  bsr_val,
+                                      const int*                bsr_mask_ptr,
+                                      const int*                bsr_row_ptr,
+                                      const int*                bsr_end_ptr,
+                                      const int*                bsr_col_ind,
+                                      int                       block_dim,
+                                      const T*                  x,
+                                      const T*                  beta,
+                                      T*                        y)
+    {
+        if(size_of_mask < 0 || size_of_mask > mb)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(handle != nullptr && descr != nullptr && (size_of_mask == 0 || nb == 0) && nb >= 0
+           && nnzb >= 0 && block_dim > 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(bsrmv_check(handle,
+                                              dir,
+                                              trans,
+                                              mb,
+                                              nb,
+                                              nnzb,
+                                              alpha,
+                                              descr,
+                                              bsr_val,
+                                              bsr_row_ptr,
+                                              bsr_col_ind,
+                                              block_dim,
+                                              x,
+                                              beta,
+                                              y));
+
+        if(bsr_mask_ptr == nullptr || bsr_end_ptr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return bsrmv_compute(handle,
+                             dir,
+                             size_of_mask,
+                             mb,
+                             alpha,
+                             descr,
+                             bsr_val,
+                             bsr_mask_ptr,
+                             bsr_row_ptr,
+                             bsr_end_ptr,
+                             bsr_col_ind,
+                             block_dim,
+                             x,
+                             beta,
+                             y);
+    }
+
+    // C = alpha * A * op(B) + beta * C with column major B and C
+    template <typename T>
+    hipsparseStatus_t bsrmm_template(hipsparseHandle_t         handle,
+                                     hipsparseDirection_t      dir,
+                                     hipsparseOperation_t      trans_A,
+                                     hipsparseOperation_t      trans_B,
+                                     int                       mb,
+                                     int                       n,
+                                     int                       kb,
+                                     int                       nnzb,
+                                     const T*                  alpha,
+                                     const hipsparseMatDescr_t descr,
+                                     const T*                  bsr_val,
+                                     const int*                bsr_row_ptr,
+                                     const int*                bsr_col_ind,
+                                     int                       block_dim,
+                                     const T*                  B,
+                                     int                       ldb,
+                                     const T*                  beta,
+                                     T*                        C,
+                                     int                       ldc)
+    {
+        using V = typename host_value<T>::type;
+
+        if(handle == nullptr || descr == nullptr || !valid_direction(dir)
+           || !valid_operation(trans_A) || !valid_operation(trans_B))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(mb < 0 || n < 0 || kb < 0 || nnzb < 0 || block_dim <= 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(trans_A != HIPSPARSE_OPERATION_NON_TRANSPOSE
+           || trans_B == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
+           || ((const mat_descr*)descr)->type != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(mb == 0 || n == 0 || kb == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(alpha == nullptr || beta == nullptr || bsr_row_ptr == nullptr || B == nullptr
+           || C == nullptr || (nnzb > 0 && (bsr_val == nullptr || bsr_col_ind == nullptr)))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        bool trans = (trans_B == HIPSPARSE_OPERATION_TRANSPOSE);
+
+        if(ldb < (trans ? n : kb * block_dim) || ldc < mb * block_dim)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        hipsparse::bsr_view<int, int> A = {mb,
+                                           block_dim,
+                                           dir == HIPSPARSE_DIRECTION_ROW,
+                                           bsr_row_ptr,
+                                           bsr_row_ptr + 1,
+                                           bsr_col_ind,
+                                           ((const mat_descr*)descr)->base,
+                                           bsr_val};
+
+        hipsparse::host_bsrmm(
+            A, n, *(const V*)alpha, (const V*)B, ldb, trans, *(const V*)beta, (V*)C, ldc);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Buffer sizes in bytes of the tridiagonal and pentadiagonal solvers
+    template <typename T>
+    size_t gtsv_buffer_size(int64_t values)
+    {
+        return std::max(min_buffer_size, sizeof(typename host_value<T>::type) * values);
+    }
+
+    bool valid_gtsv_algorithm(int algo)
+    {
+        // Default, Thomas, LU with partial pivoting and QR
+        return algo >= 0 && algo <= 3;
+    }
+
+    bool valid_gpsv_algorithm(int algo)
+    {
+        // Default and QR
+        return algo == 0 || algo == 1;
+    }
+
+    hipsparseStatus_t gtsv2_check(hipsparseHandle_t handle, int m, int n, int ldb)
+    {
+        if(handle == nullptr || m < 0 || n < 0 || ldb < std::max(1, m))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t gtsv2_buffer_size_template(hipsparseHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const T*          dl,
+                                                 const T*          d,
+                                                 const T*          du,
+                                                 const T*          B,
+                                                 int               ldb,
+                                                 size_t*           buffer_size)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(gtsv2_check(handle, m, n, ldb));
+
+        if(buffer_size == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *buffer_size = std::max(
+            min_buffer_size, hipsparse::host_gtsv_buffer_size<typename host_value<T>::type>(m));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // B = A^-1 * B, by LU factorization with partial pivoting
+    template <typename T>
+    hipsparseStatus_t gtsv2_template(hipsparseHandle_t handle,
+                                     int               m,
+                                     int               n,
+                                     const T*          dl,
+                                     const T*          d,
+                                     const T*          du,
+                                     T*                B,
+                                     int               ldb,
+                                     void*             buffer)
+    {
+        using V = typename host_value<T>::type;
+
+        RETURN_IF_HIPSPARSE_ERROR(gtsv2_check(handle, m, n, ldb));
+
+        if(m == 0 || n == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(dl == nullptr || d == nullptr || du == nullptr || B == nullptr || buffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        hipsparse::host_gtsv(m, n, (const V*)dl, (const V*)d, (const V*)du, (V*)B, ldb, buffer);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t gtsv2_nopivot_buffer_size_template(hipsparseHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         const T*          dl,
+                                                         const T*          d,
+                                                         const T*          du,
+                                                         const T*          B,
+                                                         int               ldb,
+                                                         size_t*           buffer_size)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(gtsv2_check(handle, m, n, ldb));
+
+        if(buffer_size == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *buffer_size = gtsv_buffer_size<T>(2 * int64_t(m));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // B = A^-1 * B, by the Thomas algorithm
+    template <typename T>
+    hipsparseStatus_t gtsv2_nopivot_template(hipsparseHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             const T*          dl,
+                                             const T*          d,
+                                             const T*          du,
+                                             T*                B,
+                                             int               ldb,
+                                             void*             buffer)
+    {
+        using V = typename host_value<T>::type;
+
+        RETURN_IF_HIPSPARSE_ERROR(gtsv2_check(handle, m, n, ldb));
+
+        if(m == 0 || n == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(dl == nullptr || d == nullptr || du == nullptr || B == nullptr || buffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        hipsparse::host_gtsv_nopivot(
+            m, n, (const V*)dl, (const V*)d, (const V*)du, (V*)B, ldb, (V*)buffer);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t gtsv2_strided_batch_buffer_size_template(hipsparseHandle_t handle,
+                                                               int               m,
+                                                               const T*          dl,
+                                                               const T*          d,
+                                                               const T*          du,
+                                                               const T*          x,
+                                                               int               batch_count,
+                                                               int               batch_stride,
+                                                               size_t*           buffer_size)
+    {
+        if(handle == nullptr || m < 0 || batch_count < 0 || batch_stride < m
+           || buffer_size == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *buffer_size = gtsv_buffer_size<T>(3 * int64_t(m) * batch_count);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Solve each system of a strided batch by cyclic reduction
+    template <typename T>
+    hipsparseStatus_t gtsv2_strided_batch_template(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   const T*          dl,
+                                                   const T*          d,
+                                                   const T*          du,
+                                                   T*                x,
+                                                   int               batch_count,
+                                                   int               batch_stride,
+                                                   void*             buffer)
+    {
+        using V = typename host_value<T>::type;
+
+        if(handle == nullptr || m < 0 || batch_count < 0 || batch_stride < m)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m == 0 || batch_count == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(dl == nullptr || d == nullptr || du == nullptr || x == nullptr || buffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        hipsparse::host_gtsv_strided_cr(m,
+                                        batch_count,
+                                        batch_stride,
+                                        (const V*)dl,
+                                        (const V*)d,
+                                        (const V*)du,
+                                        (V*)x,
+                                        (V*)buffer);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t gtsv_interleaved_batch_buffer_size_template(hipsparseHandle_t handle,
+                                                                  int               algo,
+                                                                  int               m,
+                                                                  const T*          dl,
+                                                                  const T*          d,
+                                                                  const T*          du,
+                                                                  const T*          x,
+                                                                  int               batch_count,
+                                                                  size_t*           buffer_size)
+    {
+        if(handle == nullptr || m < 0 || batch_count < 0 || !valid_gtsv_algorithm(algo)
+           || buffer_size == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The Thomas algorithm keeps one modified diagonal, QR the three diagonals of R
+        *buffer_size = gtsv_buffer_size<T>((algo == 1 ? 1 : 3) * int64_t(m) * batch_count);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Solve an interleaved batch of tridiagonal systems. Algorithm 1 is the Thomas
+    // algorithm, all others use QR factorization, which needs no pivoting to be stable.
+    template <typename T>
+    hipsparseStatus_t gtsv_interleaved_batch_template(hipsparseHandle_t handle,
+                                                      int               algo,
+                                                      int               m,
+                                                      T*                dl,
+                                                      T*                d,
+                                                      T*                du,
+                                                      T*                x,
+                                                      int               batch_count,
+                                                      void*             buffer)
+    {
+        using V = typename host_value<T>::type;
+
+        if(handle == nullptr || m < 0 || batch_count < 0 || !valid_gtsv_algorithm(algo))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m == 0 || batch_count == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(dl == nullptr || d == nullptr || du == nullptr || x == nullptr || buffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        if(algo == 1)
+        {
+            hipsparse::host_gtsv_interleaved_thomas(
+                m, batch_count, (const V*)dl, (const V*)d, (const V*)du, (V*)x, (V*)buffer);
+        }
+        else
+        {
+            hipsparse::host_gtsv_interleaved_qr(
+                m, batch_count, (const V*)dl, (const V*)d, (const V*)du, (V*)x, (V*)buffer);
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t gpsv_interleaved_batch_buffer_size_template(hipsparseHandle_t handle,
+                                                                  int               algo,
+                                                                  int               m,
+                                                                  const T*          ds,
+                                                                  const T*          dl,
+                                                                  const T*          d,
+                                                                  const T*          du,
+                                                                  const T*          dw,
+                                                                  const T*          x,
+                                                                  int               batch_count,
+                                                                  size_t*           buffer_size)
+    {
+        if(handle == nullptr || m < 0 || batch_count < 0 || !valid_gpsv_algorithm(algo)
+           || buffer_size == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *buffer_size = gtsv_buffer_size<T>(5 * int64_t(m) * batch_count);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Solve an interleaved batch of pentadiagonal systems by QR factorization
+    template <typename T>
+    hipsparseStatus_t gpsv_interleaved_batch_template(hipsparseHandle_t handle,
+                                                      int               algo,
+                                                      int               m,
+                                                      T*                ds,
+                                                      T*                dl,
+                                                      T*                d,
+                                                      T*                du,
+                                                      T*                dw,
+                                                      T*                x,
+                                                      int               batch_count,
+                                                      void*             buffer)
+    {
+        using V = typename host_value<T>::type;
+
+        if(handle == nullptr || m < 0 || batch_count < 0 || !valid_gpsv_algorithm(algo))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m == 0 || batch_count == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(ds == nullptr || dl == nullptr || d == nullptr || du == nullptr || dw == nullptr
+           || x == nullptr || buffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+        hipsparse::host_gpsv_interleaved_qr(m,
+                                            batch_count,
+                                            (const V*)ds,
+                                            (const V*)dl,
+                                            (const V*)d,
+                                            (const V*)du,
+                                            (const V*)dw,
+                                            (V*)x,
+                                            (V*)buffer);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+// SpGEMM descriptor, holding the product or its sparsity pattern with zero based
+// 64 bit indices
+struct hipsparseSpGEMMDescr
+{
+    bool                 computed = false;
+    int64_t              rows     = 0;
+    int64_t              nnz      = 0;
+    std::vector<int64_t> row_ptr;
+    std::vector<int64_t> col_ind;
+    std::vector<char>    values;
+
+    hipsparseScalarHint_t alphaHint = HIPSPARSE_SCALAR_HINT_UNKNOWN;
+    hipsparseScalarHint_t betaHint  = HIPSPARSE_SCALAR_HINT_UNKNOWN;
+};
+
+// Triangular solve descriptors, holding the level set analysis of op(A)
+struct hipsparseSpSVDescr
+{
+    bool                  analysed = false;
+    hipsparseOperation_t  op       = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparse::csrsv_info info;
+};
+
+struct hipsparseSpSMDescr
+{
+    bool                  analysed = false;
+    hipsparseOperation_t  op       = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparse::csrsv_info info;
+};
+
+struct csru2csrInfo
+{
+    hipsparseCsru2csrPermutation_t permutation = HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *handle = new handle_data;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(handle_data*)handle;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(rev == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    static constexpr char v[] = TO_STR(hipsparseVersionTweak);
+
+    sprintf(rev, "%s (host)", v);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((handle_data*)handle)->stream = streamId;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
+{
+    if(handle == nullptr || streamId == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *streamId = ((handle_data*)handle)->stream;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(mode != HIPSPARSE_POINTER_MODE_HOST && mode != HIPSPARSE_POINTER_MODE_DEVICE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Both modes read scalars directly, device memory is host accessible
+    ((handle_data*)handle)->pointer_mode = mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
+{
+    if(handle == nullptr || mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = ((handle_data*)handle)->pointer_mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetExecutionMode(hipsparseHandle_t handle, hipsparseExecutionMode_t mode)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode != HIPSPARSE_EXEC_BLOCKING && mode != HIPSPARSE_EXEC_ASYNC
+       && mode != HIPSPARSE_EXEC_CAPTURE_SAFE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Host execution cannot be captured into a graph
+    if(mode == HIPSPARSE_EXEC_CAPTURE_SAFE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    ((handle_data*)handle)->exec_mode = mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetExecutionMode(hipsparseHandle_t         handle,
+                                            hipsparseExecutionMode_t* mode)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = ((handle_data*)handle)->exec_mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetAnalysisPolicy(hipsparseHandle_t         handle,
+                                             hipsparseAnalysisPolicy_t policy)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(policy != HIPSPARSE_ANALYSIS_POLICY_FORCE && policy != HIPSPARSE_ANALYSIS_POLICY_REUSE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((handle_data*)handle)->analysis_policy = policy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetAnalysisPolicy(hipsparseHandle_t          handle,
+                                             hipsparseAnalysisPolicy_t* policy)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = ((handle_data*)handle)->analysis_policy;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetWorkspacePolicy(hipsparseHandle_t          handle,
+                                              hipsparseWorkspacePolicy_t policy)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    handle_data* data = (handle_data*)handle;
+
+    switch(policy)
+    {
+    case HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY:
+        data->workspace.set_policy(hipsparse::workspace_pool::grow_only);
+        break;
+    case HIPSPARSE_WORKSPACE_POLICY_TRIM:
+        data->workspace.set_policy(hipsparse::workspace_pool::trim_to_reserve);
+        break;
+    default:
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetWorkspacePolicy(hipsparseHandle_t           handle,
+                                              hipsparseWorkspacePolicy_t* policy)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(policy == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *policy = (((handle_data*)handle)->workspace.get_policy()
+               == hipsparse::workspace_pool::grow_only)
+                  ? HIPSPARSE_WORKSPACE_POLICY_GROW_ONLY
+                  : HIPSPARSE_WORKSPACE_POLICY_TRIM;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetWorkspaceSize(hipsparseHandle_t handle, size_t* size)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(size == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *size = ((handle_data*)handle)->workspace.allocated_bytes();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseReserveWorkspace(hipsparseHandle_t handle, size_t size)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    return ((handle_data*)handle)->workspace.reserve(size) ? HIPSPARSE_STATUS_SUCCESS
+                                                           : HIPSPARSE_STATUS_ALLOC_FAILED;
+}
+
+hipsparseStatus_t hipsparseReleaseWorkspace(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    // Routines return their temporary arrays before they return, no work in flight
+    // can refer to idle blocks
+    ((handle_data*)handle)->workspace.release_all();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descrA = new mat_descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
+{
+    delete(mat_descr*)descrA;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCopyMatDescr(hipsparseMatDescr_t dest, const hipsparseMatDescr_t src)
+{
+    if(dest == nullptr || src == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *(mat_descr*)dest = *(const mat_descr*)src;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetMatType(hipsparseMatDescr_t descrA, hipsparseMatrixType_t type)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(type != HIPSPARSE_MATRIX_TYPE_GENERAL && type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+       && type != HIPSPARSE_MATRIX_TYPE_HERMITIAN && type != HIPSPARSE_MATRIX_TYPE_TRIANGULAR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((mat_descr*)descrA)->type = type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
+{
+    return (descrA != nullptr) ? ((const mat_descr*)descrA)->type : HIPSPARSE_MATRIX_TYPE_GENERAL;
+}
+
+hipsparseStatus_t hipsparseSetMatFillMode(hipsparseMatDescr_t descrA, hipsparseFillMode_t fillMode)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(fillMode != HIPSPARSE_FILL_MODE_LOWER && fillMode != HIPSPARSE_FILL_MODE_UPPER)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((mat_descr*)descrA)->fill_mode = fillMode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
+{
+    return (descrA != nullptr) ? ((const mat_descr*)descrA)->fill_mode
+                               : HIPSPARSE_FILL_MODE_LOWER;
+}
+
+hipsparseStatus_t hipsparseSetMatDiagType(hipsparseMatDescr_t descrA, hipsparseDiagType_t diagType)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(diagType != HIPSPARSE_DIAG_TYPE_NON_UNIT && diagType != HIPSPARSE_DIAG_TYPE_UNIT)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((mat_descr*)descrA)->diag_type = diagType;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
+{
+    return (descrA != nullptr) ? ((const mat_descr*)descrA)->diag_type
+                               : HIPSPARSE_DIAG_TYPE_NON_UNIT;
+}
+
+hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparseIndexBase_t base)
+{
+    if(descrA == nullptr || !valid_index_base(base))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((mat_descr*)descrA)->base = base;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
+{
+    return (descrA != nullptr) ? ((const mat_descr*)descrA)->base : HIPSPARSE_INDEX_BASE_ZERO;
+}
+
+hipsparseStatus_t hipsparseSetMatAnalysisCache(hipsparseMatDescr_t      descrA,
+                                               hipsparseAnalysisCache_t cache)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(cache != HIPSPARSE_ANALYSIS_CACHE_OFF && cache != HIPSPARSE_ANALYSIS_CACHE_ON)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((mat_descr*)descrA)->analysis_cache = cache;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetMatAnalysisCache(const hipsparseMatDescr_t descrA,
+                                               hipsparseAnalysisCache_t* cache)
+{
+    if(descrA == nullptr || cache == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *cache = ((const mat_descr*)descrA)->analysis_cache;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetMatGeneration(hipsparseMatDescr_t descrA, int64_t generation)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((mat_descr*)descrA)->generation = generation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetMatGeneration(const hipsparseMatDescr_t descrA,
+                                            int64_t*                  generation)
+{
+    if(descrA == nullptr || generation == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *generation = ((const mat_descr*)descrA)->generation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseInvalidateMatAnalysis(hipsparseMatDescr_t descrA)
+{
+    if(descrA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // No analysis is attached to matrix descriptors by the host backend
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateHybMat(hipsparseHybMat_t* hybA)
+{
+    return create_info(hybA);
+}
+
+hipsparseStatus_t hipsparseDestroyHybMat(hipsparseHybMat_t hybA)
+{
+    return destroy_info(hybA);
+}
+
+hipsparseStatus_t hipsparseCreateBsrsv2Info(bsrsv2Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyBsrsv2Info(bsrsv2Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateBsrsm2Info(bsrsm2Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyBsrsm2Info(bsrsm2Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateBsrilu02Info(bsrilu02Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyBsrilu02Info(bsrilu02Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateBsric02Info(bsric02Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyBsric02Info(bsric02Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateCsrsv2Info(csrsv2Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyCsrsv2Info(csrsv2Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateCsrsm2Info(csrsm2Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyCsrsm2Info(csrsm2Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateCsrilu02Info(csrilu02Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyCsrilu02Info(csrilu02Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateCsric02Info(csric02Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyCsric02Info(csric02Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseShareCsrilu02Info(csrilu02Info_t source, csrsv2Info_t* info)
+{
+    return share_info(source, info);
+}
+
+hipsparseStatus_t hipsparseShareCsric02Info(csric02Info_t source, csrsv2Info_t* info)
+{
+    return share_info(source, info);
+}
+
+hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *info = new csru2csrInfo;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
+{
+    delete info;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSetCsru2csrInfoPermutation(csru2csrInfo_t                 info,
+                                                      hipsparseCsru2csrPermutation_t permutation)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(permutation != HIPSPARSE_CSRU2CSR_PERMUTATION_KEEP
+       && permutation != HIPSPARSE_CSRU2CSR_PERMUTATION_DISCARD)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    info->permutation = permutation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetCsru2csrInfoPermutation(csru2csrInfo_t                  info,
+                                                      hipsparseCsru2csrPermutation_t* permutation)
+{
+    if(info == nullptr || permutation == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *permutation = info->permutation;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateColorInfo(hipsparseColorInfo_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyColorInfo(hipsparseColorInfo_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreateCsrgemm2Info(csrgemm2Info_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyCsrgemm2Info(csrgemm2Info_t info)
+{
+    return destroy_info(info);
+}
+
+hipsparseStatus_t hipsparseCreatePruneInfo(pruneInfo_t* info)
+{
+    return create_info(info);
+}
+
+hipsparseStatus_t hipsparseDestroyPruneInfo(pruneInfo_t info)
+{
+    return destroy_info(info);
+}
+
+/*
+ * ===========================================================================
+ *    level 2 SPARSE
+ * ===========================================================================
+ */
+
+hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  int                       mb,
+                                  int                       nb,
+                                  int                       nnzb,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const float*              bsrSortedValA,
+                                  const int*                bsrSortedRowPtrA,
+                                  const int*                bsrSortedColIndA,
+                                  int                       blockDim,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y)
+{
+    return bsrmv_template(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+}
+
+hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  int                       mb,
+                                  int                       nb,
+                                  int                       nnzb,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const double*             bsrSortedValA,
+                                  const int*                bsrSortedRowPtrA,
+                                  const int*                bsrSortedColIndA,
+                                  int                       blockDim,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y)
+{
+    return bsrmv_template(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+}
+
+hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  int                       mb,
+                                  int                       nb,
+                                  int                       nnzb,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipComplex*         bsrSortedValA,
+                                  const int*                bsrSortedRowPtrA,
+                                  const int*                bsrSortedColIndA,
+                                  int                       blockDim,
+                                  const hipComplex*         x,
+                                  const hipComplex*         beta,
+                                  hipComplex*               y)
+{
+    return bsrmv_template(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+}
+
+hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  int                       mb,
+                                  int                       nb,
+                                  int                       nnzb,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipDoubleComplex*   bsrSortedValA,
+                                  const int*                bsrSortedRowPtrA,
+                                  const int*                bsrSortedColIndA,
+                                  int                       blockDim,
+                                  const hipDoubleComplex*   x,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         y)
+{
+    return bsrmv_template(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+}
+
+hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
+                                   hipsparseDirection_t      dir,
+                                   hipsparseOperation_t      trans,
+                                   int                       sizeOfMask,
+                                   int                       mb,
+                                   int                       nb,
+                                   int                       nnzb,
+                                   const float*              alpha,
+                                   const hipsparseMatDescr_t descr,
+                                   const float*              bsrVal,
+                                   const int*                bsrMaskPtr,
+                                   const int*                bsrRowPtr,
+                                   const int*                bsrEndPtr,
+                                   const int*                bsrColInd,
+                                   int                       blockDim,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y)
+{
+    return bsrxmv_template(handle,
+                           dir,
+                           trans,
+                           sizeOfMask,
+                           mb,
+                           nb,
+                           nnzb,
+                           alpha,
+                           descr,
+                           bsrVal,
+                           bsrMaskPtr,
+                           bsrRowPtr,
+                           bsrEndPtr,
+                           bsrColInd,
+                           blockDim,
+                           x,
+                           beta,
+                           y);
+}
+
+hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
+                                   hipsparseDirection_t      dir,
+                                   hipsparseOperation_t      trans,
+                                   int                       sizeOfMask,
+                                   int                       mb,
+                                   int                       nb,
+                                   int                       nnzb,
+                                   const double*             alpha,
+                                   const hipsparseMatDescr_t descr,
+                                   const double*             bsrVal,
+                                   const int*                bsrMaskPtr,
+                                   const int*                bsrRowPtr,
+                                   const int*                bsrEndPtr,
+                                   const int*                bsrColInd,
+                                   int                       blockDim,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y)
+{
+    return bsrxmv_template(handle,
+                           dir,
+                           trans,
+                           sizeOfMask,
+                           mb,
+                           nb,
+                           nnzb,
+                           alpha,
+                           descr,
+                           bsrVal,
+                           bsrMaskPtr,
+                           bsrRowPtr,
+                           bsrEndPtr,
+                           bsrColInd,
+                           blockDim,
+                           x,
+                           beta,
+                           y);
+}
+
+hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
+                                   hipsparseDirection_t      dir,
+                                   hipsparseOperation_t      trans,
+                                   int                       sizeOfMask,
+                                   int                       mb,
+                                   int                       nb,
+                                   int                       nnzb,
+                                   const hipComplex*         alpha,
+                                   const hipsparseMatDescr_t descr,
+                                   const hipComplex*         bsrVal,
+                                   const int*                bsrMaskPtr,
+                                   const int*                bsrRowPtr,
+                                   const int*                bsrEndPtr,
+                                   const int*                bsrColInd,
+                                   int                       blockDim,
+                                   const hipComplex*         x,
+                                   const hipComplex*         beta,
+                                   hipComplex*               y)
+{
+    return bsrxmv_template(handle,
+                           dir,
+                           trans,
+                           sizeOfMask,
+                           mb,
+                           nb,
+                           nnzb,
+                           alpha,
+                           descr,
+                           bsrVal,
+                           bsrMaskPtr,
+                           bsrRowPtr,
+                           bsrEndPtr,
+                           bsrColInd,
+                           blockDim,
+                           x,
+                           beta,
+                           y);
+}
+
+hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
+                                   hipsparseDirection_t      dir,
+                                   hipsparseOperation_t      trans,
+                                   int                       sizeOfMask,
+                                   int                       mb,
+                                   int                       nb,
+                                   int                       nnzb,
+                                   const hipDoubleComplex*   alpha,
+                                   const hipsparseMatDescr_t descr,
+                                   const hipDoubleComplex*   bsrVal,
+                                   const int*                bsrMaskPtr,
+                                   const int*                bsrRowPtr,
+                                   const int*                bsrEndPtr,
+                                   const int*                bsrColInd,
+                                   int                       blockDim,
+                                   const hipDoubleComplex*   x,
+                                   const hipDoubleComplex*   beta,
+                                   hipDoubleComplex*         y)
+{
+    return bsrxmv_template(handle,
+                           dir,
+                           trans,
+                           sizeOfMask,
+                           mb,
+                           nb,
+                           nnzb,
+                           alpha,
+                           descr,
+                           bsrVal,
+                           bsrMaskPtr,
+                           bsrRowPtr,
+                           bsrEndPtr,
+                           bsrColInd,
+                           blockDim,
+                           x,
+                           beta,
+                           y);
+}
+
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
+ */
+
+hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  hipsparseOperation_t      transB,
+                                  int                       mb,
+                                  int                       n,
+                                  int                       kb,
+                                  int                       nnzb,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const float*              bsrValA,
+                                  const int*                bsrRowPtrA,
+                                  const int*                bsrColIndA,
+                                  int                       blockDim,
+                                  const float*              B,
+                                  int                       ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  int                       ldc)
+{
+    return bsrmm_template(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+}
+
+hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  hipsparseOperation_t      transB,
+                                  int                       mb,
+                                  int                       n,
+                                  int                       kb,
+                                  int                       nnzb,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const double*             bsrValA,
+                                  const int*                bsrRowPtrA,
+                                  const int*                bsrColIndA,
+                                  int                       blockDim,
+                                  const double*             B,
+                                  int                       ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  int                       ldc)
+{
+    return bsrmm_template(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+}
+
+hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  hipsparseOperation_t      transB,
+                                  int                       mb,
+                                  int                       n,
+                                  int                       kb,
+                                  int                       nnzb,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipComplex*         bsrValA,
+                                  const int*                bsrRowPtrA,
+                                  const int*                bsrColIndA,
+                                  int                       blockDim,
+                                  const hipComplex*         B,
+                                  int                       ldb,
+                                  const hipComplex*         beta,
+                                  hipComplex*               C,
+                                  int                       ldc)
+{
+    return bsrmm_template(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+}
+
+hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
+                                  hipsparseDirection_t      dirA,
+                                  hipsparseOperation_t      transA,
+                                  hipsparseOperation_t      transB,
+                                  int                       mb,
+                                  int                       n,
+                                  int                       kb,
+                                  int                       nnzb,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipDoubleComplex*   bsrValA,
+                                  const int*                bsrRowPtrA,
+                                  const int*                bsrColIndA,
+                                  int                       blockDim,
+                                  const hipDoubleComplex*   B,
+                                  int                       ldb,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         C,
+                                  int                       ldc)
+{
+    return bsrmm_template(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+}
+
+/*
+ * ===========================================================================
+ *    preconditioners
+ * ===========================================================================
+ */
+
+hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const float*      dl,
+                                                const float*      d,
+                                                const float*      du,
+                                                const float*      B,
+                                                int               ldb,
+                                                size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_buffer_size_template(handle,
+                                      m,
+                                      n,
+                                      dl,
+                                      d,
+                                      du,
+                                      B,
+                                      ldb,
+                                      pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const double*     dl,
+                                                const double*     d,
+                                                const double*     du,
+                                                const double*     B,
+                                                int               db,
+                                                size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_buffer_size_template(handle,
+                                      m,
+                                      n,
+                                      dl,
+                                      d,
+                                      du,
+                                      B,
+                                      db,
+                                      pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const hipComplex* dl,
+                                                const hipComplex* d,
+                                                const hipComplex* du,
+                                                const hipComplex* B,
+                                                int               ldb,
+                                                size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_buffer_size_template(handle,
+                                      m,
+                                      n,
+                                      dl,
+                                      d,
+                                      du,
+                                      B,
+                                      ldb,
+                                      pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
+                                                int                     m,
+                                                int                     n,
+                                                const hipDoubleComplex* dl,
+                                                const hipDoubleComplex* d,
+                                                const hipDoubleComplex* du,
+                                                const hipDoubleComplex* B,
+                                                int                     ldb,
+                                                size_t*                 pBufferSizeInBytes)
+{
+    return gtsv2_buffer_size_template(handle,
+                                      m,
+                                      n,
+                                      dl,
+                                      d,
+                                      du,
+                                      B,
+                                      ldb,
+                                      pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  const float*      dl,
+                                  const float*      d,
+                                  const float*      du,
+                                  float*            B,
+                                  int               ldb,
+                                  void*             pBuffer)
+{
+    return gtsv2_template(handle,
+                          m,
+                          n,
+                          dl,
+                          d,
+                          du,
+                          B,
+                          ldb,
+                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  const double*     dl,
+                                  const double*     d,
+                                  const double*     du,
+                                  double*           B,
+                                  int               ldb,
+                                  void*             pBuffer)
+{
+    return gtsv2_template(handle,
+                          m,
+                          n,
+                          dl,
+                          d,
+                          du,
+                          B,
+                          ldb,
+                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  const hipComplex* dl,
+                                  const hipComplex* d,
+                                  const hipComplex* du,
+                                  hipComplex*       B,
+                                  int               ldb,
+                                  void*             pBuffer)
+{
+    return gtsv2_template(handle,
+                          m,
+                          n,
+                          dl,
+                          d,
+                          du,
+                          B,
+                          ldb,
+                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  const hipDoubleComplex* dl,
+                                  const hipDoubleComplex* d,
+                                  const hipDoubleComplex* du,
+                                  hipDoubleComplex*       B,
+                                  int                     ldb,
+                                  void*                   pBuffer)
+{
+    return gtsv2_template(handle,
+                          m,
+                          n,
+                          dl,
+                          d,
+                          du,
+                          B,
+                          ldb,
+                          pBuffer);
+}
+
+hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        const float*      dl,
+                                                        const float*      d,
+                                                        const float*      du,
+                                                        const float*      B,
+                                                        int               ldb,
+                                                        size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_nopivot_buffer_size_template(handle,
+                                              m,
+                                              n,
+                                              dl,
+                                              d,
+                                              du,
+                                              B,
+                                              ldb,
+                                              pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        const double*     dl,
+                                                        const double*     d,
+                                                        const double*     du,
+                                                        const double*     B,
+                                                        int               db,
+                                                        size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_nopivot_buffer_size_template(handle,
+                                              m,
+                                              n,
+                                              dl,
+                                              d,
+                                              du,
+                                              B,
+                                              db,
+                                              pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        const hipComplex* dl,
+                                                        const hipComplex* d,
+                                                        const hipComplex* du,
+                                                        const hipComplex* B,
+                                                        int               ldb,
+                                                        size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_nopivot_buffer_size_template(handle,
+                                              m,
+                                              n,
+                                              dl,
+                                              d,
+                                              du,
+                                              B,
+                                              ldb,
+                                              pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t       handle,
+                                                        int                     m,
+                                                        int                     n,
+                                                        const hipDoubleComplex* dl,
+                                                        const hipDoubleComplex* d,
+                                                        const hipDoubleComplex* du,
+                                                        const hipDoubleComplex* B,
+                                                        int                     ldb,
+                                                        size_t*                 pBufferSizeInBytes)
+{
+    return gtsv2_nopivot_buffer_size_template(handle,
+                                              m,
+                                              n,
+                                              dl,
+                                              d,
+                                              du,
+                                              B,
+                                              ldb,
+                                              pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const float*      dl,
+                                          const float*      d,
+                                          const float*      du,
+                                          float*            B,
+                                          int               ldb,
+                                          void*             pBuffer)
+{
+    return gtsv2_nopivot_template(handle,
+                                  m,
+                                  n,
+                                  dl,
+                                  d,
+                                  du,
+                                  B,
+                                  ldb,
+                                  pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const double*     dl,
+                                          const double*     d,
+                                          const double*     du,
+                                          double*           B,
+                                          int               ldb,
+                                          void*             pBuffer)
+{
+    return gtsv2_nopivot_template(handle,
+                                  m,
+                                  n,
+                                  dl,
+                                  d,
+                                  du,
+                                  B,
+                                  ldb,
+                                  pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const hipComplex* dl,
+                                          const hipComplex* d,
+                                          const hipComplex* du,
+                                          hipComplex*       B,
+                                          int               ldb,
+                                          void*             pBuffer)
+{
+    return gtsv2_nopivot_template(handle,
+                                  m,
+                                  n,
+                                  dl,
+                                  d,
+                                  du,
+                                  B,
+                                  ldb,
+                                  pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
+                                          int                     m,
+                                          int                     n,
+                                          const hipDoubleComplex* dl,
+                                          const hipDoubleComplex* d,
+                                          const hipDoubleComplex* du,
+                                          hipDoubleComplex*       B,
+                                          int                     ldb,
+                                          void*                   pBuffer)
+{
+    return gtsv2_nopivot_template(handle,
+                                  m,
+                                  n,
+                                  dl,
+                                  d,
+                                  du,
+                                  B,
+                                  ldb,
+                                  pBuffer);
+}
+
+hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                            int               m,
+                                                            const float*      dl,
+                                                            const float*      d,
+                                                            const float*      du,
+                                                            const float*      x,
+                                                            int               batchCount,
+                                                            int               batchStride,
+                                                            size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_strided_batch_buffer_size_template(handle,
+                                                    m,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    x,
+                                                    batchCount,
+                                                    batchStride,
+                                                    pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                            int               m,
+                                                            const double*     dl,
+                                                            const double*     d,
+                                                            const double*     du,
+                                                            const double*     x,
+                                                            int               batchCount,
+                                                            int               batchStride,
+                                                            size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_strided_batch_buffer_size_template(handle,
+                                                    m,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    x,
+                                                    batchCount,
+                                                    batchStride,
+                                                    pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                            int               m,
+                                                            const hipComplex* dl,
+                                                            const hipComplex* d,
+                                                            const hipComplex* du,
+                                                            const hipComplex* x,
+                                                            int               batchCount,
+                                                            int               batchStride,
+                                                            size_t*           pBufferSizeInBytes)
+{
+    return gtsv2_strided_batch_buffer_size_template(handle,
+                                                    m,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    x,
+                                                    batchCount,
+                                                    batchStride,
+                                                    pBufferSizeInBytes);
+}
+
+hipsparseStatus_t
+    hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t       handle,
+                                              int                     m,
+                                              const hipDoubleComplex* dl,
+                                              const hipDoubleComplex* d,
+                                              const hipDoubleComplex* du,
+                                              const hipDoubleComplex* x,
+                                              int                     batchCount,
+                                              int                     batchStride,
+                                              size_t*                 pBufferSizeInBytes)
+{
+    return gtsv2_strided_batch_buffer_size_template(handle,
+                                                    m,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    x,
+                                                    batchCount,
+                                                    batchStride,
+                                                    pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
+                                              int               m,
+                                              const float*      dl,
+                                              const float*      d,
+                                              const float*      du,
+                                              float*            x,
+                                              int               batchCount,
+                                              int               batchStride,
+                                              void*             pBuffer)
+{
+    return gtsv2_strided_batch_template(handle,
+                                        m,
+                                        dl,
+                                        d,
+                                        du,
+                                        x,
+                                        batchCount,
+                                        batchStride,
+                                        pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
+                                              int               m,
+                                              const double*     dl,
+                                              const double*     d,
+                                              const double*     du,
+                                              double*           x,
+                                              int               batchCount,
+                                              int               batchStride,
+                                              void*             pBuffer)
+{
+    return gtsv2_strided_batch_template(handle,
+                                        m,
+                                        dl,
+                                        d,
+                                        du,
+                                        x,
+                                        batchCount,
+                                        batchStride,
+                                        pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
+                                              int               m,
+                                              const hipComplex* dl,
+                                              const hipComplex* d,
+                                              const hipComplex* du,
+                                              hipComplex*       x,
+                                              int               batchCount,
+                                              int               batchStride,
+                                              void*             pBuffer)
+{
+    return gtsv2_strided_batch_template(handle,
+                                        m,
+                                        dl,
+                                        d,
+                                        du,
+                                        x,
+                                        batchCount,
+                                        batchStride,
+                                        pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
+                                              int                     m,
+                                              const hipDoubleComplex* dl,
+                                              const hipDoubleComplex* d,
+                                              const hipDoubleComplex* du,
+                                              hipDoubleComplex*       x,
+                                              int                     batchCount,
+                                              int                     batchStride,
+                                              void*                   pBuffer)
+{
+    return gtsv2_strided_batch_template(handle,
+                                        m,
+                                        dl,
+                                        d,
+                                        du,
+                                        x,
+                                        batchCount,
+                                        batchStride,
+                                        pBuffer);
+}
+
+hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                               int               algo,
+                                                               int               m,
+                                                               const float*      dl,
+                                                               const float*      d,
+                                                               const float*      du,
+                                                               const float*      x,
+                                                               int               batchCount,
+                                                               size_t*           pBufferSizeInBytes)
+{
+    return gtsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                               int               algo,
+                                                               int               m,
+                                                               const double*     dl,
+                                                               const double*     d,
+                                                               const double*     du,
+                                                               const double*     x,
+                                                               int               batchCount,
+                                                               size_t*           pBufferSizeInBytes)
+{
+    return gtsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                               int               algo,
+                                                               int               m,
+                                                               const hipComplex* dl,
+                                                               const hipComplex* d,
+                                                               const hipComplex* du,
+                                                               const hipComplex* x,
+                                                               int               batchCount,
+                                                               size_t*           pBufferSizeInBytes)
+{
+    return gtsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t
+    hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t       handle,
+                                                 int                     algo,
+                                                 int                     m,
+                                                 const hipDoubleComplex* dl,
+                                                 const hipDoubleComplex* d,
+                                                 const hipDoubleComplex* du,
+                                                 const hipDoubleComplex* x,
+                                                 int                     batchCount,
+                                                 size_t*                 pBufferSizeInBytes)
+{
+    return gtsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 float*            dl,
+                                                 float*            d,
+                                                 float*            du,
+                                                 float*            x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gtsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           dl,
+                                           d,
+                                           du,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 double*           dl,
+                                                 double*           d,
+                                                 double*           du,
+                                                 double*           x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gtsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           dl,
+                                           d,
+                                           du,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 hipComplex*       dl,
+                                                 hipComplex*       d,
+                                                 hipComplex*       du,
+                                                 hipComplex*       x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gtsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           dl,
+                                           d,
+                                           du,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 hipDoubleComplex* dl,
+                                                 hipDoubleComplex* d,
+                                                 hipDoubleComplex* du,
+                                                 hipDoubleComplex* x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gtsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           dl,
+                                           d,
+                                           du,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                               int               algo,
+                                                               int               m,
+                                                               const float*      ds,
+                                                               const float*      dl,
+                                                               const float*      d,
+                                                               const float*      du,
+                                                               const float*      dw,
+                                                               const float*      x,
+                                                               int               batchCount,
+                                                               size_t*           pBufferSizeInBytes)
+{
+    return gpsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       ds,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       dw,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                               int               algo,
+                                                               int               m,
+                                                               const double*     ds,
+                                                               const double*     dl,
+                                                               const double*     d,
+                                                               const double*     du,
+                                                               const double*     dw,
+                                                               const double*     x,
+                                                               int               batchCount,
+                                                               size_t*           pBufferSizeInBytes)
+{
+    return gpsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       ds,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       dw,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
+                                                               int               algo,
+                                                               int               m,
+                                                               const hipComplex* ds,
+                                                               const hipComplex* dl,
+                                                               const hipComplex* d,
+                                                               const hipComplex* du,
+                                                               const hipComplex* dw,
+                                                               const hipComplex* x,
+                                                               int               batchCount,
+                                                               size_t*           pBufferSizeInBytes)
+{
+    return gpsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       ds,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       dw,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t
+    hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t       handle,
+                                                 int                     algo,
+                                                 int                     m,
+                                                 const hipDoubleComplex* ds,
+                                                 const hipDoubleComplex* dl,
+                                                 const hipDoubleComplex* d,
+                                                 const hipDoubleComplex* du,
+                                                 const hipDoubleComplex* dw,
+                                                 const hipDoubleComplex* x,
+                                                 int                     batchCount,
+                                                 size_t*                 pBufferSizeInBytes)
+{
+    return gpsv_interleaved_batch_buffer_size_template(handle,
+                                                       algo,
+                                                       m,
+                                                       ds,
+                                                       dl,
+                                                       d,
+                                                       du,
+                                                       dw,
+                                                       x,
+                                                       batchCount,
+                                                       pBufferSizeInBytes);
+}
+
+hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 float*            ds,
+                                                 float*            dl,
+                                                 float*            d,
+                                                 float*            du,
+                                                 float*            dw,
+                                                 float*            x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gpsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           ds,
+                                           dl,
+                                           d,
+                                           du,
+                                           dw,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 double*           ds,
+                                                 double*           dl,
+                                                 double*           d,
+                                                 double*           du,
+                                                 double*           dw,
+                                                 double*           x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gpsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           ds,
+                                           dl,
+                                           d,
+                                           du,
+                                           dw,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 hipComplex*       ds,
+                                                 hipComplex*       dl,
+                                                 hipComplex*       d,
+                                                 hipComplex*       du,
+                                                 hipComplex*       dw,
+                                                 hipComplex*       x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gpsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           ds,
+                                           dl,
+                                           d,
+                                           du,
+                                           dw,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
+                                                 int               algo,
+                                                 int               m,
+                                                 hipDoubleComplex* ds,
+                                                 hipDoubleComplex* dl,
+                                                 hipDoubleComplex* d,
+                                                 hipDoubleComplex* du,
+                                                 hipDoubleComplex* dw,
+                                                 hipDoubleComplex* x,
+                                                 int               batchCount,
+                                                 void*             pBuffer)
+{
+    return gpsv_interleaved_batch_template(handle,
+                                           algo,
+                                           m,
+                                           ds,
+                                           dl,
+                                           d,
+                                           du,
+                                           dw,
+                                           x,
+                                           batchCount,
+                                           pBuffer);
+}
+
+/*
+ * ===========================================================================
+ *    generic SPARSE
+ * ===========================================================================
+ */
+
+hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
+                                       int64_t                size,
+                                       int64_t                nnz,
+                                       void*                  indices,
+                                       void*                  values,
+                                       hipsparseIndexType_t   idxType,
+                                       hipsparseIndexBase_t   idxBase,
+                                       hipDataType            valueType)
+{
+    if(spVecDescr == nullptr || size < 0 || nnz < 0 || nnz > size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(nnz > 0 && (indices == nullptr || values == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!valid_index_base(idxBase))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *spVecDescr = new spvec_descr{size, nnz, indices, values, idxType, idxBase, valueType};
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroySpVec(hipsparseSpVecDescr_t spVecDescr)
+{
+    if(spVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(spvec_descr*)spVecDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
+                                    int64_t*                    size,
+                                    int64_t*                    nnz,
+                                    void**                      indices,
+                                    void**                      values,
+                                    hipsparseIndexType_t*       idxType,
+                                    hipsparseIndexBase_t*       idxBase,
+                                    hipDataType*                valueType)
+{
+    if(spVecDescr == nullptr || size == nullptr || nnz == nullptr || indices == nullptr
+       || values == nullptr || idxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spvec_descr* x = (const spvec_descr*)spVecDescr;
+
+    *size      = x->size;
+    *nnz       = x->nnz;
+    *indices   = x->ind;
+    *values    = x->val;
+    *idxType   = x->idx_type;
+    *idxBase   = x->idx_base;
+    *valueType = x->data_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseSpVecDescr_t spVecDescr,
+                                             hipsparseIndexBase_t*       idxBase)
+{
+    if(spVecDescr == nullptr || idxBase == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *idxBase = ((const spvec_descr*)spVecDescr)->idx_base;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
+{
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const spvec_descr*)spVecDescr)->val;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
+{
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((spvec_descr*)spVecDescr)->val = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace
+{
+    hipsparseStatus_t create_spmat(hipsparseSpMatDescr_t* spMatDescr,
+                                   hipsparseFormat_t      format,
+                                   int64_t                rows,
+                                   int64_t                cols,
+                                   int64_t                nnz,
+                                   void*                  offsets,
+                                   void*                  row_ind,
+                                   void*                  col_ind,
+                                   void*                  values,
+                                   hipsparseIndexType_t   offsets_type,
+                                   hipsparseIndexType_t   ind_type,
+                                   hipsparseIndexBase_t   idx_base,
+                                   hipDataType            data_type)
+    {
+        if(spMatDescr == nullptr || rows < 0 || cols < 0 || nnz < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(!valid_index_base(idx_base))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        spmat_descr* A = new spmat_descr;
+
+        A->format       = format;
+        A->rows         = rows;
+        A->cols         = cols;
+        A->nnz          = nnz;
+        A->offsets      = offsets;
+        A->row_ind      = row_ind;
+        A->col_ind      = col_ind;
+        A->values       = values;
+        A->offsets_type = offsets_type;
+        A->ind_type     = ind_type;
+        A->idx_base     = idx_base;
+        A->data_type    = data_type;
+
+        A->ell_block_dim = 0;
+        A->ell_cols      = 0;
+
+        *spMatDescr = A;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cooRowInd,
+                                     void*                  cooColInd,
+                                     void*                  cooValues,
+                                     hipsparseIndexType_t   cooIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    if(nnz > 0 && (cooRowInd == nullptr || cooColInd == nullptr || cooValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return create_spmat(spMatDescr,
+                        HIPSPARSE_FORMAT_COO,
+                        rows,
+                        cols,
+                        nnz,
+                        nullptr,
+                        cooRowInd,
+                        cooColInd,
+                        cooValues,
+                        cooIdxType,
+                        cooIdxType,
+                        idxBase,
+                        valueType);
+}
+
+hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
+                                        int64_t                rows,
+                                        int64_t                cols,
+                                        int64_t                nnz,
+                                        void*                  cooInd,
+                                        void*                  cooValues,
+                                        hipsparseIndexType_t   cooIdxType,
+                                        hipsparseIndexBase_t   idxBase,
+                                        hipDataType            valueType)
+{
+    if(nnz > 0 && (cooInd == nullptr || cooValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return create_spmat(spMatDescr,
+                        HIPSPARSE_FORMAT_COO_AOS,
+                        rows,
+                        cols,
+                        nnz,
+                        nullptr,
+                        cooInd,
+                        nullptr,
+                        cooValues,
+                        cooIdxType,
+                        cooIdxType,
+                        idxBase,
+                        valueType);
+}
+
+hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  csrRowOffsets,
+                                     void*                  csrColInd,
+                                     void*                  csrValues,
+                                     hipsparseIndexType_t   csrRowOffsetsType,
+                                     hipsparseIndexType_t   csrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    // Row offsets may be set later, e.g. for the output of SpGEMM
+    if(nnz > 0 && (csrColInd == nullptr || csrValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(csrRowOffsets == nullptr && (csrColInd != nullptr || csrValues != nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return create_spmat(spMatDescr,
+                        HIPSPARSE_FORMAT_CSR,
+                        rows,
+                        cols,
+                        nnz,
+                        csrRowOffsets,
+                        nullptr,
+                        csrColInd,
+                        csrValues,
+                        csrRowOffsetsType,
+                        csrColIndType,
+                        idxBase,
+                        valueType);
+}
+
+hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cscColOffsets,
+                                     void*                  cscRowInd,
+                                     void*                  cscValues,
+                                     hipsparseIndexType_t   cscColOffsetsType,
+                                     hipsparseIndexType_t   cscRowIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    if(nnz > 0 && (cscRowInd == nullptr || cscValues == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(cscColOffsets == nullptr && (cscRowInd != nullptr || cscValues != nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return create_spmat(spMatDescr,
+                        HIPSPARSE_FORMAT_CSC,
+                        rows,
+                        cols,
+                        nnz,
+                        cscColOffsets,
+                        cscRowInd,
+                        nullptr,
+                        cscValues,
+                        cscColOffsetsType,
+                        cscRowIndType,
+                        idxBase,
+                        valueType);
+}
+
+hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                            int64_t                rows,
+                                            int64_t                cols,
+                                            int64_t                ellBlockSize,
+                                            int64_t                ellCols,
+                                            void*                  ellColInd,
+                                            void*                  ellValue,
+                                            hipsparseIndexType_t   ellIdxType,
+                                            hipsparseIndexBase_t   idxBase,
+                                            hipDataType            valueType)
+{
+    if(ellBlockSize <= 0 || ellCols < 0 || ellCols % ellBlockSize != 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(ellCols > 0 && (ellColInd == nullptr || ellValue == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(create_spmat(spMatDescr,
+                                           HIPSPARSE_FORMAT_BLOCKED_ELL,
+                                           rows,
+                                           cols,
+                                           rows * ellCols,
+                                           nullptr,
+                                           nullptr,
+                                           ellColInd,
+                                           ellValue,
+                                           ellIdxType,
+                                           ellIdxType,
+                                           idxBase,
+                                           valueType));
+
+    spmat_descr* A = (spmat_descr*)*spMatDescr;
+
+    A->ell_block_dim = ellBlockSize;
+    A->ell_cols      = ellCols;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroySpMat(hipsparseSpMatDescr_t spMatDescr)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(spmat_descr*)spMatDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      cooRowInd,
+                                  void**                      cooColInd,
+                                  void**                      cooValues,
+                                  hipsparseIndexType_t*       idxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || cooRowInd == nullptr || cooColInd == nullptr || cooValues == nullptr
+       || idxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_COO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows      = A->rows;
+    *cols      = A->cols;
+    *nnz       = A->nnz;
+    *cooRowInd = A->row_ind;
+    *cooColInd = A->col_ind;
+    *cooValues = A->values;
+    *idxType   = A->ind_type;
+    *idxBase   = A->idx_base;
+    *valueType = A->data_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
+                                     int64_t*                    rows,
+                                     int64_t*                    cols,
+                                     int64_t*                    nnz,
+                                     void**                      cooInd,
+                                     void**                      cooValues,
+                                     hipsparseIndexType_t*       idxType,
+                                     hipsparseIndexBase_t*       idxBase,
+                                     hipDataType*                valueType)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || cooInd == nullptr || cooValues == nullptr || idxType == nullptr || idxBase == nullptr
+       || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_COO_AOS)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows      = A->rows;
+    *cols      = A->cols;
+    *nnz       = A->nnz;
+    *cooInd    = A->row_ind;
+    *cooValues = A->values;
+    *idxType   = A->ind_type;
+    *idxBase   = A->idx_base;
+    *valueType = A->data_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      csrRowOffsets,
+                                  void**                      csrColInd,
+                                  void**                      csrValues,
+                                  hipsparseIndexType_t*       csrRowOffsetsType,
+                                  hipsparseIndexType_t*       csrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || csrRowOffsets == nullptr || csrColInd == nullptr || csrValues == nullptr
+       || csrRowOffsetsType == nullptr || csrColIndType == nullptr || idxBase == nullptr
+       || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows              = A->rows;
+    *cols              = A->cols;
+    *nnz               = A->nnz;
+    *csrRowOffsets     = A->offsets;
+    *csrColInd         = A->col_ind;
+    *csrValues         = A->values;
+    *csrRowOffsetsType = A->offsets_type;
+    *csrColIndType     = A->ind_type;
+    *idxBase           = A->idx_base;
+    *valueType         = A->data_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                         int64_t*                    rows,
+                                         int64_t*                    cols,
+                                         int64_t*                    ellBlockSize,
+                                         int64_t*                    ellCols,
+                                         void**                      ellColInd,
+                                         void**                      ellValue,
+                                         hipsparseIndexType_t*       ellIdxType,
+                                         hipsparseIndexBase_t*       idxBase,
+                                         hipDataType*                valueType)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || ellBlockSize == nullptr
+       || ellCols == nullptr || ellColInd == nullptr || ellValue == nullptr
+       || ellIdxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_BLOCKED_ELL)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows         = A->rows;
+    *cols         = A->cols;
+    *ellBlockSize = A->ell_block_dim;
+    *ellCols      = A->ell_cols;
+    *ellColInd    = A->col_ind;
+    *ellValue     = A->values;
+    *ellIdxType   = A->ind_type;
+    *idxBase      = A->idx_base;
+    *valueType    = A->data_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 csrRowOffsets,
+                                          void*                 csrColInd,
+                                          void*                 csrValues)
+{
+    if(spMatDescr == nullptr || csrRowOffsets == nullptr || csrColInd == nullptr
+       || csrValues == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spmat_descr* A = (spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    A->offsets = csrRowOffsets;
+    A->col_ind = csrColInd;
+    A->values  = csrValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 cscColOffsets,
+                                          void*                 cscRowInd,
+                                          void*                 cscValues)
+{
+    if(spMatDescr == nullptr || cscColOffsets == nullptr || cscRowInd == nullptr
+       || cscValues == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spmat_descr* A = (spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_CSC)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    A->offsets = cscColOffsets;
+    A->row_ind = cscRowInd;
+    A->values  = cscValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 cooRowInd,
+                                          void*                 cooColInd,
+                                          void*                 cooValues)
+{
+    if(spMatDescr == nullptr || cooRowInd == nullptr || cooColInd == nullptr
+       || cooValues == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spmat_descr* A = (spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_COO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    A->row_ind = cooRowInd;
+    A->col_ind = cooColInd;
+    A->values  = cooValues;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetSize(hipsparseSpMatDescr_t spMatDescr,
+                                        int64_t*              rows,
+                                        int64_t*              cols,
+                                        int64_t*              nnz)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)spMatDescr;
+
+    *rows = A->rows;
+    *cols = A->cols;
+    *nnz  = A->nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetFormat(const hipsparseSpMatDescr_t spMatDescr,
+                                          hipsparseFormat_t*          format)
+{
+    if(spMatDescr == nullptr || format == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *format = ((const spmat_descr*)spMatDescr)->format;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetIndexBase(const hipsparseSpMatDescr_t spMatDescr,
+                                             hipsparseIndexBase_t*       idxBase)
+{
+    if(spMatDescr == nullptr || idxBase == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *idxBase = ((const spmat_descr*)spMatDescr)->idx_base;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
+{
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const spmat_descr*)spMatDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
+{
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((spmat_descr*)spMatDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int* batchCount)
+{
+    if(spMatDescr == nullptr || batchCount == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *batchCount = ((const spmat_descr*)spMatDescr)->batch_count;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
+{
+    if(spMatDescr == nullptr || batchCount <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((spmat_descr*)spMatDescr)->batch_count = batchCount;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               batchStride)
+{
+    if(spMatDescr == nullptr || batchCount <= 0 || batchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spmat_descr* A = (spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_COO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    A->batch_count                 = batchCount;
+    A->columns_values_batch_stride = batchStride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               offsetsBatchStride,
+                                              int64_t               columnsValuesBatchStride)
+{
+    if(spMatDescr == nullptr || batchCount <= 0 || offsetsBatchStride < 0
+       || columnsValuesBatchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spmat_descr* A = (spmat_descr*)spMatDescr;
+
+    if(A->format != HIPSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    A->batch_count                 = batchCount;
+    A->offsets_batch_stride        = offsetsBatchStride;
+    A->columns_values_batch_stride = columnsValuesBatchStride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t     spMatDescr,
+                                             hipsparseSpMatAttribute_t attribute,
+                                             void*                     data,
+                                             size_t                    dataSize)
+{
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)spMatDescr;
+
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+        if(dataSize != sizeof(hipsparseFillMode_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *(hipsparseFillMode_t*)data = A->fill_mode;
+        return HIPSPARSE_STATUS_SUCCESS;
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+        if(dataSize != sizeof(hipsparseDiagType_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *(hipsparseDiagType_t*)data = A->diag_type;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return HIPSPARSE_STATUS_INVALID_VALUE;
+}
+
+hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
+                                             hipsparseSpMatAttribute_t attribute,
+                                             const void*               data,
+                                             size_t                    dataSize)
+{
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spmat_descr* A = (spmat_descr*)spMatDescr;
+
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+    {
+        if(dataSize != sizeof(hipsparseFillMode_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipsparseFillMode_t fill_mode = *(const hipsparseFillMode_t*)data;
+        if(fill_mode != HIPSPARSE_FILL_MODE_LOWER && fill_mode != HIPSPARSE_FILL_MODE_UPPER)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        A->fill_mode = fill_mode;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+    {
+        if(dataSize != sizeof(hipsparseDiagType_t))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipsparseDiagType_t diag_type = *(const hipsparseDiagType_t*)data;
+        if(diag_type != HIPSPARSE_DIAG_TYPE_NON_UNIT && diag_type != HIPSPARSE_DIAG_TYPE_UNIT)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        A->diag_type = diag_type;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    }
+
+    return HIPSPARSE_STATUS_INVALID_VALUE;
+}
+
+hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
+                                       int64_t                size,
+                                       void*                  values,
+                                       hipDataType            valueType)
+{
+    if(dnVecDescr == nullptr || size < 0 || (size > 0 && values == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *dnVecDescr = new dnvec_descr{size, values, valueType};
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyDnVec(hipsparseDnVecDescr_t dnVecDescr)
+{
+    if(dnVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(dnvec_descr*)dnVecDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
+                                    int64_t*                    size,
+                                    void**                      values,
+                                    hipDataType*                valueType)
+{
+    if(dnVecDescr == nullptr || size == nullptr || values == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const dnvec_descr* x = (const dnvec_descr*)dnVecDescr;
+
+    *size      = x->size;
+    *values    = x->values;
+    *valueType = x->data_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
+{
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const dnvec_descr*)dnVecDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
+{
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((dnvec_descr*)dnVecDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
+                                       int64_t                rows,
+                                       int64_t                cols,
+                                       int64_t                ld,
+                                       void*                  values,
+                                       hipDataType            valueType,
+                                       hipsparseOrder_t       order)
+{
+    if(dnMatDescr == nullptr || rows < 0 || cols < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(order != HIPSPARSE_ORDER_ROW && order != HIPSPARSE_ORDER_COLUMN)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(ld < ((order == HIPSPARSE_ORDER_COLUMN) ? rows : cols))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(rows > 0 && cols > 0 && values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    dnmat_descr* A = new dnmat_descr;
+
+    A->rows      = rows;
+    A->cols      = cols;
+    A->ld        = ld;
+    A->values    = values;
+    A->data_type = valueType;
+    A->order     = order;
+
+    *dnMatDescr = A;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyDnMat(hipsparseDnMatDescr_t dnMatDescr)
+{
+    if(dnMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete(dnmat_descr*)dnMatDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
+                                    int64_t*                    rows,
+                                    int64_t*                    cols,
+                                    int64_t*                    ld,
+                                    void**                      values,
+                                    hipDataType*                valueType,
+                                    hipsparseOrder_t*           order)
+{
+    if(dnMatDescr == nullptr || rows == nullptr || cols == nullptr || ld == nullptr
+       || values == nullptr || valueType == nullptr || order == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const dnmat_descr* A = (const dnmat_descr*)dnMatDescr;
+
+    *rows      = A->rows;
+    *cols      = A->cols;
+    *ld        = A->ld;
+    *values    = A->values;
+    *valueType = A->data_type;
+    *order     = A->order;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
+{
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *values = ((const dnmat_descr*)dnMatDescr)->values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
+{
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    ((dnmat_descr*)dnMatDescr)->values = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
+                                                int*                  batchCount,
+                                                int64_t*              batchStride)
+{
+    if(dnMatDescr == nullptr || batchCount == nullptr || batchStride == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const dnmat_descr* A = (const dnmat_descr*)dnMatDescr;
+
+    *batchCount  = A->batch_count;
+    *batchStride = A->batch_stride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
+                                                int                   batchCount,
+                                                int64_t               batchStride)
+{
+    if(dnMatDescr == nullptr || batchCount <= 0 || batchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    dnmat_descr* A = (dnmat_descr*)dnMatDescr;
+
+    A->batch_count  = batchCount;
+    A->batch_stride = batchStride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t     handle,
+                                 const void*           alpha,
+                                 hipsparseSpVecDescr_t vecX,
+                                 const void*           beta,
+                                 hipsparseDnVecDescr_t vecY)
+{
+    if(handle == nullptr || alpha == nullptr || vecX == nullptr || beta == nullptr
+       || vecY == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spvec_descr* x = (const spvec_descr*)vecX;
+    const dnvec_descr* y = (const dnvec_descr*)vecY;
+
+    if(x->data_type != y->data_type || x->size != y->size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(x->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        return dispatch_index(x->idx_type, [&](auto ind_tag) {
+            using I = typename decltype(ind_tag)::type;
+
+            T        a    = *(const T*)alpha;
+            T        b    = *(const T*)beta;
+            const I* ind  = (const I*)x->ind;
+            const T* xval = (const T*)x->val;
+            T*       yval = (T*)y->values;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < y->size; ++i)
+            {
+                yval[i] = (b == static_cast<T>(0)) ? static_cast<T>(0) : b * yval[i];
+            }
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < x->nnz; ++i)
+            {
+                yval[ind[i] - x->idx_base] += a * xval[i];
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseGather(hipsparseHandle_t     handle,
+                                  hipsparseDnVecDescr_t vecY,
+                                  hipsparseSpVecDescr_t vecX)
+{
+    if(handle == nullptr || vecY == nullptr || vecX == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spvec_descr* x = (const spvec_descr*)vecX;
+    const dnvec_descr* y = (const dnvec_descr*)vecY;
+
+    if(x->data_type != y->data_type)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(x->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        return dispatch_index(x->idx_type, [&](auto ind_tag) {
+            using I = typename decltype(ind_tag)::type;
+
+            const I* ind  = (const I*)x->ind;
+            T*       xval = (T*)x->val;
+            const T* yval = (const T*)y->values;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < x->nnz; ++i)
+            {
+                xval[i] = yval[ind[i] - x->idx_base];
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseScatter(hipsparseHandle_t     handle,
+                                   hipsparseSpVecDescr_t vecX,
+                                   hipsparseDnVecDescr_t vecY)
+{
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spvec_descr* x = (const spvec_descr*)vecX;
+    const dnvec_descr* y = (const dnvec_descr*)vecY;
+
+    if(x->data_type != y->data_type)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(x->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        return dispatch_index(x->idx_type, [&](auto ind_tag) {
+            using I = typename decltype(ind_tag)::type;
+
+            const I* ind  = (const I*)x->ind;
+            const T* xval = (const T*)x->val;
+            T*       yval = (T*)y->values;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < x->nnz; ++i)
+            {
+                yval[ind[i] - x->idx_base] = xval[i];
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
+                               const void*           c_coeff,
+                               const void*           s_coeff,
+                               hipsparseSpVecDescr_t vecX,
+                               hipsparseDnVecDescr_t vecY)
+{
+    if(handle == nullptr || c_coeff == nullptr || s_coeff == nullptr || vecX == nullptr
+       || vecY == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spvec_descr* x = (const spvec_descr*)vecX;
+    const dnvec_descr* y = (const dnvec_descr*)vecY;
+
+    if(x->data_type != y->data_type)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(x->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        return dispatch_index(x->idx_type, [&](auto ind_tag) {
+            using I = typename decltype(ind_tag)::type;
+
+            T        c    = *(const T*)c_coeff;
+            T        s    = *(const T*)s_coeff;
+            const I* ind  = (const I*)x->ind;
+            T*       xval = (T*)x->val;
+            T*       yval = (T*)y->values;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < x->nnz; ++i)
+            {
+                int64_t idx = ind[i] - x->idx_base;
+                T       xi  = xval[i];
+                T       yi  = yval[idx];
+
+                xval[i]   = c * xi + s * yi;
+                yval[idx] = c * yi - s * xi;
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseSpMatDescr_t       matA,
+                                                    hipsparseDnMatDescr_t       matB,
+                                                    hipsparseSparseToDenseAlg_t alg,
+                                                    size_t*                     bufferSize)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
+                                         hipsparseSpMatDescr_t       matA,
+                                         hipsparseDnMatDescr_t       matB,
+                                         hipsparseSparseToDenseAlg_t alg,
+                                         void*                       externalBuffer)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)matA;
+    const dnmat_descr* B = (const dnmat_descr*)matB;
+
+    if(A->rows != B->rows || A->cols != B->cols || A->data_type != B->data_type)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(A->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        dense_view<T> dense(B, 0, HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        const T*      val = (const T*)A->values;
+
+#pragma omp parallel for
+        for(int64_t j = 0; j < B->cols; ++j)
+        {
+            for(int64_t i = 0; i < B->rows; ++i)
+            {
+                dense.at(i, j) = static_cast<T>(0);
+            }
+        }
+
+        return for_each_entry(
+            A, 0, [&](int64_t i, int64_t j, int64_t k) { dense.at(i, j) = val[k]; });
+    });
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseDnMatDescr_t       matA,
+                                                    hipsparseSpMatDescr_t       matB,
+                                                    hipsparseDenseToSparseAlg_t alg,
+                                                    size_t*                     bufferSize)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           handle,
+                                                  hipsparseDnMatDescr_t       matA,
+                                                  hipsparseSpMatDescr_t       matB,
+                                                  hipsparseDenseToSparseAlg_t alg,
+                                                  void*                       externalBuffer)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    handle_data*       data = (handle_data*)handle;
+    const dnmat_descr* A    = (const dnmat_descr*)matA;
+    spmat_descr*       B    = (spmat_descr*)matB;
+
+    if(A->rows != B->rows || A->cols != B->cols || A->data_type != B->data_type)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(B->format != HIPSPARSE_FORMAT_CSR && B->format != HIPSPARSE_FORMAT_CSC
+       && B->format != HIPSPARSE_FORMAT_COO)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    bool csc = (B->format == HIPSPARSE_FORMAT_CSC);
+
+    // Compressed formats receive their offsets here
+    if(B->format != HIPSPARSE_FORMAT_COO && B->offsets == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    return dispatch_value(A->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        int64_t outer = csc ? A->cols : A->rows;
+
+        workspace_array<int64_t> ptr(data, outer + 1);
+        if(!ptr.valid())
+        {
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+
+        dense_nnz(dense_view<T>(A, 0, HIPSPARSE_OPERATION_NON_TRANSPOSE),
+                  A->rows,
+                  A->cols,
+                  csc,
+                  ptr.data() + 1);
+
+        ptr[0] = 0;
+        for(int64_t i = 0; i < outer; ++i)
+        {
+            ptr[i + 1] += ptr[i];
+        }
+
+        B->nnz = ptr[outer];
+
+        if(B->format == HIPSPARSE_FORMAT_COO)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        return store_indices(B->offsets_type, B->idx_base, ptr.data(), outer + 1, B->offsets);
+    });
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           handle,
+                                                 hipsparseDnMatDescr_t       matA,
+                                                 hipsparseSpMatDescr_t       matB,
+                                                 hipsparseDenseToSparseAlg_t alg,
+                                                 void*                       externalBuffer)
+{
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    handle_data*       data = (handle_data*)handle;
+    const dnmat_descr* A    = (const dnmat_descr*)matA;
+    const spmat_descr* B    = (const spmat_descr*)matB;
+
+    if(A->rows != B->rows || A->cols != B->cols || A->data_type != B->data_type)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(B->format != HIPSPARSE_FORMAT_CSR && B->format != HIPSPARSE_FORMAT_CSC
+       && B->format != HIPSPARSE_FORMAT_COO)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(B->nnz > 0
+       && (B->values == nullptr || (B->format != HIPSPARSE_FORMAT_CSC && B->col_ind == nullptr)
+           || (B->format != HIPSPARSE_FORMAT_CSR && B->row_ind == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    bool csc = (B->format == HIPSPARSE_FORMAT_CSC);
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    return dispatch_value(A->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        return dispatch_index(B->ind_type, [&](auto ind_tag) {
+            using J = typename decltype(ind_tag)::type;
+
+            dense_view<T> dense(A, 0, HIPSPARSE_OPERATION_NON_TRANSPOSE);
+            int64_t       outer = csc ? A->cols : A->rows;
+            int64_t       inner = csc ? A->rows : A->cols;
+
+            workspace_array<int64_t> ptr(data, outer + 1);
+            if(!ptr.valid())
+            {
+                return HIPSPARSE_STATUS_ALLOC_FAILED;
+            }
+
+            dense_nnz(dense, A->rows, A->cols, csc, ptr.data() + 1);
+
+            ptr[0] = 0;
+            for(int64_t i = 0; i < outer; ++i)
+            {
+                ptr[i + 1] += ptr[i];
+            }
+
+            if(ptr[outer] != B->nnz)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            // Row indices of COO matrices are written along with the entries
+            int64_t base = B->idx_base;
+            J*      row  = (J*)B->row_ind;
+            J*      ind  = (J*)(csc ? B->row_ind : B->col_ind);
+            T*      val  = (T*)B->values;
+
+#pragma omp parallel for
+            for(int64_t o = 0; o < outer; ++o)
+            {
+                int64_t idx = ptr[o];
+
+                for(int64_t i = 0; i < inner; ++i)
+                {
+                    T a = csc ? dense(i, o) : dense(o, i);
+
+                    if(a != static_cast<T>(0))
+                    {
+                        if(B->format == HIPSPARSE_FORMAT_COO)
+                        {
+                            row[idx] = static_cast<J>(o + base);
+                        }
+
+                        ind[idx] = static_cast<J>(i + base);
+                        val[idx] = a;
+                        ++idx;
+                    }
+                }
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t     handle,
+                                           hipsparseOperation_t  opX,
+                                           hipsparseSpVecDescr_t vecX,
+                                           hipsparseDnVecDescr_t vecY,
+                                           void*                 result,
+                                           hipDataType           computeType,
+                                           size_t*               bufferSize)
+{
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr || result == nullptr
+       || bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t     handle,
+                                hipsparseOperation_t  opX,
+                                hipsparseSpVecDescr_t vecX,
+                                hipsparseDnVecDescr_t vecY,
+                                void*                 result,
+                                hipDataType           computeType,
+                                void*                 externalBuffer)
+{
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr || result == nullptr
+       || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(opX != HIPSPARSE_OPERATION_NON_TRANSPOSE && opX != HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const spvec_descr* x = (const spvec_descr*)vecX;
+    const dnvec_descr* y = (const dnvec_descr*)vecY;
+
+    if(x->data_type != y->data_type || x->data_type != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(x->data_type, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        return dispatch_index(x->idx_type, [&](auto ind_tag) {
+            using I = typename decltype(ind_tag)::type;
+
+            const I* ind  = (const I*)x->ind;
+            const T* xval = (const T*)x->val;
+            const T* yval = (const T*)y->values;
+            bool     conj = (opX == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+            T        dot  = static_cast<T>(0);
+
+#pragma omp parallel
+            {
+                T sum = static_cast<T>(0);
+
+#pragma omp for nowait
+                for(int64_t i = 0; i < x->nnz; ++i)
+                {
+                    sum += op_value(xval[i], conj) * yval[ind[i] - x->idx_base];
+                }
+
+#pragma omp critical
+                dot += sum;
+            }
+
+            *(T*)result = dot;
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    });
+}
+
+namespace
+{
+    hipsparseStatus_t spmv_check(hipsparseHandle_t           handle,
+                                 hipsparseOperation_t        opA,
+                                 const void*                 alpha,
+                                 const hipsparseSpMatDescr_t matA,
+                                 const hipsparseDnVecDescr_t vecX,
+                                 const void*                 beta,
+                                 const hipsparseDnVecDescr_t vecY,
+                                 hipDataType                 computeType)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+           || beta == nullptr || vecY == nullptr || !valid_operation(opA))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const spmat_descr* A = (const spmat_descr*)matA;
+        const dnvec_descr* x = (const dnvec_descr*)vecX;
+        const dnvec_descr* y = (const dnvec_descr*)vecY;
+
+        bool trans = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+        if(x->size != (trans ? A->rows : A->cols) || y->size != (trans ? A->cols : A->rows))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->data_type != computeType || x->data_type != computeType
+           || y->data_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnVecDescr_t vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           size_t*                     bufferSize)
+{
+    if(bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spmv_check(handle, opA, alpha, matA, vecX, beta, vecY, computeType));
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnVecDescr_t vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Nothing to prepare
+    return spmv_check(handle, opA, alpha, matA, vecX, beta, vecY, computeType);
+}
+
+hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                const void*                 alpha,
+                                const hipsparseSpMatDescr_t matA,
+                                const hipsparseDnVecDescr_t vecX,
+                                const void*                 beta,
+                                const hipsparseDnVecDescr_t vecY,
+                                hipDataType                 computeType,
+                                hipsparseSpMVAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spmv_check(handle, opA, alpha, matA, vecX, beta, vecY, computeType));
+
+    handle_data*       data = (handle_data*)handle;
+    const spmat_descr* A    = (const spmat_descr*)matA;
+    const dnvec_descr* x    = (const dnvec_descr*)vecX;
+    const dnvec_descr* y    = (const dnvec_descr*)vecY;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    return dispatch_value(computeType, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        bool trans = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        bool conj  = (opA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+        return with_csr_view(data, A, 0, trans, [&](const auto& view) {
+            host_csrmv(view,
+                       conj,
+                       *(const T*)alpha,
+                       (const T*)x->values,
+                       *(const T*)beta,
+                       (T*)y->values);
+        });
+    });
+}
+
+namespace
+{
+    hipsparseStatus_t spmm_check(hipsparseHandle_t           handle,
+                                 hipsparseOperation_t        opA,
+                                 hipsparseOperation_t        opB,
+                                 const void*                 alpha,
+                                 const hipsparseSpMatDescr_t matA,
+                                 const hipsparseDnMatDescr_t matB,
+                                 const void*                 beta,
+                                 const hipsparseDnMatDescr_t matC,
+                                 hipDataType                 computeType)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+           || beta == nullptr || matC == nullptr || !valid_operation(opA)
+           || !valid_operation(opB))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const spmat_descr* A = (const spmat_descr*)matA;
+        const dnmat_descr* B = (const dnmat_descr*)matB;
+        const dnmat_descr* C = (const dnmat_descr*)matC;
+
+        bool transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        bool transB = (opB != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+        int64_t m = transA ? A->cols : A->rows;
+        int64_t k = transA ? A->rows : A->cols;
+
+        if(C->rows != m || (transB ? B->cols : B->rows) != k
+           || (transB ? B->rows : B->cols) != C->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // A single matrix is applied to all batches of the others
+        int batch_count = std::max(A->batch_count, std::max(B->batch_count, C->batch_count));
+
+        if(C->batch_count != batch_count || (A->batch_count != 1 && A->batch_count != batch_count)
+           || (B->batch_count != 1 && B->batch_count != batch_count))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->data_type != computeType || B->data_type != computeType
+           || C->data_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnMatDescr_t matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           size_t*                     bufferSize)
+{
+    if(bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spmm_check(handle, opA, opB, alpha, matA, matB, beta, matC, computeType));
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnMatDescr_t matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Nothing to prepare
+    return spmm_check(handle, opA, opB, alpha, matA, matB, beta, matC, computeType);
+}
+
+hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                hipsparseOperation_t        opB,
+                                const void*                 alpha,
+                                const hipsparseSpMatDescr_t matA,
+                                const hipsparseDnMatDescr_t matB,
+                                const void*                 beta,
+                                const hipsparseDnMatDescr_t matC,
+                                hipDataType                 computeType,
+                                hipsparseSpMMAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spmm_check(handle, opA, opB, alpha, matA, matB, beta, matC, computeType));
+
+    handle_data*       data = (handle_data*)handle;
+    const spmat_descr* A    = (const spmat_descr*)matA;
+    const dnmat_descr* B    = (const dnmat_descr*)matB;
+    const dnmat_descr* C    = (const dnmat_descr*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    return dispatch_value(computeType, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        bool trans = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        bool conj  = (opA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+        for(int64_t b = 0; b < C->batch_count; ++b)
+        {
+            dense_view<T> opB_view(B, b, opB);
+            dense_view<T> C_view(C, b, HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+            RETURN_IF_HIPSPARSE_ERROR(with_csr_view(data, A, b, trans, [&](const auto& view) {
+                host_csrmm(view,
+                           conj,
+                           *(const T*)alpha,
+                           opB_view,
+                           *(const T*)beta,
+                           C_view,
+                           C->cols);
+            }));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    });
+}
+
+hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpGEMMDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_setScalarHints(hipsparseSpGEMMDescr_t descr,
+                                                 hipsparseScalarHint_t  alphaHint,
+                                                 hipsparseScalarHint_t  betaHint)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alphaHint != HIPSPARSE_SCALAR_HINT_UNKNOWN && alphaHint != HIPSPARSE_SCALAR_HINT_ZERO
+       && alphaHint != HIPSPARSE_SCALAR_HINT_NONZERO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(betaHint != HIPSPARSE_SCALAR_HINT_UNKNOWN && betaHint != HIPSPARSE_SCALAR_HINT_ZERO
+       && betaHint != HIPSPARSE_SCALAR_HINT_NONZERO)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Reading scalars is cheap on the host, hints are only kept for the getter
+    descr->alphaHint = alphaHint;
+    descr->betaHint  = betaHint;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_getScalarHints(hipsparseSpGEMMDescr_t descr,
+                                                 hipsparseScalarHint_t* alphaHint,
+                                                 hipsparseScalarHint_t* betaHint)
+{
+    if(descr == nullptr || alphaHint == nullptr || betaHint == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *alphaHint = descr->alphaHint;
+    *betaHint  = descr->betaHint;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace
+{
+    hipsparseStatus_t spgemm_check(hipsparseHandle_t      handle,
+                                   hipsparseOperation_t   opA,
+                                   hipsparseOperation_t   opB,
+                                   hipsparseSpMatDescr_t  matA,
+                                   hipsparseSpMatDescr_t  matB,
+                                   hipsparseSpMatDescr_t  matC,
+                                   hipDataType            computeType,
+                                   hipsparseSpGEMMDescr_t spgemmDescr)
+    {
+        if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+           || spgemmDescr == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        const spmat_descr* A = (const spmat_descr*)matA;
+        const spmat_descr* B = (const spmat_descr*)matB;
+        const spmat_descr* C = (const spmat_descr*)matC;
+
+        if(A->format != HIPSPARSE_FORMAT_CSR || B->format != HIPSPARSE_FORMAT_CSR
+           || C->format != HIPSPARSE_FORMAT_CSR)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->cols != B->rows || C->rows != A->rows || C->cols != B->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // All matrices share their index types
+        if(B->offsets_type != A->offsets_type || C->offsets_type != A->offsets_type
+           || B->ind_type != A->ind_type || C->ind_type != A->ind_type)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->data_type != computeType || B->data_type != computeType
+           || C->data_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Sparsity pattern of C = A * B + D into the SpGEMM descriptor. The number of
+    // non-zeros of C is updated, and its row offsets are written if available.
+    hipsparseStatus_t spgemm_pattern(hipsparseSpGEMMDescr_t descr,
+                                     const spmat_descr*     A,
+                                     const spmat_descr*     B,
+                                     const spmat_descr*     D,
+                                     spmat_descr*           C)
+    {
+        return dispatch_index(A->offsets_type, [&](auto ptr_tag) {
+            using I = typename decltype(ptr_tag)::type;
+
+            return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                using J = typename decltype(ind_tag)::type;
+
+                csr_view<I, J> view_A = spgemm_view<I, J>(A);
+                csr_view<I, J> view_B = spgemm_view<I, J>(B);
+                csr_view<I, J> view_D;
+
+                if(D != nullptr)
+                {
+                    view_D = spgemm_view<I, J>(D);
+                }
+
+                int64_t m = A->rows;
+
+                descr->row_ptr.resize(m + 1);
+                descr->row_ptr[0] = 0;
+
+                hipsparse::host_csrgemm_nnz(m,
+                                            &view_A,
+                                            view_B,
+                                            (D != nullptr) ? &view_D : nullptr,
+                                            descr->row_ptr.data() + 1);
+
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    descr->row_ptr[i + 1] += descr->row_ptr[i];
+                }
+
+                descr->rows = m;
+                descr->nnz  = descr->row_ptr[m];
+                descr->col_ind.resize(descr->nnz);
+
+                hipsparse::host_csrgemm(m,
+                                        &view_A,
+                                        view_B,
+                                        (D != nullptr) ? &view_D : nullptr,
+                                        char(),
+                                        char(),
+                                        descr->row_ptr.data(),
+                                        0,
+                                        descr->col_ind.data(),
+                                        (char*)nullptr);
+
+                C->nnz = descr->nnz;
+
+                if(C->offsets == nullptr)
+                {
+                    return HIPSPARSE_STATUS_SUCCESS;
+                }
+
+                return store_indices(
+                    C->offsets_type, C->idx_base, descr->row_ptr.data(), m + 1, C->offsets);
+            });
+        });
+    }
+
+    // Values of C = alpha * A * B + beta * D. The values are stored into the SpGEMM
+    // descriptor for its pattern if to_descr is set, otherwise into C itself, which
+    // has the pattern of the product.
+    hipsparseStatus_t spgemm_values(hipsparseSpGEMMDescr_t descr,
+                                    const void*            alpha,
+                                    const spmat_descr*     A,
+                                    const spmat_descr*     B,
+                                    const void*            beta,
+                                    const spmat_descr*     D,
+                                    spmat_descr*           C,
+                                    bool                   to_descr)
+    {
+        return dispatch_value(A->data_type, [&](auto val_tag) {
+            using T = typename decltype(val_tag)::type;
+
+            return dispatch_index(A->offsets_type, [&](auto ptr_tag) {
+                using I = typename decltype(ptr_tag)::type;
+
+                return dispatch_index(A->ind_type, [&](auto ind_tag) {
+                    using J = typename decltype(ind_tag)::type;
+
+                    csr_view<I, J> view_A = spgemm_view<I, J>(A);
+                    csr_view<I, J> view_B = spgemm_view<I, J>(B);
+                    csr_view<I, J> view_D;
+
+                    if(D != nullptr)
+                    {
+                        view_D = spgemm_view<I, J>(D);
+                    }
+
+                    T a = *(const T*)alpha;
+                    T b = *(const T*)beta;
+
+                    if(!to_descr)
+                    {
+                        hipsparse::host_csrgemm_values(A->rows,
+                                                       &view_A,
+                                                       view_B,
+                                                       (D != nullptr) ? &view_D : nullptr,
+                                                       a,
+                                                       b,
+                                                       spgemm_view<I, J>(C));
+
+                        return HIPSPARSE_STATUS_SUCCESS;
+                    }
+
+                    descr->values.resize(sizeof(T) * descr->nnz);
+
+                    csr_view<int64_t, int64_t> view_C{descr->rows,
+                                                      B->cols,
+                                                      descr->row_ptr.data(),
+                                                      descr->col_ind.data(),
+                                                      nullptr,
+                                                      0,
+                                                      0,
+                                                      descr->values.data()};
+
+                    hipsparse::host_csrgemm_values(
+                        A->rows, &view_A, view_B, (D != nullptr) ? &view_D : nullptr, a, b, view_C);
+
+                    return HIPSPARSE_STATUS_SUCCESS;
+                });
+            });
+        });
+    }
+
+    // Copy the product held by the SpGEMM descriptor into the arrays of C
+    hipsparseStatus_t spgemm_store(hipsparseSpGEMMDescr_t descr, spmat_descr* C, bool values)
+    {
+        if(C->rows != descr->rows || C->nnz != descr->nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(C->offsets == nullptr || (descr->nnz > 0 && C->col_ind == nullptr)
+           || (values && descr->nnz > 0 && C->values == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(store_indices(
+            C->offsets_type, C->idx_base, descr->row_ptr.data(), descr->rows + 1, C->offsets));
+        RETURN_IF_HIPSPARSE_ERROR(store_indices(
+            C->ind_type, C->idx_base, descr->col_ind.data(), descr->nnz, C->col_ind));
+
+        if(values && descr->nnz > 0)
+        {
+            memcpy(C->values, descr->values.data(), descr->values.size());
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // The current content of C enters the product if it has any entries
+    const spmat_descr* spgemm_addend(const spmat_descr* C, const void* beta)
+    {
+        bool empty = (C->nnz == 0 || C->offsets == nullptr || C->col_ind == nullptr
+                      || C->values == nullptr);
+
+        return (empty || is_zero(beta, C->data_type)) ? nullptr : C;
+    }
+}
+
+hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t      handle,
+                                                 hipsparseOperation_t   opA,
+                                                 hipsparseOperation_t   opB,
+                                                 const void*            alpha,
+                                                 hipsparseSpMatDescr_t  matA,
+                                                 hipsparseSpMatDescr_t  matB,
+                                                 const void*            beta,
+                                                 hipsparseSpMatDescr_t  matC,
+                                                 hipDataType            computeType,
+                                                 hipsparseSpGEMMAlg_t   alg,
+                                                 hipsparseSpGEMMDescr_t spgemmDescr,
+                                                 size_t*                bufferSize1,
+                                                 void*                  externalBuffer1)
+{
+    if(alpha == nullptr || beta == nullptr || bufferSize1 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spgemm_check(handle, opA, opB, matA, matB, matC, computeType, spgemmDescr));
+
+    // The work is done by hipsparseSpGEMM_compute()
+    *bufferSize1 = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t      handle,
+                                          hipsparseOperation_t   opA,
+                                          hipsparseOperation_t   opB,
+                                          const void*            alpha,
+                                          hipsparseSpMatDescr_t  matA,
+                                          hipsparseSpMatDescr_t  matB,
+                                          const void*            beta,
+                                          hipsparseSpMatDescr_t  matC,
+                                          hipDataType            computeType,
+                                          hipsparseSpGEMMAlg_t   alg,
+                                          hipsparseSpGEMMDescr_t spgemmDescr,
+                                          size_t*                bufferSize2,
+                                          void*                  externalBuffer2)
+{
+    if(alpha == nullptr || beta == nullptr || bufferSize2 == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spgemm_check(handle, opA, opB, matA, matB, matC, computeType, spgemmDescr));
+
+    // Buffer size query
+    if(externalBuffer2 == nullptr)
+    {
+        *bufferSize2 = min_buffer_size;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    const spmat_descr* A = (const spmat_descr*)matA;
+    const spmat_descr* B = (const spmat_descr*)matB;
+    spmat_descr*       C = (spmat_descr*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    // The product is kept in the descriptor until hipsparseSpGEMM_copy(), C does not
+    // need to provide its column indices and values yet
+    const spmat_descr* D = spgemm_addend(C, beta);
+
+    spgemmDescr->computed = false;
+
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_pattern(spgemmDescr, A, B, D, C));
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_values(spgemmDescr, alpha, A, B, beta, D, C, true));
+
+    spgemmDescr->computed = true;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t      handle,
+                                       hipsparseOperation_t   opA,
+                                       hipsparseOperation_t   opB,
+                                       const void*            alpha,
+                                       hipsparseSpMatDescr_t  matA,
+                                       hipsparseSpMatDescr_t  matB,
+                                       const void*            beta,
+                                       hipsparseSpMatDescr_t  matC,
+                                       hipDataType            computeType,
+                                       hipsparseSpGEMMAlg_t   alg,
+                                       hipsparseSpGEMMDescr_t spgemmDescr)
+{
+    if(alpha == nullptr || beta == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spgemm_check(handle, opA, opB, matA, matB, matC, computeType, spgemmDescr));
+
+    const spmat_descr* A = (const spmat_descr*)matA;
+    const spmat_descr* B = (const spmat_descr*)matB;
+    spmat_descr*       C = (spmat_descr*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    if(!spgemmDescr->computed)
+    {
+        const spmat_descr* D = spgemm_addend(C, beta);
+
+        RETURN_IF_HIPSPARSE_ERROR(spgemm_pattern(spgemmDescr, A, B, D, C));
+        RETURN_IF_HIPSPARSE_ERROR(spgemm_values(spgemmDescr, alpha, A, B, beta, D, C, true));
+
+        spgemmDescr->computed = true;
+    }
+
+    return spgemm_store(spgemmDescr, C, true);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t      handle,
+                                                      hipsparseOperation_t   opA,
+                                                      hipsparseOperation_t   opB,
+                                                      hipsparseSpMatDescr_t  matA,
+                                                      hipsparseSpMatDescr_t  matB,
+                                                      hipsparseSpMatDescr_t  matC,
+                                                      hipsparseSpGEMMAlg_t   alg,
+                                                      hipsparseSpGEMMDescr_t spgemmDescr,
+                                                      size_t*                bufferSize1,
+                                                      void*                  externalBuffer1)
+{
+    if(bufferSize1 == nullptr || matA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_check(handle,
+                                           opA,
+                                           opB,
+                                           matA,
+                                           matB,
+                                           matC,
+                                           ((const spmat_descr*)matA)->data_type,
+                                           spgemmDescr));
+
+    *bufferSize1 = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t      handle,
+                                           hipsparseOperation_t   opA,
+                                           hipsparseOperation_t   opB,
+                                           hipsparseSpMatDescr_t  matA,
+                                           hipsparseSpMatDescr_t  matB,
+                                           hipsparseSpMatDescr_t  matC,
+                                           hipsparseSpGEMMAlg_t   alg,
+                                           hipsparseSpGEMMDescr_t spgemmDescr,
+                                           size_t*                bufferSize2,
+                                           void*                  externalBuffer2,
+                                           size_t*                bufferSize3,
+                                           void*                  externalBuffer3,
+                                           size_t*                bufferSize4,
+                                           void*                  externalBuffer4)
+{
+    if(bufferSize2 == nullptr || bufferSize3 == nullptr || bufferSize4 == nullptr
+       || matA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_check(handle,
+                                           opA,
+                                           opB,
+                                           matA,
+                                           matB,
+                                           matC,
+                                           ((const spmat_descr*)matA)->data_type,
+                                           spgemmDescr));
+
+    // Buffer size query
+    if(externalBuffer2 == nullptr || externalBuffer3 == nullptr || externalBuffer4 == nullptr)
+    {
+        *bufferSize2 = min_buffer_size;
+        *bufferSize3 = min_buffer_size;
+        *bufferSize4 = min_buffer_size;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    spgemmDescr->computed = false;
+
+    return spgemm_pattern(spgemmDescr,
+                          (const spmat_descr*)matA,
+                          (const spmat_descr*)matB,
+                          nullptr,
+                          (spmat_descr*)matC);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t      handle,
+                                            hipsparseOperation_t   opA,
+                                            hipsparseOperation_t   opB,
+                                            hipsparseSpMatDescr_t  matA,
+                                            hipsparseSpMatDescr_t  matB,
+                                            hipsparseSpMatDescr_t  matC,
+                                            hipsparseSpGEMMAlg_t   alg,
+                                            hipsparseSpGEMMDescr_t spgemmDescr,
+                                            size_t*                bufferSize5,
+                                            void*                  externalBuffer5)
+{
+    if(bufferSize5 == nullptr || matA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(spgemm_check(handle,
+                                           opA,
+                                           opB,
+                                           matA,
+                                           matB,
+                                           matC,
+                                           ((const spmat_descr*)matA)->data_type,
+                                           spgemmDescr));
+
+    // Buffer size query
+    if(externalBuffer5 == nullptr)
+    {
+        *bufferSize5 = min_buffer_size;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    // The pattern is copied into C, values are computed by hipsparseSpGEMMreuse_compute()
+    return spgemm_store(spgemmDescr, (spmat_descr*)matC, false);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t      handle,
+                                               hipsparseOperation_t   opA,
+                                               hipsparseOperation_t   opB,
+                                               const void*            alpha,
+                                               hipsparseSpMatDescr_t  matA,
+                                               hipsparseSpMatDescr_t  matB,
+                                               const void*            beta,
+                                               hipsparseSpMatDescr_t  matC,
+                                               hipDataType            computeType,
+                                               hipsparseSpGEMMAlg_t   alg,
+                                               hipsparseSpGEMMDescr_t spgemmDescr)
+{
+    if(alpha == nullptr || beta == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spgemm_check(handle, opA, opB, matA, matB, matC, computeType, spgemmDescr));
+
+    spmat_descr* C = (spmat_descr*)matC;
+
+    if(C->offsets == nullptr || (C->nnz > 0 && (C->col_ind == nullptr || C->values == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    // C = alpha * A * B + beta * C, with the pattern of C set up by
+    // hipsparseSpGEMMreuse_copy()
+    return spgemm_values(spgemmDescr,
+                         alpha,
+                         (const spmat_descr*)matA,
+                         (const spmat_descr*)matB,
+                         beta,
+                         is_zero(beta, computeType) ? nullptr : C,
+                         C,
+                         false);
+}
+
+namespace
+{
+    hipsparseStatus_t sddmm_check(hipsparseHandle_t           handle,
+                                  hipsparseOperation_t        opA,
+                                  hipsparseOperation_t        opB,
+                                  const void*                 alpha,
+                                  const hipsparseDnMatDescr_t matA,
+                                  const hipsparseDnMatDescr_t matB,
+                                  const void*                 beta,
+                                  hipsparseSpMatDescr_t       matC,
+                                  hipDataType                 computeType)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+           || beta == nullptr || matC == nullptr || !valid_operation(opA)
+           || !valid_operation(opB))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const dnmat_descr* A = (const dnmat_descr*)matA;
+        const dnmat_descr* B = (const dnmat_descr*)matB;
+        const spmat_descr* C = (const spmat_descr*)matC;
+
+        bool transA = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+        bool transB = (opB != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+        int64_t k = transA ? A->rows : A->cols;
+
+        if((transA ? A->cols : A->rows) != C->rows || (transB ? B->rows : B->cols) != C->cols
+           || (transB ? B->cols : B->rows) != k)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(C->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->data_type != computeType || B->data_type != computeType
+           || C->data_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t           handle,
+                                 hipsparseOperation_t        opA,
+                                 hipsparseOperation_t        opB,
+                                 const void*                 alpha,
+                                 const hipsparseDnMatDescr_t A,
+                                 const hipsparseDnMatDescr_t B,
+                                 const void*                 beta,
+                                 hipsparseSpMatDescr_t       C,
+                                 hipDataType                 computeType,
+                                 hipsparseSDDMMAlg_t         alg,
+                                 void*                       tempBuffer)
+{
+    if(tempBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(sddmm_check(handle, opA, opB, alpha, A, B, beta, C, computeType));
+
+    const dnmat_descr* matA = (const dnmat_descr*)A;
+    const dnmat_descr* matB = (const dnmat_descr*)B;
+    const spmat_descr* matC = (const spmat_descr*)C;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream((handle_data*)handle));
+
+    return dispatch_value(computeType, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        dense_view<T> opA_view(matA, 0, opA);
+        dense_view<T> opB_view(matB, 0, opB);
+        int64_t       k   = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE) ? matA->rows : matA->cols;
+        T             a   = *(const T*)alpha;
+        T             b   = *(const T*)beta;
+        T*            val = (T*)matC->values;
+
+        // C = alpha * (op(A) * op(B)) o spy(C) + beta * C
+        return for_each_entry(matC, 0, [&](int64_t i, int64_t j, int64_t pos) {
+            T sum = static_cast<T>(0);
+
+            for(int64_t l = 0; l < k; ++l)
+            {
+                sum += opA_view(i, l) * opB_view(l, j);
+            }
+
+            val[pos] = (b == static_cast<T>(0)) ? a * sum : a * sum + b * val[pos];
+        });
+    });
+}
+
+hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t           handle,
+                                            hipsparseOperation_t        opA,
+                                            hipsparseOperation_t        opB,
+                                            const void*                 alpha,
+                                            const hipsparseDnMatDescr_t A,
+                                            const hipsparseDnMatDescr_t B,
+                                            const void*                 beta,
+                                            hipsparseSpMatDescr_t       C,
+                                            hipDataType                 computeType,
+                                            hipsparseSDDMMAlg_t         alg,
+                                            size_t*                     bufferSize)
+{
+    if(bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(sddmm_check(handle, opA, opB, alpha, A, B, beta, C, computeType));
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t           handle,
+                                            hipsparseOperation_t        opA,
+                                            hipsparseOperation_t        opB,
+                                            const void*                 alpha,
+                                            const hipsparseDnMatDescr_t A,
+                                            const hipsparseDnMatDescr_t B,
+                                            const void*                 beta,
+                                            hipsparseSpMatDescr_t       C,
+                                            hipDataType                 computeType,
+                                            hipsparseSDDMMAlg_t         alg,
+                                            void*                       tempBuffer)
+{
+    if(tempBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Nothing to prepare
+    return sddmm_check(handle, opA, opB, alpha, A, B, beta, C, computeType);
+}
+
+hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpSVDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace
+{
+    hipsparseStatus_t spsv_check(hipsparseHandle_t           handle,
+                                 hipsparseOperation_t        opA,
+                                 const void*                 alpha,
+                                 const hipsparseSpMatDescr_t matA,
+                                 const hipsparseDnVecDescr_t x,
+                                 const hipsparseDnVecDescr_t y,
+                                 hipDataType                 computeType,
+                                 hipsparseSpSVDescr_t        spsvDescr)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr
+           || y == nullptr || spsvDescr == nullptr || !valid_operation(opA))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const spmat_descr* A    = (const spmat_descr*)matA;
+        const dnvec_descr* vecX = (const dnvec_descr*)x;
+        const dnvec_descr* vecY = (const dnvec_descr*)y;
+
+        if(A->rows != A->cols || vecX->size != A->rows || vecY->size != A->rows)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->data_type != computeType || vecX->data_type != computeType
+           || vecY->data_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnVecDescr_t x,
+                                           const hipsparseDnVecDescr_t y,
+                                           hipDataType                 computeType,
+                                           hipsparseSpSVAlg_t          alg,
+                                           hipsparseSpSVDescr_t        spsvDescr,
+                                           size_t*                     bufferSize)
+{
+    if(bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(spsv_check(handle, opA, alpha, matA, x, y, computeType, spsvDescr));
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         const void*                 alpha,
+                                         const hipsparseSpMatDescr_t matA,
+                                         const hipsparseDnVecDescr_t x,
+                                         const hipsparseDnVecDescr_t y,
+                                         hipDataType                 computeType,
+                                         hipsparseSpSVAlg_t          alg,
+                                         hipsparseSpSVDescr_t        spsvDescr,
+                                         void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(spsv_check(handle, opA, alpha, matA, x, y, computeType, spsvDescr));
+
+    handle_data*       data = (handle_data*)handle;
+    const spmat_descr* A    = (const spmat_descr*)matA;
+
+    // Keep an existing analysis of the same triangle if requested
+    if(data->analysis_policy == HIPSPARSE_ANALYSIS_POLICY_REUSE && spsvDescr->analysed
+       && spsvDescr->op == opA && spsvDescr->info.m == A->rows
+       && spsvDescr->info.lower == lower_triangle(A, opA))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    spsvDescr->analysed = false;
+    RETURN_IF_HIPSPARSE_ERROR(csrsv_analysis(data, A, opA, spsvDescr->info));
+
+    spsvDescr->analysed = true;
+    spsvDescr->op       = opA;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
+                                      hipsparseOperation_t        opA,
+                                      const void*                 alpha,
+                                      const hipsparseSpMatDescr_t matA,
+                                      const hipsparseDnVecDescr_t x,
+                                      const hipsparseDnVecDescr_t y,
+                                      hipDataType                 computeType,
+                                      hipsparseSpSVAlg_t          alg,
+                                      hipsparseSpSVDescr_t        spsvDescr,
+                                      void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(spsv_check(handle, opA, alpha, matA, x, y, computeType, spsvDescr));
+
+    handle_data*       data = (handle_data*)handle;
+    const spmat_descr* A    = (const spmat_descr*)matA;
+    const dnvec_descr* vecX = (const dnvec_descr*)x;
+    const dnvec_descr* vecY = (const dnvec_descr*)y;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    hipsparse::csrsv_info        local;
+    const hipsparse::csrsv_info* info;
+    RETURN_IF_HIPSPARSE_ERROR(csrsv_lookup(data, A, opA, spsvDescr, local, &info));
+
+    return dispatch_value(computeType, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        T        a    = *(const T*)alpha;
+        const T* xval = (const T*)vecX->values;
+        T*       yval = (T*)vecY->values;
+
+#pragma omp parallel for
+        for(int64_t i = 0; i < vecY->size; ++i)
+        {
+            yval[i] = a * xval[i];
+        }
+
+        return csrsv_solve<T>(
+            data, A, opA, *info, 1, [yval](int64_t i, int64_t) -> T& { return yval[i]; });
+    });
+}
+
+hipsparseStatus_t hipsparseSpSM_createDescr(hipsparseSpSMDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpSMDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSM_destroyDescr(hipsparseSpSMDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace
+{
+    hipsparseStatus_t spsm_check(hipsparseHandle_t           handle,
+                                 hipsparseOperation_t        opA,
+                                 hipsparseOperation_t        opB,
+                                 const void*                 alpha,
+                                 const hipsparseSpMatDescr_t matA,
+                                 const hipsparseDnMatDescr_t matB,
+                                 const hipsparseDnMatDescr_t matC,
+                                 hipDataType                 computeType,
+                                 hipsparseSpSMDescr_t        spsmDescr)
+    {
+        if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+           || matC == nullptr || spsmDescr == nullptr || !valid_operation(opA)
+           || !valid_operation(opB))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const spmat_descr* A = (const spmat_descr*)matA;
+        const dnmat_descr* B = (const dnmat_descr*)matB;
+        const dnmat_descr* C = (const dnmat_descr*)matC;
+
+        bool transB = (opB != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+        if(A->rows != A->cols || C->rows != A->rows || (transB ? B->cols : B->rows) != C->rows
+           || (transB ? B->rows : B->cols) != C->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A->data_type != computeType || B->data_type != computeType
+           || C->data_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           const hipsparseSpMatDescr_t matA,
+                                           const hipsparseDnMatDescr_t matB,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpSMAlg_t          alg,
+                                           hipsparseSpSMDescr_t        spsmDescr,
+                                           size_t*                     bufferSize)
+{
+    if(bufferSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spsm_check(handle, opA, opB, alpha, matA, matB, matC, computeType, spsmDescr));
+
+    *bufferSize = min_buffer_size;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         hipsparseOperation_t        opB,
+                                         const void*                 alpha,
+                                         const hipsparseSpMatDescr_t matA,
+                                         const hipsparseDnMatDescr_t matB,
+                                         const hipsparseDnMatDescr_t matC,
+                                         hipDataType                 computeType,
+                                         hipsparseSpSMAlg_t          alg,
+                                         hipsparseSpSMDescr_t        spsmDescr,
+                                         void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spsm_check(handle, opA, opB, alpha, matA, matB, matC, computeType, spsmDescr));
+
+    handle_data*       data = (handle_data*)handle;
+    const spmat_descr* A    = (const spmat_descr*)matA;
+
+    // Keep an existing analysis of the same triangle if requested
+    if(data->analysis_policy == HIPSPARSE_ANALYSIS_POLICY_REUSE && spsmDescr->analysed
+       && spsmDescr->op == opA && spsmDescr->info.m == A->rows
+       && spsmDescr->info.lower == lower_triangle(A, opA))
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    spsmDescr->analysed = false;
+    RETURN_IF_HIPSPARSE_ERROR(csrsv_analysis(data, A, opA, spsmDescr->info));
+
+    spsmDescr->analysed = true;
+    spsmDescr->op       = opA;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
+                                      hipsparseOperation_t        opA,
+                                      hipsparseOperation_t        opB,
+                                      const void*                 alpha,
+                                      const hipsparseSpMatDescr_t matA,
+                                      const hipsparseDnMatDescr_t matB,
+                                      const hipsparseDnMatDescr_t matC,
+                                      hipDataType                 computeType,
+                                      hipsparseSpSMAlg_t          alg,
+                                      hipsparseSpSMDescr_t        spsmDescr,
+                                      void*                       externalBuffer)
+{
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        spsm_check(handle, opA, opB, alpha, matA, matB, matC, computeType, spsmDescr));
+
+    handle_data*       data = (handle_data*)handle;
+    const spmat_descr* A    = (const spmat_descr*)matA;
+    const dnmat_descr* B    = (const dnmat_descr*)matB;
+    const dnmat_descr* C    = (const dnmat_descr*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(wait_stream(data));
+
+    hipsparse::csrsv_info        local;
+    const hipsparse::csrsv_info* info;
+    RETURN_IF_HIPSPARSE_ERROR(csrsv_lookup(data, A, opA, spsmDescr, local, &info));
+
+    return dispatch_value(computeType, [&](auto val_tag) {
+        using T = typename decltype(val_tag)::type;
+
+        T             a = *(const T*)alpha;
+        dense_view<T> opB_view(B, 0, opB);
+        dense_view<T> C_view(C, 0, HIPSPARSE_OPERATION_NON_TRANSPOSE);
+
+#pragma omp parallel for
+        for(int64_t j = 0; j < C->cols; ++j)
+        {
+            for(int64_t i = 0; i < C->rows; ++i)
+            {
+                C_view.at(i, j) = a * opB_view(i, j);
+            }
+        }
+
+        // All columns of C are solved together, row by row
+        return csrsv_solve<T>(data, A, opA, *info, C->cols, [&](int64_t i, int64_t j) -> T& {
+            return C_view.at(i, j);
+        });
+    });
+}
+
+#ifdef __cplusplus
+}
+#endif
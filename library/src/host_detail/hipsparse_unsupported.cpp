@@ -0,0 +1,5505 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+// Routines of the legacy API, which are not provided by the host backend
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  const float*         alpha,
+                                  const float*         xVal,
+                                  const int*           xInd,
+                                  float*               y,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  const double*        alpha,
+                                  const double*        xVal,
+                                  const int*           xInd,
+                                  double*              y,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  const hipComplex*    alpha,
+                                  const hipComplex*    xVal,
+                                  const int*           xInd,
+                                  hipComplex*          y,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
+                                  int                     nnz,
+                                  const hipDoubleComplex* alpha,
+                                  const hipDoubleComplex* xVal,
+                                  const int*              xInd,
+                                  hipDoubleComplex*       y,
+                                  hipsparseIndexBase_t    idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const float*         xVal,
+                                 const int*           xInd,
+                                 const float*         y,
+                                 float*               result,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const double*        xVal,
+                                 const int*           xInd,
+                                 const double*        y,
+                                 double*              result,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const hipComplex*    xVal,
+                                 const int*           xInd,
+                                 const hipComplex*    y,
+                                 hipComplex*          result,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
+                                 int                     nnz,
+                                 const hipDoubleComplex* xVal,
+                                 const int*              xInd,
+                                 const hipDoubleComplex* y,
+                                 hipDoubleComplex*       result,
+                                 hipsparseIndexBase_t    idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  const hipComplex*    xVal,
+                                  const int*           xInd,
+                                  const hipComplex*    y,
+                                  hipComplex*          result,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
+                                  int                     nnz,
+                                  const hipDoubleComplex* xVal,
+                                  const int*              xInd,
+                                  const hipDoubleComplex* y,
+                                  hipDoubleComplex*       result,
+                                  hipsparseIndexBase_t    idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const float*         y,
+                                 float*               xVal,
+                                 const int*           xInd,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const double*        y,
+                                 double*              xVal,
+                                 const int*           xInd,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const hipComplex*    y,
+                                 hipComplex*          xVal,
+                                 const int*           xInd,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
+                                 int                     nnz,
+                                 const hipDoubleComplex* y,
+                                 hipDoubleComplex*       xVal,
+                                 const int*              xInd,
+                                 hipsparseIndexBase_t    idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  float*               y,
+                                  float*               xVal,
+                                  const int*           xInd,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  double*              y,
+                                  double*              xVal,
+                                  const int*           xInd,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  hipComplex*          y,
+                                  hipComplex*          xVal,
+                                  const int*           xInd,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
+                                  int                  nnz,
+                                  hipDoubleComplex*    y,
+                                  hipDoubleComplex*    xVal,
+                                  const int*           xInd,
+                                  hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 float*               xVal,
+                                 const int*           xInd,
+                                 float*               y,
+                                 const float*         c,
+                                 const float*         s,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 double*              xVal,
+                                 const int*           xInd,
+                                 double*              y,
+                                 const double*        c,
+                                 const double*        s,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const float*         xVal,
+                                 const int*           xInd,
+                                 float*               y,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const double*        xVal,
+                                 const int*           xInd,
+                                 double*              y,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
+                                 int                  nnz,
+                                 const hipComplex*    xVal,
+                                 const int*           xInd,
+                                 hipComplex*          y,
+                                 hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
+                                 int                     nnz,
+                                 const hipDoubleComplex* xVal,
+                                 const int*              xInd,
+                                 hipDoubleComplex*       y,
+                                 hipsparseIndexBase_t    idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const float*              csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const double*             csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipComplex*         csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipComplex*         x,
+                                  const hipComplex*         beta,
+                                  hipComplex*               y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       nnz,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipDoubleComplex*   csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipDoubleComplex*   x,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle,
+                                             csrsv2Info_t      info,
+                                             int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      transA,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              float*                    csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      transA,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              double*                   csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      transA,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipComplex*               csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseOperation_t      transA,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipDoubleComplex*         csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 float*                    csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 csrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 double*                   csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 csrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 hipComplex*               csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 csrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 hipDoubleComplex*         csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 csrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            int                       m,
+                                            int                       nnz,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            csrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            int                       m,
+                                            int                       nnz,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            csrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            int                       m,
+                                            int                       nnz,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipComplex*         csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            csrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseOperation_t      transA,
+                                            int                       m,
+                                            int                       nnz,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipDoubleComplex*   csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            csrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseOperation_t      transA,
+                                         int                       m,
+                                         int                       nnz,
+                                         const float*              alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csrsv2Info_t              info,
+                                         const float*              f,
+                                         float*                    x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseOperation_t      transA,
+                                         int                       m,
+                                         int                       nnz,
+                                         const double*             alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csrsv2Info_t              info,
+                                         const double*             f,
+                                         double*                   x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseOperation_t      transA,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipComplex*         alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csrsv2Info_t              info,
+                                         const hipComplex*         f,
+                                         hipComplex*               x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseOperation_t      transA,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipDoubleComplex*   alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         csrsv2Info_t              info,
+                                         const hipDoubleComplex*   f,
+                                         hipDoubleComplex*         x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipsparseHybMat_t   hybA,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipsparseHybMat_t   hybA,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipsparseHybMat_t   hybA,
+                                  const hipComplex*         x,
+                                  const hipComplex*         beta,
+                                  hipComplex*               y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipsparseHybMat_t   hybA,
+                                  const hipDoubleComplex*   x,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         y)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle,
+                                             bsrsv2Info_t      info,
+                                             int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              float*                    bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              double*                   bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipComplex*               bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipDoubleComplex*         bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsv2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dirA,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       mb,
+                                                 int                       nnzb,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 float*                    bsrSortedValA,
+                                                 const int*                bsrSortedRowPtrA,
+                                                 const int*                bsrSortedColIndA,
+                                                 int                       blockDim,
+                                                 bsrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dirA,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       mb,
+                                                 int                       nnzb,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 double*                   bsrSortedValA,
+                                                 const int*                bsrSortedRowPtrA,
+                                                 const int*                bsrSortedColIndA,
+                                                 int                       blockDim,
+                                                 bsrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dirA,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       mb,
+                                                 int                       nnzb,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 hipComplex*               bsrSortedValA,
+                                                 const int*                bsrSortedRowPtrA,
+                                                 const int*                bsrSortedColIndA,
+                                                 int                       blockDim,
+                                                 bsrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dirA,
+                                                 hipsparseOperation_t      transA,
+                                                 int                       mb,
+                                                 int                       nnzb,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 hipDoubleComplex*         bsrSortedValA,
+                                                 const int*                bsrSortedRowPtrA,
+                                                 const int*                bsrSortedColIndA,
+                                                 int                       blockDim,
+                                                 bsrsv2Info_t              info,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            int                       mb,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            int                       mb,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            int                       mb,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipComplex*         bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            int                       mb,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipDoubleComplex*   bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsv2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         int                       mb,
+                                         int                       nnzb,
+                                         const float*              alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsv2Info_t              info,
+                                         const float*              f,
+                                         float*                    x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         int                       mb,
+                                         int                       nnzb,
+                                         const double*             alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsv2Info_t              info,
+                                         const double*             f,
+                                         double*                   x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         int                       mb,
+                                         int                       nnzb,
+                                         const hipComplex*         alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsv2Info_t              info,
+                                         const hipComplex*         f,
+                                         hipComplex*               x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         int                       mb,
+                                         int                       nnzb,
+                                         const hipDoubleComplex*   alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsv2Info_t              info,
+                                         const hipDoubleComplex*   f,
+                                         hipDoubleComplex*         x,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
+                                             hipsparseOperation_t transA,
+                                             int                  m,
+                                             int                  n,
+                                             int                  nnz,
+                                             int*                 pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
+                                             hipsparseOperation_t transA,
+                                             int                  m,
+                                             int                  n,
+                                             int                  nnz,
+                                             int*                 pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
+                                             hipsparseOperation_t transA,
+                                             int                  m,
+                                             int                  n,
+                                             int                  nnz,
+                                             int*                 pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
+                                             hipsparseOperation_t transA,
+                                             int                  m,
+                                             int                  n,
+                                             int                  nnz,
+                                             int*                 pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
+                                  hipsparseOperation_t transA,
+                                  int                  m,
+                                  int                  n,
+                                  const float*         alpha,
+                                  const float*         A,
+                                  int                  lda,
+                                  int                  nnz,
+                                  const float*         x,
+                                  const int*           xInd,
+                                  const float*         beta,
+                                  float*               y,
+                                  hipsparseIndexBase_t idxBase,
+                                  void*                pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
+                                  hipsparseOperation_t transA,
+                                  int                  m,
+                                  int                  n,
+                                  const double*        alpha,
+                                  const double*        A,
+                                  int                  lda,
+                                  int                  nnz,
+                                  const double*        x,
+                                  const int*           xInd,
+                                  const double*        beta,
+                                  double*              y,
+                                  hipsparseIndexBase_t idxBase,
+                                  void*                pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
+                                  hipsparseOperation_t transA,
+                                  int                  m,
+                                  int                  n,
+                                  const hipComplex*    alpha,
+                                  const hipComplex*    A,
+                                  int                  lda,
+                                  int                  nnz,
+                                  const hipComplex*    x,
+                                  const int*           xInd,
+                                  const hipComplex*    beta,
+                                  hipComplex*          y,
+                                  hipsparseIndexBase_t idxBase,
+                                  void*                pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
+                                  hipsparseOperation_t    transA,
+                                  int                     m,
+                                  int                     n,
+                                  const hipDoubleComplex* alpha,
+                                  const hipDoubleComplex* A,
+                                  int                     lda,
+                                  int                     nnz,
+                                  const hipDoubleComplex* x,
+                                  const int*              xInd,
+                                  const hipDoubleComplex* beta,
+                                  hipDoubleComplex*       y,
+                                  hipsparseIndexBase_t    idxBase,
+                                  void*                   pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const float*              alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const float*              csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const float*              B,
+                                  int                       ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const double*             alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const double*             csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const double*             B,
+                                  int                       ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const hipComplex*         alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipComplex*         csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipComplex*         B,
+                                  int                       ldb,
+                                  const hipComplex*         beta,
+                                  hipComplex*               C,
+                                  int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
+                                  hipsparseOperation_t      transA,
+                                  int                       m,
+                                  int                       n,
+                                  int                       k,
+                                  int                       nnz,
+                                  const hipDoubleComplex*   alpha,
+                                  const hipsparseMatDescr_t descrA,
+                                  const hipDoubleComplex*   csrSortedValA,
+                                  const int*                csrSortedRowPtrA,
+                                  const int*                csrSortedColIndA,
+                                  const hipDoubleComplex*   B,
+                                  int                       ldb,
+                                  const hipDoubleComplex*   beta,
+                                  hipDoubleComplex*         C,
+                                  int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const float*              alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const float*              csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const float*              B,
+                                   int                       ldb,
+                                   const float*              beta,
+                                   float*                    C,
+                                   int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const double*             alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const double*             csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const double*             B,
+                                   int                       ldb,
+                                   const double*             beta,
+                                   double*                   C,
+                                   int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const hipComplex*         alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const hipComplex*         csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const hipComplex*         B,
+                                   int                       ldb,
+                                   const hipComplex*         beta,
+                                   hipComplex*               C,
+                                   int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
+                                   hipsparseOperation_t      transA,
+                                   hipsparseOperation_t      transB,
+                                   int                       m,
+                                   int                       n,
+                                   int                       k,
+                                   int                       nnz,
+                                   const hipDoubleComplex*   alpha,
+                                   const hipsparseMatDescr_t descrA,
+                                   const hipDoubleComplex*   csrSortedValA,
+                                   const int*                csrSortedRowPtrA,
+                                   const int*                csrSortedColIndA,
+                                   const hipDoubleComplex*   B,
+                                   int                       ldb,
+                                   const hipDoubleComplex*   beta,
+                                   hipDoubleComplex*         C,
+                                   int                       ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle,
+                                             bsrsm2Info_t      info,
+                                             int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              hipsparseOperation_t      transX,
+                                              int                       mb,
+                                              int                       nrhs,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              float*                    bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsm2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              hipsparseOperation_t      transX,
+                                              int                       mb,
+                                              int                       nrhs,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              double*                   bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsm2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              hipsparseOperation_t      transX,
+                                              int                       mb,
+                                              int                       nrhs,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipComplex*               bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsm2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              hipsparseOperation_t      transA,
+                                              hipsparseOperation_t      transX,
+                                              int                       mb,
+                                              int                       nrhs,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipDoubleComplex*         bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrsm2Info_t              info,
+                                              int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transX,
+                                            int                       mb,
+                                            int                       nrhs,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transX,
+                                            int                       mb,
+                                            int                       nrhs,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transX,
+                                            int                       mb,
+                                            int                       nrhs,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipComplex*         bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
+                                            hipsparseDirection_t      dirA,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transX,
+                                            int                       mb,
+                                            int                       nrhs,
+                                            int                       nnzb,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipDoubleComplex*   bsrSortedValA,
+                                            const int*                bsrSortedRowPtrA,
+                                            const int*                bsrSortedColIndA,
+                                            int                       blockDim,
+                                            bsrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transX,
+                                         int                       mb,
+                                         int                       nrhs,
+                                         int                       nnzb,
+                                         const float*              alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsm2Info_t              info,
+                                         const float*              B,
+                                         int                       ldb,
+                                         float*                    X,
+                                         int                       ldx,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transX,
+                                         int                       mb,
+                                         int                       nrhs,
+                                         int                       nnzb,
+                                         const double*             alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsm2Info_t              info,
+                                         const double*             B,
+                                         int                       ldb,
+                                         double*                   X,
+                                         int                       ldx,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transX,
+                                         int                       mb,
+                                         int                       nrhs,
+                                         int                       nnzb,
+                                         const hipComplex*         alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsm2Info_t              info,
+                                         const hipComplex*         B,
+                                         int                       ldb,
+                                         hipComplex*               X,
+                                         int                       ldx,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dirA,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transX,
+                                         int                       mb,
+                                         int                       nrhs,
+                                         int                       nnzb,
+                                         const hipDoubleComplex*   alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   bsrSortedValA,
+                                         const int*                bsrSortedRowPtrA,
+                                         const int*                bsrSortedColIndA,
+                                         int                       blockDim,
+                                         bsrsm2Info_t              info,
+                                         const hipDoubleComplex*   B,
+                                         int                       ldb,
+                                         hipDoubleComplex*         X,
+                                         int                       ldx,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle,
+                                             csrsm2Info_t      info,
+                                             int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 int                       algo,
+                                                 hipsparseOperation_t      transA,
+                                                 hipsparseOperation_t      transB,
+                                                 int                       m,
+                                                 int                       nrhs,
+                                                 int                       nnz,
+                                                 const float*              alpha,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const float*              csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 const float*              B,
+                                                 int                       ldb,
+                                                 csrsm2Info_t              info,
+                                                 hipsparseSolvePolicy_t    policy,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 int                       algo,
+                                                 hipsparseOperation_t      transA,
+                                                 hipsparseOperation_t      transB,
+                                                 int                       m,
+                                                 int                       nrhs,
+                                                 int                       nnz,
+                                                 const double*             alpha,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const double*             csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 const double*             B,
+                                                 int                       ldb,
+                                                 csrsm2Info_t              info,
+                                                 hipsparseSolvePolicy_t    policy,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 int                       algo,
+                                                 hipsparseOperation_t      transA,
+                                                 hipsparseOperation_t      transB,
+                                                 int                       m,
+                                                 int                       nrhs,
+                                                 int                       nnz,
+                                                 const hipComplex*         alpha,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const hipComplex*         csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 const hipComplex*         B,
+                                                 int                       ldb,
+                                                 csrsm2Info_t              info,
+                                                 hipsparseSolvePolicy_t    policy,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                 int                       algo,
+                                                 hipsparseOperation_t      transA,
+                                                 hipsparseOperation_t      transB,
+                                                 int                       m,
+                                                 int                       nrhs,
+                                                 int                       nnz,
+                                                 const hipDoubleComplex*   alpha,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const hipDoubleComplex*   csrSortedValA,
+                                                 const int*                csrSortedRowPtrA,
+                                                 const int*                csrSortedColIndA,
+                                                 const hipDoubleComplex*   B,
+                                                 int                       ldb,
+                                                 csrsm2Info_t              info,
+                                                 hipsparseSolvePolicy_t    policy,
+                                                 size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
+                                            int                       algo,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       nrhs,
+                                            int                       nnz,
+                                            const float*              alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            const float*              B,
+                                            int                       ldb,
+                                            csrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
+                                            int                       algo,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       nrhs,
+                                            int                       nnz,
+                                            const double*             alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            const double*             B,
+                                            int                       ldb,
+                                            csrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
+                                            int                       algo,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       nrhs,
+                                            int                       nnz,
+                                            const hipComplex*         alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipComplex*         csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            const hipComplex*         B,
+                                            int                       ldb,
+                                            csrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
+                                            int                       algo,
+                                            hipsparseOperation_t      transA,
+                                            hipsparseOperation_t      transB,
+                                            int                       m,
+                                            int                       nrhs,
+                                            int                       nnz,
+                                            const hipDoubleComplex*   alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            const hipDoubleComplex*   csrSortedValA,
+                                            const int*                csrSortedRowPtrA,
+                                            const int*                csrSortedColIndA,
+                                            const hipDoubleComplex*   B,
+                                            int                       ldb,
+                                            csrsm2Info_t              info,
+                                            hipsparseSolvePolicy_t    policy,
+                                            void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
+                                         int                       algo,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transB,
+                                         int                       m,
+                                         int                       nrhs,
+                                         int                       nnz,
+                                         const float*              alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         float*                    B,
+                                         int                       ldb,
+                                         csrsm2Info_t              info,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
+                                         int                       algo,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transB,
+                                         int                       m,
+                                         int                       nrhs,
+                                         int                       nnz,
+                                         const double*             alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         double*                   B,
+                                         int                       ldb,
+                                         csrsm2Info_t              info,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
+                                         int                       algo,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transB,
+                                         int                       m,
+                                         int                       nrhs,
+                                         int                       nnz,
+                                         const hipComplex*         alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         hipComplex*               B,
+                                         int                       ldb,
+                                         csrsm2Info_t              info,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
+                                         int                       algo,
+                                         hipsparseOperation_t      transA,
+                                         hipsparseOperation_t      transB,
+                                         int                       m,
+                                         int                       nrhs,
+                                         int                       nnz,
+                                         const hipDoubleComplex*   alpha,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrSortedValA,
+                                         const int*                csrSortedRowPtrA,
+                                         const int*                csrSortedColIndA,
+                                         hipDoubleComplex*         B,
+                                         int                       ldb,
+                                         csrsm2Info_t              info,
+                                         hipsparseSolvePolicy_t    policy,
+                                         void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  int               nnz,
+                                  const float*      alpha,
+                                  const float*      A,
+                                  int               lda,
+                                  const float*      cscValB,
+                                  const int*        cscColPtrB,
+                                  const int*        cscRowIndB,
+                                  const float*      beta,
+                                  float*            C,
+                                  int               ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  int               nnz,
+                                  const double*     alpha,
+                                  const double*     A,
+                                  int               lda,
+                                  const double*     cscValB,
+                                  const int*        cscColPtrB,
+                                  const int*        cscRowIndB,
+                                  const double*     beta,
+                                  double*           C,
+                                  int               ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  int               nnz,
+                                  const hipComplex* alpha,
+                                  const hipComplex* A,
+                                  int               lda,
+                                  const hipComplex* cscValB,
+                                  const int*        cscColPtrB,
+                                  const int*        cscRowIndB,
+                                  const hipComplex* beta,
+                                  hipComplex*       C,
+                                  int               ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  int                     nnz,
+                                  const hipDoubleComplex* alpha,
+                                  const hipDoubleComplex* A,
+                                  int                     lda,
+                                  const hipDoubleComplex* cscValB,
+                                  const int*              cscColPtrB,
+                                  const int*              cscRowIndB,
+                                  const hipDoubleComplex* beta,
+                                  hipDoubleComplex*       C,
+                                  int                     ldc)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       n,
+                                       const hipsparseMatDescr_t descrA,
+                                       int                       nnzA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const hipsparseMatDescr_t descrB,
+                                       int                       nnzB,
+                                       const int*                csrRowPtrB,
+                                       const int*                csrColIndB,
+                                       const hipsparseMatDescr_t descrC,
+                                       int*                      csrRowPtrC,
+                                       int*                      nnzTotalDevHostPtr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const float*              alpha,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const float*              csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const float*              beta,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const float*              csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const double*             alpha,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const double*             csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const double*             beta,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const double*             csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipComplex*         alpha,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const hipComplex*         csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipComplex*         beta,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const hipComplex*         csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipDoubleComplex*   alpha,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const hipDoubleComplex*   csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipDoubleComplex*   beta,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const hipDoubleComplex*   csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   const float*              alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const float*              csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   const float*              beta,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const float*              csrSortedValB,
+                                                   const int*                csrSortedRowPtrB,
+                                                   const int*                csrSortedColIndB,
+                                                   const hipsparseMatDescr_t descrC,
+                                                   const float*              csrSortedValC,
+                                                   const int*                csrSortedRowPtrC,
+                                                   const int*                csrSortedColIndC,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   const double*             alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const double*             csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   const double*             beta,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const double*             csrSortedValB,
+                                                   const int*                csrSortedRowPtrB,
+                                                   const int*                csrSortedColIndB,
+                                                   const hipsparseMatDescr_t descrC,
+                                                   const double*             csrSortedValC,
+                                                   const int*                csrSortedRowPtrC,
+                                                   const int*                csrSortedColIndC,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   const hipComplex*         alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const hipComplex*         csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   const hipComplex*         beta,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const hipComplex*         csrSortedValB,
+                                                   const int*                csrSortedRowPtrB,
+                                                   const int*                csrSortedColIndB,
+                                                   const hipsparseMatDescr_t descrC,
+                                                   const hipComplex*         csrSortedValC,
+                                                   const int*                csrSortedRowPtrC,
+                                                   const int*                csrSortedColIndC,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   const hipDoubleComplex*   alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const hipDoubleComplex*   csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   const hipDoubleComplex*   beta,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const hipDoubleComplex*   csrSortedValB,
+                                                   const int*                csrSortedRowPtrB,
+                                                   const int*                csrSortedColIndB,
+                                                   const hipsparseMatDescr_t descrC,
+                                                   const hipDoubleComplex*   csrSortedValC,
+                                                   const int*                csrSortedRowPtrC,
+                                                   const int*                csrSortedColIndC,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
+                                        int                       m,
+                                        int                       n,
+                                        const hipsparseMatDescr_t descrA,
+                                        int                       nnzA,
+                                        const int*                csrSortedRowPtrA,
+                                        const int*                csrSortedColIndA,
+                                        const hipsparseMatDescr_t descrB,
+                                        int                       nnzB,
+                                        const int*                csrSortedRowPtrB,
+                                        const int*                csrSortedColIndB,
+                                        const hipsparseMatDescr_t descrC,
+                                        int*                      csrSortedRowPtrC,
+                                        int*                      nnzTotalDevHostPtr,
+                                        void*                     workspace)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const float*              alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const float*              csrSortedValA,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     const float*              beta,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const float*              csrSortedValB,
+                                     const int*                csrSortedRowPtrB,
+                                     const int*                csrSortedColIndB,
+                                     const hipsparseMatDescr_t descrC,
+                                     float*                    csrSortedValC,
+                                     int*                      csrSortedRowPtrC,
+                                     int*                      csrSortedColIndC,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const double*             alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const double*             csrSortedValA,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     const double*             beta,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const double*             csrSortedValB,
+                                     const int*                csrSortedRowPtrB,
+                                     const int*                csrSortedColIndB,
+                                     const hipsparseMatDescr_t descrC,
+                                     double*                   csrSortedValC,
+                                     int*                      csrSortedRowPtrC,
+                                     int*                      csrSortedColIndC,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipComplex*         alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const hipComplex*         csrSortedValA,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     const hipComplex*         beta,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const hipComplex*         csrSortedValB,
+                                     const int*                csrSortedRowPtrB,
+                                     const int*                csrSortedColIndB,
+                                     const hipsparseMatDescr_t descrC,
+                                     hipComplex*               csrSortedValC,
+                                     int*                      csrSortedRowPtrC,
+                                     int*                      csrSortedColIndC,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     const hipDoubleComplex*   alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const hipDoubleComplex*   csrSortedValA,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     const hipDoubleComplex*   beta,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const hipDoubleComplex*   csrSortedValB,
+                                     const int*                csrSortedRowPtrB,
+                                     const int*                csrSortedColIndB,
+                                     const hipsparseMatDescr_t descrC,
+                                     hipDoubleComplex*         csrSortedValC,
+                                     int*                      csrSortedRowPtrC,
+                                     int*                      csrSortedColIndC,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
+                                       hipsparseOperation_t      transA,
+                                       hipsparseOperation_t      transB,
+                                       int                       m,
+                                       int                       n,
+                                       int                       k,
+                                       const hipsparseMatDescr_t descrA,
+                                       int                       nnzA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const hipsparseMatDescr_t descrB,
+                                       int                       nnzB,
+                                       const int*                csrRowPtrB,
+                                       const int*                csrColIndB,
+                                       const hipsparseMatDescr_t descrC,
+                                       int*                      csrRowPtrC,
+                                       int*                      nnzTotalDevHostPtr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const float*              csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const float*              csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const double*             csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const double*             csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const hipComplex*         csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const hipComplex*         csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
+                                    hipsparseOperation_t      transA,
+                                    hipsparseOperation_t      transB,
+                                    int                       m,
+                                    int                       n,
+                                    int                       k,
+                                    const hipsparseMatDescr_t descrA,
+                                    int                       nnzA,
+                                    const hipDoubleComplex*   csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    const hipsparseMatDescr_t descrB,
+                                    int                       nnzB,
+                                    const hipDoubleComplex*   csrValB,
+                                    const int*                csrRowPtrB,
+                                    const int*                csrColIndB,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         csrValC,
+                                    const int*                csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   int                       k,
+                                                   const float*              alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const int*                csrRowPtrA,
+                                                   const int*                csrColIndA,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const int*                csrRowPtrB,
+                                                   const int*                csrColIndB,
+                                                   const float*              beta,
+                                                   const hipsparseMatDescr_t descrD,
+                                                   int                       nnzD,
+                                                   const int*                csrRowPtrD,
+                                                   const int*                csrColIndD,
+                                                   csrgemm2Info_t            info,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   int                       k,
+                                                   const double*             alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const int*                csrRowPtrA,
+                                                   const int*                csrColIndA,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const int*                csrRowPtrB,
+                                                   const int*                csrColIndB,
+                                                   const double*             beta,
+                                                   const hipsparseMatDescr_t descrD,
+                                                   int                       nnzD,
+                                                   const int*                csrRowPtrD,
+                                                   const int*                csrColIndD,
+                                                   csrgemm2Info_t            info,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   int                       k,
+                                                   const hipComplex*         alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const int*                csrRowPtrA,
+                                                   const int*                csrColIndA,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const int*                csrRowPtrB,
+                                                   const int*                csrColIndB,
+                                                   const hipComplex*         beta,
+                                                   const hipsparseMatDescr_t descrD,
+                                                   int                       nnzD,
+                                                   const int*                csrRowPtrD,
+                                                   const int*                csrColIndD,
+                                                   csrgemm2Info_t            info,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       n,
+                                                   int                       k,
+                                                   const hipDoubleComplex*   alpha,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   int                       nnzA,
+                                                   const int*                csrRowPtrA,
+                                                   const int*                csrColIndA,
+                                                   const hipsparseMatDescr_t descrB,
+                                                   int                       nnzB,
+                                                   const int*                csrRowPtrB,
+                                                   const int*                csrColIndB,
+                                                   const hipDoubleComplex*   beta,
+                                                   const hipsparseMatDescr_t descrD,
+                                                   int                       nnzD,
+                                                   const int*                csrRowPtrD,
+                                                   const int*                csrColIndD,
+                                                   csrgemm2Info_t            info,
+                                                   size_t*                   pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
+                                        int                       m,
+                                        int                       n,
+                                        int                       k,
+                                        const hipsparseMatDescr_t descrA,
+                                        int                       nnzA,
+                                        const int*                csrRowPtrA,
+                                        const int*                csrColIndA,
+                                        const hipsparseMatDescr_t descrB,
+                                        int                       nnzB,
+                                        const int*                csrRowPtrB,
+                                        const int*                csrColIndB,
+                                        const hipsparseMatDescr_t descrD,
+                                        int                       nnzD,
+                                        const int*                csrRowPtrD,
+                                        const int*                csrColIndD,
+                                        const hipsparseMatDescr_t descrC,
+                                        int*                      csrRowPtrC,
+                                        int*                      nnzTotalDevHostPtr,
+                                        const csrgemm2Info_t      info,
+                                        void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       k,
+                                     const float*              alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const float*              csrValB,
+                                     const int*                csrRowPtrB,
+                                     const int*                csrColIndB,
+                                     const float*              beta,
+                                     const hipsparseMatDescr_t descrD,
+                                     int                       nnzD,
+                                     const float*              csrValD,
+                                     const int*                csrRowPtrD,
+                                     const int*                csrColIndD,
+                                     const hipsparseMatDescr_t descrC,
+                                     float*                    csrValC,
+                                     const int*                csrRowPtrC,
+                                     int*                      csrColIndC,
+                                     const csrgemm2Info_t      info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       k,
+                                     const double*             alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const double*             csrValB,
+                                     const int*                csrRowPtrB,
+                                     const int*                csrColIndB,
+                                     const double*             beta,
+                                     const hipsparseMatDescr_t descrD,
+                                     int                       nnzD,
+                                     const double*             csrValD,
+                                     const int*                csrRowPtrD,
+                                     const int*                csrColIndD,
+                                     const hipsparseMatDescr_t descrC,
+                                     double*                   csrValC,
+                                     const int*                csrRowPtrC,
+                                     int*                      csrColIndC,
+                                     const csrgemm2Info_t      info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       k,
+                                     const hipComplex*         alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const hipComplex*         csrValB,
+                                     const int*                csrRowPtrB,
+                                     const int*                csrColIndB,
+                                     const hipComplex*         beta,
+                                     const hipsparseMatDescr_t descrD,
+                                     int                       nnzD,
+                                     const hipComplex*         csrValD,
+                                     const int*                csrRowPtrD,
+                                     const int*                csrColIndD,
+                                     const hipsparseMatDescr_t descrC,
+                                     hipComplex*               csrValC,
+                                     const int*                csrRowPtrC,
+                                     int*                      csrColIndC,
+                                     const csrgemm2Info_t      info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       k,
+                                     const hipDoubleComplex*   alpha,
+                                     const hipsparseMatDescr_t descrA,
+                                     int                       nnzA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const hipsparseMatDescr_t descrB,
+                                     int                       nnzB,
+                                     const hipDoubleComplex*   csrValB,
+                                     const int*                csrRowPtrB,
+                                     const int*                csrColIndB,
+                                     const hipDoubleComplex*   beta,
+                                     const hipsparseMatDescr_t descrD,
+                                     int                       nnzD,
+                                     const hipDoubleComplex*   csrValD,
+                                     const int*                csrRowPtrD,
+                                     const int*                csrColIndD,
+                                     const hipsparseMatDescr_t descrC,
+                                     hipDoubleComplex*         csrValC,
+                                     const int*                csrRowPtrC,
+                                     int*                      csrColIndC,
+                                     const csrgemm2Info_t      info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle,
+                                               bsrilu02Info_t    info,
+                                               int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  bsrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  float*            boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  bsrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  double*           boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  bsrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  hipComplex*       boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  bsrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  hipDoubleComplex* boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                hipsparseDirection_t      dirA,
+                                                int                       mb,
+                                                int                       nnzb,
+                                                const hipsparseMatDescr_t descrA,
+                                                float*                    bsrSortedValA,
+                                                const int*                bsrSortedRowPtrA,
+                                                const int*                bsrSortedColIndA,
+                                                int                       blockDim,
+                                                bsrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                hipsparseDirection_t      dirA,
+                                                int                       mb,
+                                                int                       nnzb,
+                                                const hipsparseMatDescr_t descrA,
+                                                double*                   bsrSortedValA,
+                                                const int*                bsrSortedRowPtrA,
+                                                const int*                bsrSortedColIndA,
+                                                int                       blockDim,
+                                                bsrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                hipsparseDirection_t      dirA,
+                                                int                       mb,
+                                                int                       nnzb,
+                                                const hipsparseMatDescr_t descrA,
+                                                hipComplex*               bsrSortedValA,
+                                                const int*                bsrSortedRowPtrA,
+                                                const int*                bsrSortedColIndA,
+                                                int                       blockDim,
+                                                bsrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                hipsparseDirection_t      dirA,
+                                                int                       mb,
+                                                int                       nnzb,
+                                                const hipsparseMatDescr_t descrA,
+                                                hipDoubleComplex*         bsrSortedValA,
+                                                const int*                bsrSortedRowPtrA,
+                                                const int*                bsrSortedColIndA,
+                                                int                       blockDim,
+                                                bsrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              float*                    bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              double*                   bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipComplex*               bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
+                                              hipsparseDirection_t      dirA,
+                                              int                       mb,
+                                              int                       nnzb,
+                                              const hipsparseMatDescr_t descrA,
+                                              hipDoubleComplex*         bsrSortedValA,
+                                              const int*                bsrSortedRowPtrA,
+                                              const int*                bsrSortedColIndA,
+                                              int                       blockDim,
+                                              bsrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
+                                     hipsparseDirection_t      dirA,
+                                     int                       mb,
+                                     int                       nnzb,
+                                     const hipsparseMatDescr_t descrA,
+                                     float*                    bsrSortedValA_valM,
+                                     const int*                bsrSortedRowPtrA,
+                                     const int*                bsrSortedColIndA,
+                                     int                       blockDim,
+                                     bsrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
+                                     hipsparseDirection_t      dirA,
+                                     int                       mb,
+                                     int                       nnzb,
+                                     const hipsparseMatDescr_t descrA,
+                                     double*                   bsrSortedValA_valM,
+                                     const int*                bsrSortedRowPtrA,
+                                     const int*                bsrSortedColIndA,
+                                     int                       blockDim,
+                                     bsrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
+                                     hipsparseDirection_t      dirA,
+                                     int                       mb,
+                                     int                       nnzb,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipComplex*               bsrSortedValA_valM,
+                                     const int*                bsrSortedRowPtrA,
+                                     const int*                bsrSortedColIndA,
+                                     int                       blockDim,
+                                     bsrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
+                                     hipsparseDirection_t      dirA,
+                                     int                       mb,
+                                     int                       nnzb,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         bsrSortedValA_valM,
+                                     const int*                bsrSortedRowPtrA,
+                                     const int*                bsrSortedColIndA,
+                                     int                       blockDim,
+                                     bsrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle,
+                                               csrilu02Info_t    info,
+                                               int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  csrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  float*            boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  csrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  double*           boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  csrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  hipComplex*       boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
+                                                  csrilu02Info_t    info,
+                                                  int               enable_boost,
+                                                  double*           tol,
+                                                  hipDoubleComplex* boost_val)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                float*                    csrSortedValA,
+                                                const int*                csrSortedRowPtrA,
+                                                const int*                csrSortedColIndA,
+                                                csrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                double*                   csrSortedValA,
+                                                const int*                csrSortedRowPtrA,
+                                                const int*                csrSortedColIndA,
+                                                csrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                hipComplex*               csrSortedValA,
+                                                const int*                csrSortedRowPtrA,
+                                                const int*                csrSortedColIndA,
+                                                csrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                hipDoubleComplex*         csrSortedValA,
+                                                const int*                csrSortedRowPtrA,
+                                                const int*                csrSortedColIndA,
+                                                csrilu02Info_t            info,
+                                                int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   float*                    csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            info,
+                                                   size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   double*                   csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            info,
+                                                   size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   hipComplex*               csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            info,
+                                                   size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                   int                       m,
+                                                   int                       nnz,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   hipDoubleComplex*         csrSortedValA,
+                                                   const int*                csrSortedRowPtrA,
+                                                   const int*                csrSortedColIndA,
+                                                   csrilu02Info_t            info,
+                                                   size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              const float*              csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              const double*             csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              const hipComplex*         csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       nnz,
+                                              const hipsparseMatDescr_t descrA,
+                                              const hipDoubleComplex*   csrSortedValA,
+                                              const int*                csrSortedRowPtrA,
+                                              const int*                csrSortedColIndA,
+                                              csrilu02Info_t            info,
+                                              hipsparseSolvePolicy_t    policy,
+                                              void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     float*                    csrSortedValA_valM,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     csrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     double*                   csrSortedValA_valM,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     csrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipComplex*               csrSortedValA_valM,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     csrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         csrSortedValA_valM,
+                                     const int*                csrSortedRowPtrA,
+                                     const int*                csrSortedColIndA,
+                                     csrilu02Info_t            info,
+                                     hipsparseSolvePolicy_t    policy,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle,
+                                              bsric02Info_t     info,
+                                              int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
+                                               hipsparseDirection_t      dirA,
+                                               int                       mb,
+                                               int                       nnzb,
+                                               const hipsparseMatDescr_t descrA,
+                                               float*                    bsrValA,
+                                               const int*                bsrRowPtrA,
+                                               const int*                bsrColIndA,
+                                               int                       blockDim,
+                                               bsric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
+                                               hipsparseDirection_t      dirA,
+                                               int                       mb,
+                                               int                       nnzb,
+                                               const hipsparseMatDescr_t descrA,
+                                               double*                   bsrValA,
+                                               const int*                bsrRowPtrA,
+                                               const int*                bsrColIndA,
+                                               int                       blockDim,
+                                               bsric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
+                                               hipsparseDirection_t      dirA,
+                                               int                       mb,
+                                               int                       nnzb,
+                                               const hipsparseMatDescr_t descrA,
+                                               hipComplex*               bsrValA,
+                                               const int*                bsrRowPtrA,
+                                               const int*                bsrColIndA,
+                                               int                       blockDim,
+                                               bsric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
+                                               hipsparseDirection_t      dirA,
+                                               int                       mb,
+                                               int                       nnzb,
+                                               const hipsparseMatDescr_t descrA,
+                                               hipDoubleComplex*         bsrValA,
+                                               const int*                bsrRowPtrA,
+                                               const int*                bsrColIndA,
+                                               int                       blockDim,
+                                               bsric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
+                                             hipsparseDirection_t      dirA,
+                                             int                       mb,
+                                             int                       nnzb,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              bsrValA,
+                                             const int*                bsrRowPtrA,
+                                             const int*                bsrColIndA,
+                                             int                       blockDim,
+                                             bsric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
+                                             hipsparseDirection_t      dirA,
+                                             int                       mb,
+                                             int                       nnzb,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             bsrValA,
+                                             const int*                bsrRowPtrA,
+                                             const int*                bsrColIndA,
+                                             int                       blockDim,
+                                             bsric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
+                                             hipsparseDirection_t      dirA,
+                                             int                       mb,
+                                             int                       nnzb,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipComplex*         bsrValA,
+                                             const int*                bsrRowPtrA,
+                                             const int*                bsrColIndA,
+                                             int                       blockDim,
+                                             bsric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
+                                             hipsparseDirection_t      dirA,
+                                             int                       mb,
+                                             int                       nnzb,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipDoubleComplex*   bsrValA,
+                                             const int*                bsrRowPtrA,
+                                             const int*                bsrColIndA,
+                                             int                       blockDim,
+                                             bsric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    float*                    bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    bsric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    double*                   bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    bsric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    hipComplex*               bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    bsric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    hipDoubleComplex*         bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    bsric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle,
+                                              csric02Info_t     info,
+                                              int*              position)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
+                                               int                       m,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descrA,
+                                               float*                    csrSortedValA,
+                                               const int*                csrSortedRowPtrA,
+                                               const int*                csrSortedColIndA,
+                                               csric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
+                                               int                       m,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descrA,
+                                               double*                   csrSortedValA,
+                                               const int*                csrSortedRowPtrA,
+                                               const int*                csrSortedColIndA,
+                                               csric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
+                                               int                       m,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descrA,
+                                               hipComplex*               csrSortedValA,
+                                               const int*                csrSortedRowPtrA,
+                                               const int*                csrSortedColIndA,
+                                               csric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
+                                               int                       m,
+                                               int                       nnz,
+                                               const hipsparseMatDescr_t descrA,
+                                               hipDoubleComplex*         csrSortedValA,
+                                               const int*                csrSortedRowPtrA,
+                                               const int*                csrSortedColIndA,
+                                               csric02Info_t             info,
+                                               int*                      pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  float*                    csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             info,
+                                                  size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  double*                   csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             info,
+                                                  size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  hipComplex*               csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             info,
+                                                  size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       nnz,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  hipDoubleComplex*         csrSortedValA,
+                                                  const int*                csrSortedRowPtrA,
+                                                  const int*                csrSortedColIndA,
+                                                  csric02Info_t             info,
+                                                  size_t*                   pBufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipComplex*         csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnz,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipDoubleComplex*   csrSortedValA,
+                                             const int*                csrSortedRowPtrA,
+                                             const int*                csrSortedColIndA,
+                                             csric02Info_t             info,
+                                             hipsparseSolvePolicy_t    policy,
+                                             void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    float*                    csrSortedValA_valM,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    csric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    double*                   csrSortedValA_valM,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    csric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    hipComplex*               csrSortedValA_valM,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    csric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    hipDoubleComplex*         csrSortedValA_valM,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    csric02Info_t             info,
+                                    hipsparseSolvePolicy_t    policy,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const float*              A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const double*             A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const hipComplex*         A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
+                                hipsparseDirection_t      dirA,
+                                int                       m,
+                                int                       n,
+                                const hipsparseMatDescr_t descrA,
+                                const hipDoubleComplex*   A,
+                                int                       lda,
+                                int*                      nnzPerRowColumn,
+                                int*                      nnzTotalDevHostPtr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              A,
+                                      int                       ld,
+                                      const int*                nnz_per_rows,
+                                      float*                    csr_val,
+                                      int*                      csr_row_ptr,
+                                      int*                      csr_col_ind)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             A,
+                                      int                       ld,
+                                      const int*                nnz_per_rows,
+                                      double*                   csr_val,
+                                      int*                      csr_row_ptr,
+                                      int*                      csr_col_ind)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         A,
+                                      int                       ld,
+                                      const int*                nnz_per_rows,
+                                      hipComplex*               csr_val,
+                                      int*                      csr_row_ptr,
+                                      int*                      csr_col_ind)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   A,
+                                      int                       ld,
+                                      const int*                nnz_per_rows,
+                                      hipDoubleComplex*         csr_val,
+                                      int*                      csr_row_ptr,
+                                      int*                      csr_col_ind)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       n,
+                                                      const float*              A,
+                                                      int                       lda,
+                                                      const float*              threshold,
+                                                      const hipsparseMatDescr_t descr,
+                                                      const float*              csrVal,
+                                                      const int*                csrRowPtr,
+                                                      const int*                csrColInd,
+                                                      size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
+                                                      int                       m,
+                                                      int                       n,
+                                                      const double*             A,
+                                                      int                       lda,
+                                                      const double*             threshold,
+                                                      const hipsparseMatDescr_t descr,
+                                                      const double*             csrVal,
+                                                      const int*                csrRowPtr,
+                                                      const int*                csrColInd,
+                                                      size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       n,
+                                                         const float*              A,
+                                                         int                       lda,
+                                                         const float*              threshold,
+                                                         const hipsparseMatDescr_t descr,
+                                                         const float*              csrVal,
+                                                         const int*                csrRowPtr,
+                                                         const int*                csrColInd,
+                                                         size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                         int                       m,
+                                                         int                       n,
+                                                         const double*             A,
+                                                         int                       lda,
+                                                         const double*             threshold,
+                                                         const hipsparseMatDescr_t descr,
+                                                         const double*             csrVal,
+                                                         const int*                csrRowPtr,
+                                                         const int*                csrColInd,
+                                                         size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       n,
+                                              const float*              A,
+                                              int                       lda,
+                                              const float*              threshold,
+                                              const hipsparseMatDescr_t descr,
+                                              int*                      csrRowPtr,
+                                              int*                      nnzTotalDevHostPtr,
+                                              void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
+                                              int                       m,
+                                              int                       n,
+                                              const double*             A,
+                                              int                       lda,
+                                              const double*             threshold,
+                                              const hipsparseMatDescr_t descr,
+                                              int*                      csrRowPtr,
+                                              int*                      nnzTotalDevHostPtr,
+                                              void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       n,
+                                           const float*              A,
+                                           int                       lda,
+                                           const float*              threshold,
+                                           const hipsparseMatDescr_t descr,
+                                           float*                    csrVal,
+                                           const int*                csrRowPtr,
+                                           int*                      csrColInd,
+                                           void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       n,
+                                           const double*             A,
+                                           int                       lda,
+                                           const double*             threshold,
+                                           const hipsparseMatDescr_t descr,
+                                           double*                   csrVal,
+                                           const int*                csrRowPtr,
+                                           int*                      csrColInd,
+                                           void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       n,
+                                                    const float*              A,
+                                                    int                       lda,
+                                                    float                     percentage,
+                                                    const hipsparseMatDescr_t descr,
+                                                    const float*              csrVal,
+                                                    const int*                csrRowPtr,
+                                                    const int*                csrColInd,
+                                                    pruneInfo_t               info,
+                                                    size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       n,
+                                                    const double*             A,
+                                                    int                       lda,
+                                                    double                    percentage,
+                                                    const hipsparseMatDescr_t descr,
+                                                    const double*             csrVal,
+                                                    const int*                csrRowPtr,
+                                                    const int*                csrColInd,
+                                                    pruneInfo_t               info,
+                                                    size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseSpruneDense2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const float*              A,
+                                                       int                       lda,
+                                                       float                     percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       const float*              csrVal,
+                                                       const int*                csrRowPtr,
+                                                       const int*                csrColInd,
+                                                       pruneInfo_t               info,
+                                                       size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseDpruneDense2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const double*             A,
+                                                       int                       lda,
+                                                       double                    percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       const double*             csrVal,
+                                                       const int*                csrRowPtr,
+                                                       const int*                csrColInd,
+                                                       pruneInfo_t               info,
+                                                       size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            const float*              A,
+                                            int                       lda,
+                                            float                     percentage,
+                                            const hipsparseMatDescr_t descr,
+                                            int*                      csrRowPtr,
+                                            int*                      nnzTotalDevHostPtr,
+                                            pruneInfo_t               info,
+                                            void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            const double*             A,
+                                            int                       lda,
+                                            double                    percentage,
+                                            const hipsparseMatDescr_t descr,
+                                            int*                      csrRowPtr,
+                                            int*                      nnzTotalDevHostPtr,
+                                            pruneInfo_t               info,
+                                            void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const float*              A,
+                                                       int                       lda,
+                                                       float                     percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       float*                    csrVal,
+                                                       const int*                csrRowPtr,
+                                                       int*                      csrColInd,
+                                                       pruneInfo_t               info,
+                                                       void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       const double*             A,
+                                                       int                       lda,
+                                                       double                    percentage,
+                                                       const hipsparseMatDescr_t descr,
+                                                       double*                   csrVal,
+                                                       const int*                csrRowPtr,
+                                                       int*                      csrColInd,
+                                                       pruneInfo_t               info,
+                                                       void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              A,
+                                      int                       ld,
+                                      const int*                nnz_per_columns,
+                                      float*                    csc_val,
+                                      int*                      csc_row_ind,
+                                      int*                      csc_col_ptr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             A,
+                                      int                       ld,
+                                      const int*                nnz_per_columns,
+                                      double*                   csc_val,
+                                      int*                      csc_row_ind,
+                                      int*                      csc_col_ptr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         A,
+                                      int                       ld,
+                                      const int*                nnz_per_columns,
+                                      hipComplex*               csc_val,
+                                      int*                      csc_row_ind,
+                                      int*                      csc_col_ptr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   A,
+                                      int                       ld,
+                                      const int*                nnz_per_columns,
+                                      hipDoubleComplex*         csc_val,
+                                      int*                      csc_row_ind,
+                                      int*                      csc_col_ptr)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      float*                    A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      double*                   A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      hipComplex*               A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      hipDoubleComplex*         A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const float*              csc_val,
+                                      const int*                csc_row_ind,
+                                      const int*                csc_col_ptr,
+                                      float*                    A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const double*             csc_val,
+                                      const int*                csc_row_ind,
+                                      const int*                csc_col_ptr,
+                                      double*                   A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipComplex*         csc_val,
+                                      const int*                csc_row_ind,
+                                      const int*                csc_col_ptr,
+                                      hipComplex*               A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t descr,
+                                      const hipDoubleComplex*   csc_val,
+                                      const int*                csc_row_ind,
+                                      const int*                csc_col_ptr,
+                                      hipDoubleComplex*         A,
+                                      int                       ld)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
+                                       hipsparseDirection_t      dirA,
+                                       int                       m,
+                                       int                       n,
+                                       const hipsparseMatDescr_t descrA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       int                       blockDim,
+                                       const hipsparseMatDescr_t descrC,
+                                       int*                      bsrRowPtrC,
+                                       int*                      bsrNnzb)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         float                     tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         double                    tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         hipComplex                tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrValA,
+                                         const int*                csrRowPtrA,
+                                         int*                      nnzPerRow,
+                                         int*                      nnzC,
+                                         hipDoubleComplex          tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
+                                    const int*           csrRowPtr,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 cooRowInd,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const float*         csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    float*               cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const double*        csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    double*              cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
+                                    int                  m,
+                                    int                  n,
+                                    int                  nnz,
+                                    const hipComplex*    csrSortedVal,
+                                    const int*           csrSortedRowPtr,
+                                    const int*           csrSortedColInd,
+                                    hipComplex*          cscSortedVal,
+                                    int*                 cscSortedRowInd,
+                                    int*                 cscSortedColPtr,
+                                    hipsparseAction_t    copyValues,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
+                                    int                     m,
+                                    int                     n,
+                                    int                     nnz,
+                                    const hipDoubleComplex* csrSortedVal,
+                                    const int*              csrSortedRowPtr,
+                                    const int*              csrSortedColInd,
+                                    hipDoubleComplex*       cscSortedVal,
+                                    int*                    cscSortedRowInd,
+                                    int*                    cscSortedColPtr,
+                                    hipsparseAction_t       copyValues,
+                                    hipsparseIndexBase_t    idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   csrSortedValA,
+                                    const int*                csrSortedRowPtrA,
+                                    const int*                csrSortedColIndA,
+                                    hipsparseHybMat_t         hybA,
+                                    int                       userEllWidth,
+                                    hipsparseHybPartition_t   partitionType)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
+                                                   int               mb,
+                                                   int               nb,
+                                                   int               nnzb,
+                                                   const float*      bsr_val,
+                                                   const int*        bsr_row_ptr,
+                                                   const int*        bsr_col_ind,
+                                                   int               row_block_dim,
+                                                   int               col_block_dim,
+                                                   size_t*           p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
+                                                   int               mb,
+                                                   int               nb,
+                                                   int               nnzb,
+                                                   const double*     bsr_val,
+                                                   const int*        bsr_row_ptr,
+                                                   const int*        bsr_col_ind,
+                                                   int               row_block_dim,
+                                                   int               col_block_dim,
+                                                   size_t*           p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
+                                                   int               mb,
+                                                   int               nb,
+                                                   int               nnzb,
+                                                   const hipComplex* bsr_val,
+                                                   const int*        bsr_row_ptr,
+                                                   const int*        bsr_col_ind,
+                                                   int               row_block_dim,
+                                                   int               col_block_dim,
+                                                   size_t*           p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handle,
+                                                   int                     mb,
+                                                   int                     nb,
+                                                   int                     nnzb,
+                                                   const hipDoubleComplex* bsr_val,
+                                                   const int*              bsr_row_ptr,
+                                                   const int*              bsr_col_ind,
+                                                   int                     row_block_dim,
+                                                   int                     col_block_dim,
+                                                   size_t*                 p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
+                                        int                  mb,
+                                        int                  nb,
+                                        int                  nnzb,
+                                        const float*         bsr_val,
+                                        const int*           bsr_row_ptr,
+                                        const int*           bsr_col_ind,
+                                        int                  row_block_dim,
+                                        int                  col_block_dim,
+                                        float*               bsc_val,
+                                        int*                 bsc_row_ind,
+                                        int*                 bsc_col_ptr,
+                                        hipsparseAction_t    copy_values,
+                                        hipsparseIndexBase_t idx_base,
+                                        void*                temp_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
+                                        int                  mb,
+                                        int                  nb,
+                                        int                  nnzb,
+                                        const double*        bsr_val,
+                                        const int*           bsr_row_ptr,
+                                        const int*           bsr_col_ind,
+                                        int                  row_block_dim,
+                                        int                  col_block_dim,
+                                        double*              bsc_val,
+                                        int*                 bsc_row_ind,
+                                        int*                 bsc_col_ptr,
+                                        hipsparseAction_t    copy_values,
+                                        hipsparseIndexBase_t idx_base,
+                                        void*                temp_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
+                                        int                  mb,
+                                        int                  nb,
+                                        int                  nnzb,
+                                        const hipComplex*    bsr_val,
+                                        const int*           bsr_row_ptr,
+                                        const int*           bsr_col_ind,
+                                        int                  row_block_dim,
+                                        int                  col_block_dim,
+                                        hipComplex*          bsc_val,
+                                        int*                 bsc_row_ind,
+                                        int*                 bsc_col_ptr,
+                                        hipsparseAction_t    copy_values,
+                                        hipsparseIndexBase_t idx_base,
+                                        void*                temp_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
+                                        int                     mb,
+                                        int                     nb,
+                                        int                     nnzb,
+                                        const hipDoubleComplex* bsr_val,
+                                        const int*              bsr_row_ptr,
+                                        const int*              bsr_col_ind,
+                                        int                     row_block_dim,
+                                        int                     col_block_dim,
+                                        hipDoubleComplex*       bsc_val,
+                                        int*                    bsc_row_ind,
+                                        int*                    bsc_col_ptr,
+                                        hipsparseAction_t       copy_values,
+                                        hipsparseIndexBase_t    idx_base,
+                                        void*                   temp_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const float*              csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const double*             csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const hipComplex*         csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseDirection_t      dir,
+                                                 int                       m,
+                                                 int                       n,
+                                                 const hipsparseMatDescr_t csr_descr,
+                                                 const hipDoubleComplex*   csr_val,
+                                                 const int*                csr_row_ptr,
+                                                 const int*                csr_col_ind,
+                                                 int                       row_block_dim,
+                                                 int                       col_block_dim,
+                                                 size_t*                   p_buffer_size)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
+                                         hipsparseDirection_t      dir,
+                                         int                       m,
+                                         int                       n,
+                                         const hipsparseMatDescr_t csr_descr,
+                                         const int*                csr_row_ptr,
+                                         const int*                csr_col_ind,
+                                         const hipsparseMatDescr_t bsr_descr,
+                                         int*                      bsr_row_ptr,
+                                         int                       row_block_dim,
+                                         int                       col_block_dim,
+                                         int*                      bsr_nnz_devhost,
+                                         void*                     p_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const float*              csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      float*                    bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const double*             csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      double*                   bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const hipComplex*         csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      hipComplex*               bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dir,
+                                      int                       m,
+                                      int                       n,
+                                      const hipsparseMatDescr_t csr_descr,
+                                      const hipDoubleComplex*   csr_val,
+                                      const int*                csr_row_ptr,
+                                      const int*                csr_col_ind,
+                                      const hipsparseMatDescr_t bsr_descr,
+                                      hipDoubleComplex*         bsr_val,
+                                      int*                      bsr_row_ptr,
+                                      int*                      bsr_col_ind,
+                                      int                       row_block_dim,
+                                      int                       col_block_dim,
+                                      void*                     p_buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       m,
+                                    int                       n,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   csrValA,
+                                    const int*                csrRowPtrA,
+                                    const int*                csrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         bsrValC,
+                                    int*                      bsrRowPtrC,
+                                    int*                      bsrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    float*                    csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    double*                   csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipComplex*               csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    const hipsparseMatDescr_t descrC,
+                                    hipDoubleComplex*         csrValC,
+                                    int*                      csrRowPtrC,
+                                    int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const float*              bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      float*                    csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const double*             bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      double*                   csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipComplex*         bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      hipComplex*               csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
+                                      hipsparseDirection_t      dirA,
+                                      int                       mb,
+                                      int                       nb,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipDoubleComplex*   bsrValA,
+                                      const int*                bsrRowPtrA,
+                                      const int*                bsrColIndA,
+                                      int                       rowBlockDim,
+                                      int                       colBlockDim,
+                                      const hipsparseMatDescr_t descrC,
+                                      hipDoubleComplex*         csrValC,
+                                      int*                      csrRowPtrC,
+                                      int*                      csrColIndC)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const float*              csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             float*                    csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             float                     tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const double*             csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             double*                   csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             double                    tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipComplex*         csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             hipComplex*               csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             hipComplex                tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             const hipsparseMatDescr_t descrA,
+                                             const hipDoubleComplex*   csrValA,
+                                             const int*                csrColIndA,
+                                             const int*                csrRowPtrA,
+                                             int                       nnzA,
+                                             const int*                nnzPerRow,
+                                             hipDoubleComplex*         csrValC,
+                                             int*                      csrColIndC,
+                                             int*                      csrRowPtrC,
+                                             hipDoubleComplex          tol)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       n,
+                                                    int                       nnzA,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    const float*              csrValA,
+                                                    const int*                csrRowPtrA,
+                                                    const int*                csrColIndA,
+                                                    const float*              threshold,
+                                                    const hipsparseMatDescr_t descrC,
+                                                    const float*              csrValC,
+                                                    const int*                csrRowPtrC,
+                                                    const int*                csrColIndC,
+                                                    size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
+                                                    int                       m,
+                                                    int                       n,
+                                                    int                       nnzA,
+                                                    const hipsparseMatDescr_t descrA,
+                                                    const double*             csrValA,
+                                                    const int*                csrRowPtrA,
+                                                    const int*                csrColIndA,
+                                                    const double*             threshold,
+                                                    const hipsparseMatDescr_t descrC,
+                                                    const double*             csrValC,
+                                                    const int*                csrRowPtrC,
+                                                    const int*                csrColIndC,
+                                                    size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       int                       nnzA,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const float*              csrValA,
+                                                       const int*                csrRowPtrA,
+                                                       const int*                csrColIndA,
+                                                       const float*              threshold,
+                                                       const hipsparseMatDescr_t descrC,
+                                                       const float*              csrValC,
+                                                       const int*                csrRowPtrC,
+                                                       const int*                csrColIndC,
+                                                       size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
+                                                       int                       m,
+                                                       int                       n,
+                                                       int                       nnzA,
+                                                       const hipsparseMatDescr_t descrA,
+                                                       const double*             csrValA,
+                                                       const int*                csrRowPtrA,
+                                                       const int*                csrColIndA,
+                                                       const double*             threshold,
+                                                       const hipsparseMatDescr_t descrC,
+                                                       const double*             csrValC,
+                                                       const int*                csrRowPtrC,
+                                                       const int*                csrColIndC,
+                                                       size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const float*              threshold,
+                                            const hipsparseMatDescr_t descrC,
+                                            int*                      csrRowPtrC,
+                                            int*                      nnzTotalDevHostPtr,
+                                            void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       nnzA,
+                                            const hipsparseMatDescr_t descrA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const double*             threshold,
+                                            const hipsparseMatDescr_t descrC,
+                                            int*                      csrRowPtrC,
+                                            int*                      nnzTotalDevHostPtr,
+                                            void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         const float*              threshold,
+                                         const hipsparseMatDescr_t descrC,
+                                         float*                    csrValC,
+                                         const int*                csrRowPtrC,
+                                         int*                      csrColIndC,
+                                         void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
+                                         int                       m,
+                                         int                       n,
+                                         int                       nnzA,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         const double*             threshold,
+                                         const hipsparseMatDescr_t descrC,
+                                         double*                   csrValC,
+                                         const int*                csrRowPtrC,
+                                         int*                      csrColIndC,
+                                         void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       n,
+                                                  int                       nnzA,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const float*              csrValA,
+                                                  const int*                csrRowPtrA,
+                                                  const int*                csrColIndA,
+                                                  float                     percentage,
+                                                  const hipsparseMatDescr_t descrC,
+                                                  const float*              csrValC,
+                                                  const int*                csrRowPtrC,
+                                                  const int*                csrColIndC,
+                                                  pruneInfo_t               info,
+                                                  size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
+                                                  int                       m,
+                                                  int                       n,
+                                                  int                       nnzA,
+                                                  const hipsparseMatDescr_t descrA,
+                                                  const double*             csrValA,
+                                                  const int*                csrRowPtrA,
+                                                  const int*                csrColIndA,
+                                                  double                    percentage,
+                                                  const hipsparseMatDescr_t descrC,
+                                                  const double*             csrValC,
+                                                  const int*                csrRowPtrC,
+                                                  const int*                csrColIndC,
+                                                  pruneInfo_t               info,
+                                                  size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       n,
+                                                     int                       nnzA,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const float*              csrValA,
+                                                     const int*                csrRowPtrA,
+                                                     const int*                csrColIndA,
+                                                     float                     percentage,
+                                                     const hipsparseMatDescr_t descrC,
+                                                     const float*              csrValC,
+                                                     const int*                csrRowPtrC,
+                                                     const int*                csrColIndC,
+                                                     pruneInfo_t               info,
+                                                     size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       n,
+                                                     int                       nnzA,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const double*             csrValA,
+                                                     const int*                csrRowPtrA,
+                                                     const int*                csrColIndA,
+                                                     double                    percentage,
+                                                     const hipsparseMatDescr_t descrC,
+                                                     const double*             csrValC,
+                                                     const int*                csrRowPtrC,
+                                                     const int*                csrColIndC,
+                                                     pruneInfo_t               info,
+                                                     size_t*                   bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnzA,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          float                     percentage,
+                                          const hipsparseMatDescr_t descrC,
+                                          int*                      csrRowPtrC,
+                                          int*                      nnzTotalDevHostPtr,
+                                          pruneInfo_t               info,
+                                          void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t
+    hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       n,
+                                          int                       nnzA,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          double                    percentage,
+                                          const hipsparseMatDescr_t descrC,
+                                          int*                      csrRowPtrC,
+                                          int*                      nnzTotalDevHostPtr,
+                                          pruneInfo_t               info,
+                                          void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       n,
+                                                     int                       nnzA,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const float*              csrValA,
+                                                     const int*                csrRowPtrA,
+                                                     const int*                csrColIndA,
+                                                     float                     percentage,
+                                                     const hipsparseMatDescr_t descrC,
+                                                     float*                    csrValC,
+                                                     const int*                csrRowPtrC,
+                                                     int*                      csrColIndC,
+                                                     pruneInfo_t               info,
+                                                     void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
+                                                     int                       m,
+                                                     int                       n,
+                                                     int                       nnzA,
+                                                     const hipsparseMatDescr_t descrA,
+                                                     const double*             csrValA,
+                                                     const int*                csrRowPtrA,
+                                                     const int*                csrColIndA,
+                                                     double                    percentage,
+                                                     const hipsparseMatDescr_t descrC,
+                                                     double*                   csrValC,
+                                                     const int*                csrRowPtrC,
+                                                     int*                      csrColIndC,
+                                                     pruneInfo_t               info,
+                                                     void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    float*                    csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    double*                   csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    hipComplex*               csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipsparseHybMat_t   hybA,
+                                    hipDoubleComplex*         csrSortedValA,
+                                    int*                      csrSortedRowPtrA,
+                                    int*                      csrSortedColIndA)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
+                                    const int*           cooRowInd,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 csrRowPtr,
+                                    hipsparseIndexBase_t idxBase)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  int               nnz,
+                                                  const int*        csrRowPtr,
+                                                  const int*        csrColInd,
+                                                  size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    const int*                csrRowPtr,
+                                    int*                      csrColInd,
+                                    int*                      P,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  int               nnz,
+                                                  const int*        cscColPtr,
+                                                  const int*        cscRowInd,
+                                                  size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       n,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descrA,
+                                    const int*                cscColPtr,
+                                    int*                      cscRowInd,
+                                    int*                      P,
+                                    void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  int               nnz,
+                                                  const int*        cooRows,
+                                                  const int*        cooCols,
+                                                  size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nnz,
+                                         int*              cooRows,
+                                         int*              cooCols,
+                                         int*              P,
+                                         void*             pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
+                                            int               m,
+                                            int               n,
+                                            int               nnz,
+                                            int*              cooRows,
+                                            int*              cooCols,
+                                            int*              P,
+                                            void*             pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const float*              bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const double*             bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipComplex*         bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
+                                                   hipsparseDirection_t      dirA,
+                                                   int                       mb,
+                                                   int                       nb,
+                                                   int                       nnzb,
+                                                   const hipsparseMatDescr_t descrA,
+                                                   const hipDoubleComplex*   bsrValA,
+                                                   const int*                bsrRowPtrA,
+                                                   const int*                bsrColIndA,
+                                                   int                       rowBlockDimA,
+                                                   int                       colBlockDimA,
+                                                   int                       rowBlockDimC,
+                                                   int                       colBlockDimC,
+                                                   int*                      bufferSize)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
+                                           hipsparseDirection_t      dirA,
+                                           int                       mb,
+                                           int                       nb,
+                                           int                       nnzb,
+                                           const hipsparseMatDescr_t descrA,
+                                           const int*                bsrRowPtrA,
+                                           const int*                bsrColIndA,
+                                           int                       rowBlockDimA,
+                                           int                       colBlockDimA,
+                                           const hipsparseMatDescr_t descrC,
+                                           int*                      bsrRowPtrC,
+                                           int                       rowBlockDimC,
+                                           int                       colBlockDimC,
+                                           int*                      nnzTotalDevHostPtr,
+                                           void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const float*              bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        float*                    bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const double*             bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        double*                   bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const hipComplex*         bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        hipComplex*               bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const hipDoubleComplex*   bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       rowBlockDimA,
+                                        int                       colBlockDimA,
+                                        const hipsparseMatDescr_t descrC,
+                                        hipDoubleComplex*         bsrValC,
+                                        int*                      bsrRowPtrC,
+                                        int*                      bsrColIndC,
+                                        int                       rowBlockDimC,
+                                        int                       colBlockDimC,
+                                        void*                     buffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   float*            csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   double*           csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   hipComplex*       csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nnz,
+                                                   hipDoubleComplex* csrVal,
+                                                   const int*        csrRowPtr,
+                                                   int*              csrColInd,
+                                                   csru2csrInfo_t    info,
+                                                   size_t*           pBufferSizeInBytes)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     float*                    csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     double*                   csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipComplex*               csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     float*                    csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     double*                   csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipComplex*               csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       n,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     hipDoubleComplex*         csrVal,
+                                     const int*                csrRowPtr,
+                                     int*                      csrColInd,
+                                     csru2csrInfo_t            info,
+                                     void*                     pBuffer)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const float*              fractionToColor,
+                                     int*                      ncolors,
+                                     int*                      coloring,
+                                     int*                      reordering,
+                                     hipsparseColorInfo_t      info)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const double*             fractionToColor,
+                                     int*                      ncolors,
+                                     int*                      coloring,
+                                     int*                      reordering,
+                                     hipsparseColorInfo_t      info)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const float*              fractionToColor,
+                                     int*                      ncolors,
+                                     int*                      coloring,
+                                     int*                      reordering,
+                                     hipsparseColorInfo_t      info)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     const double*             fractionToColor,
+                                     int*                      ncolors,
+                                     int*                      coloring,
+                                     int*                      reordering,
+                                     hipsparseColorInfo_t      info)
+{
+    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,422 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef HOST_BSRMV_HPP
+#define HOST_BSRMV_HPP
+
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// CPU products of block compressed (BSR and BSRX) matrices with dense vectors and
+// matrices. Block sizes 2 to 8 and 16 run kernels specialized at compile time, which keep
+// the partial sums of a block row in registers and fully unroll the loops over the
+// blocks. All other block sizes run a generic kernel.
+
+namespace hipsparse
+{
+    // Block compressed view of a sparse matrix with square blocks of size dim. Block row
+    // i holds the blocks k = begin(i), ..., end(i) - 1 with block column col(k), the
+    // values of block k start at val[dim * dim * k]. For BSR, end_ptr is ptr + 1.
+    template <typename I, typename J>
+    struct bsr_view
+    {
+        int64_t     mb;
+        int64_t     dim;
+        bool        row_major;
+        const I*    ptr;
+        const I*    end_ptr;
+        const J*    ind;
+        int64_t     base;
+        const void* val;
+
+        int64_t begin(int64_t i) const
+        {
+            return ptr[i] - base;
+        }
+
+        int64_t end(int64_t i) const
+        {
+            return end_ptr[i] - base;
+        }
+
+        int64_t col(int64_t k) const
+        {
+            return ind[k] - base;
+        }
+
+        // Offset of element (bi, bj) of block k
+        int64_t at(int64_t k, int64_t bi, int64_t bj) const
+        {
+            return dim * dim * k + (row_major ? dim * bi + bj : dim * bj + bi);
+        }
+    };
+
+    // Call f(i) in parallel for all block rows i of A, or for the block rows mask[0], ...,
+    // mask[size - 1] if mask is not null. Mask entries use the index base of A.
+    template <typename V, typename J, typename F>
+    void bsr_for_each_row(const V& A, const J* mask, int64_t size, F f)
+    {
+        int64_t rows = (mask != nullptr) ? size : A.mb;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+        for(int64_t r = 0; r < rows; ++r)
+        {
+            f((mask != nullptr) ? mask[r] - A.base : r);
+        }
+    }
+
+    // y = alpha * sum + beta * y, y is not read if beta is zero
+    template <typename T>
+    void bsr_store(T* y, T alpha, T sum, T beta)
+    {
+        *y = (beta == T()) ? alpha * sum : alpha * sum + beta * (*y);
+    }
+
+    // Block row i of y = alpha * A * x + beta * y for block size BD. Row major blocks are
+    // applied row by row, column major blocks column by column, such that the values of
+    // a block are read contiguously.
+    template <int BD, bool ROW, typename T, typename V>
+    void bsrmv_block_row(const V& A, int64_t i, T alpha, const T* x, T beta, T* y)
+    {
+        const T* val = (const T*)A.val;
+
+        T sum[BD];
+
+        for(int bi = 0; bi < BD; ++bi)
+        {
+            sum[bi] = T();
+        }
+
+        for(int64_t k = A.begin(i); k < A.end(i); ++k)
+        {
+            const T* block = val + BD * BD * k;
+            const T* xk    = x + BD * A.col(k);
+
+            if(ROW)
+            {
+                for(int bi = 0; bi < BD; ++bi)
+                {
+                    for(int bj = 0; bj < BD; ++bj)
+                    {
+                        sum[bi] = sum[bi] + block[BD * bi + bj] * xk[bj];
+                    }
+                }
+            }
+            else
+            {
+                for(int bj = 0; bj < BD; ++bj)
+                {
+                    T xj = xk[bj];
+
+                    for(int bi = 0; bi < BD; ++bi)
+                    {
+                        sum[bi] = sum[bi] + block[BD * bj + bi] * xj;
+                    }
+                }
+            }
+        }
+
+        for(int bi = 0; bi < BD; ++bi)
+        {
+            bsr_store(y + BD * i + bi, alpha, sum[bi], beta);
+        }
+    }
+
+    // Block row i of y = alpha * A * x + beta * y for any block size
+    template <typename T, typename V>
+    void bsrmv_block_row_dynamic(const V& A, int64_t i, T alpha, const T* x, T beta, T* y)
+    {
+        const T* val = (const T*)A.val;
+
+        for(int64_t bi = 0; bi < A.dim; ++bi)
+        {
+            T sum = T();
+
+            for(int64_t k = A.begin(i); k < A.end(i); ++k)
+            {
+                const T* xk = x + A.dim * A.col(k);
+
+                for(int64_t bj = 0; bj < A.dim; ++bj)
+                {
+                    sum = sum + val[A.at(k, bi, bj)] * xk[bj];
+                }
+            }
+
+            bsr_store(y + A.dim * i + bi, alpha, sum, beta);
+        }
+    }
+
+    template <int BD, typename T, typename V, typename J>
+    void host_bsrmv_fixed(
+        const V& A, const J* mask, int64_t size, T alpha, const T* x, T beta, T* y)
+    {
+        if(A.row_major)
+        {
+            bsr_for_each_row(A, mask, size, [&](int64_t i) {
+                bsrmv_block_row<BD, true>(A, i, alpha, x, beta, y);
+            });
+        }
+        else
+        {
+            bsr_for_each_row(A, mask, size, [&](int64_t i) {
+                bsrmv_block_row<BD, false>(A, i, alpha, x, beta, y);
+            });
+        }
+    }
+
+    // y = alpha * A * x + beta * y, restricted to the block rows of mask if mask is not
+    // null (see bsr_for_each_row). All other block rows of y are not touched.
+    template <typename T, typename V, typename J>
+    void host_bsrmv(const V& A, const J* mask, int64_t size, T alpha, const T* x, T beta, T* y)
+    {
+        switch(A.dim)
+        {
+        case 2:
+            return host_bsrmv_fixed<2>(A, mask, size, alpha, x, beta, y);
+        case 3:
+            return host_bsrmv_fixed<3>(A, mask, size, alpha, x, beta, y);
+        case 4:
+            return host_bsrmv_fixed<4>(A, mask, size, alpha, x, beta, y);
+        case 5:
+            return host_bsrmv_fixed<5>(A, mask, size, alpha, x, beta, y);
+        case 6:
+            return host_bsrmv_fixed<6>(A, mask, size, alpha, x, beta, y);
+        case 7:
+            return host_bsrmv_fixed<7>(A, mask, size, alpha, x, beta, y);
+        case 8:
+            return host_bsrmv_fixed<8>(A, mask, size, alpha, x, beta, y);
+        case 16:
+            return host_bsrmv_fixed<16>(A, mask, size, alpha, x, beta, y);
+        default:
+            return bsr_for_each_row(A, mask, size, [&](int64_t i) {
+                bsrmv_block_row_dynamic(A, i, alpha, x, beta, y);
+            });
+        }
+    }
+
+    // Column major dense matrix, or its transpose
+    template <typename T>
+    struct bsrmm_dense
+    {
+        const T* val;
+        int64_t  ld;
+        bool     trans;
+
+        T operator()(int64_t i, int64_t j) const
+        {
+            return trans ? val[ld * i + j] : val[i + ld * j];
+        }
+    };
+
+    // Number of columns of C computed together by the fixed size kernels
+    static constexpr int bsrmm_tile_cols = 4;
+
+    // Columns j, ..., j + NC - 1 of block row i of C = alpha * A * B + beta * C for block
+    // size BD. The BD x NC tile of C is accumulated in registers, each value of A is
+    // loaded once per tile.
+    template <int BD, int NC, bool ROW, typename T, typename V>
+    void bsrmm_tile(const V&              A,
+                    int64_t               i,
+                    int64_t               j,
+                    T                     alpha,
+                    const bsrmm_dense<T>& B,
+                    T                     beta,
+                    T*                    C,
+                    int64_t               ldc)
+    {
+        const T* val = (const T*)A.val;
+
+        T sum[BD][NC];
+
+        for(int bi = 0; bi < BD; ++bi)
+        {
+            for(int c = 0; c < NC; ++c)
+            {
+                sum[bi][c] = T();
+            }
+        }
+
+        for(int64_t k = A.begin(i); k < A.end(i); ++k)
+        {
+            const T* block = val + BD * BD * k;
+            int64_t  row_B = BD * A.col(k);
+
+            for(int t = 0; t < BD; ++t)
+            {
+                T b[NC];
+
+                for(int c = 0; c < NC; ++c)
+                {
+                    b[c] = B(row_B + t, j + c);
+                }
+
+                for(int bi = 0; bi < BD; ++bi)
+                {
+                    T a = ROW ? block[BD * bi + t] : block[BD * t + bi];
+
+                    for(int c = 0; c < NC; ++c)
+                    {
+                        sum[bi][c] = sum[bi][c] + a * b[c];
+                    }
+                }
+            }
+        }
+
+        for(int c = 0; c < NC; ++c)
+        {
+            for(int bi = 0; bi < BD; ++bi)
+            {
+                bsr_store(C + BD * i + bi + ldc * (j + c), alpha, sum[bi][c], beta);
+            }
+        }
+    }
+
+    template <int BD, bool ROW, typename T, typename V>
+    void bsrmm_block_row(const V&              A,
+                         int64_t               i,
+                         int64_t               n,
+                         T                     alpha,
+                         const bsrmm_dense<T>& B,
+                         T                     beta,
+                         T*                    C,
+                         int64_t               ldc)
+    {
+        int64_t j = 0;
+
+        for(; j + bsrmm_tile_cols <= n; j += bsrmm_tile_cols)
+        {
+            bsrmm_tile<BD, bsrmm_tile_cols, ROW>(A, i, j, alpha, B, beta, C, ldc);
+        }
+
+        for(; j < n; ++j)
+        {
+            bsrmm_tile<BD, 1, ROW>(A, i, j, alpha, B, beta, C, ldc);
+        }
+    }
+
+    // Block row i of C = alpha * A * B + beta * C for any block size
+    template <typename T, typename V>
+    void bsrmm_block_row_dynamic(const V&              A,
+                                 int64_t               i,
+                                 int64_t               n,
+                                 T                     alpha,
+                                 const bsrmm_dense<T>& B,
+                                 T                     beta,
+                                 T*                    C,
+                                 int64_t               ldc)
+    {
+        const T* val = (const T*)A.val;
+
+        for(int64_t j = 0; j < n; ++j)
+        {
+            for(int64_t bi = 0; bi < A.dim; ++bi)
+            {
+                T sum = T();
+
+                for(int64_t k = A.begin(i); k < A.end(i); ++k)
+                {
+                    int64_t row_B = A.dim * A.col(k);
+
+                    for(int64_t t = 0; t < A.dim; ++t)
+                    {
+                        sum = sum + val[A.at(k, bi, t)] * B(row_B + t, j);
+                    }
+                }
+
+                bsr_store(C + A.dim * i + bi + ldc * j, alpha, sum, beta);
+            }
+        }
+    }
+
+    template <int BD, typename T, typename V>
+    void host_bsrmm_fixed(
+        const V& A, int64_t n, T alpha, const bsrmm_dense<T>& B, T beta, T* C, int64_t ldc)
+    {
+        const int* all = nullptr;
+
+        if(A.row_major)
+        {
+            bsr_for_each_row(A, all, 0, [&](int64_t i) {
+                bsrmm_block_row<BD, true>(A, i, n, alpha, B, beta, C, ldc);
+            });
+        }
+        else
+        {
+            bsr_for_each_row(A, all, 0, [&](int64_t i) {
+                bsrmm_block_row<BD, false>(A, i, n, alpha, B, beta, C, ldc);
+            });
+        }
+    }
+
+    // C = alpha * A * op(B) + beta * C, where B and C are column major, C has n columns
+    // and op(B) is B or its transpose
+    template <typename T, typename V>
+    void host_bsrmm(const V& A,
+                    int64_t  n,
+                    T        alpha,
+                    const T* B,
+                    int64_t  ldb,
+                    bool     trans_B,
+                    T        beta,
+                    T*       C,
+                    int64_t  ldc)
+    {
+        bsrmm_dense<T> op_B = {B, ldb, trans_B};
+
+        switch(A.dim)
+        {
+        case 2:
+            return host_bsrmm_fixed<2>(A, n, alpha, op_B, beta, C, ldc);
+        case 3:
+            return host_bsrmm_fixed<3>(A, n, alpha, op_B, beta, C, ldc);
+        case 4:
+            return host_bsrmm_fixed<4>(A, n, alpha, op_B, beta, C, ldc);
+        case 5:
+            return host_bsrmm_fixed<5>(A, n, alpha, op_B, beta, C, ldc);
+        case 6:
+            return host_bsrmm_fixed<6>(A, n, alpha, op_B, beta, C, ldc);
+        case 7:
+            return host_bsrmm_fixed<7>(A, n, alpha, op_B, beta, C, ldc);
+        case 8:
+            return host_bsrmm_fixed<8>(A, n, alpha, op_B, beta, C, ldc);
+        case 16:
+            return host_bsrmm_fixed<16>(A, n, alpha, op_B, beta, C, ldc);
+        default:
+        {
+            const int* all = nullptr;
+
+            return bsr_for_each_row(A, all, 0, [&](int64_t i) {
+                bsrmm_block_row_dynamic(A, i, n, alpha, op_B, beta, C, ldc);
+            });
+        }
+        }
+    }
+}
+
+#endif // HOST_BSRMV_HPP
@@ -0,0 +1,486 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#pragma once
+#ifndef HOST_CSRGEMM_HPP
+#define HOST_CSRGEMM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// CPU sparse matrix sparse matrix multiplication C = alpha * A * B + beta * D of row
+// compressed views (see host_csrmv.hpp), in a symbolic and a numeric phase. A or D
+// may be nullptr to drop their term.
+
+namespace hipsparse
+{
+    // Row accumulator of the CPU SpGEMM. Rows with few candidate entries collect
+    // them in a list that is sorted when the row is complete, longer rows use an
+    // open addressing hash table sized for the row. Memory therefore scales with the
+    // longest row rather than with the number of columns. In both cases the values
+    // of a column are summed in the order they have been added.
+    template <typename T>
+    class csrgemm_accumulator
+    {
+    public:
+        // Rows with at most this many candidate entries are sorted
+        static constexpr int64_t sort_limit = 128;
+
+        // Start a row with at most bound distinct columns
+        void begin(int64_t bound)
+        {
+            hashed_ = bound > sort_limit;
+            cols_.clear();
+            vals_.clear();
+
+            if(!hashed_)
+            {
+                return;
+            }
+
+            int64_t capacity = 2 * sort_limit;
+            while(capacity < 2 * bound)
+            {
+                capacity <<= 1;
+            }
+
+            if(static_cast<int64_t>(keys_.size()) < capacity)
+            {
+                keys_.assign(capacity, -1);
+                table_.resize(capacity);
+            }
+
+            mask_ = capacity - 1;
+            slots_.clear();
+        }
+
+        // Add column j without a value (symbolic phase)
+        void insert(int64_t j)
+        {
+            if(!hashed_)
+            {
+                cols_.push_back(j);
+                return;
+            }
+
+            int64_t slot = probe(j);
+            if(keys_[slot] < 0)
+            {
+                keys_[slot] = j;
+                slots_.push_back(slot);
+            }
+        }
+
+        // Add val to column j (numeric phase)
+        void add(int64_t j, T val)
+        {
+            if(!hashed_)
+            {
+                cols_.push_back(j);
+                vals_.push_back(val);
+                return;
+            }
+
+            int64_t slot = probe(j);
+            if(keys_[slot] < 0)
+            {
+                keys_[slot]  = j;
+                table_[slot] = val;
+                slots_.push_back(slot);
+            }
+            else
+            {
+                table_[slot] = table_[slot] + val;
+            }
+        }
+
+        // Complete the row. Afterwards, cols() holds the distinct columns in
+        // ascending order, and vals() their values if these have been added.
+        void finish(bool values)
+        {
+            if(hashed_)
+            {
+                std::sort(slots_.begin(), slots_.end(), [this](int64_t a, int64_t b) {
+                    return keys_[a] < keys_[b];
+                });
+
+                cols_.resize(slots_.size());
+                vals_.resize(values ? slots_.size() : 0);
+
+                for(size_t s = 0; s < slots_.size(); ++s)
+                {
+                    cols_[s] = keys_[slots_[s]];
+
+                    if(values)
+                    {
+                        vals_[s] = table_[slots_[s]];
+                    }
+
+                    keys_[slots_[s]] = -1;
+                }
+
+                return;
+            }
+
+            if(!values)
+            {
+                std::sort(cols_.begin(), cols_.end());
+                cols_.erase(std::unique(cols_.begin(), cols_.end()), cols_.end());
+
+                return;
+            }
+
+            perm_.resize(cols_.size());
+            for(size_t s = 0; s < perm_.size(); ++s)
+            {
+                perm_[s] = static_cast<int64_t>(s);
+            }
+
+            std::stable_sort(perm_.begin(), perm_.end(), [this](int64_t a, int64_t b) {
+                return cols_[a] < cols_[b];
+            });
+
+            sorted_cols_.clear();
+            sorted_vals_.clear();
+
+            for(size_t s = 0; s < perm_.size(); ++s)
+            {
+                int64_t j = cols_[perm_[s]];
+
+                if(!sorted_cols_.empty() && sorted_cols_.back() == j)
+                {
+                    sorted_vals_.back() = sorted_vals_.back() + vals_[perm_[s]];
+                }
+                else
+                {
+                    sorted_cols_.push_back(j);
+                    sorted_vals_.push_back(vals_[perm_[s]]);
+                }
+            }
+
+            cols_.swap(sorted_cols_);
+            vals_.swap(sorted_vals_);
+        }
+
+        const std::vector<int64_t>& cols() const
+        {
+            return cols_;
+        }
+
+        const std::vector<T>& vals() const
+        {
+            return vals_;
+        }
+
+    private:
+        // Slot of column j, either holding j or empty
+        int64_t probe(int64_t j) const
+        {
+            int64_t slot = static_cast<int64_t>((static_cast<uint64_t>(j) * 0x9E3779B97F4A7C15ull)
+                                                >> 17)
+                           & mask_;
+
+            while(keys_[slot] >= 0 && keys_[slot] != j)
+            {
+                slot = (slot + 1) & mask_;
+            }
+
+            return slot;
+        }
+
+        bool    hashed_ = false;
+        int64_t mask_   = 0;
+
+        std::vector<int64_t> keys_;
+        std::vector<T>       table_;
+        std::vector<int64_t> slots_;
+
+        std::vector<int64_t> cols_;
+        std::vector<T>       vals_;
+        std::vector<int64_t> perm_;
+        std::vector<int64_t> sorted_cols_;
+        std::vector<T>       sorted_vals_;
+    };
+
+    // Work estimate of the rows of C = A * B + D and a split of the rows into chunks
+    // of about equal work, which are scheduled dynamically.
+    struct csrgemm_schedule
+    {
+        // Prefix sum of the work per row, where a row costs one plus the number of
+        // products formed in it
+        std::vector<int64_t> work;
+
+        // Row ranges [chunks[c], chunks[c + 1])
+        std::vector<int64_t> chunks;
+
+        // Upper bound of the number of distinct columns in row i
+        int64_t bound(int64_t i) const
+        {
+            return work[i + 1] - work[i] - 1;
+        }
+    };
+
+    // Number of chunks per thread, to balance rows whose cost is underestimated
+    static constexpr int64_t csrgemm_chunks_per_thread = 16;
+
+    template <typename V>
+    csrgemm_schedule csrgemm_plan(int64_t m, const V* A, const V& B, const V* D)
+    {
+        csrgemm_schedule plan;
+
+        plan.work.resize(m + 1);
+        plan.work[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t i = 0; i < m; ++i)
+        {
+            int64_t w = 1;
+
+            for(int64_t k = (A != nullptr) ? A->begin(i) : 0; A != nullptr && k < A->end(i); ++k)
+            {
+                int64_t r = A->col(k);
+
+                w += B.end(r) - B.begin(r);
+            }
+
+            if(D != nullptr)
+            {
+                w += D->end(i) - D->begin(i);
+            }
+
+            plan.work[i + 1] = w;
+        }
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            plan.work[i + 1] += plan.work[i];
+        }
+
+        int64_t threads = 1;
+#ifdef _OPENMP
+        threads = omp_get_max_threads();
+#endif
+
+        int64_t nchunks = std::max(std::min(m, threads * csrgemm_chunks_per_thread),
+                                   static_cast<int64_t>(1));
+
+        plan.chunks.resize(nchunks + 1);
+
+        for(int64_t c = 0; c < nchunks; ++c)
+        {
+            int64_t target = plan.work[m] / nchunks * c + plan.work[m] % nchunks * c / nchunks;
+
+            plan.chunks[c]
+                = std::lower_bound(plan.work.begin(), plan.work.end(), target) - plan.work.begin();
+        }
+
+        plan.chunks[nchunks] = m;
+
+        return plan;
+    }
+
+    // Gather the entries of row i of alpha * A * B + beta * D into the accumulator.
+    // Without values, only the columns are collected.
+    template <typename T, typename V>
+    void csrgemm_row(int64_t                 i,
+                     const V*                A,
+                     const V&                B,
+                     const V*                D,
+                     T                       alpha,
+                     T                       beta,
+                     bool                    values,
+                     csrgemm_accumulator<T>& acc)
+    {
+        const T* val_A = (A != nullptr) ? (const T*)A->val : nullptr;
+        const T* val_B = (const T*)B.val;
+        const T* val_D = (D != nullptr) ? (const T*)D->val : nullptr;
+
+        for(int64_t k = (A != nullptr) ? A->begin(i) : 0; A != nullptr && k < A->end(i); ++k)
+        {
+            int64_t r = A->col(k);
+
+            if(!values)
+            {
+                for(int64_t l = B.begin(r); l < B.end(r); ++l)
+                {
+                    acc.insert(B.col(l));
+                }
+
+                continue;
+            }
+
+            T a = alpha * val_A[A->pos(k)];
+
+            for(int64_t l = B.begin(r); l < B.end(r); ++l)
+            {
+                acc.add(B.col(l), a * val_B[B.pos(l)]);
+            }
+        }
+
+        for(int64_t k = (D != nullptr) ? D->begin(i) : 0; D != nullptr && k < D->end(i); ++k)
+        {
+            if(values)
+            {
+                acc.add(D->col(k), beta * val_D[D->pos(k)]);
+            }
+            else
+            {
+                acc.insert(D->col(k));
+            }
+        }
+
+        acc.finish(values);
+    }
+
+    // Symbolic phase: number of non-zeros of each row of C = A * B + D
+    template <typename V, typename R>
+    void host_csrgemm_nnz(int64_t m, const V* A, const V& B, const V* D, R* row_nnz)
+    {
+        csrgemm_schedule plan = csrgemm_plan(m, A, B, D);
+        int64_t          nchunks = plan.chunks.size() - 1;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            csrgemm_accumulator<char> acc;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int64_t c = 0; c < nchunks; ++c)
+            {
+                for(int64_t i = plan.chunks[c]; i < plan.chunks[c + 1]; ++i)
+                {
+                    acc.begin(plan.bound(i));
+                    csrgemm_row(i, A, B, D, char(), char(), false, acc);
+
+                    row_nnz[i] = static_cast<R>(acc.cols().size());
+                }
+            }
+        }
+    }
+
+    // Numeric phase: columns and values of C = alpha * A * B + beta * D for the row
+    // offsets ptr_C of C, in ascending column order per row. Values are only
+    // computed if val_C is not nullptr.
+    template <typename T, typename V, typename IC, typename JC>
+    void host_csrgemm(int64_t   m,
+                      const V*  A,
+                      const V&  B,
+                      const V*  D,
+                      T         alpha,
+                      T         beta,
+                      const IC* ptr_C,
+                      int64_t   base_C,
+                      JC*       ind_C,
+                      T*        val_C)
+    {
+        csrgemm_schedule plan    = csrgemm_plan(m, A, B, D);
+        int64_t          nchunks = plan.chunks.size() - 1;
+        bool             values  = (val_C != nullptr);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            csrgemm_accumulator<T> acc;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int64_t c = 0; c < nchunks; ++c)
+            {
+                for(int64_t i = plan.chunks[c]; i < plan.chunks[c + 1]; ++i)
+                {
+                    acc.begin(plan.bound(i));
+                    csrgemm_row(i, A, B, D, alpha, beta, values, acc);
+
+                    int64_t idx = ptr_C[i] - base_C;
+
+                    for(size_t s = 0; s < acc.cols().size(); ++s)
+                    {
+                        ind_C[idx + s] = static_cast<JC>(acc.cols()[s] + base_C);
+
+                        if(values)
+                        {
+                            val_C[idx + s] = acc.vals()[s];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Numeric phase for an existing sparsity pattern of C, which has to contain all
+    // entries of the product. Columns of C that are not part of the product are set
+    // to zero. D may alias C.
+    template <typename T, typename V, typename VC>
+    void host_csrgemm_values(
+        int64_t m, const V* A, const V& B, const V* D, T alpha, T beta, const VC& C)
+    {
+        csrgemm_schedule plan    = csrgemm_plan(m, A, B, D);
+        int64_t          nchunks = plan.chunks.size() - 1;
+        T*               val_C   = (T*)C.val;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            csrgemm_accumulator<T> acc;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int64_t c = 0; c < nchunks; ++c)
+            {
+                for(int64_t i = plan.chunks[c]; i < plan.chunks[c + 1]; ++i)
+                {
+                    acc.begin(plan.bound(i));
+                    csrgemm_row(i, A, B, D, alpha, beta, true, acc);
+
+                    const std::vector<int64_t>& cols = acc.cols();
+
+                    for(int64_t k = C.begin(i); k < C.end(i); ++k)
+                    {
+                        auto it = std::lower_bound(cols.begin(), cols.end(), C.col(k));
+
+                        val_C[C.pos(k)] = (it != cols.end() && *it == C.col(k))
+                                              ? acc.vals()[it - cols.begin()]
+                                              : T();
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // HOST_CSRGEMM_HPP
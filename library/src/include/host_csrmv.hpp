@@ -0,0 +1,207 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#pragma once
+#ifndef HOST_CSRMV_HPP
+#define HOST_CSRMV_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace hipsparse
+{
+    // Row compressed view of a sparse matrix. Row i holds the entries
+    // k = begin(i), ..., end(i) - 1 with column col(k) and value val[pos(k)].
+    template <typename I, typename J>
+    struct csr_view
+    {
+        int64_t        m;
+        int64_t        n;
+        const I*       ptr;
+        const J*       ind;
+        const int64_t* perm;
+        int64_t        ptr_base;
+        int64_t        ind_base;
+        const void*    val;
+
+        int64_t begin(int64_t i) const
+        {
+            return ptr[i] - ptr_base;
+        }
+
+        int64_t end(int64_t i) const
+        {
+            return ptr[i + 1] - ptr_base;
+        }
+
+        int64_t col(int64_t k) const
+        {
+            return ind[k] - ind_base;
+        }
+
+        int64_t pos(int64_t k) const
+        {
+            return (perm != nullptr) ? perm[k] : k;
+        }
+    };
+
+    // Point on the merge path of the row end offsets and the entries of a matrix:
+    // rows [0, row) and entries [0, entry) have been consumed.
+    struct merge_coordinate
+    {
+        int64_t row;
+        int64_t entry;
+    };
+
+    // Minimum number of rows plus entries processed by a merge-path partition
+    static constexpr int64_t merge_path_min_items = 4096;
+
+    // Intersection of the merge path with diagonal row + entry = diagonal, found by
+    // binary search. Entries are counted relative to begin(0).
+    template <typename V>
+    merge_coordinate merge_path_search(const V& A, int64_t nnz, int64_t diagonal)
+    {
+        int64_t first = A.begin(0);
+        int64_t lo    = std::max(diagonal - nnz, static_cast<int64_t>(0));
+        int64_t hi    = std::min(diagonal, A.m);
+
+        while(lo < hi)
+        {
+            int64_t mid = lo + (hi - lo) / 2;
+
+            if(A.end(mid) - first <= diagonal - mid - 1)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        merge_coordinate coord = {lo, diagonal - lo};
+        return coord;
+    }
+
+    // sum += A(k, :) * x for the entries k = k_begin, ..., k_end - 1. Real types are
+    // vectorized, such that the loads of x become gathers on targets that have them.
+    template <typename T, typename V, typename L>
+    T merge_path_dot(
+        const V& A, L& load, const T* x, int64_t k_begin, int64_t k_end, T sum, std::true_type)
+    {
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum)
+#endif
+        for(int64_t k = k_begin; k < k_end; ++k)
+        {
+            sum += load(k) * x[A.col(k)];
+        }
+
+        return sum;
+    }
+
+    template <typename T, typename V, typename L>
+    T merge_path_dot(
+        const V& A, L& load, const T* x, int64_t k_begin, int64_t k_end, T sum, std::false_type)
+    {
+        for(int64_t k = k_begin; k < k_end; ++k)
+        {
+            sum = sum + load(k) * x[A.col(k)];
+        }
+
+        return sum;
+    }
+
+    // y = alpha * A * x + beta * y, where load(k) returns the value of entry k.
+    //
+    // Load balanced by merge path: the rows and entries of A are split into equally
+    // sized partitions, independent of the row lengths, such that a few long rows do
+    // not serialize the product. A row shared by several partitions is completed by
+    // the partition it ends in, the partial sums of all other partitions are added
+    // afterwards. y is not read if beta is zero.
+    template <typename T, typename V, typename L>
+    void host_csrmv_merge_path(const V& A, L load, T alpha, const T* x, T beta, T* y)
+    {
+        if(A.m == 0)
+        {
+            return;
+        }
+
+        typedef typename std::is_arithmetic<T>::type vectorize;
+
+        const T zero = T();
+        int64_t nnz  = A.end(A.m - 1) - A.begin(0);
+        int64_t work = A.m + nnz;
+
+        int64_t parts = 1;
+#ifdef _OPENMP
+        parts = std::min(static_cast<int64_t>(omp_get_max_threads()),
+                         (work + merge_path_min_items - 1) / merge_path_min_items);
+        parts = std::max(parts, static_cast<int64_t>(1));
+#endif
+
+        std::vector<int64_t> carry_row(parts);
+        std::vector<T>       carry_sum(parts);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(parts)
+#endif
+        for(int64_t p = 0; p < parts; ++p)
+        {
+            merge_coordinate first = merge_path_search(A, nnz, work * p / parts);
+            merge_coordinate last  = merge_path_search(A, nnz, work * (p + 1) / parts);
+
+            int64_t k = A.begin(0) + first.entry;
+
+            for(int64_t i = first.row; i < last.row; ++i)
+            {
+                T sum = merge_path_dot(A, load, x, k, A.end(i), zero, vectorize());
+                k     = A.end(i);
+
+                y[i] = (beta == zero) ? alpha * sum : alpha * sum + beta * y[i];
+            }
+
+            // Entries of the row that continues in the next partition
+            carry_row[p] = last.row;
+            carry_sum[p]
+                = merge_path_dot(A, load, x, k, A.begin(0) + last.entry, zero, vectorize());
+        }
+
+        for(int64_t p = 0; p < parts; ++p)
+        {
+            if(carry_row[p] < A.m)
+            {
+                y[carry_row[p]] = y[carry_row[p]] + alpha * carry_sum[p];
+            }
+        }
+    }
+}
+
+#endif // HOST_CSRMV_HPP
@@ -0,0 +1,297 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#pragma once
+#ifndef HOST_CSRSV_HPP
+#define HOST_CSRSV_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// CPU triangular solve of row compressed views (see host_csrmv.hpp). The solve is
+// split into an analysis of the sparsity pattern, which can be reused as long as the
+// pattern does not change, and a parallel solve.
+
+namespace hipsparse
+{
+    // Levels narrower than this number of rows on average are solved without
+    // barriers, each row waiting for the rows it depends on instead
+    static constexpr int64_t csrsv_sync_free_width = 64;
+
+    // Level set analysis of the lower or upper triangular part of a sparse matrix.
+    // Row i depends on the rows j of its entries in the strict triangle. Level l holds
+    // the rows whose longest chain of dependencies has length l, all rows of a level
+    // can be solved in parallel once the previous levels are complete.
+    struct csrsv_info
+    {
+        int64_t m         = 0;
+        bool    lower     = true;
+        bool    sync_free = false;
+
+        // Entry of the diagonal of each row, -1 if the row has no diagonal entry
+        std::vector<int64_t> diag;
+
+        // Rows of level l are order[level_ptr[l]], ..., order[level_ptr[l + 1] - 1]
+        std::vector<int64_t> level_ptr;
+        std::vector<int64_t> order;
+
+        int64_t levels() const
+        {
+            return static_cast<int64_t>(level_ptr.size()) - 1;
+        }
+    };
+
+    template <typename V>
+    void host_csrsv_analysis(const V& A, bool lower, csrsv_info& info)
+    {
+        int64_t m = A.m;
+
+        info.m     = m;
+        info.lower = lower;
+        info.diag.assign(m, -1);
+
+        std::vector<int64_t> level(m);
+        int64_t              nlevels = 0;
+
+        // Rows are visited in the order of the substitution, such that the levels
+        // of all dependencies are known
+        for(int64_t r = 0; r < m; ++r)
+        {
+            int64_t i   = lower ? r : m - 1 - r;
+            int64_t lvl = 0;
+
+            for(int64_t k = A.begin(i); k < A.end(i); ++k)
+            {
+                int64_t j = A.col(k);
+
+                if(j == i)
+                {
+                    info.diag[i] = (info.diag[i] < 0) ? k : info.diag[i];
+                }
+                else if(lower ? j < i : j > i)
+                {
+                    lvl = std::max(lvl, level[j] + 1);
+                }
+            }
+
+            level[i] = lvl;
+            nlevels  = std::max(nlevels, lvl + 1);
+        }
+
+        info.level_ptr.assign(nlevels + 1, 0);
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            ++info.level_ptr[level[i] + 1];
+        }
+
+        for(int64_t l = 0; l < nlevels; ++l)
+        {
+            info.level_ptr[l + 1] += info.level_ptr[l];
+        }
+
+        std::vector<int64_t> next(info.level_ptr.begin(), info.level_ptr.end() - 1);
+
+        info.order.resize(m);
+
+        for(int64_t r = 0; r < m; ++r)
+        {
+            int64_t i = lower ? r : m - 1 - r;
+
+            info.order[next[level[i]]++] = i;
+        }
+
+        info.sync_free = (m < nlevels * csrsv_sync_free_width);
+    }
+
+    // Lowest row without diagonal entry, -1 if all rows have one
+    inline int64_t csrsv_struct_pivot(const csrsv_info& info)
+    {
+        for(int64_t i = 0; i < info.m; ++i)
+        {
+            if(info.diag[i] < 0)
+            {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    // Lowest row whose diagonal entry is zero, -1 if there is none. load(k) returns
+    // the value of entry k.
+    template <typename T, typename L>
+    int64_t csrsv_numeric_pivot(const csrsv_info& info, L load)
+    {
+        for(int64_t i = 0; i < info.m; ++i)
+        {
+            if(info.diag[i] >= 0 && load(info.diag[i]) == T())
+            {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    // Substitution of row i for all right hand sides. A missing or zero diagonal
+    // entry is treated as one, such that the solve completes past a pivot.
+    template <typename T, typename V, typename L, typename Y>
+    void csrsv_row(
+        const csrsv_info& info, const V& A, L& load, bool unit, int64_t nrhs, Y& y, int64_t i)
+    {
+        const T zero = T();
+        T       d    = (unit || info.diag[i] < 0) ? zero : load(info.diag[i]);
+
+        for(int64_t r = 0; r < nrhs; ++r)
+        {
+            T sum = y(i, r);
+
+            for(int64_t k = A.begin(i); k < A.end(i); ++k)
+            {
+                int64_t j = A.col(k);
+
+                if(info.lower ? j < i : j > i)
+                {
+                    sum = sum - load(k) * y(j, r);
+                }
+            }
+
+            y(i, r) = (d == zero) ? sum : sum / d;
+        }
+    }
+
+    // Upper bound of the thread ids passed to the row functor of csrsv_schedule
+    inline int csrsv_max_threads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    // Call row(i, tid) once for every row i of the analysed triangle, such that all
+    // rows i depends on are complete before row i is processed. tid is the id of the
+    // calling thread, below csrsv_max_threads().
+    //
+    // Wide level sets are processed level by level, with a barrier between levels.
+    // Otherwise, rows are dealt out to the threads in level order, and each row spins
+    // on the completion flags of its dependencies. All dependencies of a row precede
+    // it in level order, hence the lowest incomplete row is always runnable.
+    template <typename V, typename F>
+    void csrsv_schedule(const csrsv_info& info, const V& A, F row)
+    {
+        int64_t m = info.m;
+
+        if(!info.sync_free)
+        {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                int tid = 0;
+#ifdef _OPENMP
+                tid = omp_get_thread_num();
+#endif
+
+                for(int64_t l = 0; l < info.levels(); ++l)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+                    for(int64_t p = info.level_ptr[l]; p < info.level_ptr[l + 1]; ++p)
+                    {
+                        row(info.order[p], tid);
+                    }
+                }
+            }
+
+            return;
+        }
+
+        std::unique_ptr<std::atomic<char>[]> done(new std::atomic<char>[m]);
+
+        for(int64_t i = 0; i < m; ++i)
+        {
+            done[i].store(0, std::memory_order_relaxed);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int threads = 1;
+            int tid     = 0;
+#ifdef _OPENMP
+            threads = omp_get_num_threads();
+            tid     = omp_get_thread_num();
+#endif
+
+            for(int64_t p = tid; p < m; p += threads)
+            {
+                int64_t i = info.order[p];
+
+                for(int64_t k = A.begin(i); k < A.end(i); ++k)
+                {
+                    int64_t j = A.col(k);
+
+                    if(info.lower ? j < i : j > i)
+                    {
+                        while(done[j].load(std::memory_order_acquire) == 0)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+                row(i, tid);
+
+                done[i].store(1, std::memory_order_release);
+            }
+        }
+    }
+
+    // Solve op(A) * Y = B in place, where y(i, r) holds B(i, r) on entry and Y(i, r) on
+    // exit, for nrhs right hand sides. load(k) returns the value of entry k of op(A),
+    // info is the analysis of the triangle to be solved.
+    template <typename T, typename V, typename L, typename Y>
+    void host_csrsv_solve(
+        const csrsv_info& info, const V& A, L load, bool unit, int64_t nrhs, Y y)
+    {
+        csrsv_schedule(info, A, [&](int64_t i, int) {
+            csrsv_row<T>(info, A, load, unit, nrhs, y, i);
+        });
+    }
+}
+
+#endif // HOST_CSRSV_HPP
@@ -0,0 +1,694 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef HOST_GTSV_HPP
+#define HOST_GTSV_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// CPU solvers for tridiagonal and pentadiagonal systems. Batches of systems, and the
+// right-hand sides of a shared matrix, are solved in chunks of lanes. Every step of a
+// solver is applied to all lanes of a chunk before the next step, such that the loops
+// over the lanes are free of dependencies and vectorize. Chunks are processed in parallel.
+
+namespace hipsparse
+{
+    // Number of systems or right-hand sides in a chunk
+    static const int64_t gtsv_lanes = 64;
+
+    template <typename T>
+    inline T gtsv_conj(const T& x)
+    {
+        return x;
+    }
+
+    template <typename T>
+    inline std::complex<T> gtsv_conj(const std::complex<T>& x)
+    {
+        return std::conj(x);
+    }
+
+    template <typename T>
+    inline T gtsv_abs2(const T& x)
+    {
+        return x * x;
+    }
+
+    template <typename T>
+    inline T gtsv_abs2(const std::complex<T>& x)
+    {
+        return std::norm(x);
+    }
+
+    // Rotation G = [conj(c) conj(s); -s c] with G * [a; b] = [r; 0]. If a and b are both
+    // zero, G is the identity. Free of branches, such that it vectorizes.
+    template <typename T>
+    inline void gtsv_givens(const T& a, const T& b, T& c, T& s, T& r)
+    {
+        auto nrm  = std::sqrt(gtsv_abs2(a) + gtsv_abs2(b));
+        auto zero = (nrm == 0) ? decltype(nrm)(1) : decltype(nrm)(0);
+        auto inv  = decltype(nrm)(1) / (nrm + zero);
+
+        c = a * inv + T(zero);
+        s = b * inv;
+        r = T(nrm);
+    }
+
+    // Call f(l0, l1) in parallel for the chunks [l0, l1) of lanes 0, ..., lanes - 1
+    template <typename F>
+    void gtsv_for_each_chunk(int64_t lanes, F f)
+    {
+        int64_t chunks = (lanes - 1) / gtsv_lanes + 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t c = 0; c < chunks; ++c)
+        {
+            f(c * gtsv_lanes, std::min(lanes, (c + 1) * gtsv_lanes));
+        }
+    }
+
+    // Thomas algorithm for an interleaved batch of m x m tridiagonal systems. Entry i of
+    // system b is stored at i * batch + b. x holds the right-hand sides on entry and the
+    // solutions on exit. buffer holds m * batch values. There is no pivoting, the
+    // systems should be diagonally dominant.
+    template <typename T>
+    void host_gtsv_interleaved_thomas(
+        int64_t m, int64_t batch, const T* dl, const T* d, const T* du, T* x, T* buffer)
+    {
+        // Modified upper diagonal
+        T* cp = buffer;
+
+        gtsv_for_each_chunk(batch, [&](int64_t b0, int64_t b1) {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(int64_t b = b0; b < b1; ++b)
+            {
+                T inv = T(1) / d[b];
+                cp[b] = du[b] * inv;
+                x[b]  = x[b] * inv;
+            }
+
+            for(int64_t i = 1; i < m; ++i)
+            {
+                const int64_t r = i * batch;
+                const int64_t p = r - batch;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t b = b0; b < b1; ++b)
+                {
+                    T inv     = T(1) / (d[r + b] - dl[r + b] * cp[p + b]);
+                    cp[r + b] = du[r + b] * inv;
+                    x[r + b]  = (x[r + b] - dl[r + b] * x[p + b]) * inv;
+                }
+            }
+
+            for(int64_t i = m - 2; i >= 0; --i)
+            {
+                const int64_t r = i * batch;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t b = b0; b < b1; ++b)
+                {
+                    x[r + b] -= cp[r + b] * x[r + batch + b];
+                }
+            }
+        });
+    }
+
+    // Row i of the upper triangular systems R * x = y of an interleaved batch, where row
+    // i of R holds R[k][i * batch + b] in column i + k for k = 0, ..., W - 1
+    template <int W, int BW, typename T>
+    void gtsv_interleaved_backward_row(
+        int64_t i, int64_t batch, int64_t b0, int64_t b1, T* const (&R)[BW], T* x)
+    {
+        const int64_t r = i * batch;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int64_t b = b0; b < b1; ++b)
+        {
+            T sum = x[r + b];
+
+            for(int k = 1; k < W; ++k)
+            {
+                sum -= R[k][r + b] * x[r + k * batch + b];
+            }
+
+            x[r + b] = sum / R[0][r + b];
+        }
+    }
+
+    // Solve the upper triangular systems R * x = y with BW - 1 upper diagonals. The last
+    // rows are cut off by the end of the matrix.
+    template <int BW, typename T>
+    void gtsv_interleaved_backward(
+        int64_t m, int64_t batch, int64_t b0, int64_t b1, T* const (&R)[BW], T* x)
+    {
+        for(int64_t i = m - 1; i >= 0; --i)
+        {
+            switch(std::min<int64_t>(BW, m - i))
+            {
+            case 1:
+                gtsv_interleaved_backward_row<1>(i, batch, b0, b1, R, x);
+                break;
+            case 2:
+                gtsv_interleaved_backward_row<2>(i, batch, b0, b1, R, x);
+                break;
+            case 3:
+                gtsv_interleaved_backward_row<(BW < 3 ? BW : 3)>(i, batch, b0, b1, R, x);
+                break;
+            case 4:
+                gtsv_interleaved_backward_row<(BW < 4 ? BW : 4)>(i, batch, b0, b1, R, x);
+                break;
+            default:
+                gtsv_interleaved_backward_row<BW>(i, batch, b0, b1, R, x);
+                break;
+            }
+        }
+    }
+
+    // QR factorization by Givens rotations for an interleaved batch of tridiagonal
+    // systems, with the layout of host_gtsv_interleaved_thomas. R has two upper
+    // diagonals. buffer holds 3 * m * batch values. The solver is stable for any
+    // non-singular matrix.
+    template <typename T>
+    void host_gtsv_interleaved_qr(
+        int64_t m, int64_t batch, const T* dl, const T* d, const T* du, T* x, T* buffer)
+    {
+        T* const R[3] = {buffer, buffer + m * batch, buffer + 2 * m * batch};
+
+        gtsv_for_each_chunk(batch, [&](int64_t b0, int64_t b1) {
+            // Columns k and k + 1 of the current row k
+            T p0[gtsv_lanes];
+            T p1[gtsv_lanes];
+
+            for(int64_t b = b0; b < b1; ++b)
+            {
+                p0[b - b0] = d[b];
+                p1[b - b0] = (m > 1) ? du[b] : T(0);
+            }
+
+            for(int64_t k = 0; k < m - 1; ++k)
+            {
+                const int64_t r  = k * batch;
+                const int64_t n  = r + batch;
+                const bool    u2 = (k + 2 < m);
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t b = b0; b < b1; ++b)
+                {
+                    const int64_t j = b - b0;
+
+                    T c, s, nrm;
+                    gtsv_givens(p0[j], dl[n + b], c, s, nrm);
+
+                    T q1 = d[n + b];
+                    T q2 = du[n + b];
+                    q2   = u2 ? q2 : T(0);
+
+                    R[0][r + b] = nrm;
+                    R[1][r + b] = gtsv_conj(c) * p1[j] + gtsv_conj(s) * q1;
+                    R[2][r + b] = gtsv_conj(s) * q2;
+
+                    p0[j] = c * q1 - s * p1[j];
+                    p1[j] = c * q2;
+
+                    T xk     = x[r + b];
+                    T xn     = x[n + b];
+                    x[r + b] = gtsv_conj(c) * xk + gtsv_conj(s) * xn;
+                    x[n + b] = c * xn - s * xk;
+                }
+            }
+
+            for(int64_t b = b0; b < b1; ++b)
+            {
+                R[0][(m - 1) * batch + b] = p0[b - b0];
+            }
+
+            gtsv_interleaved_backward<3>(m, batch, b0, b1, R, x);
+        });
+    }
+
+    // QR factorization by Givens rotations for an interleaved batch of pentadiagonal
+    // systems. Row i of system b holds ds, dl, d, du and dw at i * batch + b in the
+    // columns i - 2, ..., i + 2. R has four upper diagonals. buffer holds 5 * m * batch
+    // values.
+    template <typename T>
+    void host_gpsv_interleaved_qr(int64_t  m,
+                                  int64_t  batch,
+                                  const T* ds,
+                                  const T* dl,
+                                  const T* d,
+                                  const T* du,
+                                  const T* dw,
+                                  T*       x,
+                                  T*       buffer)
+    {
+        T* const R[5] = {buffer,
+                         buffer + m * batch,
+                         buffer + 2 * m * batch,
+                         buffer + 3 * m * batch,
+                         buffer + 4 * m * batch};
+
+        gtsv_for_each_chunk(batch, [&](int64_t b0, int64_t b1) {
+            // At step k, p holds the columns k, ..., k + 3 of row k, q the columns
+            // k, ..., k + 4 of row k + 1 and t the columns k + 1, ..., k + 4 of row k + 2
+            T p[4][gtsv_lanes];
+            T q[5][gtsv_lanes];
+            T t[4][gtsv_lanes];
+
+            for(int64_t b = b0; b < b1; ++b)
+            {
+                const int64_t j = b - b0;
+
+                p[0][j] = d[b];
+                p[1][j] = (m > 1) ? du[b] : T(0);
+                p[2][j] = (m > 2) ? dw[b] : T(0);
+                p[3][j] = T(0);
+
+                if(m > 1)
+                {
+                    q[0][j] = dl[batch + b];
+                    q[1][j] = d[batch + b];
+                    q[2][j] = (m > 2) ? du[batch + b] : T(0);
+                    q[3][j] = (m > 3) ? dw[batch + b] : T(0);
+                }
+            }
+
+            for(int64_t k = 0; k < m - 1; ++k)
+            {
+                const int64_t r = k * batch;
+                const int64_t n = r + batch;
+                const int64_t o = n + batch;
+
+                if(k + 2 < m)
+                {
+                    const bool u3 = (k + 3 < m);
+                    const bool u4 = (k + 4 < m);
+
+                    // Rotate rows k + 1 and k + 2 to eliminate row k + 2 in column k
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for(int64_t b = b0; b < b1; ++b)
+                    {
+                        const int64_t j = b - b0;
+
+                        T s1 = dl[o + b];
+                        T s2 = d[o + b];
+                        T s3 = du[o + b];
+                        T s4 = dw[o + b];
+                        s3   = u3 ? s3 : T(0);
+                        s4   = u4 ? s4 : T(0);
+
+                        T c, s, nrm;
+                        gtsv_givens(q[0][j], ds[o + b], c, s, nrm);
+
+                        T cc = gtsv_conj(c);
+                        T sc = gtsv_conj(s);
+
+                        t[0][j] = c * s1 - s * q[1][j];
+                        t[1][j] = c * s2 - s * q[2][j];
+                        t[2][j] = c * s3 - s * q[3][j];
+                        t[3][j] = c * s4;
+
+                        q[0][j] = nrm;
+                        q[1][j] = cc * q[1][j] + sc * s1;
+                        q[2][j] = cc * q[2][j] + sc * s2;
+                        q[3][j] = cc * q[3][j] + sc * s3;
+                        q[4][j] = sc * s4;
+
+                        T xn     = x[n + b];
+                        T xo     = x[o + b];
+                        x[n + b] = cc * xn + sc * xo;
+                        x[o + b] = c * xo - s * xn;
+                    }
+                }
+                else
+                {
+                    for(int64_t b = b0; b < b1; ++b)
+                    {
+                        q[4][b - b0] = T(0);
+                    }
+                }
+
+                // Rotate rows k and k + 1 to eliminate row k + 1 in column k
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t b = b0; b < b1; ++b)
+                {
+                    const int64_t j = b - b0;
+
+                    T c, s, nrm;
+                    gtsv_givens(p[0][j], q[0][j], c, s, nrm);
+
+                    T cc = gtsv_conj(c);
+                    T sc = gtsv_conj(s);
+
+                    R[0][r + b] = nrm;
+                    R[1][r + b] = cc * p[1][j] + sc * q[1][j];
+                    R[2][r + b] = cc * p[2][j] + sc * q[2][j];
+                    R[3][r + b] = cc * p[3][j] + sc * q[3][j];
+                    R[4][r + b] = sc * q[4][j];
+
+                    p[0][j] = c * q[1][j] - s * p[1][j];
+                    p[1][j] = c * q[2][j] - s * p[2][j];
+                    p[2][j] = c * q[3][j] - s * p[3][j];
+                    p[3][j] = c * q[4][j];
+
+                    T xk     = x[r + b];
+                    T xn     = x[n + b];
+                    x[r + b] = cc * xk + sc * xn;
+                    x[n + b] = c * xn - s * xk;
+                }
+
+                if(k + 2 < m)
+                {
+                    for(int64_t b = b0; b < b1; ++b)
+                    {
+                        const int64_t j = b - b0;
+
+                        q[0][j] = t[0][j];
+                        q[1][j] = t[1][j];
+                        q[2][j] = t[2][j];
+                        q[3][j] = t[3][j];
+                    }
+                }
+            }
+
+            for(int64_t b = b0; b < b1; ++b)
+            {
+                R[0][(m - 1) * batch + b] = p[0][b - b0];
+            }
+
+            gtsv_interleaved_backward<5>(m, batch, b0, b1, R, x);
+        });
+    }
+
+    // Cyclic reduction for the tridiagonal system with the diagonals a, b and c, which
+    // are overwritten. a[0] and c[m - 1] must be zero. x holds the right-hand side on
+    // entry and the solution on exit. The equations of a level are independent of each
+    // other, such that the loops over them vectorize. There is no pivoting.
+    template <typename T>
+    void gtsv_cyclic_reduction(int64_t m, T* a, T* b, T* c, T* x)
+    {
+        // Level s eliminates the neighbours i - s and i + s from the equations
+        // i = 2s - 1, 4s - 1, ..., which then couple to i - 2s and i + 2s only
+        int64_t s = 1;
+        for(; 2 * s - 1 < m; s *= 2)
+        {
+            int64_t i = 2 * s - 1;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(int64_t e = i; e < m - s; e += 2 * s)
+            {
+                T k1 = a[e] / b[e - s];
+                T k2 = c[e] / b[e + s];
+
+                b[e] -= c[e - s] * k1 + a[e + s] * k2;
+                x[e] -= x[e - s] * k1 + x[e + s] * k2;
+                a[e] = -a[e - s] * k1;
+                c[e] = -c[e + s] * k2;
+            }
+
+            // The last equation of the level may have no upper neighbour
+            i += ((std::max<int64_t>(m - s - i, 0) + 2 * s - 1) / (2 * s)) * 2 * s;
+            if(i < m)
+            {
+                T k1 = a[i] / b[i - s];
+
+                b[i] -= c[i - s] * k1;
+                x[i] -= x[i - s] * k1;
+                a[i] = -a[i - s] * k1;
+                c[i] = T(0);
+            }
+        }
+
+        // A single equation s - 1 remains, substitute back level by level
+        x[s - 1] /= b[s - 1];
+
+        for(s /= 2; s >= 1; s /= 2)
+        {
+            x[s - 1] = (x[s - 1] - ((2 * s - 1 < m) ? c[s - 1] * x[2 * s - 1] : T(0))) / b[s - 1];
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(int64_t e = 3 * s - 1; e < m - s; e += 2 * s)
+            {
+                x[e] = (x[e] - a[e] * x[e - s] - c[e] * x[e + s]) / b[e];
+            }
+
+            int64_t i = 3 * s - 1;
+            i += ((std::max<int64_t>(m - s - i, 0) + 2 * s - 1) / (2 * s)) * 2 * s;
+            if(i < m)
+            {
+                x[i] = (x[i] - a[i] * x[i - s]) / b[i];
+            }
+        }
+    }
+
+    // Strided batch of tridiagonal systems, system b starts at b * stride. Each system is
+    // solved by cyclic reduction. buffer holds 3 * m * batch values.
+    template <typename T>
+    void host_gtsv_strided_cr(int64_t  m,
+                              int64_t  batch,
+                              int64_t  stride,
+                              const T* dl,
+                              const T* d,
+                              const T* du,
+                              T*       x,
+                              T*       buffer)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for(int64_t sys = 0; sys < batch; ++sys)
+        {
+            T* a = buffer + 3 * m * sys;
+            T* b = a + m;
+            T* c = b + m;
+
+            const int64_t offset = stride * sys;
+
+            std::copy(dl + offset, dl + offset + m, a);
+            std::copy(d + offset, d + offset + m, b);
+            std::copy(du + offset, du + offset + m, c);
+
+            a[0]     = T(0);
+            c[m - 1] = T(0);
+
+            gtsv_cyclic_reduction(m, a, b, c, x + offset);
+        }
+    }
+
+    // Thomas factorization of a single tridiagonal matrix, applied to the n columns of B
+    // with leading dimension ldb. buffer holds 2 * m values. There is no pivoting.
+    template <typename T>
+    void host_gtsv_nopivot(
+        int64_t m, int64_t n, const T* dl, const T* d, const T* du, T* B, int64_t ldb, T* buffer)
+    {
+        // Modified upper diagonal and inverse pivots
+        T* cp  = buffer;
+        T* inv = buffer + m;
+
+        inv[0] = T(1) / d[0];
+        cp[0]  = du[0] * inv[0];
+
+        for(int64_t i = 1; i < m; ++i)
+        {
+            inv[i] = T(1) / (d[i] - dl[i] * cp[i - 1]);
+            cp[i]  = du[i] * inv[i];
+        }
+
+        gtsv_for_each_chunk(n, [&](int64_t j0, int64_t j1) {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(int64_t j = j0; j < j1; ++j)
+            {
+                B[ldb * j] *= inv[0];
+            }
+
+            for(int64_t i = 1; i < m; ++i)
+            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t j = j0; j < j1; ++j)
+                {
+                    T* b = B + ldb * j;
+                    b[i] = (b[i] - dl[i] * b[i - 1]) * inv[i];
+                }
+            }
+
+            for(int64_t i = m - 2; i >= 0; --i)
+            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t j = j0; j < j1; ++j)
+                {
+                    T* b = B + ldb * j;
+                    b[i] -= cp[i] * b[i + 1];
+                }
+            }
+        });
+    }
+
+    // Size in bytes of the buffer of host_gtsv
+    template <typename T>
+    size_t host_gtsv_buffer_size(int64_t m)
+    {
+        return (4 * sizeof(T) + sizeof(int64_t)) * m;
+    }
+
+    // LU factorization with partial pivoting of a single tridiagonal matrix, as in
+    // LAPACK gttrf, applied to the n columns of B with leading dimension ldb. The row
+    // interchanges are the same for all columns, such that only the arithmetic is
+    // vectorized across columns.
+    template <typename T>
+    void host_gtsv(
+        int64_t m, int64_t n, const T* dl, const T* d, const T* du, T* B, int64_t ldb, void* buffer)
+    {
+        // Multipliers, diagonal, first and second upper diagonal of U, and pivots
+        T*       l   = (T*)buffer;
+        T*       dd  = l + m;
+        T*       u   = dd + m;
+        T*       u2  = u + m;
+        int64_t* piv = (int64_t*)(u2 + m);
+
+        std::copy(dl + 1, dl + m, l);
+        std::copy(d, d + m, dd);
+        std::copy(du, du + m, u);
+        std::fill(u2, u2 + m, T(0));
+
+        for(int64_t i = 0; i < m - 1; ++i)
+        {
+            if(gtsv_abs2(dd[i]) >= gtsv_abs2(l[i]))
+            {
+                piv[i] = i;
+
+                if(dd[i] != T(0))
+                {
+                    l[i] /= dd[i];
+                    dd[i + 1] -= l[i] * u[i];
+                }
+            }
+            else
+            {
+                T fact    = dd[i] / l[i];
+                dd[i]     = l[i];
+                l[i]      = fact;
+                T temp    = u[i];
+                u[i]      = dd[i + 1];
+                dd[i + 1] = temp - fact * dd[i + 1];
+
+                if(i + 2 < m)
+                {
+                    u2[i]    = u[i + 1];
+                    u[i + 1] = -fact * u[i + 1];
+                }
+
+                piv[i] = i + 1;
+            }
+        }
+
+        gtsv_for_each_chunk(n, [&](int64_t j0, int64_t j1) {
+            for(int64_t i = 0; i < m - 1; ++i)
+            {
+                if(piv[i] == i)
+                {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for(int64_t j = j0; j < j1; ++j)
+                    {
+                        T* b = B + ldb * j;
+                        b[i + 1] -= l[i] * b[i];
+                    }
+                }
+                else
+                {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for(int64_t j = j0; j < j1; ++j)
+                    {
+                        T* b     = B + ldb * j;
+                        T  temp  = b[i];
+                        b[i]     = b[i + 1];
+                        b[i + 1] = temp - l[i] * b[i];
+                    }
+                }
+            }
+
+            for(int64_t i = m - 1; i >= 0; --i)
+            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(int64_t j = j0; j < j1; ++j)
+                {
+                    T* b   = B + ldb * j;
+                    T  sum = b[i];
+
+                    if(i + 1 < m)
+                    {
+                        sum -= u[i] * b[i + 1];
+                    }
+
+                    if(i + 2 < m)
+                    {
+                        sum -= u2[i] * b[i + 2];
+                    }
+
+                    b[i] = sum / dd[i];
+                }
+            }
+        });
+    }
+}
+
+#endif // HOST_GTSV_HPP
@@ -0,0 +1,315 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef LOGGING_HPP
+#define LOGGING_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace hipsparse
+{
+    // Logging layers, combined as bit mask in the environment variable HIPSPARSE_LAYER
+    enum layer_mode
+    {
+        layer_mode_none        = 0,
+        layer_mode_log_trace   = 1,
+        layer_mode_log_bench   = 2,
+        layer_mode_log_profile = 4
+    };
+
+    enum profile_format
+    {
+        profile_format_json,
+        profile_format_csv
+    };
+
+    // Accumulated calls of a single API function
+    struct profile_entry
+    {
+        uint64_t calls   = 0;
+        double   time_us = 0.0;
+    };
+
+    // Argument formatting. Pointers are logged by address, as their contents might
+    // live in device memory.
+    template <typename T>
+    inline void log_arg(std::ostream& os, T* arg)
+    {
+        os << (const void*)arg;
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_enum<T>::value>::type log_arg(std::ostream& os,
+                                                                          T             arg)
+    {
+        os << (int)arg;
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_arithmetic<T>::value>::type log_arg(std::ostream& os,
+                                                                                T             arg)
+    {
+        os << arg;
+    }
+
+    inline void log_arg(std::ostream& os, const std::string& arg)
+    {
+        os << arg;
+    }
+
+    inline void log_arg(std::ostream& os, const char* arg)
+    {
+        os << arg;
+    }
+
+    // Empty strings are skipped, e.g. optional arguments of a command line
+    template <typename T>
+    inline bool log_empty(const T&)
+    {
+        return false;
+    }
+
+    inline bool log_empty(const std::string& arg)
+    {
+        return arg.empty();
+    }
+
+    inline void log_args(std::ostream&, char) {}
+
+    template <typename T, typename... Ts>
+    inline void log_args(std::ostream& os, char separator, const T& arg, const Ts&... args)
+    {
+        if(!log_empty(arg))
+        {
+            os << separator;
+            log_arg(os, arg);
+        }
+
+        log_args(os, separator, args...);
+    }
+
+    // Comma separated trace line, e.g. "hipsparseScsrmv,0x1234,0,100,..."
+    template <typename... Ts>
+    inline std::string log_line(const char* name, const Ts&... args)
+    {
+        std::ostringstream os;
+        os << name;
+        log_args(os, ',', args...);
+        return os.str();
+    }
+
+    // Space separated command line of the benchmark client, e.g.
+    // "./hipsparse-bench -f csrmv -r s ..."
+    template <typename... Ts>
+    inline std::string log_command(const Ts&... args)
+    {
+        std::ostringstream os;
+        os << "./hipsparse-bench";
+        log_args(os, ' ', args...);
+        return os.str();
+    }
+
+    // Process wide logger. The configuration is read once from the environment:
+    //
+    //   HIPSPARSE_LAYER               bit mask of layer_mode
+    //   HIPSPARSE_LOG_TRACE_PATH      trace output file, stderr if not set
+    //   HIPSPARSE_LOG_BENCH_PATH      bench output file, stderr if not set
+    //   HIPSPARSE_LOG_PROFILE_PATH    profile output file, stderr if not set
+    //   HIPSPARSE_LOG_PROFILE_FORMAT  "json" (default) or "csv"
+    //
+    // Variables that hold the same path share a single file. The JSON profile is a single
+    // array that holds one object per handle and is closed when the logger is destroyed.
+    class logger
+    {
+    public:
+        logger(int            mode,
+               std::ostream*  trace_os,
+               std::ostream*  bench_os,
+               std::ostream*  profile_os,
+               profile_format format)
+            : mode_(mode)
+            , trace_os_(trace_os)
+            , bench_os_(bench_os)
+            , profile_os_(profile_os)
+            , format_(format)
+        {
+        }
+
+        ~logger()
+        {
+            if(json_open_)
+            {
+                *profile_os_ << "\n]" << std::endl;
+            }
+        }
+
+        logger(const logger&) = delete;
+        logger& operator=(const logger&) = delete;
+
+        static logger& instance()
+        {
+            static logger log(environment_mode(),
+                              environment_stream("HIPSPARSE_LOG_TRACE_PATH"),
+                              environment_stream("HIPSPARSE_LOG_BENCH_PATH"),
+                              environment_stream("HIPSPARSE_LOG_PROFILE_PATH"),
+                              environment_format());
+            return log;
+        }
+
+        int mode() const
+        {
+            return mode_;
+        }
+
+        void trace(const std::string& line)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            *trace_os_ << line << std::endl;
+        }
+
+        void bench(const std::string& line)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            *bench_os_ << line << std::endl;
+        }
+
+        // Account a call of function name on handle
+        void profile(const void* handle, const char* name, double time_us)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            profile_entry& entry = profiles_[handle][name];
+            ++entry.calls;
+            entry.time_us += time_us;
+        }
+
+        // Write and reset the profile of handle, functions are sorted by name
+        void dump_profile(const void* handle)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto it = profiles_.find(handle);
+            if(it == profiles_.end())
+            {
+                return;
+            }
+
+            std::ostream& os = *profile_os_;
+
+            if(format_ == profile_format_csv)
+            {
+                if(!csv_header_)
+                {
+                    os << "handle,function,calls,time_us\n";
+                    csv_header_ = true;
+                }
+
+                for(auto& entry : it->second)
+                {
+                    os << handle << ',' << entry.first << ',' << entry.second.calls << ','
+                       << entry.second.time_us << '\n';
+                }
+            }
+            else
+            {
+                os << (json_open_ ? ",\n" : "[\n");
+                json_open_ = true;
+
+                os << "  {\n    \"handle\": \"" << handle << "\",\n    \"functions\": [";
+
+                const char* separator = "\n";
+                for(auto& entry : it->second)
+                {
+                    os << separator << "      {\"name\": \"" << entry.first
+                       << "\", \"calls\": " << entry.second.calls
+                       << ", \"time_us\": " << entry.second.time_us << "}";
+                    separator = ",\n";
+                }
+
+                os << "\n    ]\n  }";
+            }
+
+            os.flush();
+            profiles_.erase(it);
+        }
+
+    private:
+        static int environment_mode()
+        {
+            const char* env = getenv("HIPSPARSE_LAYER");
+            return (env != nullptr) ? (int)strtol(env, nullptr, 0) : layer_mode_none;
+        }
+
+        static profile_format environment_format()
+        {
+            const char* env = getenv("HIPSPARSE_LOG_PROFILE_FORMAT");
+            return (env != nullptr && std::string(env) == "csv") ? profile_format_csv
+                                                                : profile_format_json;
+        }
+
+        // Files are kept open for the lifetime of the process, a path is only opened once
+        static std::ostream* environment_stream(const char* variable)
+        {
+            static std::map<std::string, std::unique_ptr<std::ofstream>> files;
+
+            const char* path = getenv(variable);
+            if(path == nullptr)
+            {
+                return &std::cerr;
+            }
+
+            std::unique_ptr<std::ofstream>& file = files[path];
+            if(file == nullptr)
+            {
+                file.reset(new std::ofstream(path));
+            }
+
+            return file->is_open() ? file.get() : &std::cerr;
+        }
+
+        int            mode_;
+        std::ostream*  trace_os_;
+        std::ostream*  bench_os_;
+        std::ostream*  profile_os_;
+        profile_format format_;
+        bool           csv_header_ = false;
+        bool           json_open_  = false;
+
+        std::mutex                                                          mutex_;
+        std::unordered_map<const void*, std::map<std::string, profile_entry>> profiles_;
+    };
+}
+
+#endif // LOGGING_HPP
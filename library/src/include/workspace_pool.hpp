@@ -0,0 +1,391 @@
+/* ************************************************************************
+* Copyright (c) 2022 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef WORKSPACE_POOL_HPP
+#define WORKSPACE_POOL_HPP
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace hipsparse
+{
+    // Allocator used by the workspace pool to obtain and return memory blocks. The
+    // library routes this to hipMalloc / hipFree, tests can plug in a mock allocator.
+    struct workspace_allocator
+    {
+        // Returns nullptr on failure
+        void* (*allocate)(size_t size, void* user_data);
+        void (*deallocate)(void* ptr, void* user_data);
+        void* user_data;
+    };
+
+    // Size-class bucketed cache of temporary buffers. Block sizes are rounded up to
+    // the next power of two (minimum 256 bytes), such that a released block can serve
+    // any later request of the same or a smaller size class. Requests are served by
+    // the smallest cached block that fits.
+    //
+    // With policy grow_only, released blocks stay cached until trim() is called or the
+    // pool is destroyed. With policy trim, released blocks are only kept as long as
+    // the total cached size does not exceed the reserved size, all other blocks are
+    // returned to the allocator immediately.
+    //
+    // A frozen pool does not call the allocator at all. Requests are only served from
+    // cached blocks and released blocks are always kept.
+    class workspace_pool
+    {
+    public:
+        enum policy
+        {
+            grow_only,
+            trim_to_reserve
+        };
+
+        static constexpr size_t min_block_size  = 256;
+        static constexpr int    num_size_classes = 48;
+
+        explicit workspace_pool(const workspace_allocator& allocator)
+            : allocator_(allocator)
+            , free_blocks_(num_size_classes)
+        {
+        }
+
+        ~workspace_pool()
+        {
+            frozen_ = false;
+            trim();
+
+            // Blocks still in use at destruction are returned as well
+            for(auto& block : in_use_)
+            {
+                allocator_.deallocate(block.first, allocator_.user_data);
+            }
+        }
+
+        workspace_pool(const workspace_pool&) = delete;
+        workspace_pool& operator=(const workspace_pool&) = delete;
+
+        // Size class index of a request, -1 if the request is too large
+        static int size_class(size_t size)
+        {
+            size_t block = min_block_size;
+            for(int c = 0; c < num_size_classes; ++c, block <<= 1)
+            {
+                if(size <= block)
+                {
+                    return c;
+                }
+            }
+
+            return -1;
+        }
+
+        static size_t class_size(int c)
+        {
+            return min_block_size << c;
+        }
+
+        // Obtain a block of at least size bytes. A request of size 0 succeeds and
+        // returns nullptr, similar to hipMalloc.
+        bool acquire(size_t size, void** ptr)
+        {
+            *ptr = nullptr;
+
+            if(size == 0)
+            {
+                return true;
+            }
+
+            int c = size_class(size);
+            if(c < 0)
+            {
+                return false;
+            }
+
+            int cached = cached_class(c);
+
+            if(cached >= 0)
+            {
+                c = cached;
+
+                *ptr = free_blocks_[c].back();
+                free_blocks_[c].pop_back();
+
+                cached_bytes_ -= class_size(c);
+            }
+            else if(frozen_)
+            {
+                return false;
+            }
+            else
+            {
+                *ptr = allocator_.allocate(class_size(c), allocator_.user_data);
+
+                if(*ptr == nullptr)
+                {
+                    // Drop the idle blocks that are not reserved and try once more
+                    shrink_to_reserve();
+                    *ptr = allocator_.allocate(class_size(c), allocator_.user_data);
+
+                    if(*ptr == nullptr)
+                    {
+                        return false;
+                    }
+                }
+
+                allocated_bytes_ += class_size(c);
+            }
+
+            in_use_[*ptr] = c;
+            in_use_bytes_ += class_size(c);
+
+            return true;
+        }
+
+        // Return a block previously obtained by acquire(). Unknown pointers are
+        // ignored, such that release(nullptr) is a no-op.
+        void release(void* ptr)
+        {
+            auto it = in_use_.find(ptr);
+            if(it == in_use_.end())
+            {
+                return;
+            }
+
+            int c = it->second;
+            in_use_.erase(it);
+            in_use_bytes_ -= class_size(c);
+
+            if(!frozen_ && policy_ == trim_to_reserve
+               && cached_bytes_ + class_size(c) > reserved_bytes_)
+            {
+                allocator_.deallocate(ptr, allocator_.user_data);
+                allocated_bytes_ -= class_size(c);
+
+                return;
+            }
+
+            free_blocks_[c].push_back(ptr);
+            cached_bytes_ += class_size(c);
+        }
+
+        // Make sure a block large enough for size bytes is cached and raise the
+        // retention limit of the trim policy to at least the size of that block.
+        bool reserve(size_t size)
+        {
+            if(frozen_)
+            {
+                return false;
+            }
+
+            if(size == 0)
+            {
+                return true;
+            }
+
+            int c = size_class(size);
+            if(c < 0)
+            {
+                return false;
+            }
+
+            // The limit covers the whole block, such that it is kept once released
+            if(class_size(c) > reserved_bytes_)
+            {
+                reserved_bytes_ = class_size(c);
+            }
+
+            // An idle block of the same or a larger class already serves the request
+            if(cached_class(c) >= 0)
+            {
+                return true;
+            }
+
+            void* ptr;
+            if(!acquire(size, &ptr))
+            {
+                return false;
+            }
+
+            // Keep the block cached, independent of the policy
+            in_use_.erase(ptr);
+            in_use_bytes_ -= class_size(c);
+            free_blocks_[c].push_back(ptr);
+            cached_bytes_ += class_size(c);
+
+            return true;
+        }
+
+        // Return all idle blocks to the allocator. Blocks in use are not affected.
+        void trim()
+        {
+            if(frozen_)
+            {
+                return;
+            }
+
+            for(int c = 0; c < num_size_classes; ++c)
+            {
+                for(void* ptr : free_blocks_[c])
+                {
+                    allocator_.deallocate(ptr, allocator_.user_data);
+                    allocated_bytes_ -= class_size(c);
+                }
+
+                free_blocks_[c].clear();
+            }
+
+            cached_bytes_ = 0;
+        }
+
+        // Return idle blocks to the allocator until the cached size does not exceed the
+        // reserved size. Going from the largest size class down, blocks are kept as long
+        // as they fit into the reserved size, such that a block cached by reserve() is
+        // not dropped in favour of smaller ones.
+        void shrink_to_reserve()
+        {
+            if(frozen_ || cached_bytes_ <= reserved_bytes_)
+            {
+                return;
+            }
+
+            size_t kept = 0;
+
+            for(int c = num_size_classes - 1; c >= 0; --c)
+            {
+                std::vector<void*>& bucket = free_blocks_[c];
+
+                size_t n = 0;
+                for(void* ptr : bucket)
+                {
+                    if(kept + class_size(c) <= reserved_bytes_)
+                    {
+                        kept += class_size(c);
+                        bucket[n++] = ptr;
+                    }
+                    else
+                    {
+                        allocator_.deallocate(ptr, allocator_.user_data);
+                        allocated_bytes_ -= class_size(c);
+                    }
+                }
+
+                bucket.resize(n);
+            }
+
+            cached_bytes_ = kept;
+        }
+
+        // Release all idle blocks and reset the reserved size
+        void release_all()
+        {
+            trim();
+            reserved_bytes_ = 0;
+        }
+
+        void set_policy(policy p)
+        {
+            policy_ = p;
+
+            if(policy_ == trim_to_reserve)
+            {
+                shrink_to_reserve();
+            }
+        }
+
+        policy get_policy() const
+        {
+            return policy_;
+        }
+
+        // Leaving the frozen state applies the policy to blocks that have been kept
+        void set_frozen(bool frozen)
+        {
+            frozen_ = frozen;
+
+            if(policy_ == trim_to_reserve)
+            {
+                shrink_to_reserve();
+            }
+        }
+
+        bool frozen() const
+        {
+            return frozen_;
+        }
+
+        // Total number of bytes currently obtained from the allocator
+        size_t allocated_bytes() const
+        {
+            return allocated_bytes_;
+        }
+
+        // Number of bytes held in idle blocks
+        size_t cached_bytes() const
+        {
+            return cached_bytes_;
+        }
+
+        // Number of bytes handed out and not yet released
+        size_t in_use_bytes() const
+        {
+            return in_use_bytes_;
+        }
+
+        // Largest reserved size, rounded up to the size of the reserved block
+        size_t reserved_bytes() const
+        {
+            return reserved_bytes_;
+        }
+
+    private:
+        // Smallest size class, starting from c, that holds an idle block, -1 if none
+        int cached_class(int c) const
+        {
+            for(; c < num_size_classes; ++c)
+            {
+                if(!free_blocks_[c].empty())
+                {
+                    return c;
+                }
+            }
+
+            return -1;
+        }
+
+        workspace_allocator allocator_;
+        policy              policy_ = grow_only;
+        bool                frozen_ = false;
+
+        std::vector<std::vector<void*>> free_blocks_;
+        std::unordered_map<void*, int>  in_use_;
+
+        size_t allocated_bytes_ = 0;
+        size_t cached_bytes_    = 0;
+        size_t in_use_bytes_    = 0;
+        size_t reserved_bytes_  = 0;
+    };
+}
+
+#endif // WORKSPACE_POOL_HPP
@@ -42,10 +42,15 @@ from fnmatch import fnmatchcase
 from xml.dom import minidom
 import multiprocessing
 import time
+import json
+import tempfile
 
 args = {}
 OS_info = {}
 
+# exit code of hipsparse-bench for a routine that the backend does not support
+BENCH_NOT_SUPPORTED = 77
+
 timeout = False
 test_proc = None
 stop = 0
@@ -67,6 +72,14 @@ def parse_args():
                         help='Installation directory where build or release folders are (optional, default: build)')
     parser.add_argument(      '--fail_test', default=False, required=False, action='store_true',
                         help='Return as if test failed (optional, default: false)')
+    parser.add_argument(      '--perf_baseline', type=str, required=False, default="perf_baseline.json",
+                        help='Baseline of the perf test sets (optional, default: perf_baseline.json)')
+    parser.add_argument(      '--perf_update', default=False, required=False, action='store_true',
+                        help='Store the measured times as baseline of the device instead of comparing (optional, default: false)')
+    parser.add_argument(      '--perf_repeat', type=int, required=False, default=5,
+                        help='Number of runs of each perf test, the fastest run is compared (optional, default: 5)')
+    parser.add_argument(      '--perf_backend', type=str, required=False, default="rocm", choices=["rocm", "cuda", "host"],
+                        help='Backend of the build, selects the perf tests it provides (optional, default: rocm)')
     # parser.add_argument('-v', '--verbose', required=False, default = False, action='store_true',
     #                     help='Verbose install (optional, default: False)')
     return parser.parse_args()
@@ -75,6 +88,14 @@ def parse_args():
 def vram_detect():
     global OS_info
     OS_info["VRAM"] = 0
+    try:
+        vram_query()
+    except OSError:
+        # no GPU tools installed, e.g. when running the perf suite on the host backend
+        print("VRAM could not be detected")
+
+def vram_query():
+    global OS_info
     if os.name == "nt":
         cmd = "hipinfo.exe"
         process = subprocess.run([cmd], stdout=subprocess.PIPE)
@@ -226,6 +247,69 @@ def run_cmd(cmd, test = False, time_limit = 0):
         status = 3
     return status
 
+def load_baseline(path):
+    if not os.path.isfile(path):
+        print(f'*** No perf baseline found at {path}')
+        return {"default_tolerance": 0.1, "tolerance": {}, "baseline_us": {}}
+    with open(path) as f:
+        return json.load(f)
+
+def run_perf(name, cmd, baseline, measured):
+    """Run a perf test --perf_repeat times, compare the fastest time against the baseline
+    of the device. Returns non-zero on failure, slowdown, an unsupported routine or a
+    missing baseline."""
+    global args
+    fd, out_path = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    cmd_args = shlex.split(cmd)
+    # benchmark executables are picked up from the test directory
+    if os.path.isfile(cmd_args[0]):
+        cmd_args[0] = os.path.join(os.curdir, cmd_args[0])
+    cmd_args += ['--format', 'json', '--output', out_path]
+    print(' '.join(cmd_args))
+    results = []
+    try:
+        for i in range(max(args.perf_repeat, 1)):
+            os.remove(out_path)
+            proc = subprocess.run(cmd_args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+            print(proc.stdout.strip())
+            if proc.returncode == BENCH_NOT_SUPPORTED:
+                # the perf set must only contain routines that every backend provides
+                print(f'***\n*** FAILED: {name} is not supported by this backend\n***')
+                return 1
+            if proc.returncode != 0:
+                print(f'***\n*** FAILED: {name} returned {proc.returncode}\n***')
+                return 1
+            with open(out_path) as f:
+                results += [json.loads(line) for line in f if line.strip()]
+    finally:
+        if os.path.isfile(out_path):
+            os.remove(out_path)
+
+    time_us = min(r['time_us'] for r in results)
+    device = results[0].get('device', 'unknown')
+    measured.setdefault(device, {})[name] = time_us
+
+    reference = baseline['baseline_us'].get(device, {}).get(name)
+    if reference is None:
+        if args.perf_update:
+            print(f'***\n*** {name}: {time_us:.2f} us, new baseline for {device}\n***')
+            return 0
+        print(f'***\n*** FAILED: {name}: {time_us:.2f} us, no baseline for {device}, '
+              f'record one with --perf_update\n***')
+        return 1
+    tolerance = baseline['tolerance'].get(name, baseline['default_tolerance'])
+    ratio = time_us / reference
+    print(f'***\n*** {name}: {time_us:.2f} us, baseline {reference:.2f} us, ratio {ratio:.3f}, tolerance {tolerance}\n***')
+    if args.perf_update:
+        return 0
+    if ratio > 1.0 + tolerance:
+        print(f'***\n*** SLOWDOWN: {name} on {device}\n***')
+        return 1
+    if ratio < 1.0 - tolerance:
+        print(f'*** {name} is faster than its baseline, consider updating it with --perf_update')
+    return 0
+
 def batch(script, xml):
     global OS_info
     global args
@@ -281,6 +365,30 @@ def batch(script, xml):
                         error = run_cmd(var_cmd, True, timeout)
                         if (error == 2):
                             print( f'***\n*** Timed out when running: {name}\n***')
+            # run the matching performance tests and compare them against the baseline
+            baseline = None
+            measured = {}
+            for perf in xml.getElementsByTagName('perf'):
+                runset = perf.getAttribute('sets').split(',')
+                if args.test in runset:
+                    if baseline is None:
+                        baseline = load_baseline(args.perf_baseline)
+                    backends = perf.getAttribute('backends')
+                    for run in perf.getElementsByTagName('run'):
+                        name = run.getAttribute('name')
+                        if backends and args.perf_backend not in backends.split(','):
+                            print( f'***\n*** Skipped: {name} is not provided by the {args.perf_backend} backend\n***')
+                            continue
+                        print( f'***\n*** Running: {name}\n***')
+                        var_cmd = run.firstChild.data.format_map(var_subs)
+                        error = run_perf(name, var_cmd, baseline, measured) or error
+            if args.perf_update and measured:
+                for device in measured:
+                    baseline['baseline_us'].setdefault(device, {}).update(measured[device])
+                with open(args.perf_baseline, 'w') as f:
+                    json.dump(baseline, f, indent=2, sort_keys=True)
+                    f.write('\n')
+                print(f'*** Updated baseline {args.perf_baseline}')
         else:
             error = run_cmd(cmd)
         fail = fail or error
@@ -325,6 +433,8 @@ def main():
 
     os_detect()
     args = parse_args()
+    # the tests change into the test directory, the baseline is relative to the caller
+    args.perf_baseline = os.path.abspath(args.perf_baseline)
 
     status = run_tests()
 